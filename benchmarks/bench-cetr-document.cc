@@ -0,0 +1,89 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <nwc-toolkit/cetr-document.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+std::string body;
+std::vector<double> histogram;
+
+void BenchmarkParse(nwc_toolkit::benchmark::State *state,
+    nwc_toolkit::CetrDocument::SmoothingMode mode) {
+  state->PauseTiming();
+  nwc_toolkit::HtmlDocument html_doc;
+  html_doc.set_attribute_handler(
+      nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
+  if (!html_doc.Parse(nwc_toolkit::String(body.data(), body.length()))) {
+    NWC_TOOLKIT_ERROR("failed to parse document");
+  }
+  nwc_toolkit::CetrDocument cetr_doc;
+  cetr_doc.set_smoothing_mode(mode);
+  state->set_bytes_per_op(body.length());
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    cetr_doc.Parse(html_doc);
+  }
+}
+
+void BenchmarkParseExact(nwc_toolkit::benchmark::State *state) {
+  BenchmarkParse(state, nwc_toolkit::CetrDocument::EXACT_SMOOTHING);
+}
+
+void BenchmarkParseFast(nwc_toolkit::benchmark::State *state) {
+  BenchmarkParse(state, nwc_toolkit::CetrDocument::FAST_SMOOTHING);
+}
+
+// A histogram of tag ratios on a long page, whose standard deviation is
+// hundreds of lines.
+void BenchmarkSmoothHistogram(nwc_toolkit::benchmark::State *state,
+    nwc_toolkit::CetrDocument::SmoothingMode mode) {
+  state->PauseTiming();
+  std::vector<double> smoothed_histogram;
+  state->set_bytes_per_op(histogram.size() * sizeof(double));
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    nwc_toolkit::CetrDocument::SmoothHistogram(histogram, mode,
+        &smoothed_histogram);
+  }
+}
+
+void BenchmarkSmoothHistogramExact(nwc_toolkit::benchmark::State *state) {
+  BenchmarkSmoothHistogram(state,
+      nwc_toolkit::CetrDocument::EXACT_SMOOTHING);
+}
+
+void BenchmarkSmoothHistogramFast(nwc_toolkit::benchmark::State *state) {
+  BenchmarkSmoothHistogram(state, nwc_toolkit::CetrDocument::FAST_SMOOTHING);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  runner.ReadDataFile("sample.html", &body);
+
+  std::srand(1);
+  histogram.resize(4096);
+  for (std::size_t i = 0; i < histogram.size(); ++i) {
+    histogram[i] = ((std::rand() % 4) == 0) ? (std::rand() % 2000) : 1.0;
+  }
+
+  runner.Run("cetr-document/Parse/exact", BenchmarkParseExact);
+  runner.Run("cetr-document/Parse/fast", BenchmarkParseFast);
+  runner.Run("cetr-document/SmoothHistogram/exact",
+      BenchmarkSmoothHistogramExact);
+  runner.Run("cetr-document/SmoothHistogram/fast",
+      BenchmarkSmoothHistogramFast);
+
+  return runner.Finish();
+}
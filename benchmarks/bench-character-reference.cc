@@ -0,0 +1,73 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <string>
+#include <tr1/random>
+
+#include <nwc-toolkit/character-reference.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+enum { TEXT_LENGTH = 1 << 16 };
+
+std::string text;
+std::string text_with_references;
+
+// Inserts a character reference every 64 bytes on average.
+void GenerateText() {
+  static const char * const REFERENCES[] = {
+    "&amp;", "&lt;", "&gt;", "&quot;", "&nbsp;", "&copy;",
+    "&#12354;", "&#x3042;", "&hellip;", "&unknown;"
+  };
+  enum { NUM_REFERENCES = sizeof(REFERENCES) / sizeof(REFERENCES[0]) };
+
+  nwc_toolkit::benchmark::GenerateJapaneseText(TEXT_LENGTH, 2, &text);
+  std::tr1::mt19937 mt_rand(TEXT_LENGTH);
+  for (std::size_t i = 0; i < text.length(); ++i) {
+    text_with_references += text[i];
+    if (((text[i] & 0xC0) != 0x80) && ((mt_rand() % 64) == 0)) {
+      text_with_references += REFERENCES[mt_rand() % NUM_REFERENCES];
+    }
+  }
+  // Decode() must not see a reference split by the boundary of a sequence.
+  text_with_references += ' ';
+}
+
+void BenchmarkDecode(nwc_toolkit::benchmark::State *state,
+    const std::string &src) {
+  state->PauseTiming();
+  nwc_toolkit::StringBuilder dest;
+  state->set_bytes_per_op(src.length());
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    dest.Clear();
+    nwc_toolkit::CharacterReference::Decode(
+        nwc_toolkit::String(src.data(), src.length()), &dest);
+  }
+}
+
+void BenchmarkDecodeWithReferences(nwc_toolkit::benchmark::State *state) {
+  BenchmarkDecode(state, text_with_references);
+}
+
+void BenchmarkDecodeWithoutReferences(nwc_toolkit::benchmark::State *state) {
+  BenchmarkDecode(state, text);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  GenerateText();
+
+  runner.Run("character-reference/Decode/references",
+      BenchmarkDecodeWithReferences);
+  runner.Run("character-reference/Decode/plain",
+      BenchmarkDecodeWithoutReferences);
+
+  return runner.Finish();
+}
@@ -0,0 +1,102 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <string>
+#include <vector>
+
+#include <nwc-toolkit/bzip2-coder.h>
+#include <nwc-toolkit/gzip-coder.h>
+#include <nwc-toolkit/xz-coder.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+enum { TEXT_LENGTH = 1 << 20 };
+
+std::string text;
+
+// Codes the whole `src' at once and returns the size of the result.
+std::size_t Code(nwc_toolkit::Coder *coder, const char *src,
+    std::size_t src_size, std::vector<char> *dest) {
+  coder->set_next_in(src);
+  coder->set_avail_in(src_size);
+  coder->set_next_out(&(*dest)[0]);
+  coder->set_avail_out(dest->size());
+  while ((coder->avail_in() != 0) && !coder->is_end()) {
+    if (!coder->Code() || (coder->avail_out() == 0)) {
+      NWC_TOOLKIT_ERROR("failed to code data");
+    }
+  }
+  while (!coder->is_end()) {
+    if (!coder->Finish() || (coder->avail_out() == 0)) {
+      NWC_TOOLKIT_ERROR("failed to finish coding data");
+    }
+  }
+  std::size_t total_out = static_cast<std::size_t>(coder->total_out());
+  if (!coder->Close()) {
+    NWC_TOOLKIT_ERROR("failed to close coder");
+  }
+  return total_out;
+}
+
+template <typename Coder>
+void BenchmarkEncode(nwc_toolkit::benchmark::State *state) {
+  state->PauseTiming();
+  Coder coder;
+  std::vector<char> dest(text.length() * 2 + (1 << 16));
+  state->set_bytes_per_op(text.length());
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    if (!coder.OpenEncoder(nwc_toolkit::Coder::DEFAULT_PRESET)) {
+      NWC_TOOLKIT_ERROR("failed to open encoder");
+    }
+    Code(&coder, text.data(), text.length(), &dest);
+  }
+}
+
+// The throughput of decoding is calculated from the decoded size.
+template <typename Coder>
+void BenchmarkDecode(nwc_toolkit::benchmark::State *state) {
+  state->PauseTiming();
+  Coder coder;
+  std::vector<char> encoded(text.length() * 2 + (1 << 16));
+  if (!coder.OpenEncoder(nwc_toolkit::Coder::DEFAULT_PRESET)) {
+    NWC_TOOLKIT_ERROR("failed to open encoder");
+  }
+  encoded.resize(Code(&coder, text.data(), text.length(), &encoded));
+  std::vector<char> decoded(text.length() + 1);
+  state->set_bytes_per_op(text.length());
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    if (!coder.OpenDecoder()) {
+      NWC_TOOLKIT_ERROR("failed to open decoder");
+    }
+    Code(&coder, &encoded[0], encoded.size(), &decoded);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  nwc_toolkit::benchmark::GenerateJapaneseText(TEXT_LENGTH, 4, &text);
+
+  runner.Run("coder/GzipCoder/encode",
+      BenchmarkEncode<nwc_toolkit::GzipCoder>);
+  runner.Run("coder/GzipCoder/decode",
+      BenchmarkDecode<nwc_toolkit::GzipCoder>);
+  runner.Run("coder/Bzip2Coder/encode",
+      BenchmarkEncode<nwc_toolkit::Bzip2Coder>);
+  runner.Run("coder/Bzip2Coder/decode",
+      BenchmarkDecode<nwc_toolkit::Bzip2Coder>);
+  runner.Run("coder/XzCoder/encode",
+      BenchmarkEncode<nwc_toolkit::XzCoder>);
+  runner.Run("coder/XzCoder/decode",
+      BenchmarkDecode<nwc_toolkit::XzCoder>);
+
+  return runner.Finish();
+}
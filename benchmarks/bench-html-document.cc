@@ -0,0 +1,72 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <string>
+
+#include <nwc-toolkit/html-document.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+std::string utf8_body;
+std::string sjis_body;
+
+void BenchmarkParse(nwc_toolkit::benchmark::State *state,
+    const std::string &body) {
+  state->PauseTiming();
+  nwc_toolkit::HtmlArchiveEntry entry;
+  entry.set_url("http://www.example.com/");
+  entry.set_status_code(200);
+  entry.set_header("Content-Type: text/html\r\n");
+  entry.set_body(nwc_toolkit::String(body.data(), body.length()));
+  nwc_toolkit::HtmlDocument document;
+  state->set_bytes_per_op(body.length());
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    if (!document.Parse(entry)) {
+      NWC_TOOLKIT_ERROR("failed to parse document");
+    }
+  }
+}
+
+void BenchmarkParseUtf8(nwc_toolkit::benchmark::State *state) {
+  BenchmarkParse(state, utf8_body);
+}
+
+void BenchmarkParseShiftJis(nwc_toolkit::benchmark::State *state) {
+  BenchmarkParse(state, sjis_body);
+}
+
+void BenchmarkExtractText(nwc_toolkit::benchmark::State *state) {
+  state->PauseTiming();
+  nwc_toolkit::HtmlDocument document;
+  if (!document.Parse(nwc_toolkit::String(
+      utf8_body.data(), utf8_body.length()))) {
+    NWC_TOOLKIT_ERROR("failed to parse document");
+  }
+  nwc_toolkit::StringBuilder text;
+  state->set_bytes_per_op(utf8_body.length());
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    text.Clear();
+    document.ExtractText(&text);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  runner.ReadDataFile("sample.html", &utf8_body);
+  runner.ReadDataFile("sample-sjis.html", &sjis_body);
+
+  runner.Run("html-document/Parse/utf-8", BenchmarkParseUtf8);
+  runner.Run("html-document/Parse/shift_jis", BenchmarkParseShiftJis);
+  runner.Run("html-document/ExtractText", BenchmarkExtractText);
+
+  return runner.Finish();
+}
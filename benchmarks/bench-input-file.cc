@@ -0,0 +1,86 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <cstdio>
+#include <string>
+
+#include <nwc-toolkit/input-file.h>
+#include <nwc-toolkit/output-file.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+const char * const PLAIN_FILE_NAME = "bench-input-file.dat";
+const char * const GZIP_FILE_NAME = "bench-input-file.dat.gz";
+
+std::size_t num_lines = 0;
+std::size_t total_length = 0;
+
+void WriteFile(const std::string &text, const char *file_name) {
+  nwc_toolkit::OutputFile file;
+  if (!file.Open(file_name) ||
+      !file.Write(nwc_toolkit::String(text.data(), text.length())) ||
+      !file.Close()) {
+    NWC_TOOLKIT_ERROR("failed to write file: %s", file_name);
+  }
+}
+
+void CreateFiles() {
+  enum { TEXT_LENGTH = 16 << 20 };
+
+  std::string text;
+  nwc_toolkit::benchmark::GenerateJapaneseText(TEXT_LENGTH, 1, &text);
+  text += '\n';
+  for (std::size_t i = 0; i < text.length(); ++i) {
+    if (text[i] == '\n') {
+      ++num_lines;
+    }
+  }
+  total_length = text.length();
+
+  WriteFile(text, PLAIN_FILE_NAME);
+  WriteFile(text, GZIP_FILE_NAME);
+}
+
+// An operation reads a line. The file is reopened when it is exhausted.
+template <bool IS_GZIP>
+void BenchmarkReadLine(nwc_toolkit::benchmark::State *state) {
+  const char *file_name = IS_GZIP ? GZIP_FILE_NAME : PLAIN_FILE_NAME;
+
+  state->PauseTiming();
+  nwc_toolkit::InputFile file;
+  if (!file.Open(file_name)) {
+    NWC_TOOLKIT_ERROR("failed to open file: %s", file_name);
+  }
+  state->set_bytes_per_op(1.0 * total_length / num_lines);
+  state->ResumeTiming();
+
+  nwc_toolkit::String line;
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    if (!file.ReadLine(&line)) {
+      state->PauseTiming();
+      if (!file.Close() || !file.Open(file_name) ||
+          !file.ReadLine(&line)) {
+        NWC_TOOLKIT_ERROR("failed to reopen file: %s", file_name);
+      }
+      state->ResumeTiming();
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  CreateFiles();
+
+  runner.Run("input-file/ReadLine/plain", BenchmarkReadLine<false>);
+  runner.Run("input-file/ReadLine/gzip", BenchmarkReadLine<true>);
+
+  std::remove(PLAIN_FILE_NAME);
+  std::remove(GZIP_FILE_NAME);
+
+  return runner.Finish();
+}
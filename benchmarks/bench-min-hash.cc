@@ -0,0 +1,44 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <string>
+
+#include <nwc-toolkit/html-document.h>
+#include <nwc-toolkit/min-hash.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+std::string body;
+
+template <std::size_t NUM_BANDS, std::size_t NUM_ROWS>
+void BenchmarkCalculate(nwc_toolkit::benchmark::State *state) {
+  state->PauseTiming();
+  nwc_toolkit::HtmlDocument document;
+  document.Parse(nwc_toolkit::String(body.data(), body.length()));
+  nwc_toolkit::StringBuilder text;
+  document.ExtractText(&text);
+  nwc_toolkit::MinHash min_hash;
+  min_hash.Reset(NUM_BANDS, NUM_ROWS);
+  min_hash.Calculate(text.str());
+  state->set_bytes_per_op(text.length());
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    min_hash.Calculate(text.str());
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  runner.ReadDataFile("sample.html", &body);
+
+  runner.Run("min-hash/Calculate/1x4", BenchmarkCalculate<1, 4>);
+  runner.Run("min-hash/Calculate/16x8", BenchmarkCalculate<16, 8>);
+
+  return runner.Finish();
+}
@@ -0,0 +1,85 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <tr1/random>
+#include <vector>
+
+#include <nwc-toolkit/multikey-sort.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+enum { NUM_KEYS = 1 << 16 };
+
+class LessThan {
+ public:
+  bool operator()(const char *lhs, const char *rhs) const {
+    return std::strcmp(lhs, rhs) < 0;
+  }
+};
+
+// Keys share prefixes as n-grams do, so that multikey quicksort has to
+// look at many characters.
+void GenerateKeys(std::vector<std::string> *keys,
+    std::size_t *total_length) {
+  static const char * const WORDS[] = {
+    "the", "of", "and", "to", "in", "a", "is", "that", "for", "it",
+    "as", "was", "with", "be", "by", "on", "not", "he", "this", "are"
+  };
+  enum { NUM_WORDS = sizeof(WORDS) / sizeof(WORDS[0]) };
+
+  std::tr1::mt19937 mt_rand(NUM_KEYS);
+  keys->resize(NUM_KEYS);
+  *total_length = 0;
+  for (std::size_t i = 0; i < keys->size(); ++i) {
+    std::size_t num_words = 1 + (mt_rand() % 5);
+    for (std::size_t j = 0; j < num_words; ++j) {
+      if (j != 0) {
+        (*keys)[i] += ' ';
+      }
+      (*keys)[i] += WORDS[mt_rand() % NUM_WORDS];
+    }
+    *total_length += (*keys)[i].length() + 1;
+  }
+}
+
+template <bool IS_MULTIKEY_SORT>
+void BenchmarkSort(nwc_toolkit::benchmark::State *state) {
+  state->PauseTiming();
+  std::vector<std::string> keys;
+  std::size_t total_length;
+  GenerateKeys(&keys, &total_length);
+  std::vector<const char *> original_ptrs(keys.size());
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    original_ptrs[i] = keys[i].c_str();
+  }
+  std::vector<const char *> ptrs(original_ptrs.size());
+  state->set_bytes_per_op(total_length);
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    std::copy(original_ptrs.begin(), original_ptrs.end(), ptrs.begin());
+    state->ResumeTiming();
+    if (IS_MULTIKEY_SORT) {
+      nwc_toolkit::MultikeySort(ptrs.begin(), ptrs.end());
+    } else {
+      std::sort(ptrs.begin(), ptrs.end(), LessThan());
+    }
+    state->PauseTiming();
+  }
+  state->ResumeTiming();
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  runner.Run("multikey-sort/MultikeySort/65536", BenchmarkSort<true>);
+  runner.Run("multikey-sort/std::sort/65536", BenchmarkSort<false>);
+
+  return runner.Finish();
+}
@@ -0,0 +1,123 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <string>
+#include <tr1/random>
+#include <vector>
+
+#include <nwc-toolkit/sha1-digest.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+enum { NUM_BODIES = 64 };
+
+std::string body;
+
+// Bodies of various lengths like those in an HTML archive.
+const std::vector<std::string> &GetBodies() {
+  static std::vector<std::string> bodies;
+  if (bodies.empty()) {
+    std::tr1::mt19937 mt_rand(NUM_BODIES);
+    bodies.resize(NUM_BODIES);
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+      std::size_t length = 1024 + (mt_rand() % (body.length() * 2));
+      for (std::size_t j = 0; j < length; ++j) {
+        bodies[i] += body[j % body.length()];
+      }
+    }
+  }
+  return bodies;
+}
+
+template <nwc_toolkit::Sha1Digest::Kernel KERNEL>
+void BenchmarkAppend(nwc_toolkit::benchmark::State *state) {
+  state->PauseTiming();
+  nwc_toolkit::Sha1Digest::set_kernel(KERNEL);
+  nwc_toolkit::String message(body.data(), body.length());
+  state->set_bytes_per_op(body.length());
+  state->ResumeTiming();
+
+  nwc_toolkit::Sha1Digest digest;
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    digest.Clear();
+    digest.Append(message);
+    digest.Finish();
+  }
+}
+
+template <nwc_toolkit::Sha1Digest::Kernel KERNEL>
+void BenchmarkCalculate(nwc_toolkit::benchmark::State *state) {
+  state->PauseTiming();
+  nwc_toolkit::Sha1Digest::set_kernel(KERNEL);
+  const std::vector<std::string> &bodies = GetBodies();
+  std::vector<nwc_toolkit::String> messages(bodies.size());
+  std::size_t total_length = 0;
+  for (std::size_t i = 0; i < bodies.size(); ++i) {
+    messages[i] = nwc_toolkit::String(bodies[i].data(), bodies[i].length());
+    total_length += bodies[i].length();
+  }
+  nwc_toolkit::Sha1Digest *digests = new nwc_toolkit::Sha1Digest[NUM_BODIES];
+  state->set_bytes_per_op(total_length);
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    nwc_toolkit::Sha1Digest::Calculate(&messages[0], messages.size(),
+        digests);
+  }
+
+  state->PauseTiming();
+  delete [] digests;
+  state->ResumeTiming();
+}
+
+struct KernelBenchmark {
+  nwc_toolkit::Sha1Digest::Kernel kernel;
+  const char *append_name;
+  nwc_toolkit::benchmark::Function append_function;
+  const char *calculate_name;
+  nwc_toolkit::benchmark::Function calculate_function;
+};
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  runner.ReadDataFile("sample.html", &body);
+
+  // Kernels which the CPU does not support are skipped.
+  static const KernelBenchmark BENCHMARKS[] = {
+    { nwc_toolkit::Sha1Digest::GENERIC_KERNEL,
+      "sha1-digest/Append/generic",
+      BenchmarkAppend<nwc_toolkit::Sha1Digest::GENERIC_KERNEL>,
+      "sha1-digest/Calculate/generic",
+      BenchmarkCalculate<nwc_toolkit::Sha1Digest::GENERIC_KERNEL> },
+    { nwc_toolkit::Sha1Digest::SHA_KERNEL,
+      "sha1-digest/Append/sha",
+      BenchmarkAppend<nwc_toolkit::Sha1Digest::SHA_KERNEL>,
+      "sha1-digest/Calculate/sha",
+      BenchmarkCalculate<nwc_toolkit::Sha1Digest::SHA_KERNEL> },
+    { nwc_toolkit::Sha1Digest::SSE2_KERNEL, NULL, NULL,
+      "sha1-digest/Calculate/sse2",
+      BenchmarkCalculate<nwc_toolkit::Sha1Digest::SSE2_KERNEL> },
+    { nwc_toolkit::Sha1Digest::AVX2_KERNEL, NULL, NULL,
+      "sha1-digest/Calculate/avx2",
+      BenchmarkCalculate<nwc_toolkit::Sha1Digest::AVX2_KERNEL> }
+  };
+  for (std::size_t i = 0; i < (sizeof(BENCHMARKS) / sizeof(BENCHMARKS[0]));
+       ++i) {
+    if (!nwc_toolkit::Sha1Digest::set_kernel(BENCHMARKS[i].kernel)) {
+      continue;
+    }
+    if (BENCHMARKS[i].append_name != NULL) {
+      runner.Run(BENCHMARKS[i].append_name, BENCHMARKS[i].append_function);
+    }
+    runner.Run(BENCHMARKS[i].calculate_name,
+        BENCHMARKS[i].calculate_function);
+  }
+  nwc_toolkit::Sha1Digest::set_kernel(nwc_toolkit::Sha1Digest::AUTO_KERNEL);
+
+  return runner.Finish();
+}
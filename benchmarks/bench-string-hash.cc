@@ -0,0 +1,74 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <string>
+#include <tr1/random>
+#include <vector>
+
+#include <nwc-toolkit/string-hash.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+enum { NUM_KEYS = 1 << 10 };
+
+// Keys are cycled so that the hash values depend on different inputs.
+template <std::size_t LENGTH>
+const std::vector<std::string> &GetKeys() {
+  static std::vector<std::string> keys;
+  if (keys.empty()) {
+    std::tr1::mt19937 mt_rand(LENGTH);
+    keys.resize(NUM_KEYS);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      for (std::size_t j = 0; j < LENGTH; ++j) {
+        keys[i] += static_cast<char>('A' + (mt_rand() % 26));
+      }
+    }
+  }
+  return keys;
+}
+
+template <typename Hash, std::size_t LENGTH>
+void BenchmarkHash(nwc_toolkit::benchmark::State *state) {
+  state->PauseTiming();
+  const std::vector<std::string> &keys = GetKeys<LENGTH>();
+  std::vector<nwc_toolkit::String> strs(keys.size());
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    strs[i] = nwc_toolkit::String(keys[i].data(), keys[i].length());
+  }
+  state->set_bytes_per_op(LENGTH);
+  state->ResumeTiming();
+
+  Hash hash;
+  unsigned long long sum = 0;
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    sum += hash(strs[i % NUM_KEYS]);
+  }
+
+  // Prevents the loop from being removed.
+  if (sum == 0) {
+    state->set_bytes_per_op(LENGTH);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  runner.Run("string-hash/StringHash/8",
+      BenchmarkHash<nwc_toolkit::StringHash, 8>);
+  runner.Run("string-hash/StringHash/64",
+      BenchmarkHash<nwc_toolkit::StringHash, 64>);
+  runner.Run("string-hash/StringHash/1024",
+      BenchmarkHash<nwc_toolkit::StringHash, 1024>);
+  runner.Run("string-hash/StringHash64/8",
+      BenchmarkHash<nwc_toolkit::StringHash64, 8>);
+  runner.Run("string-hash/StringHash64/64",
+      BenchmarkHash<nwc_toolkit::StringHash64, 64>);
+  runner.Run("string-hash/StringHash64/1024",
+      BenchmarkHash<nwc_toolkit::StringHash64, 1024>);
+
+  return runner.Finish();
+}
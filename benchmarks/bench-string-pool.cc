@@ -0,0 +1,53 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <string>
+#include <tr1/random>
+#include <vector>
+
+#include <nwc-toolkit/string-pool.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+enum { NUM_STRS = 1 << 12 };
+
+template <std::size_t LENGTH>
+void BenchmarkAppend(nwc_toolkit::benchmark::State *state) {
+  // The pool is cleared periodically to bound the memory usage.
+  enum { NUM_OPS_PER_POOL = 1 << 20 };
+
+  state->PauseTiming();
+  std::tr1::mt19937 mt_rand(LENGTH);
+  std::vector<std::string> strs(NUM_STRS);
+  for (std::size_t i = 0; i < strs.size(); ++i) {
+    for (std::size_t j = 0; j < LENGTH; ++j) {
+      strs[i] += static_cast<char>('a' + (mt_rand() % 26));
+    }
+  }
+  nwc_toolkit::StringPool pool;
+  state->set_bytes_per_op(LENGTH);
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    if ((i % NUM_OPS_PER_POOL) == (NUM_OPS_PER_POOL - 1)) {
+      state->PauseTiming();
+      pool.Clear();
+      state->ResumeTiming();
+    }
+    const std::string &str = strs[i % NUM_STRS];
+    pool.Append(str.data(), str.length());
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  runner.Run("string-pool/Append/16", BenchmarkAppend<16>);
+  runner.Run("string-pool/Append/256", BenchmarkAppend<256>);
+
+  return runner.Finish();
+}
@@ -0,0 +1,83 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <cmath>
+#include <tr1/random>
+#include <vector>
+
+#include <nwc-toolkit/token-trie.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+enum {
+  VOCABULARY_SIZE = 1 << 16,
+  SENTENCE_LENGTH = 24,
+  NUM_SENTENCES = 1 << 12
+};
+
+// Token IDs follow Zipf's law as words in natural language text.
+void GenerateSentences(std::vector<int> *tokens) {
+  std::vector<double> cumulative_freqs(VOCABULARY_SIZE);
+  double total_freq = 0.0;
+  for (std::size_t i = 0; i < cumulative_freqs.size(); ++i) {
+    total_freq += 1.0 / (i + 1);
+    cumulative_freqs[i] = total_freq;
+  }
+
+  std::tr1::mt19937 mt_rand(SENTENCE_LENGTH);
+  tokens->resize(SENTENCE_LENGTH * NUM_SENTENCES);
+  for (std::size_t i = 0; i < tokens->size(); ++i) {
+    double value = total_freq * mt_rand() / 4294967296.0;
+    std::size_t l = 0;
+    std::size_t r = cumulative_freqs.size() - 1;
+    while (l < r) {
+      std::size_t m = (l + r) / 2;
+      if (cumulative_freqs[m] < value) {
+        l = m + 1;
+      } else {
+        r = m;
+      }
+    }
+    (*tokens)[i] = static_cast<int>(l);
+  }
+}
+
+template <std::size_t MAX_DEPTH>
+void BenchmarkInsert(nwc_toolkit::benchmark::State *state) {
+  enum { MEMORY_USAGE = 64 << 20 };
+
+  state->PauseTiming();
+  std::vector<int> tokens;
+  GenerateSentences(&tokens);
+  nwc_toolkit::TokenTrie trie;
+  trie.Reset(MAX_DEPTH, MEMORY_USAGE);
+  trie.Insert(&tokens[0], 1);
+  state->set_bytes_per_op(SENTENCE_LENGTH * sizeof(int));
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    // The hash table is never resized, so it is cleared before it becomes
+    // crowded.
+    if (trie.num_nodes() > (trie.table_size() / 2)) {
+      state->PauseTiming();
+      trie.Clear();
+      trie.Insert(&tokens[0], 1);
+      state->ResumeTiming();
+    }
+    trie.Insert(&tokens[(i % NUM_SENTENCES) * SENTENCE_LENGTH],
+        SENTENCE_LENGTH);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  runner.Run("token-trie/Insert/1", BenchmarkInsert<1>);
+  runner.Run("token-trie/Insert/5", BenchmarkInsert<5>);
+
+  return runner.Finish();
+}
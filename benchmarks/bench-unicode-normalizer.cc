@@ -0,0 +1,49 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <string>
+
+#include <nwc-toolkit/unicode-normalizer.h>
+
+#include "./benchmark.h"
+
+namespace {
+
+enum { TEXT_LENGTH = 1 << 16 };
+
+std::string text;
+
+template <nwc_toolkit::UnicodeNormalizer::NormalizationForm FORM>
+void BenchmarkNormalize(nwc_toolkit::benchmark::State *state) {
+  state->PauseTiming();
+  nwc_toolkit::UnicodeNormalizer normalizer;
+  if (!normalizer.Open(FORM)) {
+    NWC_TOOLKIT_ERROR("failed to open unicode normalizer");
+  }
+  nwc_toolkit::StringBuilder dest;
+  state->set_bytes_per_op(text.length());
+  state->ResumeTiming();
+
+  for (long long i = 0; i < state->num_ops(); ++i) {
+    dest.Clear();
+    if (!normalizer.Normalize(
+        nwc_toolkit::String(text.data(), text.length()), &dest)) {
+      NWC_TOOLKIT_ERROR("failed to normalize text");
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  nwc_toolkit::benchmark::Runner runner;
+  runner.ParseOptions(argc, argv);
+
+  nwc_toolkit::benchmark::GenerateJapaneseText(TEXT_LENGTH, 3, &text);
+
+  runner.Run("unicode-normalizer/Normalize/NFC",
+      BenchmarkNormalize<nwc_toolkit::UnicodeNormalizer::NFC>);
+  runner.Run("unicode-normalizer/Normalize/NFKC",
+      BenchmarkNormalize<nwc_toolkit::UnicodeNormalizer::NFKC>);
+
+  return runner.Finish();
+}
@@ -0,0 +1,391 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include "./benchmark.h"
+
+#include <getopt.h>
+#include <time.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <tr1/random>
+
+// Dynamic exception specifications are not allowed in C++11 or later.
+#if __cplusplus >= 201103L
+#define NWC_TOOLKIT_THROW_BAD_ALLOC
+#define NWC_TOOLKIT_THROW_NOTHING noexcept
+#else  // __cplusplus >= 201103L
+#define NWC_TOOLKIT_THROW_BAD_ALLOC throw(std::bad_alloc)
+#define NWC_TOOLKIT_THROW_NOTHING throw()
+#endif  // __cplusplus >= 201103L
+
+namespace {
+
+// Benchmarks run in a single thread, so the counter is not atomic.
+long long num_allocations = 0;
+
+void *Allocate(std::size_t size) {
+  ++num_allocations;
+  void *ptr = std::malloc((size != 0) ? size : 1);
+  if (ptr == NULL) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+}  // namespace
+
+void *operator new(std::size_t size) NWC_TOOLKIT_THROW_BAD_ALLOC {
+  return Allocate(size);
+}
+
+void *operator new[](std::size_t size) NWC_TOOLKIT_THROW_BAD_ALLOC {
+  return Allocate(size);
+}
+
+void operator delete(void *ptr) NWC_TOOLKIT_THROW_NOTHING {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr) NWC_TOOLKIT_THROW_NOTHING {
+  std::free(ptr);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void *ptr, std::size_t) NWC_TOOLKIT_THROW_NOTHING {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) NWC_TOOLKIT_THROW_NOTHING {
+  std::free(ptr);
+}
+#endif  // __cpp_sized_deallocation
+
+namespace nwc_toolkit {
+namespace benchmark {
+namespace {
+
+enum { DEFAULT_NUM_REPEATS = 3 };
+
+const double DEFAULT_MIN_TIME = 0.2;
+
+void AppendUtf8(int code_point, std::string *text) {
+  if (code_point < 0x80) {
+    *text += static_cast<char>(code_point);
+  } else if (code_point < 0x800) {
+    *text += static_cast<char>(0xC0 | (code_point >> 6));
+    *text += static_cast<char>(0x80 | (code_point & 0x3F));
+  } else {
+    *text += static_cast<char>(0xE0 | (code_point >> 12));
+    *text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    *text += static_cast<char>(0x80 | (code_point & 0x3F));
+  }
+}
+
+}  // namespace
+
+State::State(long long num_ops)
+    : num_ops_(num_ops),
+      bytes_per_op_(0.0),
+      seconds_(0.0),
+      num_allocations_(0),
+      start_time_(0.0),
+      start_num_allocations_(0),
+      is_timing_(false) {}
+
+void State::PauseTiming() {
+  if (is_timing_) {
+    seconds_ += GetTime() - start_time_;
+    num_allocations_ += ::num_allocations - start_num_allocations_;
+    is_timing_ = false;
+  }
+}
+
+void State::ResumeTiming() {
+  if (!is_timing_) {
+    is_timing_ = true;
+    start_num_allocations_ = ::num_allocations;
+    start_time_ = GetTime();
+  }
+}
+
+Runner::Runner()
+    : baseline_file_name_(),
+      save_file_name_(),
+      filter_(),
+      data_dir_("."),
+      min_time_(DEFAULT_MIN_TIME),
+      num_repeats_(DEFAULT_NUM_REPEATS),
+      threshold_(0.0),
+      baseline_(),
+      num_regressions_(0),
+      is_header_printed_(false) {}
+
+void Runner::ParseOptions(int argc, char *argv[]) {
+  static const struct option long_options[] = {
+    { "baseline", 1, NULL, 'b' },
+    { "save", 1, NULL, 's' },
+    { "filter", 1, NULL, 'f' },
+    { "data", 1, NULL, 'd' },
+    { "time", 1, NULL, 't' },
+    { "repeats", 1, NULL, 'r' },
+    { "threshold", 1, NULL, 'p' },
+    { "help", 0, NULL, 'h' },
+    { NULL, 0, NULL, '\0' }
+  };
+
+  int value;
+  while ((value = ::getopt_long(argc, argv,
+      "b:s:f:d:t:r:p:h", long_options, NULL)) != -1) {
+    switch (value) {
+      case 'b': {
+        baseline_file_name_ = optarg;
+        break;
+      }
+      case 's': {
+        save_file_name_ = optarg;
+        break;
+      }
+      case 'f': {
+        filter_ = optarg;
+        break;
+      }
+      case 'd': {
+        data_dir_ = optarg;
+        break;
+      }
+      case 't': {
+        char *end_of_value;
+        min_time_ = std::strtod(optarg, &end_of_value);
+        if ((*end_of_value != '\0') || !(min_time_ > 0.0)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
+      case 'r': {
+        char *end_of_value;
+        long long value = std::strtoll(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value <= 0) || (value > 100)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        num_repeats_ = static_cast<int>(value);
+        break;
+      }
+      case 'p': {
+        char *end_of_value;
+        threshold_ = std::strtod(optarg, &end_of_value);
+        if ((*end_of_value != '\0') || !(threshold_ >= 0.0)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
+      case 'h': {
+        PrintHelp(argv[0]);
+        std::exit(0);
+      }
+      default: {
+        NWC_TOOLKIT_ERROR("invalid option");
+      }
+    }
+  }
+  if (optind != argc) {
+    NWC_TOOLKIT_ERROR("too many arguments: %s", argv[optind]);
+  }
+
+  if (!baseline_file_name_.empty()) {
+    ReadBaseline();
+  }
+}
+
+void Runner::ReadDataFile(const char *file_name, std::string *data) const {
+  std::string path = data_dir_ + '/' + file_name;
+  std::ifstream file(path.c_str(), std::ios::binary);
+  if (!file) {
+    NWC_TOOLKIT_ERROR("failed to open data file: %s", path.c_str());
+  }
+  std::ostringstream stream;
+  stream << file.rdbuf();
+  *data = stream.str();
+}
+
+void Runner::Run(const char *name, Function function) {
+  if (std::string(name).find(filter_) == std::string::npos) {
+    return;
+  }
+
+  // The number of operations is increased until a run takes the minimum
+  // time. The prediction is limited to 100 times for safety.
+  long long num_ops = 1;
+  for ( ; ; ) {
+    State state(num_ops);
+    state.ResumeTiming();
+    function(&state);
+    state.PauseTiming();
+    if (state.seconds() >= min_time_) {
+      break;
+    }
+    double scale = (state.seconds() > 0.0) ?
+        (1.5 * min_time_ / state.seconds()) : 100.0;
+    scale = (scale < 2.0) ? 2.0 : ((scale > 100.0) ? 100.0 : scale);
+    num_ops = static_cast<long long>(num_ops * scale);
+  }
+
+  double best_ns_per_op = 0.0;
+  double bytes_per_op = 0.0;
+  double allocs_per_op = 0.0;
+  for (int i = 0; i < num_repeats_; ++i) {
+    State state(num_ops);
+    state.ResumeTiming();
+    function(&state);
+    state.PauseTiming();
+    double ns_per_op = state.seconds() * 1000000000.0 / num_ops;
+    if ((i == 0) || (ns_per_op < best_ns_per_op)) {
+      best_ns_per_op = ns_per_op;
+    }
+    bytes_per_op = state.bytes_per_op();
+    allocs_per_op = 1.0 * state.num_allocations() / num_ops;
+  }
+
+  double mb_per_sec = (best_ns_per_op > 0.0) ?
+      (bytes_per_op * 1000.0 / best_ns_per_op) : 0.0;
+  PrintResult(name, best_ns_per_op, mb_per_sec, allocs_per_op);
+}
+
+int Runner::Finish() {
+  if (num_regressions_ != 0) {
+    std::cerr << num_regressions_ << " benchmark(s) slower than the baseline"
+        " by more than " << threshold_ << '%' << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+void Runner::ReadBaseline() {
+  std::ifstream file(baseline_file_name_.c_str());
+  if (!file) {
+    NWC_TOOLKIT_ERROR("failed to open baseline file: %s",
+        baseline_file_name_.c_str());
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || (line[0] == '#')) {
+      continue;
+    }
+    std::istringstream stream(line);
+    std::string name;
+    double ns_per_op;
+    if (!(stream >> name >> ns_per_op)) {
+      NWC_TOOLKIT_ERROR("invalid baseline: %s", line.c_str());
+    }
+    baseline_[name] = ns_per_op;
+  }
+}
+
+void Runner::PrintHelp(const char *command) const {
+  std::cerr << "Usage: " << command << " [OPTION]...\n\n"
+      "Options:\n"
+      "  -b, --baseline=[FILE]  compare results with FILE\n"
+      "  -s, --save=[FILE]      append results to FILE\n"
+      "  -f, --filter=[S]       run benchmarks whose names contain S\n"
+      "  -d, --data=[DIR]       read data files in DIR (default: .)\n"
+      "  -t, --time=[N]         "
+      "run each benchmark for at least N seconds (default: "
+      << DEFAULT_MIN_TIME << ")\n"
+      "  -r, --repeats=[N]      report the best of N runs (default: "
+      << DEFAULT_NUM_REPEATS << ")\n"
+      "  -p, --threshold=[N]    "
+      "fail if ns/op is N% larger than the baseline\n"
+      "                         (default: 0, never fail)\n"
+      "  -h, --help             print this help\n"
+      << std::flush;
+}
+
+void Runner::PrintResult(const char *name, double ns_per_op,
+    double mb_per_sec, double allocs_per_op) {
+  if (!is_header_printed_) {
+    std::printf("%-40s %12s %10s %10s %10s\n",
+        "benchmark", "ns/op", "MB/s", "allocs/op", "baseline");
+    is_header_printed_ = true;
+  }
+
+  std::printf("%-40s %12.2f %10.2f %10.2f", name, ns_per_op, mb_per_sec,
+      allocs_per_op);
+  Baseline::const_iterator it = baseline_.find(name);
+  if ((it != baseline_.end()) && (it->second > 0.0)) {
+    double change = 100.0 * (ns_per_op - it->second) / it->second;
+    bool is_regression = (threshold_ > 0.0) && (change > threshold_);
+    std::printf(" %+9.1f%%%s", change, is_regression ? " slower" : "");
+    if (is_regression) {
+      ++num_regressions_;
+    }
+  } else if (!baseline_file_name_.empty()) {
+    std::printf(" %10s", "-");
+  }
+  std::printf("\n");
+  std::fflush(stdout);
+
+  if (!save_file_name_.empty()) {
+    std::FILE *file = std::fopen(save_file_name_.c_str(), "a");
+    if (file == NULL) {
+      NWC_TOOLKIT_ERROR("failed to open file: %s", save_file_name_.c_str());
+    }
+    std::fprintf(file, "%s %.2f %.2f %.2f\n",
+        name, ns_per_op, mb_per_sec, allocs_per_op);
+    std::fclose(file);
+  }
+}
+
+void GenerateJapaneseText(std::size_t length, unsigned int seed,
+    std::string *text) {
+  static const int PUNCTUATIONS[] = {
+    0x3001, 0x3002, 0x300C, 0x300D, 0xFF01, 0xFF1F
+  };
+  enum { NUM_PUNCTUATIONS = sizeof(PUNCTUATIONS) / sizeof(PUNCTUATIONS[0]) };
+
+  std::tr1::mt19937 mt_rand(seed);
+  text->clear();
+  while (text->length() < length) {
+    std::size_t run_length = 1 + (mt_rand() % 6);
+    unsigned int type = mt_rand() % 100;
+    for (std::size_t i = 0; i < run_length; ++i) {
+      if (type < 40) {
+        // Hiragana.
+        AppendUtf8(0x3041 + (mt_rand() % 83), text);
+      } else if (type < 65) {
+        // Kanji in the most frequent block.
+        AppendUtf8(0x4E00 + (mt_rand() % 2048), text);
+      } else if (type < 80) {
+        // Katakana.
+        AppendUtf8(0x30A1 + (mt_rand() % 86), text);
+      } else if (type < 88) {
+        *text += static_cast<char>('a' + (mt_rand() % 26));
+      } else if (type < 92) {
+        *text += static_cast<char>('0' + (mt_rand() % 10));
+      } else if (type < 95) {
+        // Fullwidth alphabets.
+        AppendUtf8(0xFF21 + (mt_rand() % 26), text);
+      } else {
+        // Halfwidth katakana.
+        AppendUtf8(0xFF66 + (mt_rand() % 56), text);
+      }
+    }
+    if ((mt_rand() % 8) == 0) {
+      AppendUtf8(PUNCTUATIONS[mt_rand() % NUM_PUNCTUATIONS], text);
+    }
+    if ((mt_rand() % 64) == 0) {
+      *text += '\n';
+    }
+  }
+}
+
+double GetTime() {
+  struct timespec ts;
+  ::clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + (ts.tv_nsec * 0.000000001);
+}
+
+}  // namespace benchmark
+}  // namespace nwc_toolkit
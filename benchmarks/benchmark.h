@@ -0,0 +1,137 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#ifndef NWC_TOOLKIT_BENCHMARKS_BENCHMARK_H_
+#define NWC_TOOLKIT_BENCHMARKS_BENCHMARK_H_
+
+#include <errno.h>
+#include <error.h>
+
+#include <map>
+#include <string>
+
+#ifndef NWC_TOOLKIT_ERROR
+#define NWC_TOOLKIT_ERROR(fmt, ...) \
+  error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
+#endif  // NWC_TOOLKIT_ERROR
+
+namespace nwc_toolkit {
+namespace benchmark {
+
+// State is given to a benchmark function, which must run its operation
+// num_ops() times. Preparation which should not be measured, such as
+// copying input or reopening a file, is excluded by PauseTiming() and
+// ResumeTiming(). The number of allocations by operator new is counted
+// only while timing.
+class State {
+ public:
+  explicit State(long long num_ops);
+  ~State() {}
+
+  long long num_ops() const {
+    return num_ops_;
+  }
+  double bytes_per_op() const {
+    return bytes_per_op_;
+  }
+  double seconds() const {
+    return seconds_;
+  }
+  long long num_allocations() const {
+    return num_allocations_;
+  }
+
+  // Sets the number of bytes processed by an operation, which is used to
+  // calculate the throughput in MB/s.
+  void set_bytes_per_op(double value) {
+    bytes_per_op_ = value;
+  }
+
+  void PauseTiming();
+  void ResumeTiming();
+
+ private:
+  friend class Runner;
+
+  long long num_ops_;
+  double bytes_per_op_;
+  double seconds_;
+  long long num_allocations_;
+  double start_time_;
+  long long start_num_allocations_;
+  bool is_timing_;
+
+  // Disallows copy and assignment.
+  State(const State &);
+  State &operator=(const State &);
+};
+
+typedef void (*Function)(State *state);
+
+// Runner runs benchmark functions and prints ns/op, MB/s and allocations
+// per operation. The number of operations is increased until a run takes
+// at least the minimum time, and the best of repeated runs is reported
+// because it is the least affected by other processes.
+//
+// If a baseline file is given, the change of ns/op from the baseline is
+// also printed, and Finish() returns 1 if a benchmark is slower than the
+// baseline by more than the threshold. Results can be appended to a file
+// in the same format as a baseline file:
+//
+//  # name ns/op MB/s allocs/op
+//  string-hash/StringHash/16 9.87 1621.07 0
+class Runner {
+ public:
+  Runner();
+  ~Runner() {}
+
+  const std::string &data_dir() const {
+    return data_dir_;
+  }
+
+  void ParseOptions(int argc, char *argv[]);
+
+  // Reads a file in the data directory.
+  void ReadDataFile(const char *file_name, std::string *data) const;
+
+  void Run(const char *name, Function function);
+
+  // Returns the exit status.
+  int Finish();
+
+ private:
+  typedef std::map<std::string, double> Baseline;
+
+  std::string baseline_file_name_;
+  std::string save_file_name_;
+  std::string filter_;
+  std::string data_dir_;
+  double min_time_;
+  int num_repeats_;
+  double threshold_;
+  Baseline baseline_;
+  int num_regressions_;
+  bool is_header_printed_;
+
+  void ReadBaseline();
+  void PrintHelp(const char *command) const;
+  void PrintResult(const char *name, double ns_per_op, double mb_per_sec,
+      double allocs_per_op);
+
+  // Disallows copy and assignment.
+  Runner(const Runner &);
+  Runner &operator=(const Runner &);
+};
+
+// Generates Japanese text which consists of hiragana, katakana, kanji,
+// ASCII, fullwidth and halfwidth characters, and punctuation. The same
+// text is generated for the same `seed'.
+void GenerateJapaneseText(std::size_t length, unsigned int seed,
+    std::string *text);
+
+// Returns the current time in seconds.
+double GetTime();
+
+}  // namespace benchmark
+}  // namespace nwc_toolkit
+
+#endif  // NWC_TOOLKIT_BENCHMARKS_BENCHMARK_H_
@@ -0,0 +1,635 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <errno.h>
+#include <error.h>
+#include <getopt.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <tr1/random>
+#include <vector>
+
+#include <nwc-toolkit/character-encoding.h>
+#include <nwc-toolkit/html-archive-entry.h>
+#include <nwc-toolkit/output-file.h>
+
+#define NWC_TOOLKIT_ERROR(fmt, ...) \
+  error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
+
+namespace {
+
+enum {
+  DEFAULT_NUM_ENTRIES = 1000,
+  DEFAULT_VOCABULARY_SIZE = 20000,
+  DEFAULT_PATHOLOGICAL_RATE = 5,
+  DEFAULT_SEED = 1
+};
+
+const double DEFAULT_ZIPF_EXPONENT = 1.0;
+
+// Common kanji, all of which are available in CP932 and EUC-JP.
+const char KANJI[] =
+    "日本人国年大十二一中出三見月子分生上行手自時方学地会事者東社前気後"
+    "今新化理長間実作業物力内合部市場立代明高動通意外家定問題要話文開発"
+    "経用最話金電道法主全情報教員政関連結果性的北西南都県区町村駅店品"
+    "番号数量変通信映画音楽写真記事活計画設計製造販売商売価値費料利益"
+    "技術研究調査資料説明確認管理運営営業務所属組織制度改正規則条件状"
+    "態環境自然空海山川野島森林田畑花草木鳥魚犬猫食飲料理味色形大小"
+    "長短高低多少新古強弱早遅明暗軽重広狭深浅近遠朝昼夜春夏秋冬雨雪"
+    "風雲天気温度熱冷暑寒週曜日時分秒今昨明毎回度初最終始末続休";
+
+enum PageType {
+  NORMAL_PAGE,
+  HUGE_PAGE,
+  DEEP_NESTING_PAGE,
+  UNCLOSED_PAGE,
+  BINARY_PAGE,
+  WRONG_CHARSET_PAGE,
+  ERROR_STATUS_PAGE,
+  ENTITY_STORM_PAGE,
+  LONG_LINE_PAGE,
+  NUM_PAGE_TYPES
+};
+
+const char * const PAGE_TYPE_NAMES[] = {
+  "normal", "huge", "deep-nesting", "unclosed", "binary",
+  "wrong-charset", "error-status", "entity-storm", "long-line"
+};
+
+enum Encoding {
+  UTF8_ENCODING,
+  CP932_ENCODING,
+  EUC_JP_ENCODING,
+  NUM_ENCODINGS
+};
+
+const char * const ENCODING_CODES[] = { "UTF-8", "CP932", "EUC-JP" };
+const char * const ENCODING_LABELS[] = { "UTF-8", "Shift_JIS", "EUC-JP" };
+
+long long num_entries = DEFAULT_NUM_ENTRIES;
+long long vocabulary_size = DEFAULT_VOCABULARY_SIZE;
+double zipf_exponent = DEFAULT_ZIPF_EXPONENT;
+long long pathological_rate = DEFAULT_PATHOLOGICAL_RATE;
+unsigned long seed = DEFAULT_SEED;
+nwc_toolkit::String output_file_name;
+bool is_help_mode = false;
+
+long long ParseInteger(const char *str, long long min_value,
+    long long max_value) {
+  char *end_of_value;
+  long long value = std::strtoll(str, &end_of_value, 10);
+  if ((*end_of_value != '\0') || (value < min_value) || (value > max_value)) {
+    NWC_TOOLKIT_ERROR("invalid argument: %s", str);
+  }
+  return value;
+}
+
+void ParseOptions(int argc, char *argv[]) {
+  static const struct option long_options[] = {
+    { "entries", 1, NULL, 'n' },
+    { "vocabulary", 1, NULL, 'v' },
+    { "zipf", 1, NULL, 'z' },
+    { "pathological", 1, NULL, 'x' },
+    { "seed", 1, NULL, 's' },
+    { "output", 1, NULL, 'o' },
+    { "help", 0, NULL, 'h' },
+    { NULL, 0, NULL, '\0' }
+  };
+
+  int value;
+  while ((value = ::getopt_long(argc, argv, "n:v:z:x:s:o:h",
+      long_options, NULL)) != -1) {
+    switch (value) {
+      case 'n': {
+        num_entries = ParseInteger(optarg, 0, 1LL << 40);
+        break;
+      }
+      case 'v': {
+        vocabulary_size = ParseInteger(optarg, 1, 1 << 24);
+        break;
+      }
+      case 'z': {
+        char *end_of_value;
+        zipf_exponent = std::strtod(optarg, &end_of_value);
+        if ((*end_of_value != '\0') || !(zipf_exponent >= 0.0)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
+      case 'x': {
+        pathological_rate = ParseInteger(optarg, 0, 100);
+        break;
+      }
+      case 's': {
+        seed = static_cast<unsigned long>(
+            ParseInteger(optarg, 0, 0xFFFFFFFFLL));
+        break;
+      }
+      case 'o': {
+        output_file_name = optarg;
+        break;
+      }
+      case 'h': {
+        is_help_mode = true;
+        break;
+      }
+      default: {
+        NWC_TOOLKIT_ERROR("invalid option");
+      }
+    }
+  }
+}
+
+void PrintHelp(const char *command) {
+  std::cerr << "Usage: " << command << " [OPTION]...\n\n"
+      "Generates a synthetic HTML archive of Japanese pages.\n\n"
+      "Options:\n"
+      "  -n, --entries=[N]       generate N entries (default: "
+      << DEFAULT_NUM_ENTRIES << ")\n"
+      "  -v, --vocabulary=[N]    use N distinct words (default: "
+      << DEFAULT_VOCABULARY_SIZE << ")\n"
+      "  -z, --zipf=[S]          draw words from a Zipf distribution\n"
+      "                          with exponent S (default: "
+      << DEFAULT_ZIPF_EXPONENT << ")\n"
+      "  -x, --pathological=[N]  make N% of entries pathological (default: "
+      << DEFAULT_PATHOLOGICAL_RATE << ")\n"
+      "  -s, --seed=[N]          set the seed of random numbers (default: "
+      << DEFAULT_SEED << ")\n"
+      "  -o, --output=[FILE]     write result to FILE (default: stdout)\n"
+      "  -h, --help              print this help\n"
+      << std::flush;
+}
+
+void AppendUtf8(int code_point, std::string *str) {
+  if (code_point < 0x80) {
+    *str += static_cast<char>(code_point);
+  } else if (code_point < 0x800) {
+    *str += static_cast<char>(0xC0 | (code_point >> 6));
+    *str += static_cast<char>(0x80 | (code_point & 0x3F));
+  } else {
+    *str += static_cast<char>(0xE0 | (code_point >> 12));
+    *str += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    *str += static_cast<char>(0x80 | (code_point & 0x3F));
+  }
+}
+
+// Random wraps a Mersenne Twister for drawing integers and probabilities.
+class Random {
+ public:
+  explicit Random(unsigned long seed) : mt_rand_(seed) {}
+
+  // Returns an integer in [0, n).
+  std::size_t Next(std::size_t n) {
+    return static_cast<std::size_t>(mt_rand_()) % n;
+  }
+  // Returns an integer in [min_value, max_value].
+  std::size_t Next(std::size_t min_value, std::size_t max_value) {
+    return min_value + Next(max_value - min_value + 1);
+  }
+  // Returns a real number in [0, 1).
+  double NextReal() {
+    return mt_rand_() / 4294967296.0;
+  }
+  bool NextBool(double probability) {
+    return NextReal() < probability;
+  }
+
+ private:
+  std::tr1::mt19937 mt_rand_;
+
+  // Disallows copy and assignment.
+  Random(const Random &);
+  Random &operator=(const Random &);
+};
+
+// Vocabulary consists of random words of kanji, hiragana, katakana and
+// alphanumerics. The frequency of the i-th word is proportional to
+// 1 / (i + 1)^s, which resembles the distribution of words in real text.
+class Vocabulary {
+ public:
+  Vocabulary() : words_(), cumulative_probs_(), kanji_() {}
+
+  void Build(std::size_t size, double exponent, Random *random);
+
+  const std::string &Sample(Random *random) const {
+    std::vector<double>::const_iterator it = std::upper_bound(
+        cumulative_probs_.begin(), cumulative_probs_.end(),
+        random->NextReal());
+    std::size_t index = it - cumulative_probs_.begin();
+    return words_[std::min(index, words_.size() - 1)];
+  }
+
+ private:
+  std::vector<std::string> words_;
+  std::vector<double> cumulative_probs_;
+  std::vector<std::string> kanji_;
+
+  void GenerateWord(Random *random, std::string *word) const;
+
+  // Disallows copy and assignment.
+  Vocabulary(const Vocabulary &);
+  Vocabulary &operator=(const Vocabulary &);
+};
+
+void Vocabulary::Build(std::size_t size, double exponent, Random *random) {
+  kanji_.clear();
+  for (const char *p = KANJI; *p != '\0'; p += 3) {
+    kanji_.push_back(std::string(p, 3));
+  }
+
+  words_.resize(size);
+  cumulative_probs_.resize(size);
+  double total = 0.0;
+  for (std::size_t i = 0; i < size; ++i) {
+    GenerateWord(random, &words_[i]);
+    total += 1.0 / std::pow(static_cast<double>(i + 1), exponent);
+    cumulative_probs_[i] = total;
+  }
+  for (std::size_t i = 0; i < size; ++i) {
+    cumulative_probs_[i] /= total;
+  }
+}
+
+void Vocabulary::GenerateWord(Random *random, std::string *word) const {
+  word->clear();
+  std::size_t type = random->Next(100);
+  if (type < 35) {
+    std::size_t length = random->Next(1, 3);
+    for (std::size_t i = 0; i < length; ++i) {
+      *word += kanji_[random->Next(kanji_.size())];
+    }
+  } else if (type < 70) {
+    std::size_t length = random->Next(1, 4);
+    for (std::size_t i = 0; i < length; ++i) {
+      AppendUtf8(0x3041 + static_cast<int>(random->Next(83)), word);
+    }
+  } else if (type < 88) {
+    std::size_t length = random->Next(2, 6);
+    for (std::size_t i = 0; i < length; ++i) {
+      AppendUtf8(0x30A1 + static_cast<int>(random->Next(83)), word);
+    }
+    if (random->NextBool(0.3)) {
+      AppendUtf8(0x30FC, word);
+    }
+  } else if (type < 96) {
+    std::size_t length = random->Next(2, 8);
+    for (std::size_t i = 0; i < length; ++i) {
+      *word += static_cast<char>('a' + random->Next(26));
+    }
+  } else {
+    std::size_t length = random->Next(1, 4);
+    for (std::size_t i = 0; i < length; ++i) {
+      *word += static_cast<char>('0' + random->Next(10));
+    }
+  }
+}
+
+// PageGenerator builds pages in UTF-8 and converts them to the encoding of
+// each entry. Counts of page types and encodings are kept for the report.
+class PageGenerator {
+ public:
+  PageGenerator(const Vocabulary &vocabulary, Random *random)
+      : vocabulary_(vocabulary), random_(random), html_(), body_(),
+        page_type_counts_(NUM_PAGE_TYPES, 0),
+        encoding_counts_(NUM_ENCODINGS, 0) {}
+
+  void Generate(long long id, nwc_toolkit::HtmlArchiveEntry *entry);
+
+  long long page_type_count(int type) const {
+    return page_type_counts_[type];
+  }
+  long long encoding_count(int encoding) const {
+    return encoding_counts_[encoding];
+  }
+
+ private:
+  const Vocabulary &vocabulary_;
+  Random *random_;
+  std::string html_;
+  nwc_toolkit::StringBuilder body_;
+  std::vector<long long> page_type_counts_;
+  std::vector<long long> encoding_counts_;
+
+  PageType ChoosePageType();
+
+  void AppendSentence(std::string *str);
+  void AppendParagraph(std::string *str);
+  void AppendPage(const char *charset, std::string *str);
+  void AppendPathologicalBody(PageType type, std::string *str);
+
+  void Encode(Encoding encoding, const std::string &src);
+
+  // Disallows copy and assignment.
+  PageGenerator(const PageGenerator &);
+  PageGenerator &operator=(const PageGenerator &);
+};
+
+void PageGenerator::Generate(long long id,
+    nwc_toolkit::HtmlArchiveEntry *entry) {
+  char url[128];
+  std::sprintf(url, "http://www%lld.example.jp/%u/%lld.html",
+      id % 997, static_cast<unsigned>(random_->Next(100)), id);
+  entry->set_url(url);
+  entry->set_status_code(200);
+
+  PageType type = ChoosePageType();
+  ++page_type_counts_[type];
+
+  std::size_t value = random_->Next(10);
+  Encoding encoding = (value < 5) ? UTF8_ENCODING :
+      ((value < 8) ? CP932_ENCODING : EUC_JP_ENCODING);
+
+  // The charset is declared in the response header, in a meta element, or
+  // nowhere, in which case it must be detected from the body.
+  std::size_t declaration = random_->Next(5);
+  const char *meta_charset = (declaration >= 2 && declaration < 4) ?
+      ENCODING_LABELS[encoding] : NULL;
+  std::string header = "Content-Type: text/html";
+  if (declaration < 2) {
+    header += "; charset=";
+    header += ENCODING_LABELS[encoding];
+  }
+  header += "\n";
+
+  html_.clear();
+  switch (type) {
+    case NORMAL_PAGE: {
+      AppendPage(meta_charset, &html_);
+      break;
+    }
+    case WRONG_CHARSET_PAGE: {
+      // The body is not encoded in the declared charset.
+      encoding = CP932_ENCODING;
+      header = "Content-Type: text/html; charset=UTF-8\n";
+      AppendPage("UTF-8", &html_);
+      break;
+    }
+    case ERROR_STATUS_PAGE: {
+      static const int STATUS_CODES[] = { 301, 302, 403, 404, 500, 503 };
+      entry->set_status_code(STATUS_CODES[random_->Next(6)]);
+      html_ = "<html><head><title>Error</title></head>"
+          "<body><h1>Not Found</h1></body></html>\n";
+      break;
+    }
+    default: {
+      AppendPathologicalBody(type, &html_);
+      break;
+    }
+  }
+  ++encoding_counts_[encoding];
+  entry->set_header(nwc_toolkit::String(header.data(), header.length()));
+
+  if (type == BINARY_PAGE) {
+    entry->set_body(nwc_toolkit::String(html_.data(), html_.length()));
+  } else {
+    Encode(encoding, html_);
+    entry->set_body(body_.str());
+  }
+}
+
+PageType PageGenerator::ChoosePageType() {
+  if (random_->Next(100) >= static_cast<std::size_t>(pathological_rate)) {
+    return NORMAL_PAGE;
+  }
+  return static_cast<PageType>(1 + random_->Next(NUM_PAGE_TYPES - 1));
+}
+
+void PageGenerator::AppendSentence(std::string *str) {
+  static const char * const ENDINGS[] = { "。", "。", "。", "！", "？" };
+
+  std::size_t num_words = random_->Next(4, 24);
+  for (std::size_t i = 0; i < num_words; ++i) {
+    *str += vocabulary_.Sample(random_);
+    if (random_->NextBool(0.05)) {
+      *str += "、";
+    }
+  }
+  *str += ENDINGS[random_->Next(5)];
+}
+
+void PageGenerator::AppendParagraph(std::string *str) {
+  static const char * const ENTITIES[] = {
+    "&amp;", "&quot;", "&lt;", "&gt;", "&nbsp;", "&#x3042;", "&#12354;"
+  };
+
+  *str += "<p>";
+  std::size_t num_sentences = random_->Next(1, 6);
+  for (std::size_t i = 0; i < num_sentences; ++i) {
+    std::size_t decoration = random_->Next(20);
+    if (decoration == 0) {
+      *str += "<a href=\"/link.html\">";
+      AppendSentence(str);
+      *str += "</a>";
+    } else if (decoration == 1) {
+      *str += "<strong>";
+      AppendSentence(str);
+      *str += "</strong>";
+    } else {
+      AppendSentence(str);
+    }
+    if (random_->NextBool(0.1)) {
+      *str += ENTITIES[random_->Next(7)];
+    }
+    if (random_->NextBool(0.2)) {
+      *str += "<br>\n";
+    }
+  }
+  *str += "</p>\n";
+}
+
+void PageGenerator::AppendPage(const char *charset, std::string *str) {
+  *str += "<!DOCTYPE HTML PUBLIC \"-//W3C//DTD HTML 4.01 Transitional//EN\">\n"
+      "<html lang=\"ja\">\n<head>\n";
+  if (charset != NULL) {
+    *str += "<meta http-equiv=\"Content-Type\" content=\"text/html; charset=";
+    *str += charset;
+    *str += "\">\n";
+  }
+  *str += "<title>";
+  AppendSentence(str);
+  *str += "</title>\n"
+      "<style type=\"text/css\">\n"
+      "body { margin: 0; font-family: sans-serif; }\n"
+      "#content p { line-height: 1.6; }\n"
+      "</style>\n"
+      "<script type=\"text/javascript\">\n"
+      "var pageTracker = { id: \"UA-000000-1\", load: function () {"
+      " return document.getElementsByTagName(\"p\").length < 10; } };\n"
+      "</script>\n"
+      "</head>\n<body>\n<div id=\"header\">\n<h1>";
+  *str += vocabulary_.Sample(random_);
+  *str += vocabulary_.Sample(random_);
+  *str += "</h1>\n<ul class=\"menu\">\n";
+  std::size_t num_links = random_->Next(3, 10);
+  for (std::size_t i = 0; i < num_links; ++i) {
+    *str += "<li><a href=\"/category/";
+    str->append(1, static_cast<char>('a' + i));
+    *str += "/\">";
+    *str += vocabulary_.Sample(random_);
+    *str += "</a></li>\n";
+  }
+  *str += "</ul>\n</div>\n<div id=\"content\">\n";
+
+  std::size_t num_paragraphs = random_->Next(2, 30);
+  for (std::size_t i = 0; i < num_paragraphs; ++i) {
+    if (random_->NextBool(0.1)) {
+      *str += "<h2>";
+      *str += vocabulary_.Sample(random_);
+      *str += "</h2>\n";
+    }
+    if (random_->NextBool(0.05)) {
+      *str += "<table>\n";
+      std::size_t num_rows = random_->Next(2, 8);
+      for (std::size_t j = 0; j < num_rows; ++j) {
+        *str += "<tr><th>";
+        *str += vocabulary_.Sample(random_);
+        *str += "</th><td>";
+        *str += vocabulary_.Sample(random_);
+        *str += "</td></tr>\n";
+      }
+      *str += "</table>\n";
+    }
+    AppendParagraph(str);
+  }
+  *str += "</div>\n<div id=\"footer\">Copyright (C) example.jp</div>\n"
+      "</body>\n</html>\n";
+}
+
+void PageGenerator::AppendPathologicalBody(PageType type, std::string *str) {
+  switch (type) {
+    case HUGE_PAGE: {
+      // A normal page repeated up to 1MiB, like a long log or a book.
+      AppendPage(NULL, str);
+      std::size_t page_length = str->length();
+      while (str->length() < (1 << 20)) {
+        str->append(*str, 0, page_length);
+      }
+      break;
+    }
+    case DEEP_NESTING_PAGE: {
+      *str += "<html><body>";
+      for (int i = 0; i < 20000; ++i) {
+        *str += (i % 2 == 0) ? "<div>" : "<span>";
+      }
+      AppendParagraph(str);
+      *str += "</body></html>\n";
+      break;
+    }
+    case UNCLOSED_PAGE: {
+      *str += "<html><head><title>";
+      AppendSentence(str);
+      *str += "</title></head><body><!-- ";
+      AppendParagraph(str);
+      *str += "<script type=\"text/javascript\">var s = \"";
+      while (str->length() < (256 << 10)) {
+        AppendSentence(str);
+      }
+      break;
+    }
+    case BINARY_PAGE: {
+      std::size_t length = random_->Next(4 << 10, 64 << 10);
+      for (std::size_t i = 0; i < length; ++i) {
+        *str += static_cast<char>(random_->Next(256));
+      }
+      break;
+    }
+    case ENTITY_STORM_PAGE: {
+      static const char * const ENTITIES[] = {
+        "&#12354;", "&#x30A2;", "&amp;", "&nbsp;", "&#xFFFFFFFF;",
+        "&undefined;", "&#;", "&"
+      };
+      *str += "<html><body><p>";
+      for (int i = 0; i < 50000; ++i) {
+        *str += ENTITIES[random_->Next(8)];
+      }
+      *str += "</p></body></html>\n";
+      break;
+    }
+    case LONG_LINE_PAGE: {
+      // A line without tags, spaces or punctuation.
+      *str += "<html><body><p>";
+      while (str->length() < (1 << 20)) {
+        *str += vocabulary_.Sample(random_);
+      }
+      *str += "</p></body></html>\n";
+      break;
+    }
+    default: {
+      AppendPage(NULL, str);
+      break;
+    }
+  }
+}
+
+void PageGenerator::Encode(Encoding encoding, const std::string &src) {
+  body_.Clear();
+  if (encoding == UTF8_ENCODING) {
+    body_.Append(nwc_toolkit::String(src.data(), src.length()));
+    return;
+  }
+  if (!nwc_toolkit::CharacterEncoding::Convert("UTF-8",
+      nwc_toolkit::String(src.data(), src.length()),
+      ENCODING_CODES[encoding], &body_)) {
+    NWC_TOOLKIT_ERROR("failed to convert text to %s",
+        ENCODING_CODES[encoding]);
+  }
+}
+
+void Generate(nwc_toolkit::OutputFile *output_file) {
+  Random random(seed);
+  Vocabulary vocabulary;
+  vocabulary.Build(static_cast<std::size_t>(vocabulary_size),
+      zipf_exponent, &random);
+
+  PageGenerator generator(vocabulary, &random);
+  nwc_toolkit::HtmlArchiveEntry entry;
+  long long total_length = 0;
+  for (long long i = 0; i < num_entries; ++i) {
+    generator.Generate(i, &entry);
+    if (!entry.Write(output_file)) {
+      NWC_TOOLKIT_ERROR("failed to write entry");
+    }
+    total_length += entry.body().length();
+  }
+
+  std::cerr << "entries: " << num_entries
+      << ", body bytes: " << total_length << '\n';
+  for (int i = 0; i < NUM_ENCODINGS; ++i) {
+    std::cerr << ENCODING_CODES[i] << ": "
+        << generator.encoding_count(i) << '\n';
+  }
+  for (int i = 0; i < NUM_PAGE_TYPES; ++i) {
+    std::cerr << PAGE_TYPE_NAMES[i] << ": "
+        << generator.page_type_count(i) << '\n';
+  }
+  std::cerr << std::flush;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  ParseOptions(argc, argv);
+  if (is_help_mode) {
+    PrintHelp(argv[0]);
+    return 0;
+  }
+
+  nwc_toolkit::OutputFile output_file;
+  std::cerr << "output: " << (output_file_name.is_empty()
+      ? "(standard output)" : output_file_name) << std::endl;
+  if (!output_file.Open(output_file_name)) {
+    NWC_TOOLKIT_ERROR("failed to open output file: %s",
+        output_file_name.ptr());
+  }
+  Generate(&output_file);
+  if (!output_file.Close()) {
+    NWC_TOOLKIT_ERROR("failed to close output file: %s",
+        output_file_name.ptr());
+  }
+
+  return 0;
+}
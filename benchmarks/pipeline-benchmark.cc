@@ -0,0 +1,618 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <errno.h>
+#include <error.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <nwc-toolkit/input-file.h>
+#include <nwc-toolkit/output-file.h>
+#include <nwc-toolkit/string-builder.h>
+
+#define NWC_TOOLKIT_ERROR(fmt, ...) \
+  error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
+
+namespace {
+
+enum {
+  DEFAULT_NUM_ENTRIES = 1000,
+  DEFAULT_MEMORY_LIMIT = 64,
+  DEFAULT_MAX_NGRAM_LENGTH = 5,
+  OUTPUT_BUF_LENGTH_THRESHOLD = (1 << 16) - (1 << 10)
+};
+
+const char DEFAULT_TOOLS_DIR[] = "../tools";
+const char DEFAULT_GENERATOR[] = "./corpus-generator";
+const char DEFAULT_WORK_DIR[] = "pipeline-work";
+
+std::string tools_dir = DEFAULT_TOOLS_DIR;
+std::string generator = DEFAULT_GENERATOR;
+std::string work_dir = DEFAULT_WORK_DIR;
+std::vector<std::string> generator_options;
+long long memory_limit = DEFAULT_MEMORY_LIMIT;
+long long max_ngram_length = DEFAULT_MAX_NGRAM_LENGTH;
+std::string result_file_name;
+bool is_keep_mode = false;
+bool is_help_mode = false;
+
+long long ParseInteger(const char *str, long long min_value,
+    long long max_value) {
+  char *end_of_value;
+  long long value = std::strtoll(str, &end_of_value, 10);
+  if ((*end_of_value != '\0') || (value < min_value) || (value > max_value)) {
+    NWC_TOOLKIT_ERROR("invalid argument: %s", str);
+  }
+  return value;
+}
+
+void ParseOptions(int argc, char *argv[]) {
+  static const struct option long_options[] = {
+    { "tools", 1, NULL, 't' },
+    { "generator", 1, NULL, 'g' },
+    { "work", 1, NULL, 'w' },
+    { "entries", 1, NULL, 'n' },
+    { "vocabulary", 1, NULL, 'v' },
+    { "zipf", 1, NULL, 'z' },
+    { "pathological", 1, NULL, 'x' },
+    { "seed", 1, NULL, 's' },
+    { "memory", 1, NULL, 'l' },
+    { "tokens", 1, NULL, 'N' },
+    { "output", 1, NULL, 'o' },
+    { "keep", 0, NULL, 'k' },
+    { "help", 0, NULL, 'h' },
+    { NULL, 0, NULL, '\0' }
+  };
+
+  int value;
+  while ((value = ::getopt_long(argc, argv, "t:g:w:n:v:z:x:s:l:N:o:kh",
+      long_options, NULL)) != -1) {
+    switch (value) {
+      case 't': {
+        tools_dir = optarg;
+        break;
+      }
+      case 'g': {
+        generator = optarg;
+        break;
+      }
+      case 'w': {
+        work_dir = optarg;
+        break;
+      }
+      case 'n':
+      case 'v':
+      case 'z':
+      case 'x':
+      case 's': {
+        // Options of the corpus generator are passed as is.
+        std::string option = "-";
+        option += static_cast<char>(value);
+        generator_options.push_back(option);
+        generator_options.push_back(optarg);
+        break;
+      }
+      case 'l': {
+        memory_limit = ParseInteger(optarg, 2, 262144);
+        break;
+      }
+      case 'N': {
+        max_ngram_length = ParseInteger(optarg, 1, 32);
+        break;
+      }
+      case 'o': {
+        result_file_name = optarg;
+        break;
+      }
+      case 'k': {
+        is_keep_mode = true;
+        break;
+      }
+      case 'h': {
+        is_help_mode = true;
+        break;
+      }
+      default: {
+        NWC_TOOLKIT_ERROR("invalid option");
+      }
+    }
+  }
+}
+
+void PrintHelp(const char *command) {
+  std::cerr << "Usage: " << command << " [OPTION]...\n\n"
+      "Runs corpus-generator, nwc-toolkit-text-extractor, a MeCab stand-in,\n"
+      "nwc-toolkit-ngram-counter and nwc-toolkit-ngram-merger in order,\n"
+      "and prints wall time, CPU time, peak RSS and bytes of each stage.\n\n"
+      "Options:\n"
+      "  -t, --tools=[DIR]       find tools in DIR (default: "
+      << DEFAULT_TOOLS_DIR << ")\n"
+      "  -g, --generator=[FILE]  use FILE as the generator (default: "
+      << DEFAULT_GENERATOR << ")\n"
+      "  -w, --work=[DIR]        write intermediate files to DIR\n"
+      "                          (default: " << DEFAULT_WORK_DIR << ")\n"
+      "  -n, --entries=[N]       generate N entries (default: "
+      << DEFAULT_NUM_ENTRIES << ")\n"
+      "  -v, --vocabulary=[N]    use N distinct words\n"
+      "  -z, --zipf=[S]          use a Zipf distribution with exponent S\n"
+      "  -x, --pathological=[N]  make N% of entries pathological\n"
+      "  -s, --seed=[N]          set the seed of random numbers\n"
+      "  -l, --memory=[N]        limit the memory usage of\n"
+      "                          nwc-toolkit-ngram-counter to N MiB"
+      " (default: " << DEFAULT_MEMORY_LIMIT << ")\n"
+      "  -N, --tokens=[N]        count n-grams up to N tokens (default: "
+      << DEFAULT_MAX_NGRAM_LENGTH << ")\n"
+      "  -o, --output=[FILE]     append results to FILE in JSON lines\n"
+      "  -k, --keep              keep intermediate files\n"
+      "  -h, --help              print this help\n"
+      << std::flush;
+}
+
+double GetTime() {
+  struct ::timespec ts;
+  ::clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+double ToSeconds(const struct ::timeval &tv) {
+  return tv.tv_sec + (tv.tv_usec / 1000000.0);
+}
+
+long long GetFileSize(const std::string &path) {
+  struct ::stat st;
+  if (::stat(path.c_str(), &st) != 0) {
+    return 0;
+  }
+  return static_cast<long long>(st.st_size);
+}
+
+long long GetTotalFileSize(const std::vector<std::string> &paths) {
+  long long total_size = 0;
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    total_size += GetFileSize(paths[i]);
+  }
+  return total_size;
+}
+
+struct StageResult {
+  StageResult()
+      : name(), wall_seconds(0.0), cpu_seconds(0.0), peak_rss(0),
+        input_bytes(0), output_bytes(0) {}
+
+  std::string name;
+  double wall_seconds;
+  double cpu_seconds;
+  long long peak_rss;
+  long long input_bytes;
+  long long output_bytes;
+};
+
+// Stage runs a step of the pipeline in a child process, so that its CPU
+// time and peak RSS are obtained from wait4() separately from the other
+// stages. The standard error of the child is saved to a log file.
+class Stage {
+ public:
+  explicit Stage(const std::string &name)
+      : name_(name), log_path_(work_dir + "/" + name + ".log") {}
+  virtual ~Stage() {}
+
+  // Returns true on success. The result is filled in on success.
+  bool Run(const std::vector<std::string> &input_paths,
+      const std::vector<std::string> &output_paths, StageResult *result);
+
+ protected:
+  // Is called in the child process and returns its exit status.
+  virtual int Main(const std::vector<std::string> &input_paths,
+      const std::vector<std::string> &output_paths) = 0;
+
+ private:
+  std::string name_;
+  std::string log_path_;
+
+  // Disallows copy and assignment.
+  Stage(const Stage &);
+  Stage &operator=(const Stage &);
+};
+
+bool Stage::Run(const std::vector<std::string> &input_paths,
+    const std::vector<std::string> &output_paths, StageResult *result) {
+  std::cerr << name_ << ": " << std::flush;
+  double start_time = GetTime();
+  pid_t pid = ::fork();
+  if (pid == -1) {
+    NWC_TOOLKIT_ERROR("failed to fork");
+  } else if (pid == 0) {
+    int fd = ::open(log_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if ((fd == -1) || (::dup2(fd, 2) == -1)) {
+      ::_exit(127);
+    }
+    ::close(fd);
+    ::_exit(Main(input_paths, output_paths));
+  }
+
+  int status;
+  struct ::rusage usage;
+  if (::wait4(pid, &status, 0, &usage) == -1) {
+    NWC_TOOLKIT_ERROR("failed to wait for %s", name_.c_str());
+  }
+  double wall_seconds = GetTime() - start_time;
+  if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+    std::cerr << "failed (see " << log_path_ << ")" << std::endl;
+    return false;
+  }
+  std::cerr << "done" << std::endl;
+
+  result->name = name_;
+  result->wall_seconds = wall_seconds;
+  result->cpu_seconds = ToSeconds(usage.ru_utime) + ToSeconds(usage.ru_stime);
+  result->peak_rss = static_cast<long long>(usage.ru_maxrss) * 1024;
+  result->input_bytes = GetTotalFileSize(input_paths);
+  result->output_bytes = GetTotalFileSize(output_paths);
+  return true;
+}
+
+// CommandStage executes a program. Input and output paths are given as
+// a part of the arguments.
+class CommandStage : public Stage {
+ public:
+  CommandStage(const std::string &name,
+      const std::vector<std::string> &args)
+      : Stage(name), args_(args) {}
+
+ protected:
+  int Main(const std::vector<std::string> &,
+      const std::vector<std::string> &) {
+    std::vector<char *> argv;
+    for (std::size_t i = 0; i < args_.size(); ++i) {
+      argv.push_back(const_cast<char *>(args_[i].c_str()));
+    }
+    argv.push_back(NULL);
+    ::execv(argv[0], &argv[0]);
+    std::perror(argv[0]);
+    return 127;
+  }
+
+ private:
+  std::vector<std::string> args_;
+};
+
+// MecabStandInStage converts the output of nwc-toolkit-text-extractor into
+// MeCab format without a dictionary, so that the pipeline runs offline.
+// A run of characters of the same type (kanji, hiragana, katakana, Latin
+// letters or digits) becomes a token and any other character becomes a
+// token by itself. The cost is far less than that of MeCab, so the stage
+// measures the I/O of the format rather than morphological analysis.
+class MecabStandInStage : public Stage {
+ public:
+  MecabStandInStage() : Stage("mecab-stand-in") {}
+
+ protected:
+  int Main(const std::vector<std::string> &input_paths,
+      const std::vector<std::string> &output_paths);
+
+ private:
+  enum CharType {
+    SPACE_CHAR,
+    KANJI_CHAR,
+    HIRAGANA_CHAR,
+    KATAKANA_CHAR,
+    ALPHA_CHAR,
+    DIGIT_CHAR,
+    OTHER_CHAR
+  };
+
+  static int DecodeUtf8(const char *ptr, const char *end, int *length);
+  static CharType GetCharType(int code_point);
+  static void AppendToken(const nwc_toolkit::String &token, CharType type,
+      nwc_toolkit::StringBuilder *output_buf);
+};
+
+int MecabStandInStage::Main(const std::vector<std::string> &input_paths,
+    const std::vector<std::string> &output_paths) {
+  nwc_toolkit::InputFile input_file;
+  if (!input_file.Open(input_paths[0].c_str())) {
+    NWC_TOOLKIT_ERROR("failed to open file: %s", input_paths[0].c_str());
+  }
+  nwc_toolkit::OutputFile output_file;
+  if (!output_file.Open(output_paths[0].c_str())) {
+    NWC_TOOLKIT_ERROR("failed to open file: %s", output_paths[0].c_str());
+  }
+
+  nwc_toolkit::StringBuilder output_buf;
+  nwc_toolkit::String line;
+  while (input_file.ReadLine(&line)) {
+    line = line.StripRight();
+    if (line.is_empty()) {
+      continue;
+    }
+    const char *token_begin = line.begin();
+    CharType token_type = SPACE_CHAR;
+    for (const char *ptr = line.begin(); ptr < line.end(); ) {
+      int length;
+      CharType type = GetCharType(DecodeUtf8(ptr, line.end(), &length));
+      if ((type != token_type) || (type == OTHER_CHAR)) {
+        if (token_type != SPACE_CHAR) {
+          AppendToken(nwc_toolkit::String(token_begin, ptr), token_type,
+              &output_buf);
+        }
+        token_begin = ptr;
+        token_type = type;
+      }
+      ptr += length;
+    }
+    if (token_type != SPACE_CHAR) {
+      AppendToken(nwc_toolkit::String(token_begin, line.end()), token_type,
+          &output_buf);
+    }
+    output_buf.Append("EOS\n");
+    if (output_buf.length() > OUTPUT_BUF_LENGTH_THRESHOLD) {
+      if (!output_file.Write(output_buf.str())) {
+        NWC_TOOLKIT_ERROR("failed to write result");
+      }
+      output_buf.Clear();
+    }
+  }
+  if (!output_file.Write(output_buf.str()) || !output_file.Close()) {
+    NWC_TOOLKIT_ERROR("failed to write result");
+  }
+  return 0;
+}
+
+// Returns a code point, or -1 for an invalid byte which is skipped alone.
+int MecabStandInStage::DecodeUtf8(const char *ptr, const char *end,
+    int *length) {
+  unsigned char c = static_cast<unsigned char>(*ptr);
+  int expected_length;
+  int code_point;
+  if (c < 0x80) {
+    *length = 1;
+    return c;
+  } else if ((c & 0xE0) == 0xC0) {
+    expected_length = 2;
+    code_point = c & 0x1F;
+  } else if ((c & 0xF0) == 0xE0) {
+    expected_length = 3;
+    code_point = c & 0x0F;
+  } else if ((c & 0xF8) == 0xF0) {
+    expected_length = 4;
+    code_point = c & 0x07;
+  } else {
+    *length = 1;
+    return -1;
+  }
+  if ((end - ptr) < expected_length) {
+    *length = 1;
+    return -1;
+  }
+  for (int i = 1; i < expected_length; ++i) {
+    unsigned char next = static_cast<unsigned char>(ptr[i]);
+    if ((next & 0xC0) != 0x80) {
+      *length = 1;
+      return -1;
+    }
+    code_point = (code_point << 6) | (next & 0x3F);
+  }
+  *length = expected_length;
+  return code_point;
+}
+
+MecabStandInStage::CharType MecabStandInStage::GetCharType(int code_point) {
+  if ((code_point == ' ') || (code_point == '\t') || (code_point == 0x3000)) {
+    return SPACE_CHAR;
+  } else if (((code_point >= 0x4E00) && (code_point <= 0x9FFF)) ||
+      ((code_point >= 0x3400) && (code_point <= 0x4DBF)) ||
+      (code_point == 0x3005)) {
+    return KANJI_CHAR;
+  } else if ((code_point >= 0x3041) && (code_point <= 0x309F)) {
+    return HIRAGANA_CHAR;
+  } else if (((code_point >= 0x30A1) && (code_point <= 0x30FF)) ||
+      ((code_point >= 0xFF66) && (code_point <= 0xFF9F))) {
+    return KATAKANA_CHAR;
+  } else if (((code_point >= 'A') && (code_point <= 'Z')) ||
+      ((code_point >= 'a') && (code_point <= 'z')) ||
+      ((code_point >= 0xFF21) && (code_point <= 0xFF3A)) ||
+      ((code_point >= 0xFF41) && (code_point <= 0xFF5A))) {
+    return ALPHA_CHAR;
+  } else if (((code_point >= '0') && (code_point <= '9')) ||
+      ((code_point >= 0xFF10) && (code_point <= 0xFF19))) {
+    return DIGIT_CHAR;
+  }
+  return OTHER_CHAR;
+}
+
+void MecabStandInStage::AppendToken(const nwc_toolkit::String &token,
+    CharType type, nwc_toolkit::StringBuilder *output_buf) {
+  static const char * const FEATURES[] = {
+    "", "名詞,一般", "助詞,*", "名詞,一般", "名詞,固有名詞", "名詞,数",
+    "記号,一般"
+  };
+  output_buf->Append(token).Append('\t').Append(FEATURES[type])
+      .Append(",*,*,*,*,").Append(token).Append(",*,*\n");
+}
+
+std::string GetToolPath(const char *name) {
+  return tools_dir + "/nwc-toolkit-" + name;
+}
+
+// Returns the paths of the files written by nwc-toolkit-ngram-counter.
+std::vector<std::string> FindNgramCounterOutputs(const std::string &prefix) {
+  std::vector<std::string> paths;
+  for (int file_id = 0; ; ++file_id) {
+    char suffix[32];
+    std::sprintf(suffix, ".%04d.gz", file_id);
+    std::string path = prefix + suffix;
+    if (::access(path.c_str(), F_OK) != 0) {
+      break;
+    }
+    paths.push_back(path);
+  }
+  return paths;
+}
+
+void PrintResults(const std::vector<StageResult> &results) {
+  std::printf("%-16s %10s %10s %10s %12s %12s %10s\n", "stage", "wall(s)",
+      "cpu(s)", "rss(MiB)", "input(B)", "output(B)", "MB/s");
+  StageResult total;
+  total.name = "total";
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const StageResult &result = results[i];
+    std::printf("%-16s %10.3f %10.3f %10.1f %12lld %12lld %10.2f\n",
+        result.name.c_str(), result.wall_seconds, result.cpu_seconds,
+        result.peak_rss / 1048576.0, result.input_bytes, result.output_bytes,
+        (result.wall_seconds > 0.0) ?
+        (result.input_bytes / result.wall_seconds / 1000000.0) : 0.0);
+    total.wall_seconds += result.wall_seconds;
+    total.cpu_seconds += result.cpu_seconds;
+    if (result.peak_rss > total.peak_rss) {
+      total.peak_rss = result.peak_rss;
+    }
+  }
+  std::printf("%-16s %10.3f %10.3f %10.1f\n", total.name.c_str(),
+      total.wall_seconds, total.cpu_seconds, total.peak_rss / 1048576.0);
+  std::fflush(stdout);
+}
+
+void SaveResults(const std::vector<StageResult> &results) {
+  std::FILE *file = std::fopen(result_file_name.c_str(), "a");
+  if (file == NULL) {
+    NWC_TOOLKIT_ERROR("failed to open file: %s", result_file_name.c_str());
+  }
+  long long time = static_cast<long long>(std::time(NULL));
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const StageResult &result = results[i];
+    std::fprintf(file, "{\"time\":%lld,\"stage\":\"%s\","
+        "\"wall_seconds\":%.3f,\"cpu_seconds\":%.3f,\"peak_rss_bytes\":%lld,"
+        "\"input_bytes\":%lld,\"output_bytes\":%lld}\n", time,
+        result.name.c_str(), result.wall_seconds, result.cpu_seconds,
+        result.peak_rss, result.input_bytes, result.output_bytes);
+  }
+  if (std::fclose(file) != 0) {
+    NWC_TOOLKIT_ERROR("failed to write results: %s",
+        result_file_name.c_str());
+  }
+}
+
+bool RunPipeline(std::vector<std::string> *work_files,
+    std::vector<StageResult> *results) {
+  const std::string archive_path = work_dir + "/archive.dat";
+  const std::string text_path = work_dir + "/text.dat";
+  const std::string mecab_path = work_dir + "/mecab.dat";
+  const std::string ngms_prefix = work_dir + "/ngms";
+  const std::string ngrams_path = work_dir + "/ngrams.gz";
+
+  std::vector<std::string> no_paths;
+  std::vector<std::string> archive_paths(1, archive_path);
+  std::vector<std::string> text_paths(1, text_path);
+  std::vector<std::string> mecab_paths(1, mecab_path);
+  std::vector<std::string> ngrams_paths(1, ngrams_path);
+  StageResult result;
+
+  std::vector<std::string> args;
+  args.push_back(generator);
+  args.insert(args.end(), generator_options.begin(), generator_options.end());
+  args.push_back("-o");
+  args.push_back(archive_path);
+  work_files->push_back(archive_path);
+  if (!CommandStage("corpus-generator", args).Run(
+      no_paths, archive_paths, &result)) {
+    return false;
+  }
+  results->push_back(result);
+
+  args.clear();
+  args.push_back(GetToolPath("text-extractor"));
+  args.push_back("--filter");
+  args.push_back("--output=" + text_path);
+  args.push_back(archive_path);
+  work_files->push_back(text_path);
+  if (!CommandStage("text-extractor", args).Run(
+      archive_paths, text_paths, &result)) {
+    return false;
+  }
+  results->push_back(result);
+
+  work_files->push_back(mecab_path);
+  if (!MecabStandInStage().Run(text_paths, mecab_paths, &result)) {
+    return false;
+  }
+  results->push_back(result);
+
+  std::ostringstream memory_option;
+  memory_option << "--memory=" << memory_limit;
+  std::ostringstream tokens_option;
+  tokens_option << "--tokens=" << max_ngram_length;
+  args.clear();
+  args.push_back(GetToolPath("ngram-counter"));
+  args.push_back("--mecab");
+  args.push_back("--sort");
+  args.push_back(memory_option.str());
+  args.push_back(tokens_option.str());
+  args.push_back("--prefix=" + ngms_prefix);
+  args.push_back("--extension=gz");
+  args.push_back(mecab_path);
+  bool is_ok = CommandStage("ngram-counter", args).Run(
+      mecab_paths, no_paths, &result);
+  std::vector<std::string> ngms_paths = FindNgramCounterOutputs(ngms_prefix);
+  work_files->insert(work_files->end(), ngms_paths.begin(), ngms_paths.end());
+  if (!is_ok) {
+    return false;
+  }
+  result.output_bytes = GetTotalFileSize(ngms_paths);
+  results->push_back(result);
+
+  args.clear();
+  args.push_back(GetToolPath("ngram-merger"));
+  args.push_back("--output=" + ngrams_path);
+  args.insert(args.end(), ngms_paths.begin(), ngms_paths.end());
+  work_files->push_back(ngrams_path);
+  if (!CommandStage("ngram-merger", args).Run(
+      ngms_paths, ngrams_paths, &result)) {
+    return false;
+  }
+  results->push_back(result);
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  ParseOptions(argc, argv);
+  if (is_help_mode) {
+    PrintHelp(argv[0]);
+    return 0;
+  }
+
+  if ((::mkdir(work_dir.c_str(), 0755) != 0) && (errno != EEXIST)) {
+    NWC_TOOLKIT_ERROR("failed to create directory: %s", work_dir.c_str());
+  }
+  std::cerr << "work: " << work_dir << std::endl;
+
+  std::vector<std::string> work_files;
+  std::vector<StageResult> results;
+  bool is_ok = RunPipeline(&work_files, &results);
+  PrintResults(results);
+  if (!result_file_name.empty()) {
+    SaveResults(results);
+  }
+
+  // Logs are kept for investigation.
+  if (is_ok && !is_keep_mode) {
+    for (std::size_t i = 0; i < work_files.size(); ++i) {
+      std::remove(work_files[i].c_str());
+    }
+  }
+  return is_ok ? 0 : 1;
+}
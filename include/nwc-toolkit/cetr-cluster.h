@@ -10,6 +10,15 @@
 
 namespace nwc_toolkit {
 
+// CetrCluster clusters points by k-means. The centroid of cluster 0 is
+// fixed at the origin, so that cluster 0 consists of non-content lines.
+// The other centroids are seeded by k-means++, and Lloyd's iterations are
+// repeated until no point changes its cluster. The points are kept in a
+// structure of arrays and assigned to clusters with SSE2 if available.
+// The result of the try with the smallest total squared distance is
+// returned, and it is deterministic for the same `seed'. An object keeps
+// its buffers, so Run() on the same object does not allocate memory once
+// the buffers are large enough.
 class CetrCluster {
  public:
   enum {
@@ -19,7 +28,7 @@ class CetrCluster {
 
   enum {
     MIN_NUM_TRIES = 1,
-    DEFAULT_NUM_TRIES = 3
+    DEFAULT_NUM_TRIES = 2
   };
 
   enum {
@@ -27,29 +36,44 @@ class CetrCluster {
     DEFAULT_NUM_STEPS = 100
   };
 
+  enum { NUM_SEEDING_CANDIDATES = 3 };
+
+  CetrCluster();
+  ~CetrCluster() {}
+
+  void Run(const std::vector<CetrPoint> &points,
+      std::vector<int> *clusters, int num_clusters = 0,
+      int num_tries = 0, int num_steps = 0, unsigned int seed = 0);
+
   static void Cluster(const std::vector<CetrPoint> &points,
       std::vector<int> *clusters, int num_clusters = 0,
-      int num_tries = 0, int num_steps = 0);
+      int num_tries = 0, int num_steps = 0, unsigned int seed = 0) {
+    CetrCluster clustering_module;
+    clustering_module.Run(points, clusters, num_clusters,
+        num_tries, num_steps, seed);
+  }
 
  private:
-  const int num_clusters_;
-  const int num_tries_;
-  const int num_steps_;
+  int num_clusters_;
+  int num_tries_;
+  int num_steps_;
   std::tr1::mt19937 mt_;
+  std::vector<double> xs_;
+  std::vector<double> ys_;
+  std::vector<double> centroid_xs_;
+  std::vector<double> centroid_ys_;
   std::vector<int> clusters_;
-  std::vector<CetrPoint> centroids_;
+  std::vector<double> sq_dists_;
+  std::vector<double> sum_xs_;
+  std::vector<double> sum_ys_;
   std::vector<std::size_t> numbers_;
 
-  CetrCluster(int num_clusters, int num_tries, int num_steps);
-  ~CetrCluster() {}
-
-  void Clear();
-
   void Do(const std::vector<CetrPoint> &points, std::vector<int> *clusters);
 
-  void UpdateClusters(const std::vector<CetrPoint> &points,
-      double *total_sq_dist);
-  void UpdateCentroids(const std::vector<CetrPoint> &points);
+  void SeedCentroids();
+  std::size_t ChooseSeed(double total_sq_dist);
+  bool UpdateClusters(double *total_sq_dist);
+  void UpdateCentroids();
 
   // Disallows copy and assignment.
   CetrCluster(const CetrCluster &);
@@ -0,0 +1,50 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#ifndef NWC_TOOLKIT_CHARACTER_CONVERTER_H_
+#define NWC_TOOLKIT_CHARACTER_CONVERTER_H_
+
+#include <iconv.h>
+
+#include "./string-builder.h"
+
+namespace nwc_toolkit {
+
+// CharacterConverter converts a string piece by piece, unlike
+// CharacterEncoding::Convert() that requires the whole string at once.
+class CharacterConverter {
+ public:
+  CharacterConverter() : iconv_desc_(InvalidDesc()) {}
+  ~CharacterConverter() {
+    if (is_open()) {
+      Close();
+    }
+  }
+
+  bool Open(const String &src_code, const String &dest_code);
+  bool Close();
+
+  bool is_open() const {
+    return iconv_desc_ != InvalidDesc();
+  }
+
+  // Converts `src' and appends the result to `dest'. If `src' ends with an
+  // incomplete multibyte sequence, the sequence is returned as `src_left'
+  // and should be given again with the following bytes. Convert() returns
+  // false if `src' contains an invalid sequence.
+  bool Convert(const String &src, StringBuilder *dest, String *src_left);
+
+ private:
+  ::iconv_t iconv_desc_;
+
+  static ::iconv_t InvalidDesc() {
+    return reinterpret_cast< ::iconv_t>(-1);
+  }
+
+  // Disallows copy and assignment.
+  CharacterConverter(const CharacterConverter &);
+  CharacterConverter &operator=(const CharacterConverter &);
+};
+
+}  // namespace nwc_toolkit
+
+#endif  // NWC_TOOLKIT_CHARACTER_CONVERTER_H_
@@ -0,0 +1,117 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#ifndef NWC_TOOLKIT_DIGEST_SET_H_
+#define NWC_TOOLKIT_DIGEST_SET_H_
+
+#include "./string.h"
+
+namespace nwc_toolkit {
+
+// DigestSet is a set of the first 128 bits of SHA-1 hashes for finding
+// duplicate documents, which must not be dropped because of a collision.
+// Digests are stored in an open-addressing table with linear probing. The
+// table is doubled while the old and new tables fit in the memory limit
+// together, and after that a new digest is not inserted and the caller is
+// told so. A digest is never removed, so a string once found new is never
+// found new again.
+//
+// Digests can be saved to a file and loaded into another set, so that
+// duplicates are found across processes, e.g. shards of an archive.
+class DigestSet {
+ public:
+  struct Digest {
+    unsigned long long high;
+    unsigned long long low;
+
+    bool operator==(const Digest &digest) const {
+      return (high == digest.high) && (low == digest.low);
+    }
+  };
+
+  enum {
+    MIN_MEMORY_LIMIT = 1 << 16,
+    DEFAULT_MEMORY_LIMIT = 256 << 20
+  };
+
+  DigestSet();
+  ~DigestSet() {
+    Clear();
+  }
+
+  std::size_t memory_limit() const {
+    return memory_limit_;
+  }
+  std::size_t memory_usage() const {
+    return num_slots_ * sizeof(Digest);
+  }
+  std::size_t num_digests() const {
+    return num_digests_;
+  }
+  bool is_empty() const {
+    return num_digests_ == 0;
+  }
+
+  // Removes all digests and changes the memory limit. 0 means
+  // DEFAULT_MEMORY_LIMIT.
+  void Reset(std::size_t memory_limit);
+  void Clear();
+
+  // Inserts a digest and returns true, or returns false if the digest is
+  // not in the set and the memory limit does not allow inserting it. Use
+  // Contains() to tell whether a digest is new.
+  bool Insert(const String &str) {
+    return Insert(Calculate(str));
+  }
+  bool Insert(const Digest &digest);
+
+  bool Contains(const String &str) const {
+    return Contains(Calculate(str));
+  }
+  bool Contains(const Digest &digest) const;
+
+  // Writes the digests to `path'. The file is written to a temporary file
+  // and then renamed, so a crash never leaves a partial file at `path'.
+  bool Save(const String &path) const;
+  // Inserts the digests saved by Save(). Digests already in the set are
+  // kept, so files of different sets can be merged. Returns false if the
+  // digests do not fit in the memory limit.
+  bool Load(const String &path);
+
+  // Returns the first 128 bits of the SHA-1 hash of `str'.
+  static Digest Calculate(const String &str);
+  // Parses a SHA-1 hash in 40 hexadecimal digits.
+  static bool Parse(const String &hex_digest, Digest *digest);
+
+ private:
+  enum { MIN_NUM_SLOTS = 1 << 12 };
+
+  Digest *slots_;
+  std::size_t num_slots_;
+  std::size_t num_digests_;
+  std::size_t memory_limit_;
+
+  // 0 represents an empty slot.
+  static Digest FixDigest(const Digest &digest) {
+    Digest fixed_digest = digest;
+    if ((fixed_digest.high == 0) && (fixed_digest.low == 0)) {
+      fixed_digest.low = 1;
+    }
+    return fixed_digest;
+  }
+  static bool IsEmpty(const Digest &digest) {
+    return (digest.high == 0) && (digest.low == 0);
+  }
+
+  // Returns the slot of `digest' or the first empty slot. The low word is
+  // left for choosing partitions of a SpillFile.
+  Digest *Find(const Digest &digest) const;
+  bool Grow();
+
+  // Disallows copy and assignment.
+  DigestSet(const DigestSet &);
+  DigestSet &operator=(const DigestSet &);
+};
+
+}  // namespace nwc_toolkit
+
+#endif  // NWC_TOOLKIT_DIGEST_SET_H_
@@ -0,0 +1,102 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#ifndef NWC_TOOLKIT_FINGERPRINT_SET_H_
+#define NWC_TOOLKIT_FINGERPRINT_SET_H_
+
+#include "./string-hash.h"
+
+namespace nwc_toolkit {
+
+// FingerprintSet is a set of 64-bit fingerprints for finding duplicate
+// strings. Fingerprints are stored in buckets of 8 slots (a cache line) and
+// a fingerprint is placed within MAX_NUM_PROBES buckets from its home
+// bucket. The number of buckets is doubled while the old and new buckets
+// fit in the memory limit together, so the limit also bounds the peak.
+// After that, a fingerprint which finds no empty slot is not inserted and
+// the caller is told so, e.g. to write the string to a SpillFile. A
+// fingerprint is never removed, so a string once found new is never found
+// new again.
+//
+// Fingerprints can be saved to a file and loaded into another set, so that
+// duplicates are found across processes, e.g. shards of an archive.
+class FingerprintSet {
+ public:
+  enum {
+    MIN_MEMORY_LIMIT = 1 << 16,
+    DEFAULT_MEMORY_LIMIT = 256 << 20
+  };
+
+  FingerprintSet();
+  ~FingerprintSet() {
+    Clear();
+  }
+
+  std::size_t memory_limit() const {
+    return memory_limit_;
+  }
+  std::size_t memory_usage() const {
+    return num_buckets_ * BUCKET_SIZE * sizeof(unsigned long long);
+  }
+  std::size_t num_fingerprints() const {
+    return num_fingerprints_;
+  }
+  bool is_empty() const {
+    return num_fingerprints_ == 0;
+  }
+
+  // Removes all fingerprints and changes the memory limit. 0 means
+  // DEFAULT_MEMORY_LIMIT.
+  void Reset(std::size_t memory_limit);
+  void Clear();
+
+  // Inserts a fingerprint and returns true, or returns false if the
+  // fingerprint is not in the set and the memory limit does not allow
+  // inserting it. Use Contains() to tell whether a fingerprint is new.
+  bool Insert(const String &str) {
+    return Insert(StringHash64()(str));
+  }
+  bool Insert(unsigned long long fingerprint);
+
+  bool Contains(const String &str) const {
+    return Contains(StringHash64()(str));
+  }
+  bool Contains(unsigned long long fingerprint) const;
+
+  // Writes the fingerprints to `path' in little-endian order. The file is
+  // written to a temporary file and then renamed, so a crash never leaves a
+  // partial file at `path'.
+  bool Save(const String &path) const;
+  // Inserts the fingerprints saved by Save(). Fingerprints already in the
+  // set are kept, so files of different sets can be merged. Returns false
+  // if the fingerprints do not fit in the memory limit.
+  bool Load(const String &path);
+
+ private:
+  enum {
+    BUCKET_SIZE = 8,
+    MAX_NUM_PROBES = 4,
+    MIN_NUM_BUCKETS = 1 << 10
+  };
+
+  unsigned long long *slots_;
+  std::size_t num_buckets_;
+  std::size_t num_fingerprints_;
+  std::size_t memory_limit_;
+
+  // 0 represents an empty slot.
+  static unsigned long long FixFingerprint(unsigned long long fingerprint) {
+    return (fingerprint != 0) ? fingerprint : 1;
+  }
+  // Returns the slot of `fingerprint' or the first empty slot, or NULL if
+  // neither is found.
+  unsigned long long *Find(unsigned long long fingerprint) const;
+  bool Grow();
+
+  // Disallows copy and assignment.
+  FingerprintSet(const FingerprintSet &);
+  FingerprintSet &operator=(const FingerprintSet &);
+};
+
+}  // namespace nwc_toolkit
+
+#endif  // NWC_TOOLKIT_FINGERPRINT_SET_H_
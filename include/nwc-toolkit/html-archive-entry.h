@@ -11,7 +11,8 @@ namespace nwc_toolkit {
 
 class HtmlArchiveEntry {
  public:
-  HtmlArchiveEntry() : url_(), status_code_(0), header_(), body_() {}
+  HtmlArchiveEntry()
+      : url_(), status_code_(0), header_(), body_(), is_truncated_(false) {}
   ~HtmlArchiveEntry() {
     Clear();
   }
@@ -20,6 +21,7 @@ class HtmlArchiveEntry {
   int status_code() const { return status_code_; }
   String header() const { return header_.str(); }
   String body() const { return body_.str(); }
+  bool is_truncated() const { return is_truncated_; }
 
   void set_url(const String &url) { url_.Assign(url).Append(); }
   void set_status_code(int status_code) { status_code_ = status_code; }
@@ -28,7 +30,12 @@ class HtmlArchiveEntry {
 
   void Clear();
 
-  bool Read(InputFile *file);
+  bool Read(InputFile *file) {
+    return Read(file, 0);
+  }
+  // If `max_body_length' is not 0, a body longer than `max_body_length' is
+  // truncated and the rest of the body is skipped without being buffered.
+  bool Read(InputFile *file, std::size_t max_body_length);
   bool Write(OutputFile *file) const;
 
   bool ExtractUnicodeBody(StringBuilder *unicode_body) const {
@@ -38,6 +45,11 @@ class HtmlArchiveEntry {
   bool ExtractUnicodeBody(StringBuilder *unicode_body,
       StringBuilder *src_encoding) const;
 
+  // Detects the encoding of the body like ExtractUnicodeBody() does, but
+  // tests candidates with only the first `test_length' bytes of the body.
+  bool DetectUnicodeEncoding(std::size_t test_length,
+      StringBuilder *src_encoding) const;
+
   bool ExtractContentType(StringBuilder *content_type) const;
 
  private:
@@ -48,10 +60,19 @@ class HtmlArchiveEntry {
     UTF_8_FLAG = 1 << 3
   };
 
+  struct EncodingCandidate {
+    int flag;
+    const char *encoding;
+  };
+
+  // The list ends with { 0, NULL }.
+  static const EncodingCandidate ENCODING_CANDIDATES[];
+
   StringBuilder url_;
   int status_code_;
   StringBuilder header_;
   StringBuilder body_;
+  bool is_truncated_;
 
   static bool ReadInt(InputFile *file, int *value);
   static bool WriteInt(int value, OutputFile *file);
@@ -60,6 +81,10 @@ class HtmlArchiveEntry {
 
   bool TestEncodings(int encoding_flags, StringBuilder *unicode_body,
       StringBuilder *src_encoding) const;
+  static bool TestEncodings(int encoding_flags, const String &test_body,
+      bool is_partial, StringBuilder *src_encoding);
+  static bool TestEncoding(const String &encoding, const String &test_body,
+      bool is_partial);
 
   // Disallows copy and assignment.
   HtmlArchiveEntry(const HtmlArchiveEntry &);
@@ -20,6 +20,15 @@ class HtmlDocument {
     XML_MODE
   };
 
+  // By default, attribute names are lowercased and character references in
+  // attribute values are decoded after parsing. KEEP_ATTRIBUTES_AS_IS skips
+  // this normalization for applications that do not read attributes or only
+  // read a few of them, e.g. text extraction.
+  enum AttributeHandler {
+    NORMALIZE_ATTRIBUTES,
+    KEEP_ATTRIBUTES_AS_IS
+  };
+
   HtmlDocument();
   ~HtmlDocument() {
     Clear();
@@ -37,6 +46,13 @@ class HtmlDocument {
   ParserMode parser_mode() const {
     return parser_mode_;
   }
+  AttributeHandler attribute_handler() const {
+    return attribute_handler_;
+  }
+
+  void set_attribute_handler(AttributeHandler attribute_handler) {
+    attribute_handler_ = attribute_handler;
+  }
 
   std::size_t num_units() const {
     return units_.size();
@@ -54,8 +70,31 @@ class HtmlDocument {
   }
   bool Parse(const HtmlArchiveEntry &entry);
 
+  // Parse() is equivalent to Decode() followed by ParseDecodedBody().
+  // Decode() converts the body of `entry' into UTF-8 and ParseDecodedBody()
+  // parses the converted body. They are available separately so that
+  // applications can measure the time spent on each of them.
+  bool Decode(const HtmlArchiveEntry &entry);
+  bool ParseDecodedBody();
+
   void ExtractText(StringBuilder *dest);
 
+  // Parses the body of `entry' window by window and appends its text to
+  // `dest'. Each window holds about `window_size' bytes of the body and its
+  // units are discarded after its text is extracted, so memory usage does
+  // not depend on the body length. Units that continue across a window
+  // boundary are carried over to the next window, and so is the content of
+  // <textarea> until its end tag or the window size. The encoding is
+  // detected from the first window. A body whose first window is not valid
+  // in that encoding or which may be XML is parsed as a whole by Parse().
+  // An invalid byte in a later window is replaced with U+FFFD, and the
+  // content of an unclosed <textarea> longer than a window is parsed as
+  // text, so only then does the text differ from that of Parse() and
+  // ExtractText(). After this call,
+  // only src_encoding(), content_type() and parser_mode() are available.
+  bool ExtractText(const HtmlArchiveEntry &entry, std::size_t window_size,
+      StringBuilder *dest);
+
   static bool IsBlockTag(const String &tag_name);
 
  private:
@@ -85,6 +124,15 @@ class HtmlDocument {
     PRE_MODE_FLAGS = PRE_MODE_FLAG | LISTING_MODE_FLAG | TEXTAREA_MODE_FLAG
   };
 
+  // States of window-by-window parsing, which tell the parser what the
+  // previous window has left open.
+  enum WindowState {
+    TEXT_STATE,
+    COMMENT_STATE,
+    SPECIAL_ELEMENT_STATE,
+    PLAINTEXT_STATE
+  };
+
   enum EndOfLineHandler {
     KEEP_END_OF_LINE,
     REPLACE_END_OF_LINE
@@ -94,17 +142,25 @@ class HtmlDocument {
   StringBuilder src_encoding_;
   StringBuilder content_type_;
   ParserMode parser_mode_;
+  AttributeHandler attribute_handler_;
   std::vector<HtmlUnit> units_;
   std::vector<HtmlAttribute> attributes_;
   StringPool string_pool_;
   StringBuilder temp_buf_;
   std::vector<char> symbol_stack_;
+  WindowState window_state_;
+  std::size_t window_size_;
+  StringBuilder open_tag_name_;
 
   void ClearUnits();
 
   bool ParseAsPlainText(const String &body);
   bool ParseAsXml(const String &body);
   bool ParseAsHtml(const String &body);
+  bool ExtractTextFromWholeBody(const HtmlArchiveEntry &entry,
+      StringBuilder *dest);
+  String ParseHtmlWindow(const String &window, bool is_last_window);
+  String ParseHtmlUnits(const String &body, bool is_last_window);
 
   bool ParseXmlTextUnit(String *tag);
   bool ParseXmlTagUnit(String *tag);
@@ -114,7 +170,9 @@ class HtmlDocument {
   void ParseHtmlTagUnit(String *tag);
   void ParseHtmlCommentUnit(String *tag);
   void ParseHtmlOtherUnit(String *tag);
-  void ParseHtmlSpecialTag(const String &body_left,
+  bool ParseHtmlSpecialElement(const String &tag_name, bool is_last_window,
+      String *avail);
+  bool ParseHtmlSpecialTag(const String &body_left,
       const String &tag_name, String *tag);
 
   void AppendTextUnit(const String &src, const String &text_content,
@@ -127,6 +185,9 @@ class HtmlDocument {
   void FixTagUnits();
   void FixAttributes();
 
+  static String GetWindowTail(const String &text);
+
+  void AppendUnitsToText(int *mode_flags, StringBuilder *dest) const;
   static void AppendEndOfLineToText(StringBuilder *text);
   static void AppendToText(const String &str,
       EndOfLineHandler end_of_line_handler, StringBuilder *text);
@@ -14,8 +14,14 @@ class HtmlReducer {
  private:
   StringBuilder * const dest_;
   bool is_code_;
-
-  explicit HtmlReducer(StringBuilder *dest) : dest_(dest), is_code_(false) {}
+  bool has_raw_attributes_;
+  StringBuilder value_buf_;
+
+  explicit HtmlReducer(StringBuilder *dest)
+      : dest_(dest),
+        is_code_(false),
+        has_raw_attributes_(false),
+        value_buf_() {}
   ~HtmlReducer() {}
 
   void Reduce(const HtmlDocument &src);
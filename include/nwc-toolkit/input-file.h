@@ -43,6 +43,9 @@ class InputFile {
 
   bool Read(std::size_t size, String *data);
 
+  // Skips `size' bytes without keeping them in the buffer.
+  bool Skip(std::size_t size);
+
   bool ReadLine(String *line) {
     return ReadLine('\n', line);
   }
@@ -0,0 +1,229 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#ifndef NWC_TOOLKIT_METRICS_H_
+#define NWC_TOOLKIT_METRICS_H_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "./string.h"
+
+namespace nwc_toolkit {
+
+// Metrics keeps counters, gauges and histograms of a tool and exports them
+// to a file periodically, so that a job scheduler can watch the progress
+// without reading terminal output. If the path ends with ".prom", the file
+// is replaced with a snapshot in the Prometheus text format (for the
+// textfile collector of node_exporter). Otherwise, a snapshot is appended
+// as a line of JSON. The resident set size, the peak resident set size and
+// the CPU time of the process are always exported.
+//
+// Counters, gauges and histograms can be updated even if the file is not
+// open, so a tool does not need to check whether exporting is enabled.
+// An object is not thread-safe.
+class Metrics {
+ public:
+  enum {
+    DEFAULT_INTERVAL = 10
+  };
+
+  enum Format {
+    JSON_LINES_FORMAT,
+    PROMETHEUS_FORMAT
+  };
+
+  // A counter only increases. Its rate per second since the last snapshot
+  // is exported in JSON.
+  class Counter {
+   public:
+    explicit Counter(const String &name)
+        : name_(name.ptr(), name.length()), value_(0), last_value_(0) {}
+
+    const std::string &name() const {
+      return name_;
+    }
+    long long value() const {
+      return value_;
+    }
+
+    void Add(long long value) {
+      value_ += value;
+    }
+    void Increment() {
+      ++value_;
+    }
+
+   private:
+    friend class Metrics;
+
+    std::string name_;
+    long long value_;
+    long long last_value_;
+
+    // Disallows copy and assignment.
+    Counter(const Counter &);
+    Counter &operator=(const Counter &);
+  };
+
+  // A gauge keeps the latest value, such as the size of a buffer.
+  class Gauge {
+   public:
+    explicit Gauge(const String &name)
+        : name_(name.ptr(), name.length()), value_(0.0) {}
+
+    const std::string &name() const {
+      return name_;
+    }
+    double value() const {
+      return value_;
+    }
+
+    void Set(double value) {
+      value_ = value;
+    }
+
+   private:
+    std::string name_;
+    double value_;
+
+    // Disallows copy and assignment.
+    Gauge(const Gauge &);
+    Gauge &operator=(const Gauge &);
+  };
+
+  // A histogram counts observations, typically the seconds spent on a
+  // stage, in buckets whose upper bounds are 1us, 10us, ..., 100s.
+  class Histogram {
+   public:
+    enum { NUM_BOUNDED_BUCKETS = 9, NUM_BUCKETS = NUM_BOUNDED_BUCKETS + 1 };
+
+    explicit Histogram(const String &name);
+
+    const std::string &name() const {
+      return name_;
+    }
+    long long count() const {
+      return count_;
+    }
+    double sum() const {
+      return sum_;
+    }
+    // Returns the number of observations in the bucket (not cumulative).
+    long long bucket(std::size_t index) const {
+      return buckets_[index];
+    }
+    static double upper_bound(std::size_t index);
+
+    void Observe(double value);
+
+   private:
+    std::string name_;
+    long long count_;
+    double sum_;
+    long long buckets_[NUM_BUCKETS];
+
+    // Disallows copy and assignment.
+    Histogram(const Histogram &);
+    Histogram &operator=(const Histogram &);
+  };
+
+  Metrics();
+  ~Metrics();
+
+  // Starts exporting metrics of `job' to `path' every `interval' seconds.
+  bool Open(const String &job, const String &path, double interval);
+  // Writes the last snapshot and closes the file.
+  void Close();
+
+  bool is_open() const {
+    return !path_.empty();
+  }
+  Format format() const {
+    return format_;
+  }
+
+  // The returned objects are owned by `this' and live until destruction,
+  // so they can be added before Open() or without Open().
+  Counter *AddCounter(const String &name);
+  Gauge *AddGauge(const String &name);
+  Histogram *AddHistogram(const String &name);
+
+  // Writes a snapshot if `interval' seconds have passed since the last one.
+  // This function is cheap enough to be called for every record.
+  bool Update();
+  // Writes a snapshot now.
+  bool Flush();
+
+  // Returns the current time in seconds for measuring stages.
+  static double GetTime();
+
+ private:
+  std::string job_;
+  std::string path_;
+  Format format_;
+  double interval_;
+  double start_time_;
+  double last_time_;
+  std::vector<Counter *> counters_;
+  std::vector<Gauge *> gauges_;
+  std::vector<Histogram *> histograms_;
+
+  bool WriteJsonLine(double now);
+  bool WritePrometheusFile(double now);
+  void WriteProcessStatus(std::FILE *file, bool is_json) const;
+
+  // Disallows copy and assignment.
+  Metrics(const Metrics &);
+  Metrics &operator=(const Metrics &);
+};
+
+// MetricsOptions parses --metrics and --metrics-interval, which are common
+// to the tools that export metrics. A tool adds
+// NWC_TOOLKIT_METRICS_LONG_OPTIONS to its table of long options, passes
+// the values of the options to Parse() and prints help() in its help.
+class MetricsOptions {
+ public:
+  // The values follow those of the long options of tools, which start at
+  // 0x100.
+  enum {
+    METRICS_OPTION = 0x200,
+    METRICS_INTERVAL_OPTION
+  };
+
+  MetricsOptions() : path_(), interval_(Metrics::DEFAULT_INTERVAL) {}
+
+  const String &path() const {
+    return path_;
+  }
+  double interval() const {
+    return interval_;
+  }
+
+  // Returns false if the interval is not a positive number.
+  bool Parse(int option, const char *arg);
+  // Opens `metrics' for `job' if --metrics is given.
+  bool Open(const String &job, Metrics *metrics) const;
+
+  // Returns the help of the options, which is aligned with the other
+  // options at the 24th column.
+  static const char *help();
+
+ private:
+  String path_;
+  double interval_;
+
+  // Disallows copy and assignment.
+  MetricsOptions(const MetricsOptions &);
+  MetricsOptions &operator=(const MetricsOptions &);
+};
+
+}  // namespace nwc_toolkit
+
+// The entries of `struct option' for MetricsOptions.
+#define NWC_TOOLKIT_METRICS_LONG_OPTIONS \
+  { "metrics", 1, NULL, nwc_toolkit::MetricsOptions::METRICS_OPTION }, \
+  { "metrics-interval", 1, NULL, \
+    nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION }
+
+#endif  // NWC_TOOLKIT_METRICS_H_
@@ -0,0 +1,111 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#ifndef NWC_TOOLKIT_MIN_HASH_H_
+#define NWC_TOOLKIT_MIN_HASH_H_
+
+#include <vector>
+
+#include "./string.h"
+
+namespace nwc_toolkit {
+
+// MinHash calculates a signature of a text for finding near-duplicates.
+// White spaces are removed from the text and the rest is split into
+// overlapping shingles of `shingle_size' characters. The signature consists
+// of the minimum values of `num_hashes' hash functions over the shingles,
+// and the probability that two signatures agree on a value is the Jaccard
+// similarity of their shingle sets. The hash functions are evaluated in 8
+// parallel lanes with AVX2 or in 4 lanes with SSE2 if available.
+//
+// For locality-sensitive hashing, the values are grouped into `num_bands'
+// bands of `num_rows' values. Texts which share the key of any band are
+// candidates for near-duplicates, which are found with probability
+// 1 - (1 - s^num_rows)^num_bands for similarity s.
+class MinHash {
+ public:
+  enum {
+    MIN_NUM_BANDS = 1,
+    DEFAULT_NUM_BANDS = 16
+  };
+
+  enum {
+    MIN_NUM_ROWS = 1,
+    DEFAULT_NUM_ROWS = 8
+  };
+
+  enum {
+    MIN_SHINGLE_SIZE = 1,
+    DEFAULT_SHINGLE_SIZE = 5
+  };
+
+  enum { MAX_NUM_HASHES = 1024 };
+
+  MinHash();
+  ~MinHash() {
+    Clear();
+  }
+
+  std::size_t num_bands() const {
+    return num_bands_;
+  }
+  std::size_t num_rows() const {
+    return num_rows_;
+  }
+  std::size_t num_hashes() const {
+    return values_.size();
+  }
+  std::size_t shingle_size() const {
+    return shingle_size_;
+  }
+  // Returns the number of shingles of the last text.
+  std::size_t num_shingles() const {
+    return shingle_hashes_.size();
+  }
+
+  unsigned int value(std::size_t id) const {
+    return values_[id];
+  }
+  // Returns a 64-bit key of the values of a band. Keys of different bands
+  // are different even if the values are the same.
+  unsigned long long band_key(std::size_t band_id) const;
+
+  // Changes the parameters and removes the signature. 0 means the default
+  // value. num_bands * num_rows must not exceed MAX_NUM_HASHES.
+  bool Reset(std::size_t num_bands = 0, std::size_t num_rows = 0,
+      std::size_t shingle_size = 0);
+  void Clear();
+
+  // Calculates the signature of `text' and returns false if `text' has no
+  // characters except white spaces. The hash functions depend only on their
+  // positions in the signature, so signatures calculated by different
+  // objects with the same parameters can be compared.
+  bool Calculate(const String &text);
+
+  // Returns the ratio of the values which agree. `lhs' and `rhs' must have
+  // the same number of hash functions.
+  static double EstimateSimilarity(const MinHash &lhs, const MinHash &rhs);
+  // Compares signatures which are kept out of MinHash, e.g. in a file.
+  static double EstimateSimilarity(const unsigned int *lhs,
+      const unsigned int *rhs, std::size_t num_hashes);
+
+ private:
+  std::size_t num_bands_;
+  std::size_t num_rows_;
+  std::size_t shingle_size_;
+  std::vector<unsigned int> seeds_;
+  std::vector<unsigned int> values_;
+  std::vector<unsigned long long> char_codes_;
+  std::vector<unsigned int> shingle_hashes_;
+
+  void ExtractChars(const String &text);
+  void HashShingles();
+  void UpdateValues();
+
+  // Disallows copy and assignment.
+  MinHash(const MinHash &);
+  MinHash &operator=(const MinHash &);
+};
+
+}  // namespace nwc_toolkit
+
+#endif  // NWC_TOOLKIT_MIN_HASH_H_
@@ -9,6 +9,19 @@ namespace nwc_toolkit {
 
 class Sha1Digest {
  public:
+  // Kernels to process 64-byte blocks. AUTO_KERNEL chooses the fastest one
+  // which the CPU supports when the program starts. SHA_KERNEL uses the SHA
+  // extensions of x86. SSE2_KERNEL and AVX2_KERNEL process the messages of
+  // Calculate() in 4 and 8 parallel lanes respectively, and otherwise work
+  // as GENERIC_KERNEL. All the kernels give the same digests.
+  enum Kernel {
+    AUTO_KERNEL,
+    GENERIC_KERNEL,
+    SSE2_KERNEL,
+    AVX2_KERNEL,
+    SHA_KERNEL
+  };
+
   Sha1Digest();
   ~Sha1Digest() {}
 
@@ -26,13 +39,29 @@ class Sha1Digest {
   void Append(const String &message);
   void Finish();
 
+  // Calculates the digests of `num_messages' messages at once, which is
+  // faster than one by one if the kernel has parallel lanes. `digests[i]'
+  // is the same as the result of Append(messages[i]) and Finish().
+  static void Calculate(const String *messages, std::size_t num_messages,
+      Sha1Digest *digests);
+
+  // Returns the kernel in use, which is never AUTO_KERNEL.
+  static Kernel kernel();
+  // Changes the kernel for all the objects and returns false if the CPU
+  // does not support `kernel'. This function is not thread-safe.
+  static bool set_kernel(Kernel kernel);
+
  private:
   unsigned int digest_[5];
   char hex_digest_[40];
   unsigned long long length_;
   unsigned char block_[64];
 
-  void ProcessBlock();
+  void ProcessBlocks(const unsigned char *blocks, std::size_t num_blocks);
+  void EncodeHexDigest();
+
+  static void ProcessBlock(unsigned int *digest,
+      const unsigned char *block);
 
   inline static unsigned int Shift(int num_bits, unsigned int word);
   inline static char ToHex(unsigned int value);
@@ -0,0 +1,89 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#ifndef NWC_TOOLKIT_SORTED_STRING_SET_H_
+#define NWC_TOOLKIT_SORTED_STRING_SET_H_
+
+#include <tr1/unordered_set>
+#include <vector>
+
+#include "./string-hash.h"
+#include "./string-pool.h"
+
+namespace nwc_toolkit {
+
+// SortedStringSet is a set of strings which is kept in a file across
+// processes. The file has one string per line in byte order, which is the
+// output of `LC_ALL=C sort -u', so files of parallel runs can be merged by
+// `LC_ALL=C sort -mu'. Strings must not contain '\n'.
+//
+// The file is memory-mapped and searched in place, so only a blocked bloom
+// filter of about BITS_PER_STRING bits per string is kept in memory, and
+// most strings which are not in the file are rejected without touching the
+// file. Strings inserted after Open() are kept in memory until Save().
+// Contains() does not modify the set, so it can be called from multiple
+// threads without locks as long as Insert() is not called at the same time.
+class SortedStringSet {
+ public:
+  enum { BITS_PER_STRING = 10 };
+
+  SortedStringSet();
+  ~SortedStringSet() {
+    Close();
+  }
+
+  // Returns the number of strings in the file and those inserted.
+  std::size_t num_strings() const {
+    return num_file_strings_ + new_strings_.size();
+  }
+  std::size_t num_file_strings() const {
+    return num_file_strings_;
+  }
+  std::size_t num_new_strings() const {
+    return new_strings_.size();
+  }
+
+  // Maps a file and builds its bloom filter. Returns false if the file is
+  // not available or its lines are not sorted and unique.
+  bool Open(const String &path);
+  // Unmaps the file and removes all strings.
+  void Close();
+
+  bool Contains(const String &str) const {
+    return FileContains(str) ||
+        (new_strings_.find(str) != new_strings_.end());
+  }
+  // Inserts a string and returns true if it is new.
+  bool Insert(const String &str);
+
+  // Writes the strings in the file and those inserted to `path' in byte
+  // order. The file is written to a temporary file and then renamed, so
+  // `path' may be the file opened by Open().
+  bool Save(const String &path) const;
+
+ private:
+  enum {
+    BLOCK_SIZE = 8,
+    NUM_PROBES = 7,
+    PROBE_BITS = 9
+  };
+
+  const char *file_;
+  std::size_t file_size_;
+  std::size_t num_file_strings_;
+  std::vector<unsigned long long> filter_;
+  StringPool pool_;
+  std::tr1::unordered_set<String, StringHash> new_strings_;
+
+  bool FileContains(const String &str) const;
+  bool FilterContains(const String &str) const;
+  void AddToFilter(const String &str);
+  bool BuildFilter();
+
+  // Disallows copy and assignment.
+  SortedStringSet(const SortedStringSet &);
+  SortedStringSet &operator=(const SortedStringSet &);
+};
+
+}  // namespace nwc_toolkit
+
+#endif  // NWC_TOOLKIT_SORTED_STRING_SET_H_
@@ -0,0 +1,75 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#ifndef NWC_TOOLKIT_SPILL_FILE_H_
+#define NWC_TOOLKIT_SPILL_FILE_H_
+
+#include <cstdio>
+
+#include "./string-builder.h"
+
+namespace nwc_toolkit {
+
+// SpillFile is a temporary file of records which do not fit in memory. A
+// record is a pair of a key, such as a hash value, and a value. The file is
+// removed as soon as it is created, so it never remains after exit.
+//
+// Records whose hash values do not fit in a set are usually split into
+// NUM_PARTITIONS files by PARTITION_BITS bits of the hash values, and each
+// file is processed in the same way with the next bits. A hash value goes
+// to the same partition at any time, so the first record of each hash value
+// is still the first one in its partition.
+class SpillFile {
+ public:
+  enum {
+    PARTITION_BITS = 4,
+    NUM_PARTITIONS = 1 << PARTITION_BITS,
+    MAX_NUM_LEVELS = 64 / PARTITION_BITS
+  };
+
+  SpillFile() : file_(NULL), has_error_(false) {}
+  ~SpillFile() {
+    Close();
+  }
+
+  // Creates a file in `directory', or in $TMPDIR or /tmp if `directory' is
+  // empty.
+  bool Open(const String &directory);
+  void Close();
+
+  bool is_open() const {
+    return file_ != NULL;
+  }
+  // Returns true if a record has failed to be written or read.
+  bool has_error() const {
+    return has_error_;
+  }
+
+  bool Write(const String &key, const String &value);
+  // Flushes the written records and moves to the beginning of the file.
+  bool Rewind();
+  // Reads a record and returns true, or returns false at the end of the
+  // file or on error.
+  bool Read(StringBuilder *key, StringBuilder *value);
+
+  // Returns the partition of `hash_value' at `level', which starts from 0.
+  static std::size_t GetPartitionID(unsigned long long hash_value,
+      int level) {
+    return static_cast<std::size_t>(
+        hash_value >> (64 - (PARTITION_BITS * (level + 1)))) &
+        (NUM_PARTITIONS - 1);
+  }
+
+ private:
+  std::FILE *file_;
+  bool has_error_;
+
+  bool ReadString(StringBuilder *str);
+
+  // Disallows copy and assignment.
+  SpillFile(const SpillFile &);
+  SpillFile &operator=(const SpillFile &);
+};
+
+}  // namespace nwc_toolkit
+
+#endif  // NWC_TOOLKIT_SPILL_FILE_H_
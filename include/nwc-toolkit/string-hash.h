@@ -19,6 +19,17 @@ class StringHash {
   }
 };
 
+// StringHash64 returns a 64-bit hash value, which is used as a fingerprint
+// of a string. Bytes are read in little-endian order on every platform, so
+// fingerprints can be saved and compared across machines.
+class StringHash64 {
+ public:
+  unsigned long long operator()(const String &str) const;
+
+ private:
+  static unsigned long long ToUInt64(const char *ptr, std::size_t length);
+};
+
 // http://burtleburtle.net/bob/hash/doobs.html
 inline unsigned int StringHash::operator()(const String &str) const {
   unsigned int x = 0x9E3779B9U;
@@ -80,6 +91,45 @@ inline void StringHash::Mix(unsigned int &x, unsigned int &y,
   z -= x; z -= y; z ^= (y >> 15);
 }
 
+// MurmurHash64A: http://sites.google.com/site/murmurhash/
+inline unsigned long long StringHash64::operator()(const String &str) const {
+  const unsigned long long MULTIPLIER = 0xC6A4A7935BD1E995ULL;
+  const int SHIFT = 47;
+
+  unsigned long long h = 0x9E3779B97F4A7C15ULL ^ (str.length() * MULTIPLIER);
+
+  std::size_t num_blocks = str.length() / 8;
+  for (std::size_t i = 0; i < num_blocks; ++i) {
+    unsigned long long k = ToUInt64(str.ptr() + (i * 8), 8);
+    k *= MULTIPLIER;
+    k ^= k >> SHIFT;
+    k *= MULTIPLIER;
+    h ^= k;
+    h *= MULTIPLIER;
+  }
+
+  std::size_t tail_length = str.length() % 8;
+  if (tail_length != 0) {
+    h ^= ToUInt64(str.ptr() + (num_blocks * 8), tail_length);
+    h *= MULTIPLIER;
+  }
+
+  h ^= h >> SHIFT;
+  h *= MULTIPLIER;
+  h ^= h >> SHIFT;
+  return h;
+}
+
+inline unsigned long long StringHash64::ToUInt64(const char *ptr,
+    std::size_t length) {
+  unsigned long long value = 0;
+  for (std::size_t i = 0; i < length; ++i) {
+    value |= static_cast<unsigned long long>(
+        static_cast<unsigned char>(ptr[i])) << (i * 8);
+  }
+  return value;
+}
+
 }  // namespace nwc_toolkit
 
 #endif  // NWC_TOOLKIT_STRING_HASH_H_
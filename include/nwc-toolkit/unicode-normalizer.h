@@ -3,10 +3,18 @@
 #ifndef NWC_TOOLKIT_UNICODE_NORMALIZER_H_
 #define NWC_TOOLKIT_UNICODE_NORMALIZER_H_
 
+#include <unicode/normalizer2.h>
+#include <unicode/ucnv.h>
+#include <unicode/unistr.h>
+
 #include "./string-builder.h"
 
 namespace nwc_toolkit {
 
+// UnicodeNormalizer keeps an ICU normalizer for a normalization form and
+// buffers for conversion, so that normalization of many strings does not
+// allocate memory once the buffers are large enough. An object is not
+// thread-safe but objects can be used in different threads.
 class UnicodeNormalizer {
  public:
   // C = Composition, D = Comonposition, K = Compatibility.
@@ -26,6 +34,26 @@ class UnicodeNormalizer {
     DEFAULT_HANDLER = KEEP_REPLACEMENT_CHARACTERS
   };
 
+  UnicodeNormalizer();
+  ~UnicodeNormalizer() {
+    Close();
+  }
+
+  bool Open(NormalizationForm form) {
+    return Open(form, DEFAULT_HANDLER);
+  }
+  bool Open(NormalizationForm form,
+      IllegalInputHandler illegal_input_handler);
+  void Close();
+
+  bool is_open() const {
+    return normalizer_ != NULL;
+  }
+
+  // Normalizes `src' and appends the result to `dest'.
+  bool Normalize(const String &src, StringBuilder *dest);
+
+  // Normalize() with a temporary object.
   static bool Normalize(NormalizationForm form,
       const String &src, StringBuilder *dest) {
     return Normalize(form, KEEP_REPLACEMENT_CHARACTERS, src, dest);
@@ -35,8 +63,19 @@ class UnicodeNormalizer {
       const String &src, StringBuilder *dest);
 
  private:
-  // Disallows object creation.
-  UnicodeNormalizer();
+  const icu::Normalizer2 *normalizer_;
+  ::UConverter *converter_;
+  ::UProperty quick_check_property_;
+  IllegalInputHandler illegal_input_handler_;
+  icu::UnicodeString unicode_src_;
+  icu::UnicodeString unicode_dest_;
+
+  bool IsStableChar(::UChar32 c) const;
+  bool NormalizeSegment(const String &src, StringBuilder *dest);
+
+  // Disallows copy and assignment.
+  UnicodeNormalizer(const UnicodeNormalizer &);
+  UnicodeNormalizer &operator=(const UnicodeNormalizer &);
 };
 
 }  // namespace nwc_toolkit
@@ -0,0 +1,311 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#ifndef NWC_TOOLKIT_WORKER_POOL_H_
+#define NWC_TOOLKIT_WORKER_POOL_H_
+
+#include <pthread.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "./string-builder.h"
+
+namespace nwc_toolkit {
+
+// WorkerPool processes jobs in worker threads and returns them in the order
+// of submission. Each thread has its own `Worker', which is default
+// constructed in the thread and called as `worker(&job)'. The jobs are
+// allocated in a ring of `max_num_jobs', which bounds memory usage, and the
+// owner fills and reuses them as follows:
+//
+//  Job *job = pool.AcquireJob();
+//  ... fill `job' ...
+//  pool.SubmitJob();
+//  if (pool.is_full()) {
+//    job = pool.WaitForJob();
+//    ... write the result of `job' ...
+//    pool.ReleaseJob();
+//  }
+//
+// AcquireJob(), SubmitJob(), WaitForJob() and ReleaseJob() must be called
+// from one thread.
+template <typename Job, typename Worker>
+class WorkerPool {
+ public:
+  WorkerPool()
+      : jobs_(NULL),
+        is_done_(NULL),
+        max_num_jobs_(0),
+        num_submitted_jobs_(0),
+        num_started_jobs_(0),
+        num_released_jobs_(0),
+        is_closing_(false),
+        threads_(),
+        mutex_(),
+        job_cond_(),
+        done_cond_() {
+    ::pthread_mutex_init(&mutex_, NULL);
+    ::pthread_cond_init(&job_cond_, NULL);
+    ::pthread_cond_init(&done_cond_, NULL);
+  }
+  ~WorkerPool() {
+    Close();
+    ::pthread_cond_destroy(&done_cond_);
+    ::pthread_cond_destroy(&job_cond_);
+    ::pthread_mutex_destroy(&mutex_);
+  }
+
+  // Starts `num_threads' worker threads. By default, the number of jobs is
+  // twice the number of threads.
+  bool Open(std::size_t num_threads) {
+    return Open(num_threads, num_threads * 2);
+  }
+  bool Open(std::size_t num_threads, std::size_t max_num_jobs);
+  // Waits for the submitted jobs and stops the worker threads.
+  void Close();
+
+  bool is_open() const {
+    return jobs_ != NULL;
+  }
+  std::size_t num_threads() const {
+    return threads_.size();
+  }
+  std::size_t max_num_jobs() const {
+    return max_num_jobs_;
+  }
+  // Returns the number of jobs which have been submitted but not released.
+  std::size_t num_jobs() const {
+    return static_cast<std::size_t>(num_submitted_jobs_ - num_released_jobs_);
+  }
+  bool is_empty() const {
+    return num_jobs() == 0;
+  }
+  bool is_full() const {
+    return num_jobs() == max_num_jobs_;
+  }
+
+  // Returns the job to be submitted next. The pool must not be full.
+  Job *AcquireJob() {
+    return &jobs_[num_submitted_jobs_ % max_num_jobs_];
+  }
+  // Submits the job returned by AcquireJob().
+  void SubmitJob();
+  // Waits for the oldest unreleased job and returns it.
+  Job *WaitForJob();
+  // Releases the job returned by WaitForJob() for reuse.
+  void ReleaseJob();
+
+ private:
+  Job *jobs_;
+  bool *is_done_;
+  std::size_t max_num_jobs_;
+  unsigned long long num_submitted_jobs_;
+  unsigned long long num_started_jobs_;
+  unsigned long long num_released_jobs_;
+  bool is_closing_;
+  std::vector< ::pthread_t> threads_;
+  ::pthread_mutex_t mutex_;
+  ::pthread_cond_t job_cond_;
+  ::pthread_cond_t done_cond_;
+
+  void Run();
+
+  static void *RunThread(void *pool) {
+    static_cast<WorkerPool *>(pool)->Run();
+    return NULL;
+  }
+
+  // Disallows copy and assignment.
+  WorkerPool(const WorkerPool &);
+  WorkerPool &operator=(const WorkerPool &);
+};
+
+template <typename Job, typename Worker>
+bool WorkerPool<Job, Worker>::Open(std::size_t num_threads,
+    std::size_t max_num_jobs) {
+  Close();
+  if ((num_threads == 0) || (max_num_jobs == 0)) {
+    return false;
+  }
+
+  jobs_ = new Job[max_num_jobs];
+  is_done_ = new bool[max_num_jobs];
+  max_num_jobs_ = max_num_jobs;
+  num_submitted_jobs_ = num_started_jobs_ = num_released_jobs_ = 0;
+  is_closing_ = false;
+
+  for (std::size_t i = 0; i < num_threads; ++i) {
+    ::pthread_t thread;
+    if (::pthread_create(&thread, NULL, RunThread, this) != 0) {
+      Close();
+      return false;
+    }
+    threads_.push_back(thread);
+  }
+  return true;
+}
+
+template <typename Job, typename Worker>
+void WorkerPool<Job, Worker>::Close() {
+  ::pthread_mutex_lock(&mutex_);
+  is_closing_ = true;
+  ::pthread_cond_broadcast(&job_cond_);
+  ::pthread_mutex_unlock(&mutex_);
+
+  for (std::size_t i = 0; i < threads_.size(); ++i) {
+    ::pthread_join(threads_[i], NULL);
+  }
+  threads_.clear();
+
+  delete [] jobs_;
+  jobs_ = NULL;
+  delete [] is_done_;
+  is_done_ = NULL;
+  max_num_jobs_ = 0;
+  num_submitted_jobs_ = num_started_jobs_ = num_released_jobs_ = 0;
+}
+
+template <typename Job, typename Worker>
+void WorkerPool<Job, Worker>::SubmitJob() {
+  ::pthread_mutex_lock(&mutex_);
+  is_done_[num_submitted_jobs_ % max_num_jobs_] = false;
+  ++num_submitted_jobs_;
+  ::pthread_cond_signal(&job_cond_);
+  ::pthread_mutex_unlock(&mutex_);
+}
+
+template <typename Job, typename Worker>
+Job *WorkerPool<Job, Worker>::WaitForJob() {
+  std::size_t index = num_released_jobs_ % max_num_jobs_;
+  ::pthread_mutex_lock(&mutex_);
+  while (!is_done_[index]) {
+    ::pthread_cond_wait(&done_cond_, &mutex_);
+  }
+  ::pthread_mutex_unlock(&mutex_);
+  return &jobs_[index];
+}
+
+template <typename Job, typename Worker>
+void WorkerPool<Job, Worker>::ReleaseJob() {
+  ::pthread_mutex_lock(&mutex_);
+  ++num_released_jobs_;
+  ::pthread_mutex_unlock(&mutex_);
+}
+
+// Submitted jobs are processed even after Close() is called.
+template <typename Job, typename Worker>
+void WorkerPool<Job, Worker>::Run() {
+  Worker worker;
+  ::pthread_mutex_lock(&mutex_);
+  for ( ; ; ) {
+    while ((num_started_jobs_ == num_submitted_jobs_) && !is_closing_) {
+      ::pthread_cond_wait(&job_cond_, &mutex_);
+    }
+    if (num_started_jobs_ == num_submitted_jobs_) {
+      break;
+    }
+    std::size_t index = num_started_jobs_++ % max_num_jobs_;
+    ::pthread_mutex_unlock(&mutex_);
+
+    worker(&jobs_[index]);
+
+    ::pthread_mutex_lock(&mutex_);
+    is_done_[index] = true;
+    ::pthread_cond_broadcast(&done_cond_);
+  }
+  ::pthread_mutex_unlock(&mutex_);
+}
+
+// EntryBatch is a job of archive entries, which are read by
+// `Entry::Read()'. A batch is closed when it has MAX_NUM_ENTRIES entries or
+// their bodies reach BODY_THRESHOLD bytes. Tools derive their batches from
+// EntryBatch and add the fields for results.
+template <typename Entry, std::size_t MAX_NUM_ENTRIES,
+    std::size_t BODY_THRESHOLD>
+struct EntryBatch {
+  EntryBatch() : entries(), num_entries(0) {}
+
+  // Returns false if no entry is read.
+  template <typename Input>
+  bool Read(Input *input) {
+    num_entries = 0;
+    std::size_t total_body_length = 0;
+    while ((num_entries < MAX_NUM_ENTRIES) &&
+        (total_body_length < BODY_THRESHOLD)) {
+      if (!entries[num_entries].Read(input)) {
+        break;
+      }
+      total_body_length += entries[num_entries].body().length();
+      ++num_entries;
+    }
+    return num_entries != 0;
+  }
+
+  Entry entries[MAX_NUM_ENTRIES];
+  std::size_t num_entries;
+};
+
+// LineChunk is a job of complete lines, which are read until the chunk
+// reaches THRESHOLD bytes, so chunks are processed independently and their
+// results are simply concatenated.
+template <std::size_t THRESHOLD>
+struct LineChunk {
+  LineChunk() : src() {}
+
+  // Returns false if no line is read.
+  template <typename Input>
+  bool Read(Input *input) {
+    src.Clear();
+    String line;
+    while (input->ReadLine(&line)) {
+      src.Append(line);
+      if (src.length() >= THRESHOLD) {
+        break;
+      }
+    }
+    return !src.is_empty();
+  }
+
+  StringBuilder src;
+};
+
+// ProcessJobsInOrder() reads jobs by `job->Read(input)' until it returns
+// false, processes them by `Worker' and passes them to `(*writer)(job)' in
+// input order. The jobs are processed in the calling thread if
+// `num_threads' is 1, and in a pool of `num_threads' threads otherwise,
+// which keeps at most 2 * num_threads jobs in memory. Returns false if the
+// threads cannot be started.
+template <typename Job, typename Worker, typename Input, typename Writer>
+bool ProcessJobsInOrder(Input *input, Writer *writer,
+    std::size_t num_threads) {
+  if (num_threads == 1) {
+    Worker worker;
+    Job job;
+    while (job.Read(input)) {
+      worker(&job);
+      (*writer)(&job);
+    }
+    return true;
+  }
+
+  WorkerPool<Job, Worker> pool;
+  if (!pool.Open(num_threads)) {
+    return false;
+  }
+  while (pool.AcquireJob()->Read(input)) {
+    pool.SubmitJob();
+    if (pool.is_full()) {
+      (*writer)(pool.WaitForJob());
+      pool.ReleaseJob();
+    }
+  }
+  while (!pool.is_empty()) {
+    (*writer)(pool.WaitForJob());
+    pool.ReleaseJob();
+  }
+  return true;
+}
+
+}  // namespace nwc_toolkit
+
+#endif  // NWC_TOOLKIT_WORKER_POOL_H_
@@ -2,131 +2,219 @@
 
 #include <nwc-toolkit/cetr-cluster.h>
 
-namespace nwc_toolkit {
-
-void CetrCluster::Cluster(const std::vector<CetrPoint> &points,
-    std::vector<int> *clusters, int num_clusters,
-    int num_tries, int num_steps) {
-  if (num_clusters < MIN_NUM_CLUSTERS) {
-    num_clusters = DEFAULT_NUM_CLUSTERS;
-  }
-  if (num_tries < MIN_NUM_TRIES) {
-    num_tries = DEFAULT_NUM_TRIES;
-  }
-  if (num_steps < MIN_NUM_STEPS) {
-    num_steps = DEFAULT_NUM_STEPS;
-  }
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif  // __SSE2__
 
-  CetrCluster clustering_module(num_clusters, num_tries, num_steps);
-  clustering_module.Do(points, clusters);
-}
+namespace nwc_toolkit {
 
-CetrCluster::CetrCluster(int num_clusters, int num_tries, int num_steps)
-    : num_clusters_(num_clusters),
-      num_tries_(num_tries),
-      num_steps_(num_steps),
+CetrCluster::CetrCluster()
+    : num_clusters_(DEFAULT_NUM_CLUSTERS),
+      num_tries_(DEFAULT_NUM_TRIES),
+      num_steps_(DEFAULT_NUM_STEPS),
       mt_(),
+      xs_(),
+      ys_(),
+      centroid_xs_(),
+      centroid_ys_(),
       clusters_(),
-      centroids_(),
+      sq_dists_(),
+      sum_xs_(),
+      sum_ys_(),
       numbers_() {}
 
-void CetrCluster::Clear() {
-  clusters_.clear();
-  centroids_.clear();
-  numbers_.clear();
+void CetrCluster::Run(const std::vector<CetrPoint> &points,
+    std::vector<int> *clusters, int num_clusters,
+    int num_tries, int num_steps, unsigned int seed) {
+  num_clusters_ = (num_clusters >= MIN_NUM_CLUSTERS)
+      ? num_clusters : DEFAULT_NUM_CLUSTERS;
+  num_tries_ = (num_tries >= MIN_NUM_TRIES) ? num_tries : DEFAULT_NUM_TRIES;
+  num_steps_ = (num_steps >= MIN_NUM_STEPS) ? num_steps : DEFAULT_NUM_STEPS;
+  mt_.seed(seed);
+
+  Do(points, clusters);
 }
 
 void CetrCluster::Do(const std::vector<CetrPoint> &points,
     std::vector<int> *clusters) {
-  double min_total_sq_dist = 1.0 * (1 << 30);
+  xs_.resize(points.size());
+  ys_.resize(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    xs_[i] = points[i].x();
+    ys_[i] = points[i].y();
+  }
+
+  clusters->assign(points.size(), 0);
+  double min_total_sq_dist = 0.0;
   for (int i = 0; i < num_tries_; ++i) {
+    SeedCentroids();
+    clusters_.assign(points.size(), -1);
     double total_sq_dist;
-    UpdateClusters(points, &total_sq_dist);
-    for (int i = 0; i < num_steps_; ++i) {
-      UpdateCentroids(points);
-      double last_total_sq_dist = total_sq_dist;
-      UpdateClusters(points, &total_sq_dist);
-      if (total_sq_dist == last_total_sq_dist) {
+    UpdateClusters(&total_sq_dist);
+    for (int j = 0; j < num_steps_; ++j) {
+      UpdateCentroids();
+      if (!UpdateClusters(&total_sq_dist)) {
         break;
       }
     }
-    if (total_sq_dist < min_total_sq_dist) {
-      *clusters = clusters_;
+    if ((i == 0) || (total_sq_dist < min_total_sq_dist)) {
+      clusters->swap(clusters_);
       min_total_sq_dist = total_sq_dist;
     }
-    Clear();
   }
 }
 
-void CetrCluster::UpdateClusters(const std::vector<CetrPoint> &points,
-    double *total_sq_dist) {
-  clusters_.resize(points.size());
-  if (centroids_.empty()) {
-    centroids_.resize(num_clusters_);
-    numbers_.resize(num_clusters_);
-    for (std::size_t i = 0; i < points.size(); ++i) {
-      int cluster = static_cast<int>(mt_() % num_clusters_);
-      clusters_[i] = cluster;
-      ++numbers_[cluster];
-    }
-    *total_sq_dist = 1.0 * (1 << 29);
-  } else {
-    for (std::size_t i = 0; i < numbers_.size(); ++i) {
-      numbers_[i] = 0;
+// k-means++ chooses each centroid from the points with probability
+// proportional to the squared distance to the closest chosen centroid. The
+// fixed centroid at the origin is regarded as chosen first. Like greedy
+// k-means++, several candidates are sampled for each centroid and the one
+// that minimizes the total squared distance is chosen.
+void CetrCluster::SeedCentroids() {
+  centroid_xs_.assign(num_clusters_, 0.0);
+  centroid_ys_.assign(num_clusters_, 0.0);
+
+  sq_dists_.resize(xs_.size());
+  double total_sq_dist = 0.0;
+  for (std::size_t i = 0; i < xs_.size(); ++i) {
+    sq_dists_[i] = (xs_[i] * xs_[i]) + (ys_[i] * ys_[i]);
+    total_sq_dist += sq_dists_[i];
+  }
+
+  for (int i = 1; i < num_clusters_; ++i) {
+    if (!(total_sq_dist > 0.0)) {
+      // All the points are on the chosen centroids.
+      break;
     }
-    *total_sq_dist = 0.0;
-    for (std::size_t i = 0; i < points.size(); ++i) {
-      int closest_cluster = 0;
-      double min_sq_dist = 1.0 * (1 << 29);
-      for (std::size_t j = 0; j < centroids_.size(); ++j) {
-        double x_diff = points[i].x() - centroids_[j].x();
-        double y_diff = points[i].y() - centroids_[j].y();
+    std::size_t best_point_id = 0;
+    double min_total_sq_dist = 0.0;
+    for (int j = 0; j < NUM_SEEDING_CANDIDATES; ++j) {
+      std::size_t point_id = ChooseSeed(total_sq_dist);
+      double candidate_total_sq_dist = 0.0;
+      for (std::size_t k = 0; k < xs_.size(); ++k) {
+        double x_diff = xs_[k] - xs_[point_id];
+        double y_diff = ys_[k] - ys_[point_id];
         double sq_dist = (x_diff * x_diff) + (y_diff * y_diff);
-        if (sq_dist < min_sq_dist) {
-          closest_cluster = j;
-          min_sq_dist = sq_dist;
-        }
+        candidate_total_sq_dist +=
+            (sq_dist < sq_dists_[k]) ? sq_dist : sq_dists_[k];
+      }
+      if ((j == 0) || (candidate_total_sq_dist < min_total_sq_dist)) {
+        best_point_id = point_id;
+        min_total_sq_dist = candidate_total_sq_dist;
       }
-      *total_sq_dist += min_sq_dist;
-      clusters_[i] = closest_cluster;
-      ++numbers_[clusters_[i]];
+    }
+    centroid_xs_[i] = xs_[best_point_id];
+    centroid_ys_[i] = ys_[best_point_id];
+
+    total_sq_dist = 0.0;
+    for (std::size_t j = 0; j < xs_.size(); ++j) {
+      double x_diff = xs_[j] - centroid_xs_[i];
+      double y_diff = ys_[j] - centroid_ys_[i];
+      double sq_dist = (x_diff * x_diff) + (y_diff * y_diff);
+      if (sq_dist < sq_dists_[j]) {
+        sq_dists_[j] = sq_dist;
+      }
+      total_sq_dist += sq_dists_[j];
     }
   }
 }
 
-void CetrCluster::UpdateCentroids(const std::vector<CetrPoint> &points) {
-  centroids_.resize(num_clusters_);
-  for (std::size_t i = 0; i < centroids_.size(); ++i) {
-    centroids_[i].set_x(0.0);
-    centroids_[i].set_y(0.0);
+// Samples a point with probability proportional to its squared distance to
+// the closest chosen centroid.
+std::size_t CetrCluster::ChooseSeed(double total_sq_dist) {
+  double threshold = total_sq_dist * mt_() / (1.0 + mt_.max());
+  std::size_t point_id = 0;
+  for ( ; point_id + 1 < xs_.size(); ++point_id) {
+    threshold -= sq_dists_[point_id];
+    if (threshold < 0.0) {
+      break;
+    }
   }
-  for (std::size_t i = 0; i < points.size(); ++i) {
-    centroids_[clusters_[i]].set_x(
-        centroids_[clusters_[i]].x() + points[i].x());
-    centroids_[clusters_[i]].set_y(
-        centroids_[clusters_[i]].y() + points[i].y());
+  return point_id;
+}
+
+// Assigns each point to the closest centroid, where a tie is broken by the
+// smaller cluster ID, and returns whether any point has changed its cluster.
+bool CetrCluster::UpdateClusters(double *total_sq_dist) {
+  bool is_changed = false;
+  *total_sq_dist = 0.0;
+
+  std::size_t i = 0;
+#ifdef __SSE2__
+  __m128d sum = _mm_setzero_pd();
+  for ( ; i + 2 <= xs_.size(); i += 2) {
+    __m128d x = _mm_loadu_pd(&xs_[i]);
+    __m128d y = _mm_loadu_pd(&ys_[i]);
+    __m128d x_diff = _mm_sub_pd(x, _mm_set1_pd(centroid_xs_[0]));
+    __m128d y_diff = _mm_sub_pd(y, _mm_set1_pd(centroid_ys_[0]));
+    __m128d min_sq_dist = _mm_add_pd(_mm_mul_pd(x_diff, x_diff),
+        _mm_mul_pd(y_diff, y_diff));
+    __m128d closest_cluster = _mm_setzero_pd();
+    for (int j = 1; j < num_clusters_; ++j) {
+      x_diff = _mm_sub_pd(x, _mm_set1_pd(centroid_xs_[j]));
+      y_diff = _mm_sub_pd(y, _mm_set1_pd(centroid_ys_[j]));
+      __m128d sq_dist = _mm_add_pd(_mm_mul_pd(x_diff, x_diff),
+          _mm_mul_pd(y_diff, y_diff));
+      __m128d is_closer = _mm_cmplt_pd(sq_dist, min_sq_dist);
+      min_sq_dist = _mm_or_pd(_mm_and_pd(is_closer, sq_dist),
+          _mm_andnot_pd(is_closer, min_sq_dist));
+      closest_cluster = _mm_or_pd(_mm_and_pd(is_closer, _mm_set1_pd(j)),
+          _mm_andnot_pd(is_closer, closest_cluster));
+    }
+    sum = _mm_add_pd(sum, min_sq_dist);
+
+    double closest_clusters[2];
+    _mm_storeu_pd(closest_clusters, closest_cluster);
+    for (int j = 0; j < 2; ++j) {
+      int cluster = static_cast<int>(closest_clusters[j]);
+      if (clusters_[i + j] != cluster) {
+        clusters_[i + j] = cluster;
+        is_changed = true;
+      }
+    }
   }
-  for (std::size_t i = 0; i < centroids_.size(); ++i) {
-    if (numbers_[i] != 0.0) {
-      centroids_[i].set_x(centroids_[i].x() / numbers_[i]);
-      centroids_[i].set_y(centroids_[i].y() / numbers_[i]);
+  double sums[2];
+  _mm_storeu_pd(sums, sum);
+  *total_sq_dist = sums[0] + sums[1];
+#endif  // __SSE2__
+
+  for ( ; i < xs_.size(); ++i) {
+    int closest_cluster = 0;
+    double min_sq_dist = 0.0;
+    for (int j = 0; j < num_clusters_; ++j) {
+      double x_diff = xs_[i] - centroid_xs_[j];
+      double y_diff = ys_[i] - centroid_ys_[j];
+      double sq_dist = (x_diff * x_diff) + (y_diff * y_diff);
+      if ((j == 0) || (sq_dist < min_sq_dist)) {
+        closest_cluster = j;
+        min_sq_dist = sq_dist;
+      }
+    }
+    *total_sq_dist += min_sq_dist;
+    if (clusters_[i] != closest_cluster) {
+      clusters_[i] = closest_cluster;
+      is_changed = true;
     }
   }
+  return is_changed;
+}
 
-  std::size_t origin_id = 0;
-  double min_sq_dist = 1.0 * (1 << 29);
-  for (std::size_t i = 0; i < centroids_.size(); ++i) {
-    double x_diff = centroids_[i].x();
-    double y_diff = centroids_[i].y();
-    double sq_dist = (x_diff * x_diff) + (y_diff * y_diff);
-    min_sq_dist = centroids_[i].x() * centroids_[i].x();
-    if (sq_dist < min_sq_dist) {
-      origin_id = i;
-      min_sq_dist = sq_dist;
+// Moves each centroid except the fixed one to the mean of its points. The
+// centroid of an empty cluster is left as is.
+void CetrCluster::UpdateCentroids() {
+  sum_xs_.assign(num_clusters_, 0.0);
+  sum_ys_.assign(num_clusters_, 0.0);
+  numbers_.assign(num_clusters_, 0);
+  for (std::size_t i = 0; i < xs_.size(); ++i) {
+    sum_xs_[clusters_[i]] += xs_[i];
+    sum_ys_[clusters_[i]] += ys_[i];
+    ++numbers_[clusters_[i]];
+  }
+  for (int i = 1; i < num_clusters_; ++i) {
+    if (numbers_[i] != 0) {
+      centroid_xs_[i] = sum_xs_[i] / numbers_[i];
+      centroid_ys_[i] = sum_ys_[i] / numbers_[i];
     }
   }
-  centroids_[origin_id].set_x(0.0);
-  centroids_[origin_id].set_y(0.0);
 }
 
 }  // namespace nwc_toolkit
@@ -2,11 +2,103 @@
 
 #include <nwc-toolkit/cetr-document.h>
 
+#include <algorithm>
 #include <cmath>
 
-#include <nwc-toolkit/cetr-cluster.h>
-
 namespace nwc_toolkit {
+namespace {
+
+// FAST_SMOOTHING approximates a kernel by a polynomial of (k / sd)^2 of
+// this degree, where k is the distance from the center and sd is the
+// standard deviation. Then, a smoothed value is a linear combination of
+// the moments of the values in the window, which are updated in constant
+// time when the window slides.
+enum {
+  FAST_SMOOTHING_DEGREE = 3,
+  NUM_MOMENTS = (FAST_SMOOTHING_DEGREE * 2) + 1
+};
+
+// A small kernel is convolved as is because it is faster.
+enum { MAX_EXACT_SMOOTHING_RADIUS = 32 };
+
+// Fits a polynomial of (k / sd)^2 to kernel[k] (0 <= k <= radius) by least
+// squares, where kernel[k] is used for both k and -k.
+void FitKernelPolynomial(const double *kernel, int radius,
+    double standard_derivation, double *coefficients) {
+  enum { NUM_COEFFICIENTS = FAST_SMOOTHING_DEGREE + 1 };
+
+  double matrix[NUM_COEFFICIENTS][NUM_COEFFICIENTS + 1] = {};
+  for (int k = 0; k <= radius; ++k) {
+    double weight = (k == 0) ? 1.0 : 2.0;
+    double u = (k / standard_derivation) * (k / standard_derivation);
+    double powers[(NUM_COEFFICIENTS * 2) - 1];
+    powers[0] = 1.0;
+    for (int i = 1; i < (NUM_COEFFICIENTS * 2) - 1; ++i) {
+      powers[i] = powers[i - 1] * u;
+    }
+    for (int i = 0; i < NUM_COEFFICIENTS; ++i) {
+      for (int j = 0; j < NUM_COEFFICIENTS; ++j) {
+        matrix[i][j] += weight * powers[i + j];
+      }
+      matrix[i][NUM_COEFFICIENTS] += weight * powers[i] * kernel[k];
+    }
+  }
+
+  // Gaussian elimination with partial pivoting.
+  for (int i = 0; i < NUM_COEFFICIENTS; ++i) {
+    int pivot = i;
+    for (int j = i + 1; j < NUM_COEFFICIENTS; ++j) {
+      if (std::fabs(matrix[j][i]) > std::fabs(matrix[pivot][i])) {
+        pivot = j;
+      }
+    }
+    for (int j = 0; j <= NUM_COEFFICIENTS; ++j) {
+      std::swap(matrix[i][j], matrix[pivot][j]);
+    }
+    for (int j = i + 1; j < NUM_COEFFICIENTS; ++j) {
+      double ratio = matrix[j][i] / matrix[i][i];
+      for (int k = i; k <= NUM_COEFFICIENTS; ++k) {
+        matrix[j][k] -= ratio * matrix[i][k];
+      }
+    }
+  }
+  for (int i = NUM_COEFFICIENTS - 1; i >= 0; --i) {
+    double value = matrix[i][NUM_COEFFICIENTS];
+    for (int j = i + 1; j < NUM_COEFFICIENTS; ++j) {
+      value -= matrix[i][j] * coefficients[j];
+    }
+    coefficients[i] = value / matrix[i][i];
+  }
+}
+
+// Computes the moments sum(((src_id - center) / sd)^m * src[src_id]) for
+// the values in [center - radius, center + radius].
+void ComputeMoments(const std::vector<double> &src, int center, int radius,
+    double standard_derivation, double *moments) {
+  for (int m = 0; m < NUM_MOMENTS; ++m) {
+    moments[m] = 0.0;
+  }
+  int begin = (center > radius) ? (center - radius) : 0;
+  int end = ((center + radius) < static_cast<int>(src.size()))
+      ? (center + radius + 1) : static_cast<int>(src.size());
+  for (int src_id = begin; src_id < end; ++src_id) {
+    double t = (src_id - center) / standard_derivation;
+    double term = src[src_id];
+    for (int m = 0; m < NUM_MOMENTS; ++m) {
+      moments[m] += term;
+      term *= t;
+    }
+  }
+}
+
+void AddMoments(double t, double value, double *moments) {
+  for (int m = 0; m < NUM_MOMENTS; ++m) {
+    moments[m] += value;
+    value *= t;
+  }
+}
+
+}  // namespace
 
 CetrDocument::CetrDocument()
     : lines_(),
@@ -16,7 +108,10 @@ CetrDocument::CetrDocument()
       derivates_(),
       smoothed_derivates_(),
       points_(),
-      clusters_() {}
+      clusters_(),
+      kernel_buf_(),
+      clustering_module_(),
+      smoothing_mode_(DEFAULT_SMOOTHING_MODE) {}
 
 void CetrDocument::Clear() {
   lines_.clear();
@@ -35,11 +130,7 @@ void CetrDocument::Parse(const HtmlDocument &doc,
   Clear();
 
   ExtractLines(doc, num_chars_threshold);
-  ComputeTagRatios();
-  SmoothTagRatios();
-  ComputeDerivates(window_size);
-  SmoothDerivates();
-  AssemblePoints();
+  ComputeFeatures(window_size);
   ClusterPoints(num_clusters, num_tries, num_steps);
 }
 
@@ -99,41 +190,42 @@ void CetrDocument::ExtractLines(const HtmlDocument &doc,
   FixLines();
 }
 
-void CetrDocument::ComputeTagRatios() {
+// The features are computed in as few passes as their dependencies allow,
+// because smoothing needs the standard deviation of the whole histogram.
+// The vectors keep their capacity across documents.
+void CetrDocument::ComputeFeatures(int window_size) {
+  if (window_size < MIN_WINDOW_SIZE) {
+    window_size = DEFAULT_WINDOW_SIZE;
+  }
+
   tag_ratios_.resize(lines_.size());
   for (std::size_t i = 0; i < lines_.size(); ++i) {
     tag_ratios_[i] = 1.0 * lines_[i].num_text_chars()
         / ((lines_[i].num_tags() != 0) ? lines_[i].num_tags() : 1);
   }
-}
-
-void CetrDocument::SmoothTagRatios() {
-  SmoothHistogram(tag_ratios_, &smoothed_tag_ratios_);
-}
-
-void CetrDocument::ComputeDerivates(int window_size) {
-  if (window_size < MIN_WINDOW_SIZE) {
-    window_size = DEFAULT_WINDOW_SIZE;
-  }
-
-  derivates_.resize(lines_.size(), 0.0);
+  SmoothHistogram(tag_ratios_, smoothing_mode_, &kernel_buf_,
+      &smoothed_tag_ratios_);
+
+  // A derivate is the average of the smoothed tag ratios in the window
+  // starting at the line minus the ratio of the line. The window is
+  // truncated at the end of the document. Each window is summed from its
+  // first line, because a sliding sum leaves rounding errors which change
+  // the output, for example, 0 to -0, and windows are short.
+  derivates_.resize(lines_.size());
   for (std::size_t i = 0; i < derivates_.size(); ++i) {
-    int current_window_size = ((i + window_size) < derivates_.size())
-        ? window_size : (derivates_.size() - i);
-
-    for (int j = 0; j < current_window_size; ++j) {
-      derivates_[i] += smoothed_tag_ratios_[i + j];
+    std::size_t current_window_size =
+        ((i + window_size) < derivates_.size()) ?
+        static_cast<std::size_t>(window_size) : (derivates_.size() - i);
+    double window_sum = 0.0;
+    for (std::size_t j = 0; j < current_window_size; ++j) {
+      window_sum += smoothed_tag_ratios_[i + j];
     }
-    derivates_[i] /= current_window_size;
-    derivates_[i] -= smoothed_tag_ratios_[i];
+    derivates_[i] = (window_sum / current_window_size)
+        - smoothed_tag_ratios_[i];
   }
-}
+  SmoothHistogram(derivates_, smoothing_mode_, &kernel_buf_,
+      &smoothed_derivates_);
 
-void CetrDocument::SmoothDerivates() {
-  SmoothHistogram(derivates_, &smoothed_derivates_);
-}
-
-void CetrDocument::AssemblePoints() {
   points_.resize(lines_.size());
   for (std::size_t i = 0; i < points_.size(); ++i) {
     points_[i].set_x(std::fabs(smoothed_derivates_[i]));
@@ -143,7 +235,7 @@ void CetrDocument::AssemblePoints() {
 
 void CetrDocument::ClusterPoints(int num_clusters,
     int num_tries, int num_steps) {
-  CetrCluster::Cluster(points_, &clusters_, num_clusters,
+  clustering_module_.Run(points_, &clusters_, num_clusters,
       num_tries, num_steps);
 }
 
@@ -215,13 +307,24 @@ void CetrDocument::AppendInvisibleUnit(const HtmlUnit &html_unit,
   cetr_line->set_num_units(cetr_line->num_units() + 1);
 }
 
+// Tags are almost always ASCII, so ASCII bytes are counted without decoding
+// and only the other characters are decoded for IsPrintable().
 std::size_t CetrDocument::CountChars(const String &str) {
   std::size_t num_chars = 0;
-  String str_left = str;
-  int code_point = 0;
-  while (ExtractCodePoint(str_left, &str_left, &code_point)) {
-    if (IsPrintable(code_point)) {
-      ++num_chars;
+  std::size_t i = 0;
+  while (i < str.length()) {
+    unsigned char byte = static_cast<unsigned char>(str[i]);
+    if (byte < 0x80) {
+      num_chars += (byte > 0x20) ? 1 : 0;
+      ++i;
+    } else {
+      String str_left;
+      int code_point;
+      ExtractCodePoint(str.SubString(i), &str_left, &code_point);
+      if (IsPrintable(code_point)) {
+        ++num_chars;
+      }
+      i = str.length() - str_left.length();
     }
   }
   return num_chars;
@@ -313,38 +416,104 @@ void CetrDocument::FixLines() {
   }
 }
 
+// The kernel is normalized by the sum of its right half, and values out of
+// the histogram are regarded as 0.
 void CetrDocument::SmoothHistogram(const std::vector<double> &src,
+    SmoothingMode mode, std::vector<double> *kernel_buf,
     std::vector<double> *dest) {
   double standard_derivation = ComputeStandardDerivation(src);
   int radius = static_cast<int>(std::ceil(standard_derivation));
 
-  std::vector<double> kernel_buf((radius * 2) + 1, 0.0);
-  double *kernel = &kernel_buf[radius];
+  // The kernel is not needed beyond the histogram, but the denominator
+  // covers the whole radius.
+  int max_radius = !src.empty() ? static_cast<int>(src.size() - 1) : 0;
+  int kernel_radius = (radius < max_radius) ? radius : max_radius;
+
+  kernel_buf->assign((kernel_radius * 2) + 1, 0.0);
+  double *kernel = &(*kernel_buf)[kernel_radius];
   kernel[0] = 1.0;
+  double denominator = 1.0;
   if (standard_derivation != 0.0) {
-    double denominator = 2.0 * standard_derivation * standard_derivation;
+    double exponent_denominator =
+        2.0 * standard_derivation * standard_derivation;
     for (int kernel_id = 1; kernel_id <= radius; ++kernel_id) {
-      kernel[kernel_id] = std::exp(-((kernel_id * kernel_id) / denominator));
-      kernel[-kernel_id] = kernel[kernel_id];
+      double weight =
+          std::exp(-((kernel_id * kernel_id) / exponent_denominator));
+      if (kernel_id <= kernel_radius) {
+        kernel[kernel_id] = weight;
+        kernel[-kernel_id] = weight;
+      }
+      denominator += weight;
     }
   }
+  for (int kernel_id = -kernel_radius; kernel_id <= kernel_radius;
+       ++kernel_id) {
+    kernel[kernel_id] /= denominator;
+  }
 
-  double denominator = 0.0;
-  for (int kernel_id = 0; kernel_id <= radius; ++kernel_id) {
-    denominator += kernel[kernel_id];
+  dest->assign(src.size(), 0.0);
+  if ((mode == EXACT_SMOOTHING) ||
+      (kernel_radius <= MAX_EXACT_SMOOTHING_RADIUS)) {
+    for (std::size_t dest_id = 0; dest_id < dest->size(); ++dest_id) {
+      for (int kernel_id = -kernel_radius; kernel_id <= kernel_radius;
+           ++kernel_id) {
+        int src_id = dest_id + kernel_id;
+        if ((src_id >= 0) && (src_id < static_cast<int>(src.size()))) {
+          (*dest)[dest_id] += kernel[kernel_id] * src[src_id];
+        }
+      }
+    }
+    return;
   }
-  for (int kernel_id = -radius; kernel_id <= radius; ++kernel_id) {
-    kernel[kernel_id] /= denominator;
+
+  double coefficients[FAST_SMOOTHING_DEGREE + 1];
+  FitKernelPolynomial(kernel, kernel_radius, standard_derivation,
+      coefficients);
+
+  // Sliding the window by one line moves the center by 1 / sd, which is
+  // applied to the moments by the binomial theorem.
+  double shift[NUM_MOMENTS][NUM_MOMENTS] = {};
+  for (int m = 0; m < NUM_MOMENTS; ++m) {
+    double binomial = 1.0;
+    for (int i = m; i >= 0; --i) {
+      shift[m][i] = binomial * std::pow(-1.0 / standard_derivation, m - i);
+      binomial = binomial * i / (m - i + 1);
+    }
   }
 
-  dest->resize(src.size(), 0.0);
-  for (std::size_t dest_id = 0; dest_id < dest->size(); ++dest_id) {
-    for (int kernel_id = -radius; kernel_id <= radius; ++kernel_id) {
-      int src_id = dest_id + kernel_id;
-      if ((src_id >= 0) && (src_id < static_cast<int>(src.size()))) {
-        (*dest)[dest_id] += kernel[kernel_id] * src[src_id];
+  // The moments are recomputed once per window length to stop rounding
+  // errors from accumulating, which costs O(lines) in total.
+  int window_length = (kernel_radius * 2) + 1;
+  double edge = kernel_radius / standard_derivation;
+  int num_values = static_cast<int>(src.size());
+  double moments[NUM_MOMENTS];
+  for (int dest_id = 0; dest_id < num_values; ++dest_id) {
+    if ((dest_id % window_length) == 0) {
+      ComputeMoments(src, dest_id, kernel_radius, standard_derivation,
+          moments);
+    } else {
+      int old_src_id = dest_id - 1 - kernel_radius;
+      if (old_src_id >= 0) {
+        AddMoments(-edge, -src[old_src_id], moments);
+      }
+      for (int m = NUM_MOMENTS - 1; m > 0; --m) {
+        double moment = 0.0;
+        for (int i = 0; i <= m; ++i) {
+          moment += shift[m][i] * moments[i];
+        }
+        moments[m] = moment;
       }
+      int new_src_id = dest_id + kernel_radius;
+      if (new_src_id < num_values) {
+        AddMoments(edge, src[new_src_id], moments);
+      }
+    }
+
+    double value = 0.0;
+    for (int i = 0; i <= FAST_SMOOTHING_DEGREE; ++i) {
+      value += coefficients[i] * moments[i * 2];
     }
+    (*dest)[dest_id] = value;
   }
 }
 
@@ -0,0 +1,72 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <nwc-toolkit/character-converter.h>
+
+#include <errno.h>
+
+namespace nwc_toolkit {
+
+bool CharacterConverter::Open(const String &src_code,
+    const String &dest_code) {
+  if (is_open()) {
+    Close();
+  }
+
+  StringBuilder src_code_clone, dest_code_clone;
+  src_code_clone.Append(src_code).Append();
+  dest_code_clone.Append(dest_code).Append();
+
+  iconv_desc_ = ::iconv_open(dest_code_clone.ptr(), src_code_clone.ptr());
+  return is_open();
+}
+
+bool CharacterConverter::Close() {
+  if (!is_open()) {
+    return false;
+  }
+  ::iconv_close(iconv_desc_);
+  iconv_desc_ = InvalidDesc();
+  return true;
+}
+
+bool CharacterConverter::Convert(const String &src, StringBuilder *dest,
+    String *src_left) {
+  *src_left = src.SubString(src.length());
+  if (!is_open()) {
+    return false;
+  }
+
+  char *in_buf = const_cast<char *>(src.ptr());
+  std::size_t in_bytes_left = src.length();
+
+  std::size_t out_bytes_total = dest->length();
+  if (dest->size() < out_bytes_total + in_bytes_left) {
+    dest->Reserve(out_bytes_total + in_bytes_left);
+  }
+  dest->Resize(dest->size());
+
+  char *out_buf = dest->buf() + out_bytes_total;
+  std::size_t out_bytes_left = dest->length() - out_bytes_total;
+
+  bool iconv_ok = true;
+  while (in_bytes_left > 0) {
+    std::size_t iconv_result = ::iconv(iconv_desc_, &in_buf, &in_bytes_left,
+        &out_buf, &out_bytes_left);
+    if (iconv_result != static_cast<std::size_t>(-1)) {
+      break;
+    } else if (errno == E2BIG) {
+      out_bytes_total = dest->length() - out_bytes_left;
+      dest->Resize(dest->size() * 2);
+      out_buf = dest->buf() + out_bytes_total;
+      out_bytes_left = dest->length() - out_bytes_total;
+    } else {
+      iconv_ok = (errno == EINVAL);
+      break;
+    }
+  }
+  dest->Resize(dest->length() - out_bytes_left);
+  src_left->Assign(in_buf, in_bytes_left);
+  return iconv_ok;
+}
+
+}  // namespace nwc_toolkit
@@ -0,0 +1,144 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+//
+// Reads a list of character entity references (character-entities.txt)
+// from standard input and writes a C++ header that contains a prebuilt
+// double-array of the references and the code points associated with them.
+
+#include <errno.h>
+#include <error.h>
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <nwc-toolkit/darts.h>
+
+#define NWC_TOOLKIT_ERROR(fmt, ...) \
+  error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
+
+namespace {
+
+struct Entity {
+  Entity() : name(), code_points() {}
+
+  std::string name;
+  int code_points[2];
+};
+
+void ReadEntities(std::istream *input, std::vector<Entity> *entities) {
+  std::string line;
+  while (std::getline(*input, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::string::size_type delim_pos = line.find('\t');
+    if (delim_pos == std::string::npos) {
+      NWC_TOOLKIT_ERROR("invalid line: %s", line.c_str());
+    }
+
+    Entity entity;
+    entity.name = line.substr(0, delim_pos);
+
+    const char *avail = line.c_str() + delim_pos + 1;
+    for (std::size_t i = 0; i < 2 && *avail != '\0'; ++i) {
+      char *end_of_value;
+      entity.code_points[i] =
+          static_cast<int>(std::strtol(avail, &end_of_value, 10));
+      if (end_of_value == avail) {
+        NWC_TOOLKIT_ERROR("invalid code point: %s", line.c_str());
+      }
+      avail = end_of_value;
+      while (*avail == ' ') {
+        ++avail;
+      }
+    }
+    if (*avail != '\0') {
+      NWC_TOOLKIT_ERROR("too many code points: %s", line.c_str());
+    }
+
+    if (!entities->empty() && !(entities->back().name < entity.name)) {
+      NWC_TOOLKIT_ERROR("invalid order: %s", entity.name.c_str());
+    }
+    entities->push_back(entity);
+  }
+}
+
+void BuildDic(const std::vector<Entity> &entities,
+    nwc_toolkit::Darts::DoubleArray *dic) {
+  std::vector<const char *> keys(entities.size());
+  std::vector<std::size_t> lengths(entities.size());
+  std::vector<int> values(entities.size());
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    keys[i] = entities[i].name.c_str();
+    lengths[i] = entities[i].name.length();
+    values[i] = static_cast<int>(i);
+  }
+  if (dic->build(keys.size(), &keys[0], &lengths[0], &values[0]) != 0) {
+    NWC_TOOLKIT_ERROR("failed to build dictionary");
+  }
+}
+
+void WriteTable(const std::vector<Entity> &entities,
+    const nwc_toolkit::Darts::DoubleArray &dic, std::ostream *output) {
+  const unsigned *units = static_cast<const unsigned *>(dic.array());
+
+  *output << "// Copyright 2010 Susumu Yata <syata@acm.org>\n"
+      "//\n"
+      "// This file is generated by character-entity-table-generator from\n"
+      "// character-entities.txt. Do not edit.\n"
+      "\n"
+      "#ifndef NWC_TOOLKIT_CHARACTER_ENTITY_TABLE_H_\n"
+      "#define NWC_TOOLKIT_CHARACTER_ENTITY_TABLE_H_\n"
+      "\n"
+      "#include <cstddef>\n"
+      "\n"
+      "namespace nwc_toolkit {\n"
+      "namespace {\n"
+      "\n"
+      "// Double-array units of " << entities.size() << " character entity "
+      "references.\n"
+      "// The value of each reference is an index into ENTITY_CODE_POINTS.\n"
+      "const std::size_t ENTITY_DIC_SIZE = " << dic.size() << ";\n"
+      "const unsigned ENTITY_DIC_UNITS[ENTITY_DIC_SIZE] = {";
+  for (std::size_t i = 0; i < dic.size(); ++i) {
+    *output << (((i % 6) == 0) ? "\n  " : " ")
+        << "0x" << std::hex << std::setw(8) << std::setfill('0') << units[i]
+        << std::dec << ((i + 1 < dic.size()) ? "," : "");
+  }
+  *output << "\n};\n"
+      "\n"
+      "// Code points of character entity references. Most references have\n"
+      "// only one code point and their second code points are set to 0.\n"
+      "const int ENTITY_CODE_POINTS[][2] = {\n";
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    *output << "  { " << entities[i].code_points[0] << ", "
+        << entities[i].code_points[1] << " },  // " << entities[i].name
+        << '\n';
+  }
+  *output << "};\n"
+      "\n"
+      "}  // namespace\n"
+      "}  // namespace nwc_toolkit\n"
+      "\n"
+      "#endif  // NWC_TOOLKIT_CHARACTER_ENTITY_TABLE_H_\n";
+}
+
+}  // namespace
+
+int main() {
+  std::vector<Entity> entities;
+  ReadEntities(&std::cin, &entities);
+  if (entities.empty()) {
+    NWC_TOOLKIT_ERROR("no entities");
+  }
+
+  nwc_toolkit::Darts::DoubleArray dic;
+  BuildDic(entities, &dic);
+  WriteTable(entities, dic, &std::cout);
+  if (!std::cout) {
+    NWC_TOOLKIT_ERROR("failed to write table");
+  }
+  return 0;
+}
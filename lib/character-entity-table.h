@@ -0,0 +1,4159 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+//
+// This file is generated by character-entity-table-generator from
+// character-entities.txt. Do not edit.
+
+#ifndef NWC_TOOLKIT_CHARACTER_ENTITY_TABLE_H_
+#define NWC_TOOLKIT_CHARACTER_ENTITY_TABLE_H_
+
+#include <cstddef>
+
+namespace nwc_toolkit {
+namespace {
+
+// Double-array units of 2125 character entity references.
+// The value of each reference is an index into ENTITY_CODE_POINTS.
+const std::size_t ENTITY_DIC_SIZE = 12032;
+const unsigned ENTITY_DIC_UNITS[ENTITY_DIC_SIZE] = {
+  0x00009c00, 0x00017026, 0x0001a06c, 0x00018869, 0x00421459, 0x00431c58,
+  0x00008067, 0x0044005a, 0x003d0455, 0x003a2054, 0x0043cc57, 0x00414056,
+  0x00310c51, 0x002f2050, 0x00373053, 0x00303452, 0x0020404d, 0x001b6c4c,
+  0x002d7c4f, 0x0023404e, 0x0017fc49, 0x00145048, 0x0018784b, 0x0019544a,
+  0x000e2c45, 0x00099444, 0x00124847, 0x00100046, 0x00006441, 0x0000f53b,
+  0x00040043, 0x00035842, 0x80000000, 0x0000e050, 0x0000053b, 0x80000001,
+  0x00bb1479, 0x00b91c78, 0x0001b863, 0x00bbac7a, 0x00aeb475, 0x00abec74,
+  0x00b62477, 0x00b2cc76, 0x00973871, 0x00901c70, 0x00a00073, 0x0096a472,
+  0x007f806d, 0x0073d46c, 0x008f846f, 0x0083d06e, 0x006db869, 0x006bdc68,
+  0x00705c6b, 0x0071d06a, 0x005f9c65, 0x0058e064, 0x0067f467, 0x0062e866,
+  0x0045f461, 0x00002075, 0x00537c63, 0x0048c462, 0x0000b845, 0x00018074,
+  0x0000053b, 0x80000002, 0x0000f465, 0x00019c72, 0x0001a876, 0x0001dc65,
+  0x0000e44d, 0x0000e465, 0x80000003, 0x0000053b, 0x0001cc69, 0x00018072,
+  0x0000e863, 0x00007d3b, 0x80000004, 0x80000005, 0x00000d3b, 0x00001d3b,
+  0x80000006, 0x0001e861, 0x0000f872, 0x0000dc65, 0x0001b072, 0x0001ac76,
+  0x80000007, 0x0000053b, 0x0000d479, 0x0000e461, 0x00015870, 0x0000e93b,
+  0x00017068, 0x0001f863, 0x00012067, 0x00011c66, 0x00008461, 0x80000008,
+  0x00010c63, 0x00014062, 0x0001946d, 0x00011c6c, 0x0002346f, 0x0001f46e,
+  0x0001b861, 0x0000e072, 0x0000053b, 0x80000009, 0x0002fc75, 0x00020c74,
+  0x0000f464, 0x8000000a, 0x00001d3b, 0x0001e870, 0x0002d473, 0x00023872,
+  0x0001b06f, 0x0000093b, 0x0000e06e, 0x8000000b, 0x0000e866, 0x00000d3b,
+  0x8000000c, 0x00024870, 0x00025c67, 0x0001e86c, 0x00011c79, 0x0001c846,
+  0x0001bc75, 0x0001806e, 0x0001d463, 0x00019874, 0x0001b869, 0x0001b46f,
+  0x0000e86e, 0x00001d3b, 0x8000000d, 0x0001906e, 0x0000e867, 0x0000793b,
+  0x0001cc69, 0x8000000e, 0x0000e872, 0x00001d3b, 0x8000000f, 0x0001a869,
+  0x0000d06e, 0x00023470, 0x00018067, 0x00000d3b, 0x80000010, 0x0001ac69,
+  0x0001986c, 0x0000093b, 0x00016864, 0x80000011, 0x00010063, 0x00001c65,
+  0x0001a86d, 0x0000193b, 0x0000f06c, 0x80000012, 0x0000346f, 0x0001fc6b,
+  0x00018861, 0x00019463, 0x00004863, 0x0001a873, 0x00003c65, 0x0001f46c,
+  0x0001d073, 0x00001466, 0x00013073, 0x0001b061, 0x0000e868, 0x0000193b,
+  0x0000353b, 0x80000013, 0x0000e476, 0x0001b077, 0x0001e072, 0x80000014,
+  0x00001c73, 0x00000472, 0x0000c875, 0x0000e464, 0x00019c65, 0x0001f53b,
+  0x0001a463, 0x0000fc79, 0x80000015, 0x0001d075, 0x0001a073, 0x00000d3b,
+  0x80000016, 0x80000017, 0x0001f861, 0x0000f865, 0x0001ac6e, 0x0001dc75,
+  0x00002d3b, 0x0000613b, 0x0001c06f, 0x0000b461, 0x0001bc6c, 0x0001d472,
+  0x0001d469, 0x0001a06c, 0x00008873, 0x80000018, 0x80000019, 0x0001e474,
+  0x00001c72, 0x00003d3b, 0x0001e850, 0x00017470, 0x8000001a, 0x00002872,
+  0x0001c463, 0x00012065, 0x0000f866, 0x00019876, 0x0000c065, 0x0001d46d,
+  0x0000e13b, 0x0000353b, 0x00019070, 0x0001ec65, 0x8000001b, 0x00000d3b,
+  0x8000001c, 0x00009479, 0x0000093b, 0x0000e471, 0x8000001d, 0x00006d3b,
+  0x00018863, 0x0001bc74, 0x00067872, 0x0001a866, 0x8000001e, 0x0000213b,
+  0x0007d93b, 0x0001b074, 0x0001f475, 0x0000d059, 0x0001a861, 0x00070865,
+  0x0006f86c, 0x8000001f, 0x00078863, 0x00064866, 0x80000020, 0x00063063,
+  0x0000053b, 0x80000021, 0x80000022, 0x0000053b, 0x0001a044, 0x00064869,
+  0x00062065, 0x0001b465, 0x0001d46e, 0x0001b874, 0x00018c69, 0x0001186c,
+  0x0001bc61, 0x00009044, 0x0000053b, 0x80000023, 0x0000b070, 0x0001cc65,
+  0x0001886c, 0x0000e073, 0x0000053b, 0x80000024, 0x0001b472, 0x0001fc79,
+  0x0001a06f, 0x00018c79, 0x0000e86e, 0x0000093b, 0x00015864, 0x80000025,
+  0x00012861, 0x0001bc69, 0x0000e86c, 0x0000193b, 0x00017865, 0x80000026,
+  0x0006ec72, 0x0000393b, 0x0001f069, 0x80000027, 0x0001bc6e, 0x0000fc74,
+  0x0001bc69, 0x0001c86e, 0x0001a86f, 0x00007d3b, 0x80000028, 0x0001dc6f,
+  0x0000e874, 0x00001d3b, 0x80000029, 0x00019464, 0x0001b46c, 0x0001b86c,
+  0x0000e461, 0x00018c69, 0x0000053b, 0x8000002a, 0x00002c6f, 0x00006474,
+  0x0000e072, 0x0001d86e, 0x00001d3b, 0x00003465, 0x00004444, 0x0000e074,
+  0x0000e872, 0x00003d3b, 0x0000d469, 0x8000002b, 0x0000153b, 0x0001b863,
+  0x8000002c, 0x0001f86c, 0x0001b06f, 0x8000002d, 0x00019072, 0x0000753b,
+  0x00018465, 0x00076c4f, 0x8000002e, 0x00018469, 0x00008074, 0x8000002f,
+  0x00071448, 0x00075069, 0x0000353b, 0x0001c475, 0x00010465, 0x0000e073,
+  0x0001c06e, 0x00001473, 0x0002c043, 0x0001286c, 0x00013875, 0x00014850,
+  0x0001ac69, 0x0000113b, 0x00016c6d, 0x0001b854, 0x00003d3b, 0x80000030,
+  0x0000d473, 0x80000031, 0x00019c6f, 0x00039c75, 0x0003c872, 0x0003d873,
+  0x0001f063, 0x0001c865, 0x0001a877, 0x0002c06f, 0x0001dc6c, 0x00020069,
+  0x00027449, 0x00015844, 0x00016468, 0x00012c69, 0x00013866, 0x0001f86b,
+  0x00009064, 0x0000a865, 0x0001184d, 0x0000f063, 0x00022c73, 0x00007461,
+  0x00022873, 0x0001b46f, 0x0001d46e, 0x0001a074, 0x0001d06f, 0x0001c475,
+  0x0002ec72, 0x0001ec6e, 0x00019c74, 0x00019072, 0x00018065, 0x0000f86c,
+  0x0001ac61, 0x0001d867, 0x0000053b, 0x80000032, 0x00010865, 0x0001dc43,
+  0x0001a872, 0x0001cc75, 0x0001d46c, 0x0001d86f, 0x0001bc75, 0x00017c65,
+  0x0001f079, 0x0001c451, 0x0001a06c, 0x0001b462, 0x00000d3b, 0x0001b075,
+  0x00012c6f, 0x80000033, 0x00016844, 0x00019874, 0x00001465, 0x0001a075,
+  0x0001d46f, 0x00019874, 0x0000e865, 0x00003d3b, 0x80000034, 0x0001b46f,
+  0x0000e86e, 0x00001d3b, 0x80000035, 0x0001ac6c, 0x0000793b, 0x0000246e,
+  0x80000036, 0x00007070, 0x0001c072, 0x0001fc6e, 0x00000875, 0x00018c51,
+  0x0001ac65, 0x00019075, 0x0000e874, 0x00000d3b, 0x80000037, 0x0000f074,
+  0x0000053b, 0x80000038, 0x0001c46e, 0x00003875, 0x0000286f, 0x00000467,
+  0x0001a049, 0x00012072, 0x0001d86e, 0x0001ac65, 0x00019874, 0x0000946c,
+  0x00018c61, 0x0001c467, 0x00018c72, 0x0000b866, 0x0001e06f, 0x80000039,
+  0x8000003a, 0x00007c69, 0x0001d064, 0x00019875, 0x0001f474, 0x0001b46f,
+  0x0001d463, 0x00003874, 0x0001a474, 0x8000003b, 0x0001e86e, 0x0000513b,
+  0x00012465, 0x00015443, 0x0001e465, 0x00015463, 0x0000413b, 0x0001f072,
+  0x0000dd3b, 0x0001e472, 0x0001786c, 0x0001c46b, 0x0001c069, 0x0001a077,
+  0x00018043, 0x00017873, 0x0001a075, 0x0001b46f, 0x0001cc6e, 0x0001c46e,
+  0x0001c46f, 0x0001b874, 0x00019074, 0x0001e065, 0x0001c467, 0x000c006f,
+  0x00010472, 0x00019472, 0x000000f6, 0x00018065, 0x000000f4, 0x00019861,
+  0x0001c463, 0x000a8042, 0x0001fc49, 0x000f0c72, 0x000f0870, 0x0000e06c,
+  0x0000053b, 0x8000003c, 0x0000e873, 0x00000d3b, 0x8000003d, 0x00001d3b,
+  0x8000003e, 0x00000d3b, 0x8000003f, 0x0001fc61, 0x0000e870, 0x00000d3b,
+  0x80000040, 0x00001d3b, 0x80000041, 0x0001bc74, 0x0001d061, 0x00070873,
+  0x0001fc72, 0x0000f864, 0x00019c68, 0x0003c06f, 0x0000093b, 0x0000f069,
+  0x80000042, 0x0001d863, 0x0000e079, 0x0000dc65, 0x0000b866, 0x00001d3b,
+  0x80000043, 0x00014861, 0x00011c63, 0x0000f863, 0x0000e879, 0x00000d3b,
+  0x80000044, 0x0001f863, 0x0000e879, 0x0000093b, 0x0001985a, 0x80000045,
+  0x00019867, 0x00018067, 0x0000e872, 0x0000193b, 0x0001d065, 0x80000046,
+  0x00009472, 0x00014853, 0x0000053b, 0x80000047, 0x0001dc68, 0x0000f076,
+  0x0000053b, 0x80000048, 0x0001084a, 0x80000049, 0x00002044, 0x0001b072,
+  0x0001a86f, 0x0000313b, 0x00019873, 0x00018472, 0x0000f86e, 0x8000004a,
+  0x00002c61, 0x8000004b, 0x0003e46c, 0x8000004c, 0x0001ed3b, 0x0000dc61,
+  0x0000dc72, 0x8000004d, 0x0001ec61, 0x0000293b, 0x0000353b, 0x0001b872,
+  0x0001a869, 0x0001d861, 0x00009065, 0x00028466, 0x0001a463, 0x0000093b,
+  0x0001bc74, 0x8000004e, 0x00018869, 0x0001e463, 0x0000353b, 0x0001d06c,
+  0x00009c79, 0x00010865, 0x00015041, 0x8000004f, 0x0000c13b, 0x00012075,
+  0x0002d46d, 0x0000986f, 0x00012063, 0x00012874, 0x00018441, 0x00019062,
+  0x0001b047, 0x0001c474, 0x0001ec6f, 0x0001b844, 0x0001a475, 0x00001074,
+  0x0001ec75, 0x00015c6c, 0x80000050, 0x0001c863, 0x0001dc76, 0x00007d3b,
+  0x80000051, 0x00005865, 0x0001a861, 0x00025464, 0x00028471, 0x00000031,
+  0x0000213b, 0x00019454, 0x001c6c52, 0x0003f93b, 0x0001a472, 0x00025869,
+  0x0000a065, 0x00006c43, 0x80000052, 0x00024072, 0x0003053b, 0x0002586c,
+  0x0003c473, 0x00033865, 0x0001b06f, 0x00031c64, 0x00019c6e, 0x80000053,
+  0x00019066, 0x00021065, 0x0001bc65, 0x0001cc6e, 0x0001a074, 0x0001f469,
+  0x0001146c, 0x00009044, 0x0000093b, 0x0001cc61, 0x80000054, 0x00018070,
+  0x00071c77, 0x0000d866, 0x00014475, 0x0000d874, 0x0000053b, 0x80000055,
+  0x0000053b, 0x80000056, 0x00000d3b, 0x0001dc6f, 0x0000e474, 0x80000057,
+  0x00018075, 0x0001bc61, 0x0000e86c, 0x00001d3b, 0x80000058, 0x0001bc62,
+  0x0001906c, 0x00017065, 0x0001dc6e, 0x00073852, 0x0001b06f, 0x0001a074,
+  0x0001d86f, 0x00079c56, 0x00070c55, 0x0001b875, 0x0001b049, 0x00018865,
+  0x0001fc6e, 0x00012872, 0x0001c067, 0x0000d46c, 0x0001b472, 0x0000084c,
+  0x0001f443, 0x0001b474, 0x00018c61, 0x00001d3b, 0x80000059, 0x0000246f,
+  0x0001d93b, 0x0001b444, 0x00011474, 0x0001086e, 0x0001d041, 0x0001b077,
+  0x0001cc72, 0x0001b072, 0x0001d86f, 0x0000c077, 0x8000005a, 0x8000005b,
+  0x0001d466, 0x00011c74, 0x0000153b, 0x0001b441, 0x0000b877, 0x0003ac74,
+  0x0001f065, 0x0001a06f, 0x0001d072, 0x00018469, 0x0001a872, 0x00019067,
+  0x8000005c, 0x0001e841, 0x00015454, 0x0001c468, 0x0001786f, 0x0000353b,
+  0x00012874, 0x00001477, 0x00019052, 0x00013072, 0x0001286f, 0x0001b872,
+  0x0001a84c, 0x0000113b, 0x00038445, 0x00005c44, 0x00003d3b, 0x8000005d,
+  0x00019865, 0x8000005e, 0x0001846e, 0x0000d865, 0x00010867, 0x00019065,
+  0x00040074, 0x0001d466, 0x0001c472, 0x0001ec6f, 0x00019467, 0x0001b472,
+  0x0000053b, 0x8000005f, 0x80000060, 0x0000053b, 0x0001b469, 0x00062841,
+  0x00065867, 0x0006246f, 0x00065852, 0x0000c877, 0x80000061, 0x00062c68,
+  0x0006e074, 0x0001c472, 0x00065872, 0x00067869, 0x0001e068, 0x00072477,
+  0x0001cc41, 0x0001f072, 0x00013c74, 0x0001b072, 0x0001c06f, 0x0007d53b,
+  0x0001d067, 0x0000f477, 0x00019469, 0x0001b041, 0x0001d868, 0x0001c072,
+  0x00017074, 0x0001a872, 0x00000d3b, 0x0000e877, 0x0001d06f, 0x80000062,
+  0x00019865, 0x0000153b, 0x00019c54, 0x0000e465, 0x80000063, 0x0001f470,
+  0x0001d86f, 0x00001c77, 0x0001c072, 0x0001cc41, 0x00014c72, 0x0000193b,
+  0x0001b444, 0x80000064, 0x0001e46f, 0x0001f072, 0x0001b077, 0x0001a872,
+  0x0001146e, 0x0000f477, 0x0001c06f, 0x0000713b, 0x0001ec41, 0x0001b465,
+  0x0001d872, 0x80000065, 0x0001a074, 0x00019069, 0x00018063, 0x00018c61,
+  0x00003d3b, 0x0000e872, 0x0001f461, 0x80000066, 0x000a046c, 0x80000067,
+  0x00021c77, 0x0000f06e, 0x0001cc72, 0x00004472, 0x00003041, 0x0000286f,
+  0x0001d061, 0x00019442, 0x0000cc72, 0x00010870, 0x0001f841, 0x0001e46f,
+  0x80000068, 0x00008077, 0x0001d872, 0x0001e076, 0x0000113b, 0x0001fc4c,
+  0x00019872, 0x80000069, 0x00016074, 0x0001b065, 0x0000753b, 0x0002fc52,
+  0x00018072, 0x0002bc54, 0x0000c865, 0x0001a065, 0x8000006a, 0x0001f466,
+  0x00014452, 0x00002872, 0x00017854, 0x00015067, 0x00013056, 0x00001d3b,
+  0x0002e861, 0x0001c468, 0x00016069, 0x00019865, 0x00010c74, 0x00018474,
+  0x0001dc63, 0x0001ac65, 0x0000a472, 0x00012465, 0x0000113b, 0x0001086f,
+  0x0001d463, 0x0001c874, 0x8000006b, 0x00018065, 0x0001a86f, 0x0001dc56,
+  0x0001f06f, 0x001f1470, 0x0001a474, 0x00021061, 0x0001f056, 0x0001b065,
+  0x0001e063, 0x0001b067, 0x0000153b, 0x0003fd3b, 0x00031872, 0x00023c68,
+  0x0003c86d, 0x8000006c, 0x0002ed3b, 0x00000d3b, 0x8000006d, 0x00030c72,
+  0x8000006e, 0x00026c69, 0x00016874, 0x0001b865, 0x0001a854, 0x00018456,
+  0x0001f056, 0x0001ac74, 0x00014c65, 0x00018065, 0x0001c463, 0x0001b06f,
+  0x0000093b, 0x0000e872, 0x8000006f, 0x00019065, 0x0001d463, 0x0001b074,
+  0x0001cc6f, 0x0000d072, 0x0000053b, 0x80000070, 0x0001d461, 0x00001d3b,
+  0x80000071, 0x0000f472, 0x0000fd3b, 0x00016865, 0x00001465, 0x80000072,
+  0x0001cc72, 0x0001a072, 0x0001d86f, 0x0000e077, 0x0000053b, 0x80000073,
+  0x0001cc72, 0x0001b472, 0x0000f477, 0x0001d86f, 0x0000053b, 0x80000074,
+  0x0001b063, 0x0004b441, 0x0000e872, 0x00000d3b, 0x80000075, 0x0001a872,
+  0x00000d3b, 0x0000e86b, 0x0001a06f, 0x80000076, 0x0000153b, 0x0001e074,
+  0x0000e447, 0x0000f848, 0x0004b452, 0x80000077, 0x0000053b, 0x80000078,
+  0x0001d875, 0x0001d063, 0x00019074, 0x0000f465, 0x0000c46e, 0x00000d3b,
+  0x80000079, 0x0000d054, 0x00008879, 0x8000007a, 0x0001b872, 0x0001846f,
+  0x00018872, 0x0000e463, 0x00001d3b, 0x0000713b, 0x0001a061, 0x0000153b,
+  0x00013061, 0x8000007b, 0x8000007c, 0x8000007d, 0x0001e46f, 0x8000007e,
+  0x00019869, 0x00003c65, 0x0000f872, 0x0000f074, 0x0000253b, 0x0000804e,
+  0x0001b472, 0x0000213b, 0x001f1c73, 0x00006842, 0x001eb871, 0x001ee470,
+  0x0000d041, 0x0003d865, 0x001f1c75, 0x001f5474, 0x00015076, 0x0001a065,
+  0x0001e861, 0x001f3c78, 0x00009874, 0x001c013b, 0x00036c55, 0x0001dc6e,
+  0x00010463, 0x001fc53b, 0x00014061, 0x0001ec63, 0x00016067, 0x00017466,
+  0x001e4c6d, 0x00013864, 0x0003b042, 0x00036842, 0x001f0072, 0x0001c870,
+  0x001ee86f, 0x001e1c74, 0x0001d46d, 0x0001fc6c, 0x80000080, 0x00000d3b,
+  0x80000081, 0x00016079, 0x0001b461, 0x0001bc6c, 0x0001486c, 0x0001fc53,
+  0x001e4c53, 0x0001d871, 0x00019c75, 0x00018072, 0x0001d461, 0x0001e456,
+  0x0000e865, 0x00007d3b, 0x80000082, 0x0001c465, 0x0001f872, 0x0001a053,
+  0x00018861, 0x00015479, 0x00018c6d, 0x0001fc53, 0x0000193b, 0x00013071,
+  0x0001b46c, 0x00017c6c, 0x0001cc61, 0x00016872, 0x80000083, 0x0001486f,
+  0x00017475, 0x00014467, 0x00000465, 0x0000f06e, 0x0000053b, 0x80000084,
+  0x0000393b, 0x0000e866, 0x80000085, 0x0001a873, 0x0001a069, 0x0000f06e,
+  0x0000053b, 0x80000086, 0x0001c46c, 0x0000713b, 0x0001d46f, 0x0000946c,
+  0x0001bc61, 0x80000087, 0x0001b46c, 0x0001b469, 0x0001dc70, 0x0000d065,
+  0x00000d3b, 0x0001a875, 0x0001a869, 0x80000088, 0x0001ac6c, 0x0001bc64,
+  0x00007869, 0x00003c69, 0x00007054, 0x0000f46d, 0x0001cc62, 0x00005472,
+  0x0001f063, 0x0001a475, 0x0000a06d, 0x00003d3b, 0x80000089, 0x0000093b,
+  0x0000e072, 0x8000008a, 0x0001c06d, 0x00019069, 0x00019469, 0x8000008b,
+  0x0000c86c, 0x8000008c, 0x0001f474, 0x0000c061, 0x0001b470, 0x0000693b,
+  0x00018c6f, 0x00014069, 0x0000253b, 0x00001d3b, 0x0001f073, 0x0001786e,
+  0x0000e873, 0x0000f13b, 0x8000008d, 0x00005445, 0x0001b065, 0x8000008e,
+  0x0001cc6e, 0x0001e46c, 0x8000008f, 0x00016c74, 0x0001a461, 0x80000090,
+  0x00028873, 0x00010c64, 0x00009079, 0x00034072, 0x00018465, 0x0001c46c,
+  0x0001a053, 0x0001f461, 0x0001e46c, 0x0000553b, 0x0001cc69, 0x80000091,
+  0x0002706f, 0x0000493b, 0x00024072, 0x0001f471, 0x0001ac63, 0x0001bc53,
+  0x00021072, 0x0001d46d, 0x00027c56, 0x00019066, 0x0002406c, 0x00027c75,
+  0x0003cd3b, 0x00021461, 0x0002fc6c, 0x0000f065, 0x0000053b, 0x80000092,
+  0x00023865, 0x00017079, 0x0001b053, 0x0001886d, 0x0001b461, 0x0001a86c,
+  0x0001cc53, 0x0001486c, 0x0001d071, 0x0001f875, 0x0001d461, 0x0000e065,
+  0x0000053b, 0x80000093, 0x0000e866, 0x00000d3b, 0x80000094, 0x00018c72,
+  0x0001a870, 0x0001b841, 0x00010872, 0x0001ac6c, 0x0000e46c, 0x00013c75,
+  0x0000053b, 0x80000095, 0x0001a072, 0x00019869, 0x0001cc65, 0x0001cc72,
+  0x0001cc74, 0x00019472, 0x0000e866, 0x00003d3b, 0x80000096, 0x0001c063,
+  0x0000193b, 0x0000e872, 0x80000097, 0x0001ec63, 0x0000793b, 0x0000e879,
+  0x80000098, 0x00000d3b, 0x80000099, 0x0001a46d, 0x0000d861, 0x8000009a,
+  0x0000393b, 0x0001886d, 0x8000009b, 0x0000313b, 0x00007076, 0x00007c72,
+  0x0000053b, 0x8000009c, 0x8000009d, 0x0001106c, 0x0001f93b, 0x00003465,
+  0x0000304a, 0x00011065, 0x00019865, 0x0001a872, 0x00019864, 0x0000313b,
+  0x0001fc69, 0x00006869, 0x00019c61, 0x8000009e, 0x0000c063, 0x0000093b,
+  0x00009074, 0x8000009f, 0x00007466, 0x0000153b, 0x00003d3b, 0x0001a46f,
+  0x800000a0, 0x0000f072, 0x0001f465, 0x0000d53b, 0x0000b879, 0x00017474,
+  0x0006f06e, 0x00012c71, 0x00015854, 0x800000a1, 0x00016045, 0x0007b053,
+  0x00040072, 0x0001cc65, 0x800000a2, 0x0007606c, 0x00019c65, 0x0001b075,
+  0x0001ac64, 0x001f906f, 0x00019c61, 0x0000dc61, 0x00008c62, 0x00012863,
+  0x00014064, 0x8000007f, 0x00012466, 0x00000c67, 0x0001ec73, 0x0001bc6c,
+  0x0001a46c, 0x800000a3, 0x0000c46c, 0x800000a4, 0x0000153b, 0x00060071,
+  0x0000e873, 0x0000113b, 0x00012472, 0x0006e473, 0x00078474, 0x800000a5,
+  0x0007e93b, 0x00066c65, 0x0007d53b, 0x00067075, 0x00018075, 0x00066c61,
+  0x800000a6, 0x0001dc61, 0x0001ac74, 0x00067472, 0x0001cc65, 0x0000e072,
+  0x0000053b, 0x800000a7, 0x0001c865, 0x0001c073, 0x0000e873, 0x00007d3b,
+  0x800000a8, 0x00069461, 0x00010c74, 0x00018c6c, 0x0001cc45, 0x00018c75,
+  0x0001d871, 0x00019861, 0x0000053b, 0x800000a9, 0x00015869, 0x0000153b,
+  0x00019864, 0x0000f86c, 0x800000aa, 0x0000fc65, 0x0001606c, 0x0001c463,
+  0x0000e872, 0x00001d3b, 0x800000ab, 0x800000ac, 0x00000d3b, 0x0001b044,
+  0x0001ec63, 0x0000093b, 0x0000e079, 0x800000ad, 0x00019063, 0x0001a065,
+  0x0000e86b, 0x00007d3b, 0x800000ae, 0x00000d3b, 0x800000af, 0x0001d469,
+  0x00018872, 0x0000e063, 0x0000053b, 0x800000b0, 0x0000e872, 0x00000d3b,
+  0x800000b1, 0x0000c474, 0x00019062, 0x0001c065, 0x0001806c, 0x00002872,
+  0x001da841, 0x00073474, 0x00018063, 0x00019070, 0x800000b2, 0x0001cc69,
+  0x00019c61, 0x0000b065, 0x00019c70, 0x00008c66, 0x00019872, 0x00019474,
+  0x0001c47a, 0x00008865, 0x800000b3, 0x00010061, 0x0000513b, 0x00007d3b,
+  0x0001ac6f, 0x0001bc4c, 0x0000353b, 0x00017469, 0x0001fc70, 0x0001a06e,
+  0x0000e472, 0x800000b4, 0x0000053b, 0x800000b5, 0x800000b6, 0x00011c48,
+  0x0000093b, 0x00014472, 0x0000bc61, 0x0001846f, 0x0000e063, 0x0001f06c,
+  0x00013863, 0x0000005b, 0x0001386e, 0x0000b466, 0x0000e869, 0x0001946f,
+  0x00036079, 0x0000386b, 0x00027445, 0x0001ac44, 0x0001586f, 0x0001e075,
+  0x00024c75, 0x00015c6d, 0x0001d473, 0x00017874, 0x0001a075, 0x0001806e,
+  0x00026075, 0x0007d84c, 0x0000113b, 0x0000e870, 0x0001cc6d, 0x00018077,
+  0x800000b7, 0x00031c6c, 0x00000040, 0x00022069, 0x00021471, 0x0000093b,
+  0x00024c61, 0x800000b8, 0x000f886f, 0x0000906e, 0x0000006d, 0x00025063,
+  0x00010463, 0x0000093b, 0x0001f861, 0x800000b9, 0x00012467, 0x00013466,
+  0x0002606c, 0x00012c64, 0x0000e867, 0x00000d3b, 0x800000ba, 0x0001f863,
+  0x0000e879, 0x00000d3b, 0x800000bb, 0x00025063, 0x000fcc73, 0x0000e465,
+  0x00019874, 0x00001d3b, 0x800000bc, 0x00017072, 0x000f9875, 0x000ff474,
+  0x00013c69, 0x00010c4a, 0x0000e863, 0x00002d3b, 0x0001504f, 0x00043c45,
+  0x00034846, 0x00034847, 0x800000bd, 0x800000be, 0x00000d3b, 0x0001c86f,
+  0x0003144c, 0x0000e474, 0x00012845, 0x0000793b, 0x00008479, 0x800000bf,
+  0x0000f072, 0x00033053, 0x00031c54, 0x00000d3b, 0x800000c0, 0x0001bc72,
+  0x00019c76, 0x0001dc61, 0x0000e865, 0x00001d3b, 0x800000c1, 0x00000d3b,
+  0x800000c2, 0x00011472, 0x00003463, 0x00000d3b, 0x800000c3, 0x0001906e,
+  0x0001a067, 0x0001a069, 0x0001cc61, 0x0001dc72, 0x0000f849, 0x00012079,
+  0x800000c4, 0x00008873, 0x0001e069, 0x00001d3b, 0x0001ac6c, 0x800000c5,
+  0x800000c6, 0x0001a465, 0x0000753b, 0x0000c86c, 0x00018c72, 0x000c0074,
+  0x0001a461, 0x00015476, 0x00018473, 0x00017462, 0x0000053b, 0x800000c7,
+  0x00018465, 0x00000c6e, 0x00012c63, 0x000e4470, 0x00011867, 0x0001ac74,
+  0x0001446f, 0x0001b869, 0x00018473, 0x00000d3b, 0x800000c8, 0x00011061,
+  0x0001906c, 0x000ea865, 0x0000613b, 0x0001f069, 0x00015c69, 0x00019065,
+  0x0000fc61, 0x00005d3b, 0x0001b86f, 0x000e646c, 0x800000c9, 0x0001a86d,
+  0x0001ec6d, 0x00017872, 0x00015070, 0x0001fc6d, 0x800000ca, 0x00018c69,
+  0x0000b873, 0x800000cb, 0x000e406f, 0x0000193b, 0x800000cc, 0x800000cd,
+  0x000e7c43, 0x000e4867, 0x000f106e, 0x0000f066, 0x000fe93b, 0x0000e061,
+  0x000fe53b, 0x0000d472, 0x0001f463, 0x00000d3b, 0x800000ce, 0x000e5869,
+  0x00019864, 0x00000d3b, 0x800000cf, 0x0000e465, 0x0001f463, 0x0000253b,
+  0x0001d874, 0x0001806b, 0x0000f879, 0x00018c6d, 0x0001cc70, 0x000e1c54,
+  0x800000d0, 0x0000093b, 0x0000e06c, 0x800000d1, 0x00018872, 0x0000e063,
+  0x0000053b, 0x800000d2, 0x00013869, 0x0001a063, 0x0000053b, 0x800000d3,
+  0x0001cc66, 0x0000e072, 0x0000053b, 0x800000d4, 0x0000e866, 0x0000093b,
+  0x0001a865, 0x800000d5, 0x0001c063, 0x000e086f, 0x0000e872, 0x0000713b,
+  0x0000a479, 0x0001f873, 0x00019072, 0x800000d6, 0x0000e479, 0x0001e063,
+  0x0000393b, 0x00019475, 0x800000d7, 0x0001806b, 0x0001fc63, 0x0000153b,
+  0x0000f079, 0x0001ec63, 0x800000d8, 0x00011479, 0x00007848, 0x0000153b,
+  0x0001884a, 0x0001fc63, 0x800000d9, 0x0000e079, 0x0000053b, 0x800000da,
+  0x0000e061, 0x0001cc70, 0x00018c70, 0x00001d3b, 0x800000db, 0x0001e465,
+  0x00017463, 0x0001d069, 0x0001d864, 0x0000f879, 0x0000053b, 0x800000dc,
+  0x0000053b, 0x800000dd, 0x0000d472, 0x0000f86c, 0x0000093b, 0x00011c6c,
+  0x800000de, 0x0000193b, 0x00016870, 0x800000df, 0x0001386f, 0x800000e0,
+  0x00000066, 0x0000e472, 0x0001f863, 0x0000f13b, 0x00018075, 0x0000d079,
+  0x0000b865, 0x00012c6f, 0x0001fc64, 0x00014061, 0x00006d3b, 0x00010c63,
+  0x00035467, 0x00018462, 0x00012866, 0x0000753b, 0x0001cc74, 0x800000e1,
+  0x800000e2, 0x00001d3b, 0x800000e3, 0x00024c63, 0x0000dc61, 0x800000e4,
+  0x00039c56, 0x800000e5, 0x0000353b, 0x00015873, 0x00030866, 0x00022c74,
+  0x0003206e, 0x0001a461, 0x0002044a, 0x00024063, 0x0003ed3b, 0x00022865,
+  0x00027872, 0x00000d3b, 0x800000e6, 0x0000d072, 0x0000053b, 0x800000e7,
+  0x0001f465, 0x0002e872, 0x00021c6e, 0x0000713b, 0x0001dc61, 0x0002006d,
+  0x00019472, 0x800000e8, 0x00029c70, 0x0001b864, 0x0001bc69, 0x0000353b,
+  0x0000d079, 0x0000e46c, 0x800000e9, 0x00000d3b, 0x800000ea, 0x0001a867,
+  0x00007474, 0x00019c6c, 0x00032854, 0x0001fc65, 0x00012066, 0x0001746e,
+  0x0001cc42, 0x00019872, 0x0001bc61, 0x0004a46f, 0x0038006c, 0x0004686d,
+  0x0001a463, 0x00011863, 0x0001886b, 0x00012461, 0x00046066, 0x0001dc65,
+  0x00009074, 0x0001a465, 0x000cdc65, 0x00000d3b, 0x800000eb, 0x0001c06f,
+  0x0000e077, 0x00053473, 0x0001a872, 0x00003d3b, 0x800000ec, 0x003a6073,
+  0x0001cc61, 0x0000f072, 0x00000d3b, 0x0001e472, 0x003b5474, 0x800000ed,
+  0x00003c41, 0x00019469, 0x0001dc43, 0x0001bc67, 0x0001e068, 0x00013844,
+  0x0001ec72, 0x0006b046, 0x00010074, 0x0001f441, 0x0001c46f, 0x0000193b,
+  0x0000f077, 0x800000ee, 0x00005442, 0x0001a872, 0x00018465, 0x00000d3b,
+  0x800000ef, 0x0006dc52, 0x00079455, 0x00064054, 0x0001986c, 0x00077856,
+  0x00018869, 0x00015869, 0x0000c53b, 0x00016c6c, 0x00012442, 0x00010477,
+  0x0001d852, 0x00016c75, 0x0007a061, 0x0001906e, 0x00002067, 0x0001b461,
+  0x0001386f, 0x0001ec65, 0x00014462, 0x00019472, 0x0001f06b, 0x00002074,
+  0x00062041, 0x800000f0, 0x0000493b, 0x0001b863, 0x000cf93b, 0x0001e074,
+  0x0001ac63, 0x0001b065, 0x0001486e, 0x00071c72, 0x00019054, 0x00019c65,
+  0x0001bc56, 0x00036465, 0x0001d46f, 0x0006286f, 0x0001a465, 0x0007f53b,
+  0x00040065, 0x00063c56, 0x800000f1, 0x0000a072, 0x00065874, 0x0000e072,
+  0x0000053b, 0x800000f2, 0x0001cc61, 0x00071472, 0x800000f3, 0x0001806c,
+  0x0001b86f, 0x0001c46f, 0x0000e872, 0x00001d3b, 0x800000f4, 0x00019069,
+  0x0001dc67, 0x00069074, 0x0001c072, 0x0001a868, 0x0001b872, 0x0001c06f,
+  0x0000e877, 0x00000d3b, 0x800000f5, 0x0001b465, 0x0001b474, 0x0001d463,
+  0x0001d06f, 0x0000193b, 0x0000f072, 0x800000f6, 0x0000053b, 0x800000f7,
+  0x00019065, 0x00001065, 0x0001cc72, 0x0001a072, 0x0001d86f, 0x0000e477,
+  0x800000f8, 0x0000053b, 0x00018865, 0x0001dc63, 0x0001a474, 0x0000f872,
+  0x0001d46f, 0x800000f9, 0x00000d3b, 0x0001f069, 0x0001a067, 0x0001986e,
+  0x0001b461, 0x0000f465, 0x0001886c, 0x00000d3b, 0x800000fa, 0x0001c472,
+  0x800000fb, 0x0000053b, 0x0001cc61, 0x0000e472, 0x00004c61, 0x00002071,
+  0x0000053b, 0x800000fc, 0x00007475, 0x00010470, 0x0001486e, 0x0001186c,
+  0x0001b844, 0x0001ec6f, 0x00019056, 0x0001b065, 0x0001c863, 0x00019477,
+  0x0000153b, 0x00001c45, 0x00005c42, 0x0001fc65, 0x0001cc74, 0x800000fd,
+  0x0001dc63, 0x00008072, 0x0001c46f, 0x00019074, 0x0001f054, 0x800000fe,
+  0x00014856, 0x00016065, 0x0001c46f, 0x00018856, 0x00003d3b, 0x0000e872,
+  0x800000ff, 0x00011c69, 0x0001b465, 0x00012c63, 0x0001b474, 0x00017465,
+  0x0001cc6f, 0x00036072, 0x0000d041, 0x0000c472, 0x0001c461, 0x00019874,
+  0x80000100, 0x0001e863, 0x00034072, 0x0033204f, 0x00019865, 0x80000101,
+  0x0001d86f, 0x00001d3b, 0x80000102, 0x0002146f, 0x003d6453, 0x0000f856,
+  0x0002286f, 0x0000153b, 0x80000103, 0x00021065, 0x0001cc61, 0x0000dc72,
+  0x00022872, 0x00007842, 0x0000293b, 0x00024467, 0x80000104, 0x80000105,
+  0x0003713b, 0x0003b13b, 0x00027072, 0x00031077, 0x0001d468, 0x00018874,
+  0x0001cc61, 0x0001f472, 0x00024c72, 0x0000e077, 0x0003d13b, 0x0001b873,
+  0x0001dc71, 0x0001686c, 0x00018075, 0x0001b861, 0x0001cc47, 0x00020c72,
+  0x0001c861, 0x0001dc65, 0x00018874, 0x0003a93b, 0x0000e072, 0x00018075,
+  0x0001c045, 0x0001d871, 0x00016875, 0x0001a46c, 0x0000053b, 0x80000106,
+  0x00010c6c, 0x0003ac63, 0x00017445, 0x0001a461, 0x0001d847, 0x00010446,
+  0x00000c6c, 0x0001e461, 0x00019072, 0x00018c65, 0x00019c74, 0x0001884c,
+  0x0001cc65, 0x0000f072, 0x0000053b, 0x80000107, 0x0001b465, 0x0000713b,
+  0x0001c473, 0x00006054, 0x00009873, 0x80000108, 0x0001886c, 0x0001e46e,
+  0x0001b853, 0x0001b061, 0x00011c74, 0x0000fc6c, 0x0001c045, 0x0001c871,
+  0x00018c75, 0x0000093b, 0x0001ac61, 0x80000109, 0x0001bc69, 0x00018064,
+  0x00001d3b, 0x0001986c, 0x0000f465, 0x8000010a, 0x0000b472, 0x8000010b,
+  0x00018074, 0x0001c061, 0x0001d866, 0x0001d472, 0x0001b072, 0x8000010c,
+  0x8000010d, 0x0001a46f, 0x00005d3b, 0x0000e077, 0x0000713b, 0x0001ac64,
+  0x00018c69, 0x003e6467, 0x0000c074, 0x0001d46f, 0x00010c41, 0x00012072,
+  0x8000010e, 0x003f0450, 0x00017469, 0x00001d3b, 0x0001e874, 0x0001306f,
+  0x00019c65, 0x00012c66, 0x0001406e, 0x00014c72, 0x0000dc77, 0x00013841,
+  0x0001a467, 0x0001e068, 0x0000093b, 0x0001dc72, 0x8000010f, 0x0001c874,
+  0x0001b872, 0x0001d46f, 0x0001c867, 0x0000a477, 0x00011874, 0x0001c472,
+  0x00019c72, 0x0001e869, 0x0001c068, 0x003e5c65, 0x00010c52, 0x0001d041,
+  0x00038442, 0x0003f842, 0x0001c86f, 0x003ed877, 0x003efc70, 0x003ff13b,
+  0x003e6874, 0x003f1877, 0x003e144c, 0x80000110, 0x0000053b, 0x80000111,
+  0x003e3866, 0x0001c461, 0x0001cc72, 0x00018072, 0x0001d86f, 0x0000e077,
+  0x0000053b, 0x80000112, 0x00019869, 0x0001ac67, 0x0001d468, 0x0001f874,
+  0x0001cc61, 0x0001c472, 0x0001b872, 0x0001f06f, 0x0000053b, 0x80000113,
+  0x0001cc72, 0x0001fc68, 0x0000dc77, 0x00019069, 0x00019467, 0x0001d861,
+  0x00019874, 0x0001206f, 0x003e1052, 0x00013072, 0x003ec06c, 0x00014c72,
+  0x0000e877, 0x00001d3b, 0x80000114, 0x0000e066, 0x0000053b, 0x80000115,
+  0x0001cc65, 0x00012072, 0x00018065, 0x00011474, 0x0001cc66, 0x0001884c,
+  0x0001b072, 0x0001cc41, 0x0001b872, 0x0001d06f, 0x0000f477, 0x00018852,
+  0x0000053b, 0x80000116, 0x0001f441, 0x00019467, 0x0001a069, 0x0001c072,
+  0x0001c868, 0x00005472, 0x00012c74, 0x0000093b, 0x00013872, 0x80000117,
+  0x00011877, 0x0001d86f, 0x0001d063, 0x0000153b, 0x0000f072, 0x0001946f,
+  0x80000118, 0x80000119, 0x00003d3b, 0x0000e868, 0x00018072, 0x0000f46b,
+  0x00009470, 0x00000d3b, 0x8000011a, 0x00018c69, 0x0000113b, 0x0000f479,
+  0x0000113b, 0x003dc86d, 0x8000011b, 0x0001b474, 0x8000011c, 0x00003d3b,
+  0x8000011d, 0x00019c75, 0x00019c61, 0x00018070, 0x0001446c, 0x8000011e,
+  0x00019063, 0x00001865, 0x00011864, 0x00017461, 0x0000fd3b, 0x00012c63,
+  0x0001b469, 0x00018465, 0x0001e466, 0x0001e46e, 0x0001606c, 0x0001d469,
+  0x0001cc74, 0x00018472, 0x0000b466, 0x0000b472, 0x0001b075, 0x00019c6f,
+  0x0001dc75, 0x003fe873, 0x0001a46e, 0x00025073, 0x0000c073, 0x00032475,
+  0x0001cc6c, 0x00033866, 0x0001a470, 0x8000011f, 0x00000d3b, 0x0003ed3b,
+  0x00030872, 0x0002186f, 0x0001b072, 0x0003f93b, 0x80000120, 0x80000121,
+  0x0000053b, 0x80000122, 0x00022863, 0x00000d3b, 0x80000123, 0x00003d3b,
+  0x80000124, 0x0001804a, 0x0001e063, 0x0000f079, 0x0000053b, 0x80000125,
+  0x0001d063, 0x0001ac75, 0x00019074, 0x0000e065, 0x0000053b, 0x80000126,
+  0x0000093b, 0x0000e86e, 0x80000127, 0x00019864, 0x0001b469, 0x0000e06c,
+  0x0000053b, 0x80000128, 0x0000093b, 0x003d413b, 0x80000129, 0x00013c61,
+  0x00018863, 0x00017c67, 0x00013c61, 0x0002bc61, 0x00019474, 0x00077066,
+  0x00018065, 0x00015065, 0x0001dc69, 0x00019876, 0x00014c65, 0x00018465,
+  0x0007806f, 0x00001c54, 0x0001d464, 0x00007456, 0x00088073, 0x0007d477,
+  0x0001fc69, 0x0001646d, 0x0001e84d, 0x00009c73, 0x000e2c75, 0x000f7c74,
+  0x00019875, 0x0001d453, 0x00018063, 0x00007079, 0x00018070, 0x00019061,
+  0x0001f93b, 0x0000e865, 0x8000012a, 0x00019069, 0x0001a868, 0x003dbc65,
+  0x0001f053, 0x0001486b, 0x0001a063, 0x0001ac63, 0x00018c70, 0x0000f865,
+  0x0001b861, 0x0001586e, 0x0000753b, 0x0001f070, 0x0001cc53, 0x00010c79,
+  0x00018061, 0x8000012b, 0x8000012c, 0x00018063, 0x0000193b, 0x00017c6e,
+  0x0000e465, 0x0001e865, 0x0001b054, 0x00012053, 0x0000f065, 0x00017061,
+  0x00015468, 0x0000fd3b, 0x00014447, 0x0001a472, 0x00016c69, 0x00016c70,
+  0x8000012d, 0x00006d3b, 0x00016c63, 0x0001fc47, 0x00019074, 0x0001a465,
+  0x0001f472, 0x006e3834, 0x00012064, 0x0001dc74, 0x00062474, 0x0000453b,
+  0x0006244c, 0x00063c4c, 0x00018065, 0x0001b861, 0x0000353b, 0x0007f93b,
+  0x00051c54, 0x0001b461, 0x0001bc72, 0x00064442, 0x8000012e, 0x0001f465,
+  0x000000ea, 0x00060070, 0x8000012f, 0x00040072, 0x0007b13b, 0x80000130,
+  0x0001cc65, 0x00076472, 0x0001c865, 0x0001d073, 0x00069c73, 0x0001c065,
+  0x0001c873, 0x00074473, 0x0001ac4c, 0x00070065, 0x0001a069, 0x00070c72,
+  0x0001806e, 0x80000131, 0x0001cc42, 0x0001e472, 0x0001a861, 0x0007506b,
+  0x80000132, 0x00018865, 0x00019872, 0x0001a86b, 0x00016069, 0x0001bc65,
+  0x00064c53, 0x00019c61, 0x00016061, 0x00014067, 0x0000053b, 0x80000133,
+  0x0000053b, 0x80000134, 0x0001706e, 0x00019c63, 0x00065c6e, 0x00001065,
+  0x80000135, 0x00000066, 0x0001ac6e, 0x00000d3b, 0x0001806f, 0x0001dc72,
+  0x0001c467, 0x00018875, 0x0001b065, 0x0000e474, 0x0001dc6e, 0x00007d3b,
+  0x80000136, 0x0000c870, 0x0001cc75, 0x0001d861, 0x0000093b, 0x0000e870,
+  0x80000137, 0x0001e06f, 0x00009074, 0x00018c6c, 0x00019475, 0x00007456,
+  0x0001fc70, 0x0001a062, 0x00005474, 0x00014865, 0x00004843, 0x00002c72,
+  0x0001a069, 0x0001c065, 0x00010c6c, 0x0001dc42, 0x0000b072, 0x0001fc65,
+  0x000f9854, 0x00019463, 0x000f2056, 0x0001c865, 0x000c7050, 0x00019461,
+  0x000dac52, 0x000d5c53, 0x00022c4c, 0x00001d3b, 0x000ccc4e, 0x00019c61,
+  0x00022c48, 0x0001ec6d, 0x80000138, 0x0001f86e, 0x00000044, 0x00015445,
+  0x0000193b, 0x00014047, 0x80000139, 0x0000f074, 0x00015861, 0x00006043,
+  0x0001086c, 0x00018c64, 0x00017475, 0x0001a869, 0x00037c6c, 0x0001806c,
+  0x00003d3b, 0x0000e865, 0x8000013a, 0x8000013b, 0x0001c873, 0x0000153b,
+  0x0001b474, 0x0001d069, 0x8000013c, 0x00026861, 0x0001f865, 0x00020871,
+  0x00008873, 0x00020c65, 0x0001c078, 0x0002dc64, 0x0003206c, 0x00022071,
+  0x0001f845, 0x0001b072, 0x00018061, 0x00025065, 0x0001bc6c, 0x0001a871,
+  0x00024845, 0x0001086c, 0x0003a13b, 0x00025c74, 0x0000e872, 0x00001d3b,
+  0x8000013d, 0x0000093b, 0x00027475, 0x8000013e, 0x0001bc61, 0x00026475,
+  0x00018c75, 0x0000f06c, 0x0000053b, 0x8000013f, 0x0001d461, 0x0001ec74,
+  0x00023872, 0x0001c465, 0x0000e872, 0x00001d3b, 0x80000140, 0x0001c073,
+  0x0000d073, 0x0001c465, 0x00043065, 0x00000d3b, 0x80000141, 0x0001946c,
+  0x00029c74, 0x0001d871, 0x00017875, 0x00014461, 0x0001206e, 0x0001b861,
+  0x0000193b, 0x0000e86c, 0x80000142, 0x0001bc69, 0x0002dc6c, 0x0000d065,
+  0x0000053b, 0x80000143, 0x0001b075, 0x0001dc6d, 0x00011870, 0x0001c077,
+  0x0001c044, 0x00019845, 0x0001dc48, 0x0001ac6f, 0x0001ac75, 0x00012c6e,
+  0x0001c46d, 0x0000e470, 0x80000144, 0x0000053b, 0x0001c071, 0x0001bc61,
+  0x0000e86c, 0x00001d3b, 0x80000145, 0x00019475, 0x00006065, 0x00047c74,
+  0x00002c66, 0x0001a872, 0x00019c69, 0x0001886e, 0x0001a461, 0x000c0065,
+  0x00018467, 0x0000d872, 0x0001c871, 0x000ed047, 0x0000693b, 0x0001ac6c,
+  0x00018871, 0x80000146, 0x0001ec61, 0x0001fc75, 0x80000147, 0x0001b861,
+  0x80000148, 0x0000f86c, 0x80000149, 0x0001fc73, 0x0000113b, 0x8000014a,
+  0x0000e46c, 0x000f8873, 0x0000353b, 0x00016875, 0x0001346e, 0x0001546c,
+  0x00016072, 0x0000c53b, 0x00015061, 0x00018c74, 0x0001dc61, 0x00018065,
+  0x00000072, 0x00011874, 0x0001b445, 0x0001c465, 0x0001d873, 0x00016c61,
+  0x0001c465, 0x00007053, 0x00008054, 0x0000b873, 0x8000014b, 0x00039454,
+  0x00018075, 0x0001b861, 0x000b746f, 0x000f246c, 0x0000184c, 0x00018869,
+  0x8000014c, 0x000f3865, 0x0000393b, 0x8000014d, 0x0001fc71, 0x00018c6c,
+  0x0001b864, 0x0003f445, 0x00000846, 0x00007447, 0x000f513b, 0x000fe13b,
+  0x0000053b, 0x8000014e, 0x0001c865, 0x0001dc73, 0x00019074, 0x0001ac65,
+  0x00017c64, 0x00019872, 0x00018065, 0x0001cc61, 0x00019074, 0x0001c465,
+  0x000e0072, 0x0001ec72, 0x0001ac47, 0x00018865, 0x0001d461, 0x00018874,
+  0x0001c065, 0x0000093b, 0x0000e072, 0x8000014f, 0x0001d873, 0x0001804c,
+  0x0001c465, 0x0001904c, 0x0001c465, 0x00012073, 0x00013473, 0x0000f93b,
+  0x00001073, 0x80000150, 0x00019072, 0x00019065, 0x00019063, 0x00019c65,
+  0x0001ac64, 0x0000d473, 0x0001f065, 0x00000d3b, 0x80000151, 0x0001c871,
+  0x00018075, 0x0001b861, 0x0000793b, 0x0000e86c, 0x80000152, 0x00018c6c,
+  0x0001cc6e, 0x0001bc61, 0x0001ec71, 0x00012c74, 0x0000393b, 0x00019861,
+  0x80000153, 0x00002072, 0x0001b075, 0x0001f845, 0x00019c76, 0x0000c06c,
+  0x0001d465, 0x00005c45, 0x00002865, 0x00007053, 0x00019073, 0x0000e465,
+  0x0001906c, 0x0001b865, 0x0001906d, 0x00018065, 0x0000e074, 0x0001d46e,
+  0x0001dc67, 0x0000153b, 0x00018469, 0x0001b854, 0x80000154, 0x00015053,
+  0x0001906e, 0x0001b872, 0x0001b061, 0x00019867, 0x0002b463, 0x0001e468,
+  0x00019469, 0x00003445, 0x00010474, 0x0001706c, 0x00016075, 0x0000f472,
+  0x0002106e, 0x0000093b, 0x80000155, 0x80000156, 0x00036865, 0x00012061,
+  0x00013471, 0x0001ac61, 0x0000b46c, 0x80000157, 0x0001e061, 0x0001c473,
+  0x000f6453, 0x0001d871, 0x0001b475, 0x0001dc65, 0x00018872, 0x0002bc75,
+  0x00023875, 0x000fcc54, 0x00032074, 0x0001ac61, 0x00005d3b, 0x0001dc65,
+  0x00019075, 0x80000158, 0x0000c86c, 0x000fe04c, 0x0001e471, 0x00023c72,
+  0x00052867, 0x00032474, 0x000f4047, 0x00020c71, 0x000f0c45, 0x0003ed3b,
+  0x000ce445, 0x00037d3b, 0x00025862, 0x0003d93b, 0x80000159, 0x0001a073,
+  0x00023465, 0x000ca042, 0x00021c65, 0x00000d3b, 0x8000015a, 0x00019c75,
+  0x00000d3b, 0x0001bc61, 0x0000e46c, 0x8000015b, 0x0001cc70, 0x0001d865,
+  0x00019873, 0x0000f074, 0x0000053b, 0x8000015c, 0x00018c61, 0x0001e071,
+  0x00000d3b, 0x0000e86c, 0x0001b475, 0x8000015d, 0x00019065, 0x00019c65,
+  0x00013c64, 0x8000015e, 0x00010462, 0x00025863, 0x0000e873, 0x0000f13b,
+  0x0001d071, 0x00018875, 0x0001b461, 0x0000d06c, 0x0000053b, 0x8000015f,
+  0x0001806c, 0x00026461, 0x00011074, 0x0001c845, 0x0001d071, 0x0001f475,
+  0x0000f86c, 0x80000160, 0x0001ac70, 0x0001bc61, 0x0001bc69, 0x0000113b,
+  0x0000d465, 0x0001a46c, 0x0000053b, 0x80000161, 0x0001a464, 0x0001d472,
+  0x0001d465, 0x00006073, 0x80000162, 0x80000163, 0x0001d465, 0x00040074,
+  0x0001d071, 0x00019c75, 0x0000e46c, 0x0001b461, 0x0001e53b, 0x00018469,
+  0x00018c64, 0x0001e475, 0x0001986c, 0x00003453, 0x00004454, 0x80000164,
+  0x0007d465, 0x80000165, 0x0001b071, 0x0001a861, 0x0000753b, 0x0001d045,
+  0x80000166, 0x00018475, 0x0001f071, 0x0000f86c, 0x0001506c, 0x00016074,
+  0x00052444, 0x00013042, 0x00014461, 0x00002045, 0x0000293b, 0x00018875,
+  0x0001d86c, 0x0000106c, 0x0001a869, 0x00018c64, 0x00018c6c, 0x0000c865,
+  0x00012c72, 0x0001cc65, 0x0001e869, 0x0001c06c, 0x00003045, 0x80000167,
+  0x00001d3b, 0x00007d3b, 0x0000e072, 0x0000b872, 0x0001d461, 0x00018063,
+  0x80000168, 0x0001b863, 0x00061472, 0x006e7c57, 0x0001a861, 0x0003ec45,
+  0x0003e042, 0x00060463, 0x0000053b, 0x80000169, 0x8000016a, 0x0003d045,
+  0x000ccd3b, 0x0003b045, 0x0007353b, 0x0001bc69, 0x0001946c, 0x00018864,
+  0x0000e865, 0x0007e53b, 0x0000053b, 0x8000016b, 0x0001b445, 0x0001a86c,
+  0x00045c69, 0x00001d3b, 0x8000016c, 0x0001dc75, 0x00019074, 0x00009065,
+  0x0000053b, 0x8000016d, 0x0000e863, 0x00001d3b, 0x8000016e, 0x00000d3b,
+  0x8000016f, 0x00018c62, 0x00018c6c, 0x0000093b, 0x00019461, 0x80000170,
+  0x0000f863, 0x0000e072, 0x0000053b, 0x80000171, 0x0001d46d, 0x00069c69,
+  0x00005c6f, 0x00019872, 0x0001dc61, 0x00019876, 0x0000e865, 0x0000293b,
+  0x0001d463, 0x00017064, 0x0001ec67, 0x00011066, 0x0006d861, 0x80000172,
+  0x00019863, 0x00009872, 0x00018865, 0x00007c79, 0x0000053b, 0x80000173,
+  0x0001fc61, 0x00018867, 0x0000dc61, 0x80000174, 0x0000ec75, 0x0000f074,
+  0x0000353b, 0x00037476, 0x00007c69, 0x00005070, 0x0000b473, 0x00016472,
+  0x0001c463, 0x0000e06e, 0x0000193b, 0x000b7872, 0x80000175, 0x00019470,
+  0x0000e866, 0x0000393b, 0x0001006e, 0x80000176, 0x0001d875, 0x0001d043,
+  0x0001a865, 0x0001ec6c, 0x0001bc72, 0x0001ac79, 0x0001a062, 0x00014c65,
+  0x00018075, 0x0001fc51, 0x0001806c, 0x0001c86f, 0x0001f06f, 0x00003d3b,
+  0x80000177, 0x00018075, 0x80000178, 0x0000053b, 0x80000179, 0x0000053b,
+  0x00016874, 0x0000d93b, 0x00016844, 0x00003465, 0x0001a475, 0x00000c65,
+  0x0001d86f, 0x0000cc68, 0x00018074, 0x00000c72, 0x00025068, 0x8000017a,
+  0x00019c73, 0x0001c861, 0x0001d869, 0x00007d3b, 0x00020c6d, 0x00079054,
+  0x00019463, 0x0000093b, 0x8000017b, 0x8000017c, 0x0001a464, 0x00018851,
+  0x0001986c, 0x0001a46d, 0x0000c865, 0x0003e53b, 0x0003e13b, 0x0001d065,
+  0x0000f873, 0x00077446, 0x00077c45, 0x0001d46c, 0x8000017d, 0x0003006c,
+  0x8000017e, 0x0001d065, 0x0004dc45, 0x00010472, 0x0001bc42, 0x0000d472,
+  0x0001f461, 0x00000d3b, 0x8000017f, 0x00019061, 0x0001e063, 0x00000d3b,
+  0x80000180, 0x00009074, 0x0000093b, 0x00009c65, 0x80000181, 0x0001a065,
+  0x0001b450, 0x00019872, 0x00019065, 0x00025c74, 0x0001fc61, 0x0001dc65,
+  0x0000113b, 0x0001c472, 0x0001fc6e, 0x00015073, 0x80000182, 0x0001a46b,
+  0x0001c869, 0x00000073, 0x0001cc72, 0x00018c66, 0x0001d061, 0x0001ac74,
+  0x0001b863, 0x0001b469, 0x00001d3b, 0x0001886c, 0x0000106f, 0x0001a461,
+  0x0000ac69, 0x0001f868, 0x0004c06c, 0x80000183, 0x00000d3b, 0x0000e879,
+  0x0000f472, 0x80000184, 0x0000053b, 0x80000185, 0x001f1873, 0x001c0072,
+  0x0000053b, 0x80000186, 0x0000e469, 0x80000187, 0x00001d3b, 0x0000504d,
+  0x0001c875, 0x00013c73, 0x0001b069, 0x0001c475, 0x0001d86e, 0x0000f073,
+  0x0000093b, 0x0001f461, 0x80000188, 0x00018469, 0x0001886e, 0x0001b463,
+  0x00018872, 0x0001e86c, 0x0001ac70, 0x0001c465, 0x0001e46e, 0x80000189,
+  0x0001c061, 0x001fa873, 0x0000e865, 0x0000713b, 0x8000018a, 0x8000018b,
+  0x8000018c, 0x00000d3b, 0x0000d066, 0x00019863, 0x00017865, 0x0000193b,
+  0x00012071, 0x8000018d, 0x00018070, 0x00012045, 0x00019864, 0x00019075,
+  0x0001f86e, 0x00010465, 0x0001b461, 0x0000146c, 0x0001e471, 0x0000313b,
+  0x0001c874, 0x00019461, 0x00019c75, 0x8000018e, 0x0001c461, 0x0001946c,
+  0x004af035, 0x004a9c38, 0x0001a069, 0x0000b46c, 0x00018864, 0x001dc856,
+  0x0001886c, 0x0000e065, 0x0000393b, 0x001f5c54, 0x8000018f, 0x000000f7,
+  0x0005113b, 0x001f346e, 0x00019c6d, 0x80000190, 0x001f1065, 0x001c4442,
+  0x001f593b, 0x001ff13b, 0x0001d064, 0x00019075, 0x0001d463, 0x0000e074,
+  0x0000053b, 0x80000191, 0x0001d472, 0x0001ac74, 0x0001c06f, 0x0001a069,
+  0x001e646f, 0x00000d3b, 0x80000192, 0x0000793b, 0x0000906c, 0x80000193,
+  0x0000f472, 0x0001cc63, 0x0000053b, 0x80000194, 0x0001cc70, 0x00003d3b,
+  0x80000195, 0x0000d469, 0x002cf855, 0x00001d3b, 0x80000196, 0x0000e072,
+  0x0000053b, 0x80000197, 0x0001c46f, 0x00019470, 0x0000f066, 0x80000198,
+  0x0001c063, 0x0000193b, 0x0000d472, 0x80000199, 0x00003d3b, 0x00011866,
+  0x0001cc61, 0x0001d472, 0x0000e872, 0x00000d3b, 0x8000019a, 0x00009047,
+  0x0000053b, 0x8000019b, 0x0000fc65, 0x0001cc75, 0x00018c74, 0x8000019c,
+  0x00000d3b, 0x0000d067, 0x0000053b, 0x8000019d, 0x0000e872, 0x0000153b,
+  0x0001ec73, 0x0001fd3b, 0x8000019e, 0x0000e46c, 0x00002c42, 0x00001c63,
+  0x8000019f, 0x0000c06e, 0x0001a46f, 0x0001b872, 0x00011c62, 0x0000bc45,
+  0x0000093b, 0x0001f861, 0x800001a0, 0x00013873, 0x0000706e, 0x00019c65,
+  0x0001a064, 0x0001c069, 0x00006072, 0x0000f079, 0x00001d3b, 0x0000e86c,
+  0x00013c75, 0x800001a1, 0x0000393b, 0x0000ac61, 0x800001a2, 0x0001c065,
+  0x800001a3, 0x00018c72, 0x0001186e, 0x800001a4, 0x00015c6d, 0x0000093b,
+  0x00014065, 0x00012463, 0x0001c075, 0x00010461, 0x00021866, 0x00025855,
+  0x0001a86c, 0x00037065, 0x001fa453, 0x00016865, 0x00025868, 0x00026869,
+  0x00017865, 0x00051c6f, 0x00002874, 0x001fd854, 0x0005e072, 0x00059073,
+  0x00019869, 0x00026c72, 0x00009c74, 0x0001fc45, 0x0003d13b, 0x0005a475,
+  0x0001a06c, 0x00017469, 0x00025475, 0x00016871, 0x001f0465, 0x00027475,
+  0x001f4c45, 0x0000c86d, 0x0003693b, 0x00025869, 0x800001a5, 0x00010870,
+  0x0001c045, 0x00022871, 0x0001b469, 0x0001986c, 0x00018469, 0x0001a872,
+  0x00020869, 0x0001c062, 0x001d653b, 0x0000e06d, 0x0000053b, 0x800001a6,
+  0x0000e872, 0x00000d3b, 0x800001a7, 0x0000f06f, 0x0000053b, 0x800001a8,
+  0x0001a467, 0x0001ec68, 0x00018074, 0x00069861, 0x0001b467, 0x0002086c,
+  0x00018872, 0x0001686b, 0x00001874, 0x00017061, 0x00015863, 0x0001706e,
+  0x00012065, 0x00001d3b, 0x800001a9, 0x0001b072, 0x0001d86f, 0x0000d077,
+  0x0000053b, 0x800001aa, 0x0001cc61, 0x0000fc72, 0x00072054, 0x0007f455,
+  0x00063c56, 0x00007d3b, 0x800001ab, 0x00019065, 0x00011c74, 0x0001d466,
+  0x0001c041, 0x0001e06f, 0x0001cc72, 0x0001b472, 0x00001d3b, 0x0001d841,
+  0x0000e477, 0x00007843, 0x00004044, 0x0001a872, 0x00008446, 0x800001ac,
+  0x0001a065, 0x0001bc69, 0x0001bc6c, 0x0001e86f, 0x0001bc69, 0x0001906e,
+  0x0000d067, 0x00013865, 0x800001ad, 0x0000053b, 0x0001a06c, 0x0001d842,
+  0x0001f875, 0x0003c476, 0x0001f477, 0x0001ec72, 0x0001d862, 0x00006842,
+  0x001da065, 0x0001886b, 0x0001dc65, 0x0001bc61, 0x0000353b, 0x0000e874,
+  0x0002f86f, 0x00018463, 0x0006e466, 0x800001ae, 0x0000b13b, 0x0001ac6e,
+  0x001d3c69, 0x00002c4c, 0x0001b056, 0x00019c65, 0x00019854, 0x001d1865,
+  0x00018465, 0x0001b474, 0x0001dc63, 0x0001f46f, 0x00003c72, 0x00019c65,
+  0x0001a874, 0x00040072, 0x0001c061, 0x0001cc63, 0x00009072, 0x0001d86f,
+  0x800001af, 0x00002d3b, 0x0001a46f, 0x0001b86c, 0x0001cc6f, 0x0000e472,
+  0x0006d856, 0x0007dd3b, 0x00063c72, 0x800001b0, 0x800001b1, 0x0007f53b,
+  0x0000f077, 0x000a5843, 0x00064469, 0x0001d06f, 0x800001b2, 0x00019865,
+  0x0000e865, 0x00001d3b, 0x800001b3, 0x00065472, 0x800001b4, 0x0001b065,
+  0x0001d463, 0x0001b074, 0x0001cc6f, 0x0000f072, 0x0000053b, 0x800001b5,
+  0x0001bc61, 0x0001e46e, 0x0001846c, 0x0001b467, 0x0000053b, 0x800001b6,
+  0x0000f465, 0x0001fc61, 0x00060472, 0x0000393b, 0x0000d072, 0x800001b7,
+  0x0001a061, 0x00018075, 0x0001c871, 0x0000093b, 0x0000e06c, 0x800001b8,
+  0x00011870, 0x0001d46f, 0x0001b044, 0x0001a477, 0x0006106e, 0x00018065,
+  0x0001d463, 0x00018074, 0x0001cc6f, 0x0000e072, 0x0000053b, 0x800001b9,
+  0x00019065, 0x00015465, 0x0001e056, 0x0001b863, 0x0001b456, 0x0001dc6f,
+  0x0001ec54, 0x0001fc65, 0x0000e072, 0x0001ac74, 0x800001ba, 0x0000053b,
+  0x00018865, 0x0001d863, 0x0001dc6f, 0x0001b874, 0x0000053b, 0x800001bb,
+  0x00003061, 0x0000e072, 0x0000e872, 0x00000d3b, 0x800001bc, 0x0001c063,
+  0x00019065, 0x00006842, 0x0003f472, 0x00018074, 0x0001f06f, 0x0001dc61,
+  0x0001b86f, 0x800001bd, 0x0000e472, 0x0001bc72, 0x00007d3b, 0x0001e86c,
+  0x0001d472, 0x800001be, 0x0000153b, 0x0000e877, 0x0001946e, 0x00011c64,
+  0x0001ec6d, 0x800001bf, 0x0000053b, 0x800001c0, 0x00079870, 0x00018049,
+  0x00016469, 0x0001f870, 0x00015067, 0x00019475, 0x0001c065, 0x00016069,
+  0x0001fc68, 0x0000fc73, 0x0001cc72, 0x0001b072, 0x0001f06f, 0x00003d3b,
+  0x800001c1, 0x00018874, 0x0001f061, 0x00007c42, 0x00000445, 0x0000b877,
+  0x00003056, 0x0001b461, 0x800001c2, 0x0000d472, 0x0002546c, 0x800001c3,
+  0x00024844, 0x00022074, 0x0001d463, 0x0001e46c, 0x0000213b, 0x0007cc41,
+  0x0002f046, 0x00026879, 0x00030864, 0x00031c68, 0x800001c4, 0x0000313b,
+  0x00032d3b, 0x0003fd3b, 0x0002c865, 0x00026065, 0x00027065, 0x00000d3b,
+  0x800001c5, 0x00011c43, 0x00018848, 0x0001ec63, 0x00013848, 0x0000f079,
+  0x0000093b, 0x0002c44f, 0x800001c6, 0x00009079, 0x0000053b, 0x800001c7,
+  0x00018854, 0x0001f863, 0x0000e879, 0x00000d3b, 0x800001c8, 0x0001ec63,
+  0x0000e465, 0x00026075, 0x0000053b, 0x800001c9, 0x0000053b, 0x800001ca,
+  0x0001486f, 0x0000e93b, 0x00014472, 0x00001863, 0x0000186e, 0x00015c61,
+  0x0001b466, 0x800001cb, 0x0001e869, 0x00014463, 0x0000693b, 0x00049042,
+  0x0001ec68, 0x0000dc69, 0x00018c64, 0x0000846f, 0x00008463, 0x000f386d,
+  0x00008c6c, 0x000fb473, 0x800001cc, 0x000f2071, 0x0000313b, 0x0001e072,
+  0x000e5074, 0x000e7875, 0x800001cd, 0x0000153b, 0x00001d3b, 0x0000e872,
+  0x800001ce, 0x800001cf, 0x0000346f, 0x0000ec74, 0x0001b044, 0x00002872,
+  0x00002865, 0x0001cc6f, 0x0001306e, 0x00003d3b, 0x00005061, 0x0001b477,
+  0x0001f84c, 0x0001c041, 0x800001d0, 0x0001d072, 0x0001b86f, 0x0001b872,
+  0x00002469, 0x0001a466, 0x0004a53b, 0x00012c55, 0x00011c74, 0x0001e865,
+  0x0001f041, 0x0000ac77, 0x00018c52, 0x0000d077, 0x0000053b, 0x800001d1,
+  0x0001d472, 0x0001ec6f, 0x00016c69, 0x0001a472, 0x00017079, 0x00013c41,
+  0x0001a467, 0x0001d868, 0x0001d872, 0x0001f474, 0x0001d86f, 0x0000d877,
+  0x0001b472, 0x000c006d, 0x0000053b, 0x800001d2, 0x00011c70, 0x0001d072,
+  0x0001d441, 0x0001b472, 0x0000753b, 0x0001a86f, 0x000ca441, 0x000e4472,
+  0x00009c77, 0x800001d3, 0x000e646c, 0x0000093b, 0x000000f9, 0x800001d4,
+  0x0000093b, 0x00034442, 0x800001d5, 0x0001c467, 0x000e4870, 0x000d2070,
+  0x0000053b, 0x800001d6, 0x000e6061, 0x000afc6c, 0x000e0469, 0x0001ac63,
+  0x00019c6c, 0x0000e474, 0x000f1465, 0x0000353b, 0x000f3466, 0x0001e072,
+  0x800001d7, 0x0001d461, 0x0001e472, 0x0000093b, 0x00019075, 0x800001d8,
+  0x00009865, 0x0001dc6e, 0x00019074, 0x0001d065, 0x0001e063, 0x0001c072,
+  0x00019073, 0x00018065, 0x0001a074, 0x0001b469, 0x0000193b, 0x0001a06f,
+  0x800001d9, 0x0000f06e, 0x0000e93b, 0x00012065, 0x00018c75, 0x0001c062,
+  0x00016073, 0x00001874, 0x800001da, 0x0001d871, 0x00018075, 0x00018c61,
+  0x0000e86c, 0x00000d3b, 0x800001db, 0x0001d465, 0x0001c472, 0x0001d865,
+  0x00019873, 0x00009074, 0x0000053b, 0x800001dc, 0x00019075, 0x0001f470,
+  0x0001cc71, 0x0000e06c, 0x0000393b, 0x0001b861, 0x800001dd, 0x00005869,
+  0x0000053b, 0x800001de, 0x0001b06e, 0x0000e072, 0x0001fd3b, 0x0001c063,
+  0x0001b06f, 0x800001df, 0x00010c6e, 0x0001d061, 0x0003ec6d, 0x0000e072,
+  0x00003d3b, 0x0003f474, 0x0001ec65, 0x800001e0, 0x0001fc63, 0x0003c062,
+  0x800001e1, 0x800001e2, 0x00002c45, 0x0001a071, 0x0001d864, 0x0001b861,
+  0x00018875, 0x0000f06c, 0x0000313b, 0x0003b073, 0x00019063, 0x0001b865,
+  0x800001e3, 0x00039470, 0x800001e4, 0x00015461, 0x0001a065, 0x0001f468,
+  0x00019075, 0x0001d071, 0x0000d045, 0x0001a461, 0x0000f46c, 0x0000c455,
+  0x0000353b, 0x0000c053, 0x0001d46e, 0x00013c74, 0x0001a06c, 0x800001e5,
+  0x0001d071, 0x0001e875, 0x0000b865, 0x0001d845, 0x0000906c, 0x0001c069,
+  0x0001c861, 0x0000253b, 0x0001ec64, 0x0001946c, 0x0001a454, 0x00018868,
+  0x0001d461, 0x0000dc74, 0x800001e6, 0x0000153b, 0x00028063, 0x0003e13b,
+  0x800001e7, 0x00020c65, 0x00021072, 0x00000049, 0x0003313b, 0x0003313b,
+  0x0003613b, 0x800001e8, 0x0000053b, 0x800001e9, 0x000d2061, 0x00003d3b,
+  0x800001ea, 0x00024473, 0x0000e874, 0x00001d3b, 0x800001eb, 0x0001d871,
+  0x00018075, 0x0001c861, 0x0000093b, 0x0000e86c, 0x800001ec, 0x0001cc65,
+  0x0000e874, 0x00000d3b, 0x800001ed, 0x0001744f, 0x00013c52, 0x0000e04e,
+  0x0000053b, 0x800001ee, 0x00000d3b, 0x00011844, 0x0000e445, 0x800001ef,
+  0x800001f0, 0x0000053b, 0x00001d3b, 0x0000e479, 0x0000f479, 0x800001f1,
+  0x0000e862, 0x00003d3b, 0x800001f2, 0x800001f3, 0x00000d3b, 0x0001ec65,
+  0x0001b872, 0x0001b46f, 0x0000946e, 0x0001c461, 0x0000093b, 0x00008075,
+  0x800001f4, 0x0000f86c, 0x0001a064, 0x0001a869, 0x0000393b, 0x0000d479,
+  0x800001f5, 0x0000113b, 0x0000e872, 0x0000153b, 0x0001c46f, 0x800001f6,
+  0x800001f7, 0x00004072, 0x00004c66, 0x0001c065, 0x0000253b, 0x00018072,
+  0x0000553b, 0x0001a074, 0x00018065, 0x00037848, 0x00039473, 0x00004448,
+  0x0000cc65, 0x800001f8, 0x0000cc61, 0x0001f869, 0x000d0c53, 0x0000e473,
+  0x00019c63, 0x800001f9, 0x00017453, 0x000d8852, 0x00018861, 0x00014463,
+  0x0000d53b, 0x00016463, 0x0007d074, 0x00035465, 0x00013853, 0x00012c71,
+  0x0001046b, 0x0001506e, 0x0000c53b, 0x0000a13b, 0x00009061, 0x00003065,
+  0x0000b063, 0x800001fa, 0x00018c70, 0x00061075, 0x00014861, 0x0000bc66,
+  0x0001c069, 0x00013468, 0x0003b853, 0x00003865, 0x0000c463, 0x0003ac54,
+  0x0006406f, 0x800001fb, 0x800001fc, 0x00018864, 0x0006c473, 0x00062c72,
+  0x0001846c, 0x00002445, 0x00040065, 0x800001fd, 0x0007c53b, 0x00044873,
+  0x00064c64, 0x00007c6c, 0x00034845, 0x0007c13b, 0x0007c53b, 0x00030445,
+  0x00065c61, 0x0001bc75, 0x0001b46c, 0x0001086c, 0x0001cc45, 0x00018c75,
+  0x0001d871, 0x00018c61, 0x00072c6c, 0x800001fe, 0x0001b469, 0x0006546c,
+  0x00072865, 0x800001ff, 0x0001e070, 0x80000200, 0x00075466, 0x0001cc69,
+  0x0001b470, 0x0001886c, 0x00011465, 0x0001b044, 0x0006e86f, 0x00003d3b,
+  0x80000201, 0x0000e072, 0x0000053b, 0x80000202, 0x0001586f, 0x0000093b,
+  0x0001b472, 0x80000203, 0x00012c63, 0x00001c6b, 0x0001fc75, 0x0001d063,
+  0x0000686d, 0x0000513b, 0x0003846f, 0x0000806e, 0x0001a061, 0x0001f074,
+  0x00002463, 0x00006462, 0x00009072, 0x00007464, 0x00001467, 0x00002866,
+  0x0000b865, 0x80000204, 0x0001b072, 0x00001d3b, 0x80000205, 0x0001a863,
+  0x0001e869, 0x00016c74, 0x00001d3b, 0x0002e070, 0x007d2473, 0x007d6472,
+  0x007d2c75, 0x007d0074, 0x0000f472, 0x80000206, 0x00018872, 0x0001e863,
+  0x0000fc79, 0x00018c76, 0x80000207, 0x0000dc65, 0x0000093b, 0x0001c865,
+  0x80000208, 0x0000053b, 0x0001cc69, 0x00019072, 0x0000e463, 0x80000209,
+  0x00000d3b, 0x8000020a, 0x00019c6c, 0x0000793b, 0x0001b862, 0x00001d3b,
+  0x8000020b, 0x0000f463, 0x00018061, 0x0000dc72, 0x8000020c, 0x00019072,
+  0x0000c079, 0x00000d3b, 0x0001d061, 0x00001865, 0x00019876, 0x00017461,
+  0x0000153b, 0x0001c463, 0x0000c472, 0x00018864, 0x0001c065, 0x8000020d,
+  0x00013c72, 0x0000c46f, 0x0000153b, 0x00004d3b, 0x0001e461, 0x00019442,
+  0x0001d868, 0x8000020e, 0x00021869, 0x0001bc61, 0x00019863, 0x0000d074,
+  0x00008072, 0x0000f465, 0x0001c465, 0x0000393b, 0x0001f061, 0x00026065,
+  0x0001a872, 0x0001b850, 0x8000020f, 0x80000210, 0x0001dc72, 0x0001b06b,
+  0x0003f93b, 0x0007d465, 0x80000211, 0x0001d86e, 0x0001dc69, 0x00021c74,
+  0x0000053b, 0x80000212, 0x0000e473, 0x0001846f, 0x0000e86e, 0x00000d3b,
+  0x80000213, 0x0001c86c, 0x0001c875, 0x0000e073, 0x0000053b, 0x80000214,
+  0x0001b06f, 0x0000093b, 0x0000e06e, 0x80000215, 0x0000e866, 0x00000d3b,
+  0x80000216, 0x0001f472, 0x0001b072, 0x0000f077, 0x80000217, 0x0001d46f,
+  0x0001c461, 0x0000f13b, 0x0000113b, 0x0000e472, 0x00017c67, 0x80000218,
+  0x00030454, 0x0001c06f, 0x0001bc77, 0x0001306e, 0x0001cc72, 0x00018472,
+  0x0001f041, 0x0001d06f, 0x0000e877, 0x00001d3b, 0x80000219, 0x0001d06f,
+  0x0001bc77, 0x00017c6e, 0x00031046, 0x0001c441, 0x0001d872, 0x00046445,
+  0x0001ec6f, 0x0000313b, 0x0001b472, 0x00011470, 0x0000d877, 0x8000021a,
+  0x0000486c, 0x0001c871, 0x0001ac75, 0x0001c062, 0x0001a069, 0x00005072,
+  0x00009441, 0x00007869, 0x0001d069, 0x00019c75, 0x00003845, 0x00001c44,
+  0x00019065, 0x007c0065, 0x0000193b, 0x0000e86d, 0x0001d072, 0x00009c77,
+  0x0001b072, 0x0004f53b, 0x8000021b, 0x0001cc6f, 0x8000021c, 0x8000021d,
+  0x0001fc6f, 0x00019c74, 0x0001006f, 0x0001d854, 0x00013c65, 0x0000193b,
+  0x0000113b, 0x0001786e, 0x0000e477, 0x0001d072, 0x8000021e, 0x00018072,
+  0x0001046f, 0x00009d3b, 0x00012461, 0x0000b444, 0x00001450, 0x00015077,
+  0x00010c66, 0x00017864, 0x0001f461, 0x00006842, 0x00003077, 0x0001c472,
+  0x00016c72, 0x007e9c72, 0x0001b865, 0x007f7c6e, 0x0001cc72, 0x0001e872,
+  0x00018467, 0x00010870, 0x007e7873, 0x0000d877, 0x0001e472, 0x0001a441,
+  0x0072087a, 0x00018069, 0x8000021f, 0x0001c468, 0x0001f86f, 0x80000220,
+  0x007ef074, 0x007e206f, 0x0000153b, 0x0001b472, 0x007e244c, 0x007e1c41,
+  0x0000e877, 0x00001d3b, 0x80000221, 0x0000e069, 0x0000053b, 0x80000222,
+  0x007e2c6f, 0x00000d3b, 0x80000223, 0x0001a069, 0x0000e467, 0x0001986e,
+  0x0000053b, 0x80000224, 0x0001c063, 0x0000093b, 0x0000e072, 0x80000225,
+  0x0001b469, 0x00019c6c, 0x0001a864, 0x00003d3b, 0x80000226, 0x0000d465,
+  0x0001a86d, 0x0000193b, 0x0000f06c, 0x80000227, 0x007e0052, 0x00017844,
+  0x0001c861, 0x0001ac73, 0x0000f468, 0x80000228, 0x00001d3b, 0x0001c461,
+  0x0000e872, 0x0000393b, 0x0000c473, 0x80000229, 0x0000e879, 0x0000153b,
+  0x0001c061, 0x00033076, 0x8000022a, 0x0001dc73, 0x0000e468, 0x8000022b,
+  0x00000d3b, 0x0000153b, 0x0003186f, 0x0000093b, 0x8000022c, 0x8000022d,
+  0x0001ac63, 0x0001f462, 0x00010072, 0x0001cc61, 0x8000022e, 0x00033866,
+  0x00006c65, 0x0001c864, 0x00013865, 0x0001f53b, 0x8000022f, 0x00006462,
+  0x00018063, 0x0001b861, 0x0000c872, 0x0001646c, 0x0001ec6e, 0x0001f461,
+  0x00010454, 0x80000230, 0x00013472, 0x0001c853, 0x80000231, 0x0000113b,
+  0x0001d869, 0x0000d86c, 0x0001ac4c, 0x0000753b, 0x0001146f, 0x0003b874,
+  0x0000f865, 0x0001d872, 0x0001e879, 0x80000232, 0x0001dc65, 0x00019461,
+  0x0001d042, 0x00019c70, 0x00001d3b, 0x0000d53b, 0x0001d461, 0x00016874,
+  0x00019c69, 0x00001872, 0x00019c64, 0x0001b46c, 0x00000865, 0x0001a870,
+  0x00021c73, 0x0001a46c, 0x80000233, 0x0001c469, 0x00018061, 0x0000553b,
+  0x0001b068, 0x0001ec63, 0x0000d866, 0x00009c65, 0x0000253b, 0x0001a061,
+  0x00016c6e, 0x002b3045, 0x0001c054, 0x0024f038, 0x80000234, 0x0024a436,
+  0x00022c63, 0x80000235, 0x0001ac53, 0x00000d3b, 0x80000236, 0x80000237,
+  0x0003093b, 0x00032072, 0x00025070, 0x0000f072, 0x0003ed3b, 0x00025c64,
+  0x007cf841, 0x0000d068, 0x0000053b, 0x80000238, 0x00012473, 0x0001d469,
+  0x00018872, 0x0000e063, 0x0000053b, 0x80000239, 0x00019864, 0x00019867,
+  0x0000e865, 0x00001d3b, 0x8000023a, 0x0000e472, 0x0001fc6f, 0x00003d3b,
+  0x8000023b, 0x00019070, 0x0001e063, 0x0000f466, 0x0001a065, 0x00000d3b,
+  0x8000023c, 0x0001e066, 0x0001cc63, 0x0000e072, 0x0000053b, 0x8000023d,
+  0x0001cc66, 0x0000e072, 0x0000053b, 0x8000023e, 0x0000053b, 0x8000023f,
+  0x00018070, 0x0000e069, 0x0000e466, 0x0001dc6f, 0x0000053b, 0x80000240,
+  0x0000113b, 0x00018073, 0x0001cc63, 0x0000e072, 0x80000241, 0x0001e863,
+  0x0000e879, 0x00003d3b, 0x80000242, 0x0000e479, 0x0001e863, 0x00001d3b,
+  0x80000243, 0x0001ec63, 0x0001e93b, 0x0000e879, 0x00005841, 0x0001d863,
+  0x0001cc75, 0x0000293b, 0x80000244, 0x0001ac74, 0x0001d870, 0x0000c863,
+  0x00004449, 0x80000245, 0x00011074, 0x0000cc65, 0x0001c469, 0x80000246,
+  0x00000d3b, 0x0001ac72, 0x0000153b, 0x0000253b, 0x0003d469, 0x0000e472,
+  0x00002855, 0x80000247, 0x0000e866, 0x0000313b, 0x80000248, 0x0001d063,
+  0x00011463, 0x80000249, 0x0000dc79, 0x0000f93b, 0x0000046c, 0x0000e472,
+  0x00010861, 0x0001ec63, 0x00011c63, 0x8000024a, 0x0000313b, 0x00015c6d,
+  0x0000d079, 0x00011866, 0x8000024b, 0x0000113b, 0x0000906e, 0x00008065,
+  0x00070866, 0x8000024c, 0x0001606f, 0x00014475, 0x0000293b, 0x0001b472,
+  0x00012073, 0x0001dc6f, 0x0001f075, 0x0000393b, 0x00067870, 0x0000213b,
+  0x0001d46f, 0x0000f074, 0x8000024d, 0x8000024e, 0x007cb13b, 0x00697c6f,
+  0x0007fd3b, 0x8000024f, 0x00060c61, 0x80000250, 0x00064072, 0x00018469,
+  0x0001dc74, 0x0001a874, 0x0001dc64, 0x00017068, 0x00063853, 0x00018061,
+  0x00019063, 0x0000f065, 0x0000053b, 0x80000251, 0x0000053b, 0x80000252,
+  0x00000d3b, 0x0000e872, 0x00009c61, 0x80000253, 0x00067870, 0x00000d3b,
+  0x80000254, 0x0001f063, 0x00075079, 0x0000e072, 0x0000053b, 0x80000255,
+  0x00012063, 0x0000e065, 0x0000053b, 0x80000256, 0x00017c61, 0x0001c075,
+  0x00009863, 0x0001e462, 0x00000c65, 0x00017474, 0x00001467, 0x00027066,
+  0x00019072, 0x0001d465, 0x00019076, 0x00008065, 0x0000906d, 0x0000bc6c,
+  0x00028c6f, 0x00033c6e, 0x0000213b, 0x000c0070, 0x000d5473, 0x000d6072,
+  0x000d2c75, 0x000d4474, 0x000dd477, 0x0000353b, 0x80000257, 0x80000258,
+  0x80000259, 0x00001d3b, 0x8000025a, 0x00018072, 0x00011463, 0x0000193b,
+  0x0000093b, 0x00013445, 0x8000025b, 0x0000f465, 0x00018874, 0x00000d3b,
+  0x8000025c, 0x00003d3b, 0x8000025d, 0x00019069, 0x0000f467, 0x0001ac6c,
+  0x0000053b, 0x8000025e, 0x0000713b, 0x0007d848, 0x8000025f, 0x00018c72,
+  0x80000260, 0x0001c461, 0x00019c76, 0x80000261, 0x0000e865, 0x0000093b,
+  0x80000262, 0x0001f473, 0x00003461, 0x0000f06d, 0x0000113b, 0x0001ac79,
+  0x0000053b, 0x80000263, 0x00018064, 0x00000866, 0x00004865, 0x0007d064,
+  0x00001463, 0x00013c66, 0x00079061, 0x00019065, 0x0000306f, 0x0001c061,
+  0x0000b864, 0x0001946e, 0x0000693b, 0x00008869, 0x00002c68, 0x0000bc72,
+  0x00012c68, 0x00010475, 0x0001a870, 0x0001d470, 0x00000073, 0x0001946c,
+  0x80000264, 0x0000c067, 0x0000f470, 0x80000265, 0x00019c63, 0x0000093b,
+  0x0003f53b, 0x00000479, 0x0003f13b, 0x0003e53b, 0x0003413b, 0x80000266,
+  0x80000267, 0x0000193b, 0x0000f064, 0x80000268, 0x80000269, 0x0000b867,
+  0x0000053b, 0x8000026a, 0x0001b86c, 0x0001dc6f, 0x00019070, 0x0000e065,
+  0x0000053b, 0x8000026b, 0x0000053b, 0x8000026c, 0x0000053b, 0x8000026d,
+  0x0000053b, 0x8000026e, 0x0000e865, 0x00003d3b, 0x8000026f, 0x00019c73,
+  0x0000e864, 0x00001d3b, 0x80000270, 0x00000d3b, 0x80000271, 0x0000f93b,
+  0x00001861, 0x80000272, 0x0000c863, 0x00001c62, 0x0000c865, 0x0000c864,
+  0x0000b067, 0x0000cc66, 0x80000273, 0x00008468, 0x80000274, 0x00000d3b,
+  0x0000193b, 0x00000d3b, 0x80000275, 0x00007d3b, 0x80000276, 0x00000d3b,
+  0x80000277, 0x00001d3b, 0x80000278, 0x0000093b, 0x0000e074, 0x80000279,
+  0x0000e062, 0x8000027a, 0x8000027b, 0x0000093b, 0x0000193b, 0x0000e468,
+  0x8000027c, 0x0000053b, 0x00000d3b, 0x00000061, 0x0000e474, 0x8000027d,
+  0x0000b86d, 0x0000d86c, 0x00004c70, 0x8000027e, 0x0001d06f, 0x0002f072,
+  0x0000353b, 0x0000b473, 0x00018c65, 0x0001c072, 0x00019476, 0x0000f872,
+  0x0001bc61, 0x8000027f, 0x0000f46e, 0x0001887a, 0x0000153b, 0x00000d3b,
+  0x80000280, 0x80000281, 0x0000153b, 0x00037061, 0x0001b073, 0x00006472,
+  0x0001bc64, 0x80000282, 0x0000fd3b, 0x0000e872, 0x0000093b, 0x80000283,
+  0x80000284, 0x0000113b, 0x00018c64, 0x00002c66, 0x00257c44, 0x80000285,
+  0x0001c463, 0x0000e473, 0x00013467, 0x00001d3b, 0x80000286, 0x0001c072,
+  0x000000e7, 0x0000613b, 0x00017469, 0x0000213b, 0x0001f86f, 0x0000253b,
+  0x000f3878, 0x80000287, 0x0000b864, 0x80000288, 0x00008876, 0x80000289,
+  0x8000028a, 0x0000113b, 0x0000d867, 0x0001f870, 0x000fc93b, 0x8000028b,
+  0x000f5071, 0x000fd13b, 0x0001bc69, 0x000e606e, 0x0001cc63, 0x000f3472,
+  0x0000d470, 0x0001c46d, 0x0000053b, 0x8000028c, 0x000f753b, 0x000f3871,
+  0x8000028d, 0x0001bc69, 0x0001e86c, 0x0000793b, 0x00018064, 0x8000028e,
+  0x0001a86d, 0x000f4c74, 0x0000e46c, 0x00008465, 0x0000053b, 0x8000028f,
+  0x0000e874, 0x0000093b, 0x0001a06f, 0x80000290, 0x0001506e, 0x0001c46e,
+  0x0001d079, 0x0000e93b, 0x00015463, 0x00014869, 0x0001d46e, 0x00001c74,
+  0x0001d86f, 0x80000291, 0x0000e874, 0x00003d3b, 0x80000292, 0x0001a463,
+  0x00019869, 0x0001d06b, 0x00000c73, 0x0001cc6f, 0x00009067, 0x00018870,
+  0x0001e46e, 0x00000d3b, 0x80000293, 0x0001a069, 0x0001c870, 0x0001bc73,
+  0x00018c6f, 0x0001b86c, 0x00001072, 0x0000113b, 0x0001f865, 0x0000e46e,
+  0x0001f863, 0x80000294, 0x0000606d, 0x00005072, 0x00002c4e, 0x000f7870,
+  0x00004469, 0x0000f465, 0x0003fc6d, 0x0000093b, 0x0001bc69, 0x80000295,
+  0x00008471, 0x0001fc65, 0x00019876, 0x0001d077, 0x0003d46b, 0x0001606e,
+  0x80000296, 0x80000297, 0x000f6c61, 0x80000298, 0x0000753b, 0x0000f465,
+  0x000e3c65, 0x0000113b, 0x0000b065, 0x00015062, 0x000f2869, 0x0003a073,
+  0x00018865, 0x00000c65, 0x00039864, 0x80000299, 0x000f106f, 0x0000b865,
+  0x0005186e, 0x0005c06f, 0x0004446c, 0x0000153b, 0x00010c72, 0x00043c6b,
+  0x8000029a, 0x0002bc69, 0x0002d866, 0x0001286f, 0x0001ac64, 0x00025065,
+  0x0001e862, 0x0001ac63, 0x0000bc6b, 0x00009461, 0x0001c071, 0x0001d072,
+  0x00033467, 0x0001f861, 0x000e5c45, 0x0001b075, 0x0003146f, 0x00024870,
+  0x00014875, 0x8000029b, 0x0003e53b, 0x0018c475, 0x00187872, 0x00183873,
+  0x0005d070, 0x00030879, 0x0003393b, 0x0003713b, 0x0003ed3b, 0x8000029c,
+  0x0000053b, 0x8000029d, 0x0000053b, 0x8000029e, 0x0000053b, 0x8000029f,
+  0x0000193b, 0x00012c74, 0x800002a0, 0x0001e072, 0x0000793b, 0x0001ac70,
+  0x800002a1, 0x0001ec74, 0x0002546d, 0x0001c479, 0x0000e876, 0x00000d3b,
+  0x800002a2, 0x00019873, 0x0000e869, 0x00000d3b, 0x800002a3, 0x0001a46e,
+  0x00023863, 0x0001d86f, 0x0000e875, 0x0000fd3b, 0x800002a4, 0x0000e061,
+  0x0000053b, 0x800002a5, 0x0000053b, 0x800002a6, 0x00019065, 0x00018065,
+  0x0000dc68, 0x0000e06e, 0x0000053b, 0x800002a7, 0x0000e472, 0x800002a8,
+  0x00000d3b, 0x00002467, 0x0000093b, 0x0000e870, 0x800002a9, 0x0000f463,
+  0x00019072, 0x00000d3b, 0x800002aa, 0x0001d077, 0x800002ab, 0x0000e070,
+  0x0000093b, 0x0001c46f, 0x800002ac, 0x0000053b, 0x0000e074, 0x00002c6c,
+  0x00001869, 0x0001c475, 0x0000193b, 0x0000e873, 0x800002ad, 0x0001b063,
+  0x0000293b, 0x00010c6d, 0x00002461, 0x0001986f, 0x00010874, 0x00007c64,
+  0x800002ae, 0x0003e074, 0x00019069, 0x00013c71, 0x00013876, 0x0006c877,
+  0x00012874, 0x00068875, 0x00018465, 0x0001ac73, 0x0000053b, 0x800002af,
+  0x0000d470, 0x0001c475, 0x0000f13b, 0x0001f074, 0x00005475, 0x00038c67,
+  0x00039c65, 0x00003070, 0x00007473, 0x0001c865, 0x0000313b, 0x00013c63,
+  0x0001b869, 0x00001072, 0x800002b0, 0x00065c75, 0x0001d067, 0x0001f861,
+  0x00019c72, 0x0001a461, 0x00018c6e, 0x0000093b, 0x800002b1, 0x800002b2,
+  0x0001906c, 0x00018c65, 0x0004006f, 0x800002b3, 0x00001d3b, 0x0000b06e,
+  0x0001ac64, 0x800002b4, 0x800002b5, 0x000000fd, 0x800002b6, 0x00066c65,
+  0x800002b7, 0x00688033, 0x0000253b, 0x00061c31, 0x00075870, 0x0001bc70,
+  0x0001d06c, 0x0001d075, 0x00072c73, 0x00070065, 0x0001a865, 0x0000d465,
+  0x00019464, 0x0007c53b, 0x0001a067, 0x0001d461, 0x0001b472, 0x0000e477,
+  0x0001d06f, 0x0007d53b, 0x0001706b, 0x0001a065, 0x00019c61, 0x00727c6f,
+  0x0007a13b, 0x0001a867, 0x0001b463, 0x0001946e, 0x0007586b, 0x0001c871,
+  0x0000d465, 0x0000c06e, 0x0000f86f, 0x00016872, 0x00017875, 0x0000f13b,
+  0x0001706c, 0x00013861, 0x00001865, 0x800002b8, 0x0001ac72, 0x0001b061,
+  0x00018869, 0x0001a46e, 0x0000e065, 0x0001bc67, 0x00019c6c, 0x00001d3b,
+  0x800002b9, 0x0001d06f, 0x0001bc77, 0x0000906e, 0x0000053b, 0x800002ba,
+  0x00019c65, 0x0001c066, 0x0000053b, 0x800002bb, 0x0001a069, 0x0000e074,
+  0x0001b874, 0x0001ac67, 0x0001c868, 0x0000193b, 0x0000f074, 0x800002bc,
+  0x0001ed3b, 0x00015c73, 0x0001146b, 0x0001a063, 0x0000906b, 0x0003e065,
+  0x0001e869, 0x800002bd, 0x0000353b, 0x00008c74, 0x0000b476, 0x0001e86f,
+  0x0000dc32, 0x800002be, 0x00009434, 0x00018075, 0x00005466, 0x0001d06f,
+  0x800002bf, 0x800002c0, 0x0000093b, 0x800002c1, 0x800002c2, 0x00019474,
+  0x0000286d, 0x0001e46e, 0x800002c3, 0x00017c69, 0x800002c4, 0x00010c75,
+  0x0000353b, 0x0000393b, 0x0000193b, 0x0000153b, 0x0003853b, 0x00012470,
+  0x0000f472, 0x0000a465, 0x00027878, 0x00037074, 0x00011c77, 0x00038d3b,
+  0x0001d06f, 0x0002a878, 0x00014c69, 0x00022873, 0x0001c475, 0x0001d06c,
+  0x00022873, 0x0001e86d, 0x0001d065, 0x0003dd3b, 0x0001c069, 0x00019c69,
+  0x0000d864, 0x0001a862, 0x001d2065, 0x0002b473, 0x00018872, 0x0001a86d,
+  0x00019076, 0x001d2065, 0x0000ac6c, 0x001cac73, 0x0001cc61, 0x001d3872,
+  0x0003513b, 0x800002c5, 0x0000053b, 0x800002c6, 0x800002c7, 0x00047877,
+  0x800002c8, 0x00010444, 0x0000053b, 0x800002c9, 0x0000e44c, 0x00008c48,
+  0x0000053b, 0x800002ca, 0x0000053b, 0x800002cb, 0x0000053b, 0x800002cc,
+  0x800002cd, 0x0000053b, 0x00008c52, 0x00002056, 0x00006855, 0x00003d3b,
+  0x800002ce, 0x00000d3b, 0x800002cf, 0x00001d3b, 0x800002d0, 0x00000d3b,
+  0x800002d1, 0x0000f13b, 0x0000153b, 0x00029862, 0x00002d3b, 0x800002d2,
+  0x0000253b, 0x800002d3, 0x0000253b, 0x0000a464, 0x0000613b, 0x800002d4,
+  0x00007c6c, 0x001c0068, 0x0000753b, 0x800002d5, 0x0002b46d, 0x800002d6,
+  0x800002d7, 0x800002d8, 0x800002d9, 0x0002c870, 0x00007c72, 0x001e3c76,
+  0x001fe875, 0x0002b074, 0x800002da, 0x00002d3b, 0x800002db, 0x00000d3b,
+  0x0000193b, 0x800002dc, 0x00000d3b, 0x800002dd, 0x0001904c, 0x0001f93b,
+  0x0000e84c, 0x00001d3b, 0x800002de, 0x0000093b, 0x0000393b, 0x800002df,
+  0x800002e0, 0x800002e1, 0x0003c871, 0x0000093b, 0x0001b064, 0x0003b474,
+  0x800002e2, 0x00013452, 0x0000093b, 0x0001184c, 0x800002e3, 0x00001d3b,
+  0x800002e4, 0x00011848, 0x0000053b, 0x800002e5, 0x0000053b, 0x800002e6,
+  0x0000053b, 0x800002e7, 0x00008852, 0x0001ec75, 0x00011452, 0x0000e93b,
+  0x0001e46c, 0x00001d3b, 0x00007c6c, 0x0000113b, 0x0000353b, 0x800002e8,
+  0x800002e9, 0x800002ea, 0x0000093b, 0x800002eb, 0x800002ec, 0x0000153b,
+  0x00010044, 0x0000653b, 0x800002ed, 0x0001a872, 0x0000193b, 0x0001d86c,
+  0x001fb062, 0x800002ee, 0x800002ef, 0x0001d468, 0x800002f0, 0x0000393b,
+  0x001f3c72, 0x800002f1, 0x0000053b, 0x800002f2, 0x00003072, 0x00017c55,
+  0x00018472, 0x800002f3, 0x001f604c, 0x001fc93b, 0x001ff53b, 0x00001d3b,
+  0x800002f4, 0x00000d3b, 0x800002f5, 0x001c2c65, 0x0000053b, 0x800002f6,
+  0x0000053b, 0x800002f7, 0x0000053b, 0x800002f8, 0x0001a06d, 0x00009469,
+  0x001e6863, 0x00000d3b, 0x800002f9, 0x0000f46d, 0x001c0c76, 0x0000093b,
+  0x0001d465, 0x800002fa, 0x0000053b, 0x800002fb, 0x00019069, 0x0000f46c,
+  0x0001ac6f, 0x0000093b, 0x001f0452, 0x800002fc, 0x001fcc6c, 0x00000d3b,
+  0x800002fd, 0x001ecc75, 0x800002fe, 0x0000053b, 0x0001886c, 0x0001e46d,
+  0x0000e46c, 0x800002ff, 0x00000d3b, 0x0000f474, 0x80000300, 0x0000053b,
+  0x0000e870, 0x00007d3b, 0x80000301, 0x00000d3b, 0x80000302, 0x00001d3b,
+  0x80000303, 0x00000d3b, 0x80000304, 0x0001e875, 0x0000e465, 0x00019074,
+  0x0000053b, 0x80000305, 0x80000306, 0x0001986e, 0x001fb872, 0x00011064,
+  0x0000053b, 0x80000307, 0x0001f463, 0x0000193b, 0x00017862, 0x80000308,
+  0x00001063, 0x00019872, 0x0001c072, 0x0001a461, 0x0001dc75, 0x0001a065,
+  0x00003063, 0x0000d470, 0x001d0068, 0x00006d3b, 0x00009070, 0x00016c45,
+  0x001e4c68, 0x00002d3b, 0x80000309, 0x0003b470, 0x0001bc6c, 0x00015c72,
+  0x8000030a, 0x0000e074, 0x0000193b, 0x0000cc70, 0x8000030b, 0x0001d875,
+  0x0000e93b, 0x000ad878, 0x0001346f, 0x0000e074, 0x0000153b, 0x0000a073,
+  0x8000030c, 0x0001c065, 0x00023864, 0x8000030d, 0x001e9052, 0x0000e06e,
+  0x0000053b, 0x8000030e, 0x0001f070, 0x8000030f, 0x0001d872, 0x0001a06f,
+  0x0000753b, 0x0001e465, 0x001e9048, 0x0000f46e, 0x0000ac65, 0x00003d3b,
+  0x001ef44c, 0x0001a86f, 0x0000113b, 0x0001dc71, 0x80000310, 0x0000193b,
+  0x80000311, 0x80000312, 0x00014472, 0x0000f06c, 0x00029461, 0x00024869,
+  0x0001f063, 0x0002fd3b, 0x00010465, 0x0001d864, 0x0001fc70, 0x00013466,
+  0x0000f469, 0x0000a868, 0x0000f473, 0x0001f475, 0x00000d3b, 0x0007846c,
+  0x0007186f, 0x80000313, 0x001d793b, 0x0000cc6d, 0x0005c873, 0x00064872,
+  0x00056075, 0x0005ec74, 0x000b8877, 0x00026c69, 0x000b4079, 0x00000d3b,
+  0x80000314, 0x00026465, 0x0001d46f, 0x0000e074, 0x0000f93b, 0x00020c61,
+  0x80000315, 0x0001a864, 0x0001b469, 0x0000f06c, 0x0000093b, 0x0001d870,
+  0x80000316, 0x0001dc74, 0x0001f46d, 0x0001d479, 0x0000f476, 0x0001c46e,
+  0x0000053b, 0x80000317, 0x0000e874, 0x00007d3b, 0x80000318, 0x00019c72,
+  0x0001a464, 0x0000f474, 0x0001cc6f, 0x00000d3b, 0x80000319, 0x0000393b,
+  0x0000d072, 0x8000031a, 0x0000193b, 0x0000e879, 0x8000031b, 0x0001a463,
+  0x0001fd3b, 0x0000e86b, 0x00000863, 0x8000031c, 0x0000c06b, 0x0001a872,
+  0x0000e073, 0x0001d061, 0x00006065, 0x00040072, 0x8000031d, 0x0000053b,
+  0x0000f469, 0x0002b873, 0x0000053b, 0x8000031e, 0x8000031f, 0x001c8864,
+  0x0000053b, 0x80000320, 0x80000321, 0x0001f072, 0x00000d3b, 0x0001f46f,
+  0x0000e471, 0x80000322, 0x00016065, 0x00022861, 0x0003bc62, 0x0003cc63,
+  0x00034c64, 0x00019c72, 0x001cf475, 0x00015877, 0x0001c866, 0x00010061,
+  0x00019065, 0x0000113b, 0x0006d064, 0x0001886c, 0x0000f874, 0x80000323,
+  0x0001306d, 0x00008074, 0x00018469, 0x0001ec72, 0x0001d067, 0x80000324,
+  0x80000325, 0x001c1044, 0x0001b468, 0x0000c865, 0x00007d3b, 0x00072463,
+  0x80000326, 0x80000327, 0x0000c874, 0x0000653b, 0x00018469, 0x0001ec73,
+  0x80000328, 0x0001e072, 0x00067c69, 0x0000253b, 0x001c5855, 0x0000293b,
+  0x0007493b, 0x0007ed3b, 0x00073852, 0x00071453, 0x0001c861, 0x0001ac73,
+  0x0000e868, 0x00003d3b, 0x80000329, 0x00000d3b, 0x8000032a, 0x0000f874,
+  0x0006646e, 0x0001c86e, 0x0000053b, 0x8000032b, 0x00019469, 0x0000e064,
+  0x0000053b, 0x8000032c, 0x0001a063, 0x0001c469, 0x0000e872, 0x00003d3b,
+  0x8000032d, 0x00018475, 0x0001c862, 0x0000f073, 0x0000053b, 0x8000032e,
+  0x0000e874, 0x0000f93b, 0x00012869, 0x8000032f, 0x0001906f, 0x80000330,
+  0x0001a46c, 0x00019c6d, 0x0000546e, 0x0000113b, 0x0000d06e, 0x00000d3b,
+  0x80000331, 0x0000193b, 0x00006d3b, 0x80000332, 0x00009461, 0x0001806d,
+  0x0000193b, 0x0006ec61, 0x0000f070, 0x00068863, 0x00014464, 0x0000313b,
+  0x80000333, 0x80000334, 0x0000fc70, 0x80000335, 0x0000e86e, 0x0000193b,
+  0x00004865, 0x80000336, 0x0001bc65, 0x00002c6e, 0x0000e874, 0x0000153b,
+  0x0000fc73, 0x0000606d, 0x80000337, 0x0001d065, 0x0000053b, 0x80000338,
+  0x0000113b, 0x0001d86f, 0x80000339, 0x0000e074, 0x8000033a, 0x0001d46f,
+  0x8000033b, 0x0000053b, 0x0001d46e, 0x00009474, 0x00006c75, 0x8000033c,
+  0x0003bc67, 0x8000033d, 0x0001d878, 0x0007a86c, 0x8000033e, 0x00001872,
+  0x00019069, 0x0000213b, 0x0000e864, 0x0000213b, 0x0007e465, 0x0001706f,
+  0x0001d061, 0x00000466, 0x0000ec6c, 0x0001cc71, 0x00000d3b, 0x0000393b,
+  0x0001f472, 0x8000033f, 0x0000f066, 0x0000dc72, 0x0001d473, 0x80000340,
+  0x0000e873, 0x0000093b, 0x0001dc6f, 0x80000341, 0x0000cc72, 0x80000342,
+  0x80000343, 0x00037065, 0x0001c061, 0x00015c72, 0x00022472, 0x00031c74,
+  0x0000253b, 0x0001ac65, 0x0000053b, 0x80000344, 0x0003dc70, 0x00037463,
+  0x00031079, 0x0001a074, 0x0003293b, 0x0003653b, 0x0005a445, 0x00020463,
+  0x0000e862, 0x0003dd3b, 0x0000053b, 0x80000345, 0x0000053b, 0x80000346,
+  0x0002e864, 0x00001d3b, 0x80000347, 0x0001bc72, 0x0000e86c, 0x0000793b,
+  0x0000e472, 0x80000348, 0x0000053b, 0x80000349, 0x0001f870, 0x0001cc75,
+  0x0000ac70, 0x00022473, 0x0000e872, 0x00000d3b, 0x8000034a, 0x00001d3b,
+  0x8000034b, 0x0001c461, 0x0001cc72, 0x00001c72, 0x0001706c, 0x00030c66,
+  0x00024065, 0x0000193b, 0x00027c63, 0x8000034c, 0x0000053b, 0x8000034d,
+  0x0002f464, 0x00013465, 0x00034c6d, 0x00001d3b, 0x8000034e, 0x00018072,
+  0x00018063, 0x00028c61, 0x0000053b, 0x8000034f, 0x0000e870, 0x0000193b,
+  0x00030c73, 0x80000350, 0x0000d470, 0x80000351, 0x00003d3b, 0x0001c06f,
+  0x000f4476, 0x000f3077, 0x0000b070, 0x0000e474, 0x00005472, 0x0001f93b,
+  0x00000861, 0x80000352, 0x0000053b, 0x80000353, 0x0000f472, 0x0000353b,
+  0x0000593b, 0x0001bc6c, 0x80000354, 0x00038873, 0x0001cc61, 0x0001d072,
+  0x00009063, 0x000c0072, 0x00036072, 0x80000355, 0x80000356, 0x00014079,
+  0x0001d071, 0x0000113b, 0x00004875, 0x00010073, 0x0001a870, 0x80000357,
+  0x0001ac65, 0x00011872, 0x0000193b, 0x00026865, 0x80000358, 0x00011876,
+  0x0000e53b, 0x0003e464, 0x00018875, 0x00019c63, 0x0001d867, 0x00007473,
+  0x00011c65, 0x00001063, 0x0000593b, 0x80000359, 0x0001d470, 0x0001b064,
+  0x00019065, 0x00003865, 0x000e7872, 0x000000e8, 0x0000b86e, 0x00018865,
+  0x8000035a, 0x0000b065, 0x0000b462, 0x00014863, 0x00008864, 0x8000035b,
+  0x0001f077, 0x0001e076, 0x00019861, 0x000e3c6f, 0x0001e865, 0x0000393b,
+  0x0004c93b, 0x000e146f, 0x00019c65, 0x0001246f, 0x000e5872, 0x0001bc77,
+  0x0001906c, 0x00018465, 0x0001d466, 0x0000e074, 0x0000053b, 0x8000035c,
+  0x00019469, 0x0000f874, 0x0001a467, 0x0001d868, 0x0000053b, 0x8000035d,
+  0x00019065, 0x00009065, 0x0000053b, 0x8000035e, 0x00018865, 0x0000193b,
+  0x0000f064, 0x8000035f, 0x0001946e, 0x000e1463, 0x0000e874, 0x00001d3b,
+  0x0001bc69, 0x0001dc6e, 0x0001f472, 0x00014c69, 0x80000360, 0x0000f13b,
+  0x0001d46e, 0x00001474, 0x0001cc63, 0x80000361, 0x0001946c, 0x0001e874,
+  0x0000e879, 0x0000393b, 0x0001c072, 0x80000362, 0x0000e872, 0x00001d3b,
+  0x80000363, 0x0001c461, 0x0000e872, 0x00007d3b, 0x80000364, 0x00019867,
+  0x0001d065, 0x0000193b, 0x0000f072, 0x80000365, 0x0001d465, 0x00019c74,
+  0x0000e868, 0x00000d3b, 0x80000366, 0x0000f472, 0x80000367, 0x0000053b,
+  0x80000368, 0x0001ed3b, 0x00006841, 0x00005c67, 0x0003e468, 0x00018872,
+  0x80000369, 0x0000e477, 0x0001dc61, 0x0000293b, 0x00012c67, 0x00001448,
+  0x0000646c, 0x0001b06b, 0x0001886c, 0x8000036a, 0x0001f06f, 0x0001f061,
+  0x0000e463, 0x0000e46e, 0x00002d3b, 0x0000213b, 0x00007472, 0x0001fc73,
+  0x0001a46f, 0x0001b872, 0x0002506e, 0x8000036b, 0x00039861, 0x8000036c,
+  0x0000053b, 0x8000036d, 0x8000036e, 0x00005072, 0x00011861, 0x00011061,
+  0x00018863, 0x00010c62, 0x00021c65, 0x00037c64, 0x00012c65, 0x0002bc66,
+  0x0002a869, 0x00024468, 0x00008072, 0x00036c6a, 0x0001f873, 0x0003646c,
+  0x0003ac6f, 0x0001dc72, 0x0000393b, 0x0000393b, 0x0005cc73, 0x00055072,
+  0x00059075, 0x0005ec74, 0x00059077, 0x00021065, 0x00019c74, 0x00007879,
+  0x00015467, 0x0006207a, 0x0003fd3b, 0x00011874, 0x8000036f, 0x80000370,
+  0x0002f93b, 0x00037d3b, 0x00031471, 0x80000371, 0x0000e867, 0x00000d3b,
+  0x80000372, 0x00003d3b, 0x80000373, 0x0001dc70, 0x0001e074, 0x0001c479,
+  0x0000e876, 0x0000753b, 0x0001dc6d, 0x0002186c, 0x80000374, 0x0001a873,
+  0x0000f474, 0x0001d468, 0x0000053b, 0x80000375, 0x0000053b, 0x80000376,
+  0x00015872, 0x0001cc61, 0x0000053b, 0x80000377, 0x0000053b, 0x80000378,
+  0x0000053b, 0x80000379, 0x000d746d, 0x00010c69, 0x00000c6c, 0x0001a861,
+  0x0000046d, 0x0001c467, 0x8000037a, 0x0000b865, 0x0000e864, 0x00003d3b,
+  0x0001bc75, 0x8000037b, 0x0001d469, 0x0000e474, 0x8000037c, 0x0000113b,
+  0x0000793b, 0x00019873, 0x0000053b, 0x8000037d, 0x00040076, 0x0001b861,
+  0x0001b06d, 0x0001bc6d, 0x8000037e, 0x0000e461, 0x00005c72, 0x00000d3b,
+  0x00006c72, 0x0000e46e, 0x0001b469, 0x0001fd3b, 0x8000037f, 0x80000380,
+  0x0001cc6e, 0x80000381, 0x00019c64, 0x00019c74, 0x0007f465, 0x0001b86d,
+  0x000000cd, 0x00005070, 0x0003f06f, 0x00018469, 0x0001c465, 0x00032476,
+  0x0000e873, 0x00007d3b, 0x80000382, 0x000bd86e, 0x0000393b, 0x0001dc63,
+  0x0000293b, 0x0003646f, 0x00017473, 0x00016063, 0x003ac86d, 0x0000f46e,
+  0x0001b472, 0x00031861, 0x80000383, 0x0000c879, 0x80000384, 0x0000e93b,
+  0x0001206f, 0x0000f873, 0x00016c6f, 0x0001d461, 0x0000d472, 0x80000385,
+  0x0000053b, 0x80000386, 0x80000387, 0x0001b86c, 0x0000093b, 0x0001a46c,
+  0x0000e866, 0x00000d3b, 0x80000388, 0x00075871, 0x00060075, 0x00072c74,
+  0x0006f077, 0x0001fc6f, 0x00002d3b, 0x0001fc70, 0x000ce53b, 0x80000389,
+  0x0000dc74, 0x00066c61, 0x00065c69, 0x00063075, 0x8000038a, 0x0001c072,
+  0x00061464, 0x8000038b, 0x00070d3b, 0x0007d93b, 0x0007f93b, 0x0006346e,
+  0x0000e873, 0x00000d3b, 0x8000038c, 0x0001e86c, 0x0001c875, 0x0000e073,
+  0x0000053b, 0x8000038d, 0x00065075, 0x0001d071, 0x00007d3b, 0x0000e865,
+  0x0001e872, 0x8000038e, 0x0001b462, 0x0001886c, 0x00018065, 0x0001e872,
+  0x00018062, 0x0001c061, 0x00019877, 0x00000d3b, 0x8000038f, 0x00060465,
+  0x00019067, 0x0000fc65, 0x00013872, 0x00000477, 0x0001806e, 0x00013461,
+  0x0001b872, 0x00012c6f, 0x0001b064, 0x00000d3b, 0x80000390, 0x0001e46f,
+  0x0001e868, 0x0001b477, 0x0001806e, 0x0001d061, 0x0001d06f, 0x0001c472,
+  0x0001b472, 0x0001b477, 0x80000391, 0x0000e073, 0x0000093b, 0x0001d461,
+  0x0001c472, 0x0001b070, 0x0001846f, 0x0001e866, 0x0001b06f, 0x0000e474,
+  0x0000586e, 0x00001d3b, 0x80000392, 0x00005067, 0x0001bc65, 0x00019469,
+  0x00006c6c, 0x0001dc68, 0x0000c474, 0x0001a46b, 0x0001ec63, 0x0001b462,
+  0x00019472, 0x80000393, 0x00003d3b, 0x0000d473, 0x00008470, 0x0001fc61,
+  0x0001d06f, 0x0001f872, 0x0000753b, 0x0000e877, 0x0001c06f, 0x0000c870,
+  0x00019472, 0x80000394, 0x0007e06f, 0x0000d53b, 0x00017872, 0x0007106d,
+  0x0000e53b, 0x0000dc6e, 0x00006c74, 0x00038c69, 0x0001f46f, 0x00070464,
+  0x00002072, 0x00070465, 0x80000395, 0x80000396, 0x0001d063, 0x0000a86c,
+  0x0000e472, 0x80000397, 0x00000d3b, 0x0001906f, 0x00009c6b, 0x80000398,
+  0x0001b864, 0x0001146f, 0x00018061, 0x0001a072, 0x0001846f, 0x00009079,
+  0x0000653b, 0x0001b861, 0x0003c93b, 0x0001ac61, 0x0003d53b, 0x00014474,
+  0x0001a86e, 0x00032c72, 0x0001d468, 0x00025c6c, 0x0003e13b, 0x0001b867,
+  0x00013872, 0x0002146e, 0x00033072, 0x0002b875, 0x80000399, 0x8000039a,
+  0x8000039b, 0x00001d3b, 0x8000039c, 0x00000d3b, 0x8000039d, 0x00003d3b,
+  0x8000039e, 0x00000d3b, 0x8000039f, 0x0000f065, 0x0000053b, 0x800003a0,
+  0x00009079, 0x0005393b, 0x00019c63, 0x00000d3b, 0x800003a1, 0x0001d467,
+  0x00018872, 0x0001c472, 0x0000d472, 0x0001c061, 0x0000053b, 0x800003a2,
+  0x0001b869, 0x00010c44, 0x0001b844, 0x0001dc6f, 0x0000e874, 0x0000fd3b,
+  0x800003a3, 0x0000e474, 0x800003a4, 0x0000053b, 0x0002b863, 0x00019874,
+  0x0000d465, 0x003de078, 0x0000053b, 0x800003a5, 0x003d8475, 0x003da874,
+  0x003d7073, 0x003d8072, 0x003e0071, 0x003fc870, 0x003fc86f, 0x003fd86e,
+  0x003f586d, 0x003e286c, 0x0001d473, 0x00019874, 0x0001e465, 0x0001886f,
+  0x003e0c67, 0x0000b066, 0x00016465, 0x00000464, 0x00006463, 0x00011872,
+  0x0001e461, 0x800003a6, 0x0001fd3b, 0x0001b072, 0x0003446f, 0x0000193b,
+  0x0001dc61, 0x800003a7, 0x800003a8, 0x003c0072, 0x800003a9, 0x0001d06f,
+  0x0001ac6f, 0x00000d3b, 0x0001e469, 0x0001ac6c, 0x0000793b, 0x00008874,
+  0x800003aa, 0x00018444, 0x0000193b, 0x0000986e, 0x800003ab, 0x0001b86f,
+  0x0000053b, 0x800003ac, 0x0000053b, 0x800003ad, 0x00000474, 0x0005906f,
+  0x0000d479, 0x0005f469, 0x00018066, 0x0001c46f, 0x0000053b, 0x800003ae,
+  0x800003af, 0x0000a474, 0x0001d061, 0x00001d3b, 0x0001a876, 0x0000e472,
+  0x800003b0, 0x0000fc65, 0x00018474, 0x800003b1, 0x800003b2, 0x0000193b,
+  0x0001a465, 0x800003b3, 0x00019c6f, 0x0000793b, 0x0001b06e, 0x003e2465,
+  0x0001ec6f, 0x0001f072, 0x0000293b, 0x0000293b, 0x003fc06c, 0x800003b4,
+  0x0000dc73, 0x0000fc74, 0x800003b5, 0x800003b6, 0x800003b7, 0x003fed3b,
+  0x003fa13b, 0x003fb53b, 0x003fed3b, 0x003ff53b, 0x800003b8, 0x00018061,
+  0x0001cc63, 0x0000d072, 0x0000053b, 0x800003b9, 0x0001e074, 0x0000f079,
+  0x0000053b, 0x800003ba, 0x0000e874, 0x00007d3b, 0x800003bb, 0x00000d3b,
+  0x800003bc, 0x0000dc70, 0x0001a870, 0x0000f031, 0x0000393b, 0x0001d073,
+  0x800003bd, 0x0000093b, 0x0000dc33, 0x800003be, 0x800003bf, 0x0000fc34,
+  0x0000fd3b, 0x00000d3b, 0x00001467, 0x800003c0, 0x0000f470, 0x800003c1,
+  0x00001d3b, 0x0001b067, 0x0001806f, 0x800003c2, 0x0000e46e, 0x0000f866,
+  0x0000353b, 0x800003c3, 0x00001d3b, 0x0000e472, 0x0001f873, 0x00007d3b,
+  0x800003c4, 0x0001c86c, 0x0001f470, 0x0000193b, 0x00019873, 0x800003c5,
+  0x0001c875, 0x0000d073, 0x0000153b, 0x0000e069, 0x0000113b, 0x0001a86f,
+  0x00018c61, 0x800003c6, 0x800003c7, 0x0001106e, 0x0000153b, 0x0001ac76,
+  0x0000253b, 0x0001b072, 0x003f4873, 0x800003c8, 0x0000213b, 0x0001ec6f,
+  0x0001c873, 0x003f3072, 0x0001c873, 0x800003c9, 0x0000c463, 0x0001ec63,
+  0x800003ca, 0x0000653b, 0x003f3069, 0x0000193b, 0x0000986e, 0x0001ec6c,
+  0x00014474, 0x003e646c, 0x800003cb, 0x800003cc, 0x0002b476, 0x0001986f,
+  0x0000c93b, 0x00012075, 0x003f1c64, 0x00015c73, 0x003f0464, 0x0001b869,
+  0x0001006e, 0x0001bc61, 0x0001f067, 0x003b5869, 0x00001472, 0x0000393b,
+  0x0001986c, 0x003fcc73, 0x800003cd, 0x0001886c, 0x0001f074, 0x800003ce,
+  0x800003cf, 0x0000e46c, 0x0001b065, 0x800003d0, 0x00032876, 0x0001d873,
+  0x0001ac61, 0x00007d3b, 0x0000a873, 0x0001e86c, 0x0001e865, 0x00003876,
+  0x800003d1, 0x0003106c, 0x0001f069, 0x0000513b, 0x0000d073, 0x00035867,
+  0x0002c863, 0x00022c73, 0x00030074, 0x0003e53b, 0x0000053b, 0x800003d2,
+  0x0001f861, 0x00018070, 0x0000053b, 0x800003d3, 0x0001c472, 0x0001b444,
+  0x00027c73, 0x0001cc6f, 0x0000e874, 0x00000d3b, 0x800003d4, 0x0001b472,
+  0x0000e872, 0x00000d3b, 0x800003d5, 0x0001d063, 0x00018c64, 0x0000e072,
+  0x0000053b, 0x800003d6, 0x0001d86f, 0x0001a869, 0x0000e874, 0x00001d3b,
+  0x800003d7, 0x0000093b, 0x0000e06d, 0x800003d8, 0x0000e861, 0x00000d3b,
+  0x800003d9, 0x0000193b, 0x003d5063, 0x800003da, 0x0001886d, 0x800003db,
+  0x0000e46c, 0x0000c468, 0x0000353b, 0x0000153b, 0x00014461, 0x0000f46f,
+  0x800003dc, 0x00002c70, 0x0000e86c, 0x00000d3b, 0x800003dd, 0x0001c073,
+  0x0000053b, 0x800003de, 0x0001d869, 0x0000e074, 0x00018c74, 0x0001ec72,
+  0x0001d461, 0x0001bc74, 0x00018063, 0x0001b069, 0x0000486f, 0x0001e93b,
+  0x00018c74, 0x00037065, 0x0001186e, 0x00011473, 0x0001b465, 0x800003df,
+  0x00019c6e, 0x0001cc6e, 0x800003e0, 0x0000053b, 0x00019469, 0x00018c6f,
+  0x000000ea, 0x00006d3b, 0x0001c861, 0x0001f064, 0x00019c6c, 0x0000253b,
+  0x00008065, 0x0001ac6c, 0x0001a86c, 0x00033c6e, 0x800003e1, 0x0001b069,
+  0x800003e2, 0x800003e3, 0x00000d3b, 0x0000153b, 0x0001246f, 0x0001506c,
+  0x800003e4, 0x000000f9, 0x00017c61, 0x00014474, 0x0001c463, 0x0001dc65,
+  0x0001bc65, 0x00004c71, 0x0001b86d, 0x00040066, 0x0001cc69, 0x00016061,
+  0x00000079, 0x00062c6a, 0x00003465, 0x0006b06c, 0x0006fc6f, 0x0006686e,
+  0x00078c75, 0x0006fc70, 0x0007e473, 0x00069472, 0x0001a869, 0x0001a06c,
+  0x00077474, 0x0006646c, 0x00068074, 0x00006467, 0x0006486c, 0x800003e5,
+  0x003ce93b, 0x0000193b, 0x00257044, 0x00066069, 0x00071867, 0x00019069,
+  0x0000e867, 0x00001d3b, 0x800003e6, 0x00000d3b, 0x800003e7, 0x0001a069,
+  0x0000e867, 0x00000d3b, 0x800003e8, 0x00018469, 0x0001b86c, 0x0000e067,
+  0x0000053b, 0x800003e9, 0x0000053b, 0x800003ea, 0x00019869, 0x0000f067,
+  0x0000053b, 0x800003eb, 0x0001c86e, 0x0000d073, 0x0000053b, 0x800003ec,
+  0x00019c6f, 0x0000f066, 0x0000053b, 0x800003ed, 0x0000f13b, 0x0000e866,
+  0x00068861, 0x00016070, 0x800003ee, 0x00019872, 0x0001b461, 0x0001bc6c,
+  0x0000e86c, 0x00003d3b, 0x800003ef, 0x00000d3b, 0x800003f0, 0x00001d3b,
+  0x800003f1, 0x0001586c, 0x0000f06b, 0x0001b461, 0x0006f072, 0x0001b469,
+  0x0001d46e, 0x0000f874, 0x800003f2, 0x00013474, 0x0000093b, 0x00005861,
+  0x00012831, 0x0000006f, 0x0001b433, 0x00014832, 0x0025cc35, 0x004b9834,
+  0x004ba437, 0x800003f3, 0x0000f832, 0x0000c833, 0x00012c63, 0x800003f4,
+  0x0000bc36, 0x0001e93b, 0x0000d834, 0x0000c435, 0x00002d3b, 0x00003c72,
+  0x00009c38, 0x00001d3b, 0x800003f5, 0x0000093b, 0x00010077, 0x800003f6,
+  0x00000d3b, 0x0000706c, 0x0001bc73, 0x800003f7, 0x800003f8, 0x800003f9,
+  0x0000093b, 0x0000093b, 0x0000053b, 0x800003fa, 0x0000d833, 0x800003fb,
+  0x0000fc35, 0x0000193b, 0x800003fc, 0x800003fd, 0x0000806e, 0x0000fd3b,
+  0x0000e035, 0x00001434, 0x0001d076, 0x00035865, 0x0000e53b, 0x00019c74,
+  0x00014c63, 0x0000613b, 0x0001986d, 0x0000713b, 0x0001ec72, 0x00036861,
+  0x0001d476, 0x0000c838, 0x0000293b, 0x800003fe, 0x0001a865, 0x00003d3b,
+  0x0002ec6e, 0x00035863, 0x0000253b, 0x800003ff, 0x00028c6c, 0x0002cc78,
+  0x80000400, 0x0003ed3b, 0x80000401, 0x0003f13b, 0x00035865, 0x80000402,
+  0x80000403, 0x80000404, 0x0000e845, 0x00001d3b, 0x80000405, 0x00000d3b,
+  0x80000406, 0x00040863, 0x0000093b, 0x0002386d, 0x80000407, 0x0004746c,
+  0x0000053b, 0x80000408, 0x00045c69, 0x00007d3b, 0x80000409, 0x00000d3b,
+  0x8000040a, 0x0000153b, 0x0000f870, 0x0002ac72, 0x8000040b, 0x00020472,
+  0x0000053b, 0x8000040c, 0x0000053b, 0x8000040d, 0x0001d46f, 0x0000e074,
+  0x0000053b, 0x8000040e, 0x000e6467, 0x00000466, 0x0000cc65, 0x00014064,
+  0x0001a863, 0x0002ec62, 0x00010861, 0x00010869, 0x0000906f, 0x000fa06e,
+  0x0000193b, 0x000e4c6c, 0x8000040f, 0x0000986a, 0x00005469, 0x00007d3b,
+  0x80000410, 0x000ebc76, 0x0000113b, 0x000e5c74, 0x000f1c73, 0x000f7872,
+  0x80000411, 0x00005879, 0x0000053b, 0x80000412, 0x00028061, 0x0000f074,
+  0x0000053b, 0x80000413, 0x0000053b, 0x80000414, 0x0000093b, 0x0000e863,
+  0x80000415, 0x80000416, 0x0001d46f, 0x000c0074, 0x80000417, 0x00003d3b,
+  0x80000418, 0x80000419, 0x0000053b, 0x8000041a, 0x0000053b, 0x8000041b,
+  0x00007d3b, 0x0000f873, 0x8000041c, 0x8000041d, 0x00009472, 0x00019c64,
+  0x0001a86c, 0x0000353b, 0x0001906d, 0x00018865, 0x8000041e, 0x0000dc6c,
+  0x0000193b, 0x0000113b, 0x8000041f, 0x0000f079, 0x80000420, 0x80000421,
+  0x0001a471, 0x00012864, 0x00019c73, 0x80000422, 0x000e8473, 0x000f6c70,
+  0x00011063, 0x0003986f, 0x00013063, 0x000f4c6c, 0x80000423, 0x80000424,
+  0x00003d3b, 0x00001d3b, 0x0000153b, 0x80000425, 0x0001e072, 0x00000d3b,
+  0x80000426, 0x0001ac69, 0x80000427, 0x0000d46d, 0x80000428, 0x0000393b,
+  0x0001ec71, 0x80000429, 0x0003b873, 0x0000153b, 0x000e4870, 0x0001a46c,
+  0x8000042a, 0x000fd93b, 0x000f193b, 0x000f213b, 0x000f493b, 0x000f753b,
+  0x000f4445, 0x000fa93b, 0x000fc93b, 0x000fc53b, 0x000f3066, 0x8000042b,
+  0x0001dc61, 0x00018876, 0x0000e865, 0x00000d3b, 0x8000042c, 0x0000753b,
+  0x0001cc63, 0x00009472, 0x8000042d, 0x0000f06d, 0x0000053b, 0x8000042e,
+  0x0000053b, 0x8000042f, 0x0000053b, 0x80000430, 0x00019069, 0x80000431,
+  0x0000053b, 0x80000432, 0x00001872, 0x0000113b, 0x000ed461, 0x00001863,
+  0x80000433, 0x0000053b, 0x00006465, 0x0001dc6f, 0x0000e874, 0x00003d3b,
+  0x80000434, 0x00018850, 0x0001d061, 0x00011c69, 0x0000e872, 0x00000d3b,
+  0x80000435, 0x0001e875, 0x000e9c65, 0x0000e474, 0x000ea073, 0x0000193b,
+  0x0001cc70, 0x80000436, 0x0001e072, 0x0001fc70, 0x0001ec6f, 0x0000193b,
+  0x0001b472, 0x0000e478, 0x0000e872, 0x0001ed3b, 0x0000386f, 0x80000437,
+  0x00002864, 0x0000213b, 0x0001ac71, 0x0001806c, 0x0000f874, 0x0001bc6c,
+  0x80000438, 0x00001463, 0x0000c46c, 0x80000439, 0x00019c65, 0x00006d3b,
+  0x0001c071, 0x000e0471, 0x000f3070, 0x0001bc65, 0x8000043a, 0x0000353b,
+  0x000e106a, 0x00010873, 0x00011065, 0x00003c71, 0x00015c72, 0x000eac6c,
+  0x0001bc71, 0x000e3861, 0x00001d3b, 0x0001a86c, 0x8000043b, 0x8000043c,
+  0x000eac67, 0x000f8c65, 0x00009061, 0x0001ec65, 0x00004873, 0x0001dc73,
+  0x00015c65, 0x0000d064, 0x00018c69, 0x00003473, 0x0000f06d, 0x0001d873,
+  0x0000004b, 0x0000004a, 0x00003473, 0x0001a46c, 0x00018c65, 0x0000793b,
+  0x0029006e, 0x8000043d, 0x0001f473, 0x00033c70, 0x00026874, 0x0001d472,
+  0x0000053b, 0x8000043e, 0x8000043f, 0x0001e873, 0x00026469, 0x0001f065,
+  0x00023071, 0x000e7445, 0x00022072, 0x80000440, 0x00022c6e, 0x00033071,
+  0x0003e93b, 0x00023c41, 0x0000e872, 0x0003e93b, 0x00023072, 0x0000393b,
+  0x0001f069, 0x80000441, 0x0000e866, 0x0000153b, 0x00027c6d, 0x0001846c,
+  0x80000442, 0x0001ac6c, 0x0000e874, 0x00000d3b, 0x80000443, 0x00015472,
+  0x0001ec63, 0x0000093b, 0x0000e079, 0x80000444, 0x0000053b, 0x80000445,
+  0x0001cc69, 0x0000f072, 0x0000053b, 0x80000446, 0x0000053b, 0x80000447,
+  0x00019062, 0x00019863, 0x00015464, 0x00010861, 0x00006c66, 0x0001c461,
+  0x0000d472, 0x00001c65, 0x00000d3b, 0x0000446b, 0x0002446f, 0x80000448,
+  0x00018072, 0x0000b86f, 0x0001c069, 0x00009063, 0x0000093b, 0x00072873,
+  0x80000449, 0x0001c072, 0x00005c72, 0x8000044a, 0x00000d3b, 0x0001f074,
+  0x0000d473, 0x0001dc69, 0x0000f474, 0x0007e479, 0x0000053b, 0x8000044b,
+  0x0001a06c, 0x00003069, 0x0000cc63, 0x00000061, 0x0000293b, 0x0000e870,
+  0x0000353b, 0x0001b063, 0x0001886f, 0x0000213b, 0x8000044c, 0x8000044d,
+  0x0000d46e, 0x00013873, 0x0000786c, 0x0000c472, 0x0001b061, 0x8000044e,
+  0x0001a872, 0x0000093b, 0x0001d072, 0x8000044f, 0x0001c477, 0x0001d06f,
+  0x0000f077, 0x0001fc61, 0x0001d06f, 0x0000153b, 0x0001b472, 0x0000e477,
+  0x80000450, 0x0000e13b, 0x00012065, 0x00013872, 0x00013c65, 0x0001b474,
+  0x00013c61, 0x00001472, 0x0001e068, 0x80000451, 0x0000053b, 0x80000452,
+  0x0000d474, 0x0001bc6b, 0x0001446c, 0x0001bc61, 0x0001b86f, 0x80000453,
+  0x0001ec6d, 0x00019474, 0x0001ac66, 0x00066872, 0x00011077, 0x00064c70,
+  0x00019072, 0x0001d46f, 0x0001f872, 0x0000dc77, 0x0000a075, 0x00018469,
+  0x00018072, 0x0000593b, 0x00040068, 0x00063872, 0x000cf53b, 0x0001ac67,
+  0x00063c61, 0x0001b072, 0x0001d86f, 0x0000f077, 0x0000053b, 0x80000454,
+  0x0000e866, 0x00003d3b, 0x80000455, 0x00018c62, 0x0000f472, 0x0001cc61,
+  0x0000053b, 0x80000456, 0x00009472, 0x00019c74, 0x0000053b, 0x80000457,
+  0x0000f068, 0x0001d061, 0x0001b873, 0x00000d3b, 0x80000458, 0x0001946c,
+  0x00019063, 0x0001a46f, 0x0001b072, 0x0000f06b, 0x0000053b, 0x80000459,
+  0x0000053b, 0x8000045a, 0x0001d062, 0x0001bc75, 0x0001b46c, 0x0000186c,
+  0x00019068, 0x0001b465, 0x0000e86e, 0x00003d3b, 0x8000045b, 0x0002ec73,
+  0x0002e870, 0x0002fc71, 0x00019875, 0x8000045c, 0x001c4874, 0x001d5075,
+  0x0000b86a, 0x0001a063, 0x0001f870, 0x00022069, 0x00024c6e, 0x0002d86f,
+  0x0000d465, 0x00035c6d, 0x0000553b, 0x0000e063, 0x0001ed3b, 0x0001a461,
+  0x00005466, 0x00007867, 0x0001b474, 0x00006c65, 0x00018472, 0x8000045d,
+  0x0000f463, 0x8000045e, 0x00001d3b, 0x00000d3b, 0x8000045f, 0x0001d863,
+  0x0000e479, 0x80000460, 0x00000d3b, 0x80000461, 0x0001b863, 0x80000462,
+  0x00009c6c, 0x00008066, 0x80000463, 0x00019c72, 0x0000653b, 0x00016066,
+  0x0000653b, 0x0000153b, 0x0001ac76, 0x0001dc61, 0x0000e865, 0x0000113b,
+  0x00013c6e, 0x0000d472, 0x0001cc78, 0x80000464, 0x80000465, 0x0000f13b,
+  0x00015069, 0x00001474, 0x00019469, 0x80000466, 0x0000d474, 0x80000467,
+  0x80000468, 0x0001dc6e, 0x00016869, 0x0000f86e, 0x00003d3b, 0x0000f861,
+  0x0000293b, 0x00019c74, 0x00006d3b, 0x0001e069, 0x0000dc67, 0x0001ac69,
+  0x0001d06c, 0x00022061, 0x0002586e, 0x80000469, 0x0000cc72, 0x8000046a,
+  0x00001879, 0x8000046b, 0x00032874, 0x00033468, 0x00002d3b, 0x8000046c,
+  0x00001d3b, 0x0000093b, 0x0003793b, 0x00018061, 0x00021863, 0x00031c65,
+  0x0000053b, 0x8000046d, 0x00018067, 0x0000e065, 0x0003a474, 0x00021c72,
+  0x0002486c, 0x00001d3b, 0x8000046e, 0x00000d3b, 0x8000046f, 0x0001e06f,
+  0x00018470, 0x0000e066, 0x0000053b, 0x80000470, 0x00019c65, 0x00021874,
+  0x00021070, 0x0000d064, 0x0000053b, 0x80000471, 0x80000472, 0x0001d061,
+  0x0000193b, 0x00016072, 0x0000053b, 0x80000473, 0x00001465, 0x0001b469,
+  0x0000e86e, 0x00001d3b, 0x80000474, 0x0000e465, 0x00019869, 0x00003d3b,
+  0x80000475, 0x0001b464, 0x0000f474, 0x0001d46f, 0x0000053b, 0x80000476,
+  0x0000053b, 0x80000477, 0x0001b461, 0x0000e06c, 0x0000053b, 0x80000478,
+  0x0001fc72, 0x0001cc65, 0x0000053b, 0x80000479, 0x0000d473, 0x00018863,
+  0x0001b461, 0x0000f06c, 0x0000053b, 0x8000047a, 0x00003061, 0x00011c6b,
+  0x0001a872, 0x00002466, 0x00005868, 0x0000113b, 0x0000f863, 0x00005467,
+  0x00018072, 0x8000047b, 0x0000146f, 0x00019c6f, 0x0000e864, 0x0000153b,
+  0x0000e879, 0x00006d3b, 0x8000047c, 0x0001d86f, 0x00002872, 0x0000253b,
+  0x00036c69, 0x00011874, 0x0003346f, 0x0003806e, 0x8000047d, 0x0000f46e,
+  0x8000047e, 0x8000047f, 0x0000f466, 0x0000f861, 0x0000153b, 0x00010c65,
+  0x0000f53b, 0x0000dd3b, 0x00015463, 0x00016475, 0x0001a872, 0x80000480,
+  0x00011067, 0x00014470, 0x00000864, 0x0001946f, 0x80000481, 0x0000f074,
+  0x001c006e, 0x80000482, 0x00008c74, 0x0001c073, 0x0000153b, 0x001f5074,
+  0x00014865, 0x0001c463, 0x0000c472, 0x00013c70, 0x80000483, 0x80000484,
+  0x00009c63, 0x00013474, 0x0000313b, 0x0000986c, 0x00001d3b, 0x0001fc69,
+  0x001d8c76, 0x80000485, 0x0001946f, 0x80000486, 0x001ffd3b, 0x00000d3b,
+  0x80000487, 0x00001d3b, 0x80000488, 0x00000d3b, 0x80000489, 0x00003d3b,
+  0x8000048a, 0x00019c6c, 0x00018c64, 0x0000193b, 0x0000f065, 0x8000048b,
+  0x0001e063, 0x00009479, 0x0001f46b, 0x00000d3b, 0x8000048c, 0x0000f06c,
+  0x0000053b, 0x8000048d, 0x0001a46d, 0x0000d463, 0x0001b072, 0x00000d3b,
+  0x8000048e, 0x00001d3b, 0x8000048f, 0x0000e072, 0x0000053b, 0x80000490,
+  0x0001a063, 0x00012c69, 0x0001b874, 0x0001d461, 0x0000e468, 0x00012866,
+  0x0000053b, 0x80000491, 0x00019c70, 0x0000e066, 0x0000053b, 0x80000492,
+  0x0001d06f, 0x0000e472, 0x0001b06d, 0x0000713b, 0x00018473, 0x00004479,
+  0x0001b463, 0x80000493, 0x0001cc65, 0x00018472, 0x00019875, 0x0001d863,
+  0x0000e479, 0x80000494, 0x00000d3b, 0x0001946b, 0x0000e479, 0x0001e063,
+  0x0000053b, 0x80000495, 0x0001c461, 0x0001d470, 0x0001bc63, 0x0000393b,
+  0x00018070, 0x0003f861, 0x0001a867, 0x0001b866, 0x0001f465, 0x00010868,
+  0x80000496, 0x0001046a, 0x0001d076, 0x80000497, 0x0001546f, 0x0001e469,
+  0x00000d3b, 0x0001dc64, 0x00010873, 0x80000498, 0x0000e079, 0x0000c069,
+  0x0002ec61, 0x0000393b, 0x0000113b, 0x80000499, 0x0000c46c, 0x0000e072,
+  0x8000049a, 0x0000f13b, 0x00016472, 0x0000bd3b, 0x0000186e, 0x8000049b,
+  0x00018865, 0x00de047a, 0x0000c472, 0x0001ac65, 0x00005d3b, 0x00000c79,
+  0x0001d863, 0x0001e863, 0x0000dc79, 0x00018870, 0x0000793b, 0x00018861,
+  0x00006d3b, 0x0000e066, 0x8000049c, 0x8000049d, 0x8000049e, 0x00019463,
+  0x0003206c, 0x8000049f, 0x00023061, 0x800004a0, 0x00013c74, 0x800004a1,
+  0x800004a2, 0x0000313b, 0x800004a3, 0x00023472, 0x00023c72, 0x0000193b,
+  0x0003293b, 0x0000c445, 0x00030872, 0x00031c72, 0x00027069, 0x00022441,
+  0x00024442, 0x0003f53b, 0x0001cc72, 0x0000e072, 0x0003d93b, 0x0000193b,
+  0x0001fc48, 0x800004a4, 0x001c7c64, 0x00007d3b, 0x800004a5, 0x0000e472,
+  0x0001c461, 0x00001d3b, 0x800004a6, 0x0001dc75, 0x00019074, 0x0000d065,
+  0x0000093b, 0x00028c73, 0x800004a7, 0x0001d46d, 0x00028876, 0x0001ec74,
+  0x0001dc70, 0x001c5479, 0x00060c64, 0x00046865, 0x000b7c66, 0x000a3c67,
+  0x0000253b, 0x00001c61, 0x00070862, 0x00079c63, 0x000afc6c, 0x000a0c6d,
+  0x000ae06e, 0x0009386f, 0x000b4068, 0x800004a8, 0x000b906a, 0x001db845,
+  0x000ed874, 0x000efc75, 0x000d4076, 0x00019c72, 0x0008e870, 0x00018c61,
+  0x000f4872, 0x000fd873, 0x0000e86e, 0x00000d3b, 0x800004a9, 0x00018c62,
+  0x00018064, 0x0000e061, 0x0000053b, 0x800004aa, 0x00040067, 0x00008463,
+  0x800004ab, 0x0000153b, 0x0000c465, 0x00001067, 0x800004ac, 0x0000c465,
+  0x800004ad, 0x800004ae, 0x0000ac6f, 0x0001b875, 0x0001ac6e, 0x0002d476,
+  0x0000193b, 0x0000586d, 0x0001e872, 0x001c913b, 0x0000f470, 0x0001b471,
+  0x0000753b, 0x800004af, 0x0007a474, 0x00018c67, 0x00078c72, 0x00001c6b,
+  0x00003d3b, 0x800004b0, 0x0000e473, 0x800004b1, 0x0000053b, 0x800004b2,
+  0x0000e873, 0x0000153b, 0x0000c470, 0x0000c46c, 0x800004b3, 0x0000093b,
+  0x0000b46d, 0x800004b4, 0x00000d3b, 0x0000153b, 0x00018469, 0x800004b5,
+  0x800004b6, 0x00009c6c, 0x0001c069, 0x00019472, 0x0000113b, 0x0000193b,
+  0x0000f06c, 0x00072c6b, 0x800004b7, 0x0000253b, 0x0000213b, 0x800004b8,
+  0x0000e072, 0x800004b9, 0x00018872, 0x0000113b, 0x800004ba, 0x800004bb,
+  0x800004bc, 0x800004bd, 0x00076d3b, 0x0007713b, 0x0007fd3b, 0x0000113b,
+  0x0007f53b, 0x00066061, 0x00063862, 0x800004be, 0x0001f063, 0x00000d3b,
+  0x800004bf, 0x00001d3b, 0x800004c0, 0x0000e065, 0x0000053b, 0x800004c1,
+  0x0001ec61, 0x00008c65, 0x0001586c, 0x00001d3b, 0x800004c2, 0x0000093b,
+  0x00019c72, 0x800004c3, 0x0001b872, 0x0001ac6f, 0x0001c86b, 0x00019473,
+  0x0000e86e, 0x00000d3b, 0x800004c4, 0x0000bc6b, 0x00002064, 0x00012c61,
+  0x0001a064, 0x0001ac69, 0x0000e46c, 0x00018c65, 0x0000053b, 0x800004c5,
+  0x0000093b, 0x0000e86c, 0x800004c6, 0x0000f462, 0x800004c7, 0x0000053b,
+  0x0000753b, 0x0001a869, 0x0000e461, 0x00007c75, 0x0000193b, 0x800004c8,
+  0x800004c9, 0x0001f075, 0x0001b875, 0x0000d06f, 0x0000113b, 0x0000b079,
+  0x00001d3b, 0x00019068, 0x800004ca, 0x800004cb, 0x0001cc61, 0x00011472,
+  0x00004463, 0x00000d3b, 0x800004cc, 0x0001b868, 0x00005c64, 0x0001b873,
+  0x0000053b, 0x800004cd, 0x00072c73, 0x0000f068, 0x00061c73, 0x00071070,
+  0x0001a061, 0x0001886f, 0x0000693b, 0x00073874, 0x0001c473, 0x0001c472,
+  0x00004471, 0x00078468, 0x800004ce, 0x00018c75, 0x0000ac72, 0x0007146c,
+  0x00038877, 0x00018c62, 0x00018c65, 0x800004cf, 0x0007cc66, 0x00073866,
+  0x00076461, 0x00014461, 0x0001c472, 0x0001cc61, 0x800004d0, 0x00010472,
+  0x00019074, 0x00000d3b, 0x800004d1, 0x00018869, 0x00018c68, 0x0000dc6c,
+  0x0001cc61, 0x0001d072, 0x0001d86c, 0x0001c46f, 0x0000793b, 0x0001b470,
+  0x800004d2, 0x0001c072, 0x00025872, 0x0001a06f, 0x0002bc74, 0x00024c6e,
+  0x00032470, 0x0001e86f, 0x800004d3, 0x800004d4, 0x00025c77, 0x800004d5,
+  0x00026c74, 0x000db079, 0x0000005b, 0x00027065, 0x00036d3b, 0x00038d3b,
+  0x00026864, 0x0003586e, 0x0003f13b, 0x00023466, 0x0001cc61, 0x0001f472,
+  0x0001b472, 0x0001c477, 0x0001d06f, 0x0000f073, 0x0003d53b, 0x00019069,
+  0x0001dc67, 0x00013874, 0x0001c072, 0x0001a868, 0x00019472, 0x00025475,
+  0x0000053b, 0x800004d6, 0x0000e877, 0x0003b13b, 0x0001e46f, 0x0001cc72,
+  0x0001b870, 0x0001a46f, 0x0001dc61, 0x0001b46f, 0x0001c86e, 0x00001473,
+  0x00010861, 0x00000d3b, 0x800004d7, 0x0001cc71, 0x00057064, 0x0001a875,
+  0x0001ac69, 0x0001f461, 0x0001c472, 0x00015068, 0x0001b067, 0x0001a472,
+  0x0004346c, 0x0001d46f, 0x800004d8, 0x00009077, 0x0000793b, 0x00018072,
+  0x00018073, 0x0001c068, 0x00019c65, 0x00018469, 0x0001e865, 0x0000dc73,
+  0x00019074, 0x0001986d, 0x0001f865, 0x00001d3b, 0x800004d9, 0x00000d3b,
+  0x800004da, 0x0001e93b, 0x0001a061, 0x0001806c, 0x0000d074, 0x0000ac63,
+  0x00000d3b, 0x800004db, 0x0001c06e, 0x800004dc, 0x000c0073, 0x800004dd,
+  0x00013871, 0x800004de, 0x0001a06f, 0x0000113b, 0x0003c074, 0x0001ec72,
+  0x000fac74, 0x000fa474, 0x00012874, 0x0000193b, 0x0000293b, 0x800004df,
+  0x800004e0, 0x800004e1, 0x00001473, 0x0001cc70, 0x00019c70, 0x0001006f,
+  0x00016867, 0x00033466, 0x800004e2, 0x0001c073, 0x0001d865, 0x0001ac64,
+  0x0001ec67, 0x0000ac78, 0x00013461, 0x0001006f, 0x00005d3b, 0x0001a071,
+  0x00013867, 0x0001d867, 0x000f5072, 0x0001d474, 0x000f4072, 0x0001c074,
+  0x800004e3, 0x000f7472, 0x0001b073, 0x800004e4, 0x000ed465, 0x00003d3b,
+  0x0001f468, 0x00002871, 0x00019c73, 0x00016873, 0x0001b069, 0x000f246d,
+  0x000f4c72, 0x0004e53b, 0x800004e5, 0x000f2c74, 0x0001c071, 0x000e006f,
+  0x000f593b, 0x000f593b, 0x000fb13b, 0x00001d3b, 0x800004e6, 0x00000d3b,
+  0x800004e7, 0x00003d3b, 0x800004e8, 0x00000d3b, 0x800004e9, 0x00001d3b,
+  0x800004ea, 0x00000d3b, 0x800004eb, 0x00008472, 0x000e606f, 0x000e046c,
+  0x0000053b, 0x800004ec, 0x000e5c69, 0x00000d3b, 0x800004ed, 0x00003d3b,
+  0x800004ee, 0x00000d3b, 0x800004ef, 0x00017c72, 0x00000d3b, 0x0001d061,
+  0x00015862, 0x800004f0, 0x00001c64, 0x800004f1, 0x00000d3b, 0x800004f2,
+  0x0001a46c, 0x0000193b, 0x0000e86b, 0x00003d3b, 0x800004f3, 0x000cb463,
+  0x0000053b, 0x800004f4, 0x0000053b, 0x800004f5, 0x0001cc72, 0x00009072,
+  0x00000d3b, 0x0000a075, 0x0001a872, 0x800004f6, 0x0001d06f, 0x0000d872,
+  0x000e846e, 0x800004f7, 0x00003d3b, 0x00019c72, 0x0000f464, 0x0001c061,
+  0x0000053b, 0x800004f8, 0x0001a072, 0x00011069, 0x0000053b, 0x800004f9,
+  0x00019c64, 0x00019469, 0x0001c075, 0x0001d06f, 0x800004fa, 0x00018c73,
+  0x000e9c72, 0x00003d3b, 0x0001d46f, 0x0000e474, 0x0001e463, 0x0000093b,
+  0x800004fb, 0x800004fc, 0x0003ac74, 0x00000d3b, 0x800004fd, 0x800004fe,
+  0x0001b86f, 0x0000313b, 0x0000c53b, 0x0000f445, 0x0000d878, 0x800004ff,
+  0x0000c53b, 0x0000d13b, 0x000fdc65, 0x00016068, 0x0000001d, 0x80000500,
+  0x00005865, 0x00018073, 0x0001ac72, 0x0000bc74, 0x00037870, 0x80000501,
+  0x0001186f, 0x80000502, 0x0001a069, 0x00012c45, 0x00002867, 0x80000503,
+  0x0001846e, 0x0000306d, 0x00007d3b, 0x80000504, 0x0001fc72, 0x80000505,
+  0x0000293b, 0x00019c61, 0x0000bc63, 0x0001ac6c, 0x0000a861, 0x00033865,
+  0x80000506, 0x0003b53b, 0x00027867, 0x00000038, 0x00023867, 0x0000a072,
+  0x0000dc6b, 0x00009468, 0x0003393b, 0x0003493b, 0x0003753b, 0x0003993b,
+  0x00021861, 0x00024072, 0x0001b065, 0x0001c062, 0x0001ac6c, 0x0001306d,
+  0x0001186f, 0x0002586e, 0x0001d466, 0x00018874, 0x0001cc61, 0x0001b472,
+  0x0001b072, 0x0000b874, 0x00004c77, 0x0001cc6f, 0x80000507, 0x00009070,
+  0x00014872, 0x00035477, 0x00020c69, 0x00018c74, 0x0001dc68, 0x0001d461,
+  0x0001c072, 0x0001b072, 0x00014472, 0x0004007a, 0x0001d86f, 0x0000e077,
+  0x0000053b, 0x80000508, 0x0001c461, 0x0001c470, 0x00018474, 0x0001d473,
+  0x0000e86f, 0x00000d3b, 0x80000509, 0x000c2c63, 0x000c3c64, 0x00019069,
+  0x0001d867, 0x00025867, 0x0001d868, 0x0001c061, 0x00018874, 0x0001e472,
+  0x0001d86f, 0x0000e077, 0x0000053b, 0x8000050a, 0x00018c72, 0x0001d072,
+  0x00007865, 0x000cf873, 0x00018070, 0x0001d861, 0x0000206f, 0x0001b872,
+  0x00007c6c, 0x0001b477, 0x0001c866, 0x0000353b, 0x0000f074, 0x00018067,
+  0x00019069, 0x0000dc74, 0x0001c071, 0x00029071, 0x00036870, 0x0000613b,
+  0x0000e072, 0x0001f868, 0x8000050b, 0x0000593b, 0x0001b861, 0x0001b06d,
+  0x0000cd3b, 0x8000050c, 0x0001c875, 0x0000c873, 0x0001a869, 0x0000f866,
+  0x0001c065, 0x8000050d, 0x0003d461, 0x00001473, 0x0000e93b, 0x0001f06c,
+  0x0001c472, 0x00002074, 0x0001c461, 0x8000050e, 0x00012473, 0x00019862,
+  0x0001c461, 0x0000353b, 0x8000050f, 0x00009072, 0x80000510, 0x00018c6e,
+  0x0000a865, 0x80000511, 0x00001d3b, 0x00018867, 0x00075072, 0x0001cc61,
+  0x00072074, 0x0001c472, 0x00073c72, 0x000ce13b, 0x0001fc6f, 0x80000512,
+  0x80000513, 0x00062c61, 0x0000353b, 0x0001a872, 0x00060865, 0x0000153b,
+  0x00062075, 0x0001886e, 0x80000514, 0x80000515, 0x0007fd3b, 0x00000d3b,
+  0x80000516, 0x00001d3b, 0x80000517, 0x00061861, 0x0000393b, 0x00067063,
+  0x80000518, 0x0000986d, 0x0000e872, 0x0000193b, 0x00066868, 0x80000519,
+  0x0000e872, 0x0000793b, 0x0001d474, 0x8000051a, 0x0000053b, 0x8000051b,
+  0x0000053b, 0x8000051c, 0x0000d469, 0x0001a072, 0x0000053b, 0x8000051d,
+  0x00064c71, 0x0000f06f, 0x0000053b, 0x8000051e, 0x0000e872, 0x0000f93b,
+  0x00012c61, 0x8000051f, 0x00013863, 0x0000193b, 0x0000e06d, 0x80000520,
+  0x80000521, 0x0000053b, 0x00018469, 0x0000c468, 0x80000522, 0x0000053b,
+  0x0000053b, 0x80000523, 0x0000e862, 0x0000793b, 0x0001f071, 0x80000524,
+  0x0000f46f, 0x80000525, 0x00001d3b, 0x0001fc74, 0x80000526, 0x0000053b,
+  0x0001b472, 0x00019075, 0x0001a86f, 0x0000f06b, 0x0000093b, 0x0000093b,
+  0x80000527, 0x80000528, 0x0000093b, 0x0000e863, 0x80000529, 0x8000052a,
+  0x0001e06f, 0x0000e072, 0x0000153b, 0x8000052b, 0x0000e874, 0x0000393b,
+  0x0000113b, 0x0001f069, 0x00000d3b, 0x0001fc65, 0x8000052c, 0x8000052d,
+  0x0001e464, 0x0000093b, 0x0001e872, 0x8000052e, 0x0001446d, 0x0000353b,
+  0x0007486c, 0x00009865, 0x8000052f, 0x0000093b, 0x00011050, 0x80000530,
+  0x80000531, 0x0000a873, 0x00012072, 0x80000532, 0x00013865, 0x00013461,
+  0x00012464, 0x00036069, 0x00003872, 0x00011c63, 0x0001f465, 0x00019075,
+  0x0001dc73, 0x0000d93b, 0x0001a86c, 0x00001474, 0x0000053b, 0x80000533,
+  0x00013868, 0x00015869, 0x0000153b, 0x00022044, 0x00024468, 0x00004472,
+  0x0001f872, 0x80000534, 0x0000313b, 0x00019471, 0x00018873, 0x0001a465,
+  0x80000535, 0x0001b067, 0x00026472, 0x0001c472, 0x0003d53b, 0x0001f861,
+  0x0003713b, 0x00022864, 0x0001cc61, 0x00032072, 0x00018068, 0x0001c461,
+  0x00032c72, 0x0001f465, 0x0001d472, 0x0001a474, 0x0001d865, 0x80000536,
+  0x0001606e, 0x0001cc71, 0x0001846e, 0x00032871, 0x0001f075, 0x0000e045,
+  0x0000053b, 0x80000537, 0x00028444, 0x0000e474, 0x0001dc6f, 0x00003d3b,
+  0x80000538, 0x0000e072, 0x0000053b, 0x80000539, 0x0000053b, 0x8000053a,
+  0x0000f13b, 0x0000d53b, 0x00fed870, 0x00012863, 0x8000053b, 0x00fe0473,
+  0x0005493b, 0x00fe9c75, 0x00000465, 0x0000313b, 0x00019073, 0x00003465,
+  0x8000053c, 0x8000053d, 0x0001b074, 0x8000053e, 0x0001b46c, 0x0000b86f,
+  0x00002472, 0x0001cc61, 0x0000b870, 0x0000f063, 0x00003064, 0x0000d865,
+  0x0000a066, 0x00004874, 0x00008868, 0x00fc0069, 0x00005d3b, 0x00010c6e,
+  0x00ff1c6c, 0x00002c6f, 0x00ff406e, 0x00fffc6f, 0x00006c65, 0x00005077,
+  0x0000d472, 0x00001d3b, 0x8000053f, 0x0001ac65, 0x0000d074, 0x80000540,
+  0x0001e866, 0x0000393b, 0x0000e870, 0x0000193b, 0x0000093b, 0x80000541,
+  0x80000542, 0x80000543, 0x00018065, 0x0001bc6d, 0x00019c6b, 0x00019c6d,
+  0x0001a472, 0x0000e061, 0x0000653b, 0x80000544, 0x00016065, 0x0001c461,
+  0x0001f075, 0x0001b073, 0x00002d3b, 0x00022866, 0x00023065, 0x00001468,
+  0x0001706f, 0x00001d3b, 0x0001c861, 0x00013073, 0x00018864, 0x0000dc64,
+  0x80000545, 0x00018061, 0x0001986c, 0x0001906e, 0x0001b867, 0x00008065,
+  0x00009872, 0x0001346c, 0x80000546, 0x0000dc73, 0x0000793b, 0x0000093b,
+  0x0000253b, 0x80000547, 0x00013875, 0x0000f06f, 0x00004479, 0x00018072,
+  0x0000f86f, 0x00030866, 0x0005f465, 0x80000548, 0x0000e474, 0x0000093b,
+  0x00fff53b, 0x80000549, 0x0000053b, 0x8000054a, 0x00fe2873, 0x8000054b,
+  0x0001cc69, 0x0000e072, 0x0000053b, 0x8000054c, 0x0001d46f, 0x0000e074,
+  0x0000053b, 0x8000054d, 0x0001c875, 0x0000e073, 0x0000053b, 0x8000054e,
+  0x0000053b, 0x8000054f, 0x0000053b, 0x80000550, 0x0000053b, 0x80000551,
+  0x0000e870, 0x0000393b, 0x0001f863, 0x80000552, 0x0000e872, 0x00001d3b,
+  0x80000553, 0x0000f93b, 0x00014870, 0x0001dc64, 0x0001d06c, 0x0001c075,
+  0x00001073, 0x80000554, 0x00019c64, 0x0001f86c, 0x0001bc65, 0x80000555,
+  0x0000e873, 0x0000393b, 0x80000556, 0x0000f066, 0x0000193b, 0x00000d3b,
+  0x80000557, 0x00009472, 0x0001f470, 0x00000d3b, 0x80000558, 0x0001d46f,
+  0x0001a070, 0x0000e073, 0x0000053b, 0x80000559, 0x8000055a, 0x0000053b,
+  0x0001a074, 0x0001ac69, 0x8000055b, 0x0001886d, 0x0001c461, 0x00011c70,
+  0x0001d061, 0x00007063, 0x8000055c, 0x0001fd3b, 0x0000e070, 0x8000055d,
+  0x00106462, 0x0000153b, 0x0000353b, 0x0000693b, 0x0000e467, 0x8000055e,
+  0x00017072, 0x00013474, 0x0001dc66, 0x0000693b, 0x0001d46f, 0x0001e064,
+  0x00009877, 0x8000055f, 0x00018867, 0x80000560, 0x00004874, 0x0001f062,
+  0x0000d463, 0x00038c74, 0x0000ac61, 0x00013c61, 0x0001cc75, 0x0003d46d,
+  0x00010068, 0x0000e064, 0x00012065, 0x00017c61, 0x00017472, 0x00001d3b,
+  0x80000561, 0x00015869, 0x0001f072, 0x0001f06f, 0x00018072, 0x0000fc6c,
+  0x00014074, 0x80000562, 0x0000d077, 0x0000193b, 0x0000806c, 0x0001386d,
+  0x80000563, 0x00032474, 0x0001f872, 0x0000193b, 0x0001ac69, 0x80000564,
+  0x0001fc72, 0x00000036, 0x00024867, 0x0001f461, 0x00018874, 0x00024072,
+  0x00000d3b, 0x0000003c, 0x00020078, 0x80000565, 0x0002b447, 0x0003293b,
+  0x00023068, 0x0003cd3b, 0x0001d86f, 0x00030877, 0x0001f461, 0x00018044,
+  0x0001a473, 0x0000e068, 0x0000193b, 0x0002384c, 0x80000566, 0x0001c061,
+  0x0001d873, 0x0000753b, 0x00009068, 0x00014856, 0x80000567, 0x0001986c,
+  0x0000e461, 0x00022052, 0x0000053b, 0x80000568, 0x0001d875, 0x0000e465,
+  0x00019874, 0x00001d3b, 0x80000569, 0x0000e067, 0x0000053b, 0x8000056a,
+  0x00068067, 0x00078c66, 0x00064465, 0x0000e864, 0x00009063, 0x00000862,
+  0x00001c61, 0x00012c64, 0x0004686f, 0x8000056b, 0x0005f46d, 0x0005a46c,
+  0x8000056c, 0x0006986a, 0x00045c69, 0x0006a868, 0x000ec477, 0x000fd876,
+  0x000e2075, 0x0009b074, 0x000a1c73, 0x000bb072, 0x00007d3b, 0x0004bc70,
+  0x0000513b, 0x0000e064, 0x0000053b, 0x8000056d, 0x0000e873, 0x00000d3b,
+  0x8000056e, 0x00004072, 0x0003186f, 0x8000056f, 0x0000bc63, 0x0000f062,
+  0x00040072, 0x0000113b, 0x0001c075, 0x0007f06c, 0x00012c45, 0x80000570,
+  0x80000571, 0x00006d3b, 0x0002f876, 0x00009470, 0x00021876, 0x0000d46e,
+  0x80000572, 0x00017070, 0x00038875, 0x0000153b, 0x0001a473, 0x00019874,
+  0x80000573, 0x0002b86e, 0x00078870, 0x80000574, 0x00fd7c63, 0x00001d3b,
+  0x80000575, 0x00039864, 0x0000053b, 0x80000576, 0x0001a06f, 0x0001e461,
+  0x0000b46f, 0x0000293b, 0x0000e469, 0x0001b065, 0x0000f86e, 0x00018069,
+  0x00003470, 0x80000577, 0x00019472, 0x0000f06c, 0x0000753b, 0x00018c64,
+  0x00008874, 0x0001c46f, 0x0001946e, 0x80000578, 0x00072c67, 0x80000579,
+  0x0001b86f, 0x0001fc75, 0x8000057a, 0x0000053b, 0x00063861, 0x0000f079,
+  0x0000e870, 0x0007e13b, 0x0000e068, 0x0000c070, 0x0007e93b, 0x0007e53b,
+  0x0007293b, 0x0007613b, 0x0007c53b, 0x8000057b, 0x8000057c, 0x00064473,
+  0x8000057d, 0x8000057e, 0x00003d3b, 0x0001c472, 0x0000e872, 0x00001d3b,
+  0x8000057f, 0x0001ac72, 0x0001a868, 0x0000906b, 0x0000053b, 0x80000580,
+  0x0000053b, 0x80000581, 0x0000f472, 0x0000e077, 0x0000053b, 0x80000582,
+  0x0001d46f, 0x0000e074, 0x0000053b, 0x80000583, 0x0001a075, 0x0001d469,
+  0x0000e876, 0x0000fd3b, 0x80000584, 0x00018865, 0x0001cc61, 0x0000f072,
+  0x0000053b, 0x80000585, 0x0000e86d, 0x00003d3b, 0x80000586, 0x0001c069,
+  0x0001d473, 0x0000f874, 0x80000587, 0x00019869, 0x0000093b, 0x0000793b,
+  0x0000e472, 0x80000588, 0x0000193b, 0x0000193b, 0x80000589, 0x8000058a,
+  0x0000053b, 0x8000058b, 0x8000058c, 0x0001ac73, 0x0000193b, 0x0000e871,
+  0x8000058d, 0x00004861, 0x0001886c, 0x8000058e, 0x00001073, 0x0001f06e,
+  0x0000ac71, 0x00018069, 0x00018841, 0x00013445, 0x0000906f, 0x0001e13b,
+  0x0006e073, 0x0000d474, 0x0000193b, 0x00002c78, 0x8000058f, 0x80000590,
+  0x0000946d, 0x80000591, 0x0000753b, 0x0000093b, 0x0000b461, 0x80000592,
+  0x0001cc72, 0x0000d872, 0x80000593, 0x00008064, 0x0000393b, 0x00010c6f,
+  0x0000053b, 0x80000594, 0x00013872, 0x00071864, 0x0000e53b, 0x0006fc65,
+  0x00000472, 0x0000393b, 0x00001c72, 0x0001cc61, 0x00012861, 0x0001a065,
+  0x0001c873, 0x80000595, 0x00019c63, 0x0002a074, 0x00018072, 0x00006d3b,
+  0x80000596, 0x00031477, 0x80000597, 0x80000598, 0x80000599, 0x0001253b,
+  0x00002441, 0x00016473, 0x00033c74, 0x0001dc70, 0x0000dc79, 0x00021469,
+  0x0000f872, 0x8000059a, 0x00000d3b, 0x000c4475, 0x0000d871, 0x0003e53b,
+  0x00003c73, 0x00029869, 0x00033d3b, 0x0003bd3b, 0x0003b93b, 0x00026c41,
+  0x8000059b, 0x00000d3b, 0x8000059c, 0x0000e445, 0x0001cc72, 0x0000e072,
+  0x0000053b, 0x8000059d, 0x0000e872, 0x00000d3b, 0x8000059e, 0x00007d3b,
+  0x8000059f, 0x0001c472, 0x00029072, 0x00001d3b, 0x800005a0, 0x0001a867,
+  0x0001bc74, 0x0001d468, 0x0001cc61, 0x0001c472, 0x0001b872, 0x0001c46f,
+  0x0000093b, 0x0000e877, 0x800005a1, 0x0000f93b, 0x00010c61, 0x800005a2,
+  0x00002d3b, 0x00016461, 0x0001b46c, 0x00043861, 0x00016064, 0x00004c65,
+  0x0001b461, 0x800005a3, 0x0000f474, 0x0001d46e, 0x0000053b, 0x800005a4,
+  0x0000053b, 0x800005a5, 0x800005a6, 0x00029c73, 0x0000093b, 0x0002b472,
+  0x0000e06d, 0x800005a7, 0x0000d474, 0x0000093b, 0x0000113b, 0x0000e069,
+  0x00001d3b, 0x0000113b, 0x800005a8, 0x800005a9, 0x00006c69, 0x800005aa,
+  0x800005ab, 0x0000e464, 0x00018070, 0x00000d3b, 0x0000dc66, 0x00018471,
+  0x000c0074, 0x00014873, 0x00000d3b, 0x00028c72, 0x0001c073, 0x800005ac,
+  0x800005ad, 0x000fd86e, 0x800005ae, 0x00027c76, 0x000e0868, 0x800005af,
+  0x00033c66, 0x800005b0, 0x0000153b, 0x00013071, 0x0000153b, 0x00007c73,
+  0x0001d86f, 0x000f9072, 0x0000dc74, 0x800005b1, 0x00001d3b, 0x0000093b,
+  0x00021064, 0x800005b2, 0x00001862, 0x0000f463, 0x000f3c71, 0x00001061,
+  0x00019065, 0x800005b3, 0x0001bc73, 0x0000093b, 0x0001e865, 0x800005b4,
+  0x000f7072, 0x0001f46c, 0x000f5869, 0x00000d3b, 0x800005b5, 0x0000693b,
+  0x00009861, 0x00008472, 0x0000f463, 0x00009c62, 0x0000093b, 0x800005b6,
+  0x800005b7, 0x000e4c6f, 0x0000153b, 0x00014861, 0x0001dc6c, 0x000f2874,
+  0x800005b8, 0x800005b9, 0x0000f46c, 0x0004d93b, 0x000f393b, 0x000fa13b,
+  0x0000e86c, 0x00001d3b, 0x800005ba, 0x0000093b, 0x000fe93b, 0x800005bb,
+  0x0001a06c, 0x0001b069, 0x0000193b, 0x000e106e, 0x800005bc, 0x00000d3b,
+  0x800005bd, 0x00009065, 0x0000053b, 0x800005be, 0x0000053b, 0x800005bf,
+  0x800005c0, 0x0000053b, 0x0000053b, 0x800005c1, 0x0001cc41, 0x0001c472,
+  0x0000e872, 0x00001d3b, 0x800005c2, 0x0001c472, 0x00001472, 0x800005c3,
+  0x0000fd3b, 0x00000d3b, 0x800005c4, 0x00001d3b, 0x800005c5, 0x000e7467,
+  0x00018074, 0x0001f461, 0x0001cc72, 0x0001b072, 0x0001d86f, 0x0000f877,
+  0x800005c6, 0x0001c074, 0x0000093b, 0x0001dc72, 0x0001c869, 0x0000e469,
+  0x800005c7, 0x0000053b, 0x0000053b, 0x800005c8, 0x0000053b, 0x800005c9,
+  0x00015c61, 0x00019875, 0x0000e865, 0x00001d3b, 0x800005ca, 0x0000093b,
+  0x0001f93b, 0x800005cb, 0x800005cc, 0x0001e069, 0x0002d471, 0x00015470,
+  0x00013474, 0x0001986f, 0x0002b075, 0x00003d3b, 0x800005cd, 0x0001dc74,
+  0x00019063, 0x000f6065, 0x000f7476, 0x000f3c76, 0x00008073, 0x0000653b,
+  0x00017463, 0x00018472, 0x0000c53b, 0x0001e865, 0x00015c72, 0x000d6c63,
+  0x800005ce, 0x800005cf, 0x0001486c, 0x0000ad3b, 0x00011069, 0x0001c468,
+  0x000f6c61, 0x00008464, 0x00011c6d, 0x000fa064, 0x00011861, 0x800005d0,
+  0x00015861, 0x800005d1, 0x0001306d, 0x0000413b, 0x0001906c, 0x0001e865,
+  0x0001b865, 0x0018c079, 0x0000713b, 0x0000453b, 0x0001d077, 0x00018865,
+  0x00008863, 0x00003464, 0x0001ec69, 0x0000146c, 0x800005d2, 0x0003206d,
+  0x0000253b, 0x800005d3, 0x800005d4, 0x00021c61, 0x00018863, 0x0001e070,
+  0x800005d5, 0x800005d6, 0x0003dd3b, 0x800005d7, 0x000e4445, 0x0001e872,
+  0x00035d3b, 0x0003813b, 0x00037072, 0x00019075, 0x0001c873, 0x00019862,
+  0x00035c65, 0x00035c65, 0x0000e462, 0x0001f063, 0x0003c53b, 0x800005d8,
+  0x0001d465, 0x0000e074, 0x0000053b, 0x800005d9, 0x0000e871, 0x00000d3b,
+  0x800005da, 0x00001d3b, 0x800005db, 0x800005dc, 0x0000d463, 0x0001d470,
+  0x0000353b, 0x0000e471, 0x0000f070, 0x00001d3b, 0x800005dd, 0x00000d3b,
+  0x800005de, 0x0000f93b, 0x0000093b, 0x800005df, 0x800005e0, 0x0000f874,
+  0x0001cc65, 0x800005e1, 0x00000d3b, 0x0000d871, 0x000cb46e, 0x800005e2,
+  0x00000d3b, 0x00001d3b, 0x800005e3, 0x0001e472, 0x0000906c, 0x000c3069,
+  0x800005e4, 0x0000053b, 0x0001886c, 0x0001b86c, 0x00019864, 0x0000313b,
+  0x0001a069, 0x0000e465, 0x0001e867, 0x800005e5, 0x0000e867, 0x00001d3b,
+  0x800005e6, 0x00005869, 0x00004c67, 0x0001986e, 0x800005e7, 0x0001d46c,
+  0x0000ac73, 0x00016065, 0x0000053b, 0x800005e8, 0x0000b865, 0x00040074,
+  0x0001ec66, 0x0000d871, 0x00006c61, 0x00028871, 0x0001ac72, 0x800005e9,
+  0x0001c469, 0x00004d3b, 0x0000c465, 0x0001bc65, 0x0001906c, 0x0001f465,
+  0x00024c65, 0x00005073, 0x0000f53b, 0x0000e53b, 0x0001a867, 0x00058464,
+  0x00013068, 0x0001cc71, 0x800005ea, 0x00015472, 0x00019065, 0x00001468,
+  0x0001c071, 0x0000393b, 0x00076474, 0x00011c45, 0x800005eb, 0x800005ec,
+  0x00004871, 0x0000286f, 0x00001070, 0x00017873, 0x0001e473, 0x800005ed,
+  0x0001d861, 0x0001bc61, 0x800005ee, 0x800005ef, 0x0001cc72, 0x0000e072,
+  0x0000053b, 0x800005f0, 0x0002ec45, 0x0000e470, 0x00065c72, 0x0000353b,
+  0x0000b865, 0x0005d870, 0x800005f1, 0x0000f068, 0x0007e13b, 0x000cc53b,
+  0x00019c61, 0x0007e53b, 0x0007353b, 0x0007953b, 0x00079d3b, 0x00063844,
+  0x800005f2, 0x00070465, 0x800005f3, 0x00003d3b, 0x800005f4, 0x0001946e,
+  0x0001a066, 0x0001a069, 0x0000093b, 0x0000e86e, 0x800005f5, 0x00060c48,
+  0x0000053b, 0x800005f6, 0x00065841, 0x0000e072, 0x0000a074, 0x00000d3b,
+  0x800005f7, 0x800005f8, 0x00003d3b, 0x00019869, 0x0000e865, 0x00001d3b,
+  0x800005f9, 0x0001c041, 0x0000fd3b, 0x00013c72, 0x00010067, 0x800005fa,
+  0x00001c72, 0x0006f064, 0x0001a072, 0x0001a869, 0x00068c61, 0x00001074,
+  0x0001f874, 0x0000153b, 0x0000e065, 0x0001e06c, 0x800005fb, 0x0001bc69,
+  0x00012469, 0x0000906d, 0x0000053b, 0x800005fc, 0x0001cc72, 0x0000fc72,
+  0x0001c073, 0x0001a472, 0x00006065, 0x00003d3b, 0x800005fd, 0x00004072,
+  0x0000e86b, 0x0000193b, 0x0000093b, 0x800005fe, 0x800005ff, 0x00011877,
+  0x00000041, 0x00004068, 0x0000053b, 0x80000600, 0x0000e472, 0x0001cc61,
+  0x00003d3b, 0x00018c65, 0x0000153b, 0x80000601, 0x00074873, 0x00018474,
+  0x0000093b, 0x80000602, 0x80000603, 0x0000e065, 0x0000113b, 0x00008472,
+  0x0001b475, 0x00002d3b, 0x80000604, 0x80000605, 0x00004063, 0x0001b86d,
+  0x80000606, 0x0000c874, 0x00038072, 0x00017072, 0x0007cc65, 0x0000093b,
+  0x00072465, 0x80000607, 0x0000ac61, 0x00011863, 0x00002d3b, 0x00012c69,
+  0x0001c461, 0x0000f068, 0x0001ac73, 0x0001e462, 0x0000806f, 0x80000608,
+  0x0001cc6f, 0x0000b876, 0x0001c469, 0x00035074, 0x00016c61, 0x0001346e,
+  0x0001ac6f, 0x00017073, 0x0001f46c, 0x00005479, 0x80000609, 0x8000060a,
+  0x0001a473, 0x0007286c, 0x8000060b, 0x00036463, 0x8000060c, 0x8000060d,
+  0x0002446c, 0x0000253b, 0x00002d3b, 0x00030467, 0x0003cc53, 0x0003513b,
+  0x0003e93b, 0x0003e53b, 0x00027069, 0x0003f93b, 0x0001a063, 0x0001f469,
+  0x0000e872, 0x00000d3b, 0x8000060e, 0x00001d3b, 0x8000060f, 0x0001b46f,
+  0x0000e86e, 0x0000793b, 0x00018c72, 0x80000610, 0x0001c461, 0x0000f065,
+  0x0000313b, 0x00018c76, 0x0000d074, 0x00009c72, 0x80000611, 0x00000d3b,
+  0x80000612, 0x0000f472, 0x0001d461, 0x00000d3b, 0x80000613, 0x0000dd3b,
+  0x001f8c73, 0x001c0072, 0x00046865, 0x0000c070, 0x00016462, 0x000e0476,
+  0x001fcc75, 0x001f9474, 0x80000614, 0x0000f874, 0x0001dc6e, 0x00003c6d,
+  0x0000053b, 0x80000615, 0x0001b472, 0x0000713b, 0x0002e863, 0x00009472,
+  0x0002c061, 0x80000616, 0x00015867, 0x00014066, 0x00029865, 0x0002c864,
+  0x0000e872, 0x0000113b, 0x0001f869, 0x0001f468, 0x0004d46f, 0x80000617,
+  0x00002c6d, 0x0000786c, 0x00007061, 0x0001d86f, 0x0001a063, 0x00002469,
+  0x0001c873, 0x0000e473, 0x0000dc65, 0x0000393b, 0x0001b469, 0x80000618,
+  0x0000193b, 0x0001a06e, 0x80000619, 0x8000061a, 0x00000d3b, 0x0000793b,
+  0x00018465, 0x8000061b, 0x00009872, 0x0000113b, 0x00033861, 0x00008074,
+  0x0001b467, 0x8000061c, 0x0001d872, 0x0002c463, 0x0000c861, 0x00015472,
+  0x00017c69, 0x00000d3b, 0x8000061d, 0x0000d53b, 0x00012463, 0x0001b06f,
+  0x0000253b, 0x0000146e, 0x0000213b, 0x0001c075, 0x0000fc73, 0x00000c64,
+  0x00018c75, 0x0000d866, 0x8000061e, 0x8000061f, 0x80000620, 0x0001f46e,
+  0x0000e872, 0x00007d3b, 0x80000621, 0x001e4067, 0x0001b861, 0x0001dc72,
+  0x0000e870, 0x0000093b, 0x0001dc65, 0x80000622, 0x0000e873, 0x0000093b,
+  0x001e2072, 0x80000623, 0x0004f13b, 0x001f3866, 0x80000624, 0x0001886c,
+  0x0000e872, 0x00000d3b, 0x80000625, 0x00001d3b, 0x80000626, 0x0000e072,
+  0x0000053b, 0x80000627, 0x0000053b, 0x80000628, 0x0000053b, 0x80000629,
+  0x0000053b, 0x8000062a, 0x00019c6f, 0x00009066, 0x0000053b, 0x8000062b,
+  0x0000e872, 0x00001d3b, 0x8000062c, 0x0001b46c, 0x0001ac70, 0x0001c46f,
+  0x0000e865, 0x00000d3b, 0x8000062d, 0x00001d3b, 0x8000062e, 0x0000e072,
+  0x0000053b, 0x8000062f, 0x00013c63, 0x0001c061, 0x0001a473, 0x0000f468,
+  0x80000630, 0x0000053b, 0x0000d46c, 0x80000631, 0x00003d3b, 0x00019864,
+  0x0000f065, 0x0001dc69, 0x0001986f, 0x00000d3b, 0x80000632, 0x0001bc6c,
+  0x0001f46c, 0x0001986d, 0x0001d465, 0x0000193b, 0x0000f073, 0x80000633,
+  0x0000e873, 0x0000393b, 0x0001b86d, 0x80000634, 0x0000e86c, 0x00001d3b,
+  0x80000635, 0x0000093b, 0x00003061, 0x80000636, 0x00011872, 0x80000637,
+  0x00028c68, 0x0003b069, 0x0003f472, 0x00032c6f, 0x0002186c, 0x0002a46d,
+  0x80000638, 0x00196463, 0x0001f86c, 0x0001f461, 0x0002f866, 0x0000e06c,
+  0x0000793b, 0x00017465, 0x80000639, 0x0001c065, 0x001f246f, 0x0000f86d,
+  0x8000063a, 0x0001886d, 0x0000093b, 0x0000353b, 0x00040072, 0x00052073,
+  0x8000063b, 0x8000063c, 0x00001d3b, 0x0000a865, 0x0001bc66, 0x00050075,
+  0x0001d472, 0x0001e874, 0x0000193b, 0x00017469, 0x8000063d, 0x00008c70,
+  0x0000286c, 0x0000b864, 0x0000093b, 0x0000b061, 0x8000063e, 0x0001cc6e,
+  0x0000fc74, 0x0008a862, 0x0001b46f, 0x00024061, 0x8000063f, 0x80000640,
+  0x0000093b, 0x80000641, 0x0001b469, 0x0000e46c, 0x0001cc63, 0x0000193b,
+  0x0001946d, 0x0001a46e, 0x80000642, 0x0000fc6b, 0x0001f469, 0x0000393b,
+  0x0001a465, 0x0000153b, 0x0000e072, 0x0003253b, 0x00030d3b, 0x00001d3b,
+  0x80000643, 0x80000644, 0x00000d3b, 0x0000393b, 0x0000d469, 0x80000645,
+  0x0002106d, 0x0000f474, 0x0001ac6d, 0x0000093b, 0x0001c06f, 0x80000646,
+  0x0001906e, 0x0000e065, 0x0000053b, 0x80000647, 0x0000053b, 0x80000648,
+  0x00019863, 0x00018466, 0x0001a468, 0x0001c06f, 0x001d913b, 0x0001b072,
+  0x0000e86b, 0x00000d3b, 0x80000649, 0x0000fd3b, 0x8000064a, 0x0001b461,
+  0x0001946e, 0x0000f86b, 0x0001b063, 0x8000064b, 0x00000d3b, 0x00003d3b,
+  0x8000064c, 0x0000e076, 0x0000053b, 0x8000064d, 0x0001cc6b, 0x00009873,
+  0x8000064e, 0x0001b869, 0x0000793b, 0x0001dc63, 0x8000064f, 0x0000f872,
+  0x80000650, 0x0001ac75, 0x0000113b, 0x00000d3b, 0x0001cc69, 0x0000e072,
+  0x0000053b, 0x80000651, 0x0000093b, 0x0000093b, 0x80000652, 0x80000653,
+  0x001d2061, 0x00000d3b, 0x80000654, 0x0000fc6e, 0x80000655, 0x0003f464,
+  0x00010075, 0x00000d3b, 0x001d7869, 0x80000656, 0x00030073, 0x0001dc76,
+  0x00007066, 0x0002a874, 0x0002b86f, 0x0000906d, 0x0000653b, 0x0000093b,
+  0x0002ac73, 0x80000657, 0x00018477, 0x0000213b, 0x0003c06c, 0x0003dc76,
+  0x00018861, 0x0001f476, 0x0000c06f, 0x0000b874, 0x00016c6f, 0x80000658,
+  0x0001f069, 0x00012c6e, 0x0001a074, 0x0001ac69, 0x0000e874, 0x0000193b,
+  0x0001c86e, 0x80000659, 0x00012c6d, 0x00015869, 0x0000e463, 0x00019462,
+  0x0000e061, 0x00001d3b, 0x8000065a, 0x0001e86e, 0x00005065, 0x00017064,
+  0x0000f470, 0x0000213b, 0x0006e069, 0x0000e464, 0x0007d13b, 0x0001a468,
+  0x0007dd3b, 0x0001a075, 0x00013c73, 0x8000065b, 0x00070c65, 0x0001e075,
+  0x0006506c, 0x8000065c, 0x00015070, 0x00017074, 0x8000065d, 0x8000065e,
+  0x0000053b, 0x8000065f, 0x0000053b, 0x80000660, 0x80000661, 0x0000053b,
+  0x0001c470, 0x0001dc70, 0x0001e46f, 0x0000f478, 0x0001a472, 0x00000d3b,
+  0x80000662, 0x0001b475, 0x00060072, 0x00019879, 0x0001d865, 0x00001d3b,
+  0x80000663, 0x0000f471, 0x0000e871, 0x00003d3b, 0x80000664, 0x0001cc70,
+  0x0001d070, 0x0001f46f, 0x0001a072, 0x00074845, 0x0000e878, 0x0000f93b,
+  0x00012461, 0x80000665, 0x0001c071, 0x0000f471, 0x0001dc65, 0x00000d3b,
+  0x80000666, 0x0000d06d, 0x0000053b, 0x80000667, 0x0001a069, 0x0000c873,
+  0x0000093b, 0x0000dc75, 0x80000668, 0x0000e06d, 0x0001986d, 0x0001b069,
+  0x0006a473, 0x0000f065, 0x0000053b, 0x80000669, 0x0000c86e, 0x0000106f,
+  0x8000066a, 0x0006e461, 0x8000066b, 0x0006e463, 0x0000113b, 0x00000865,
+  0x00010470, 0x00007461, 0x0001e93b, 0x0000e845, 0x0001a069, 0x0003e070,
+  0x0000053b, 0x8000066c, 0x0000393b, 0x0000e86d, 0x8000066d, 0x0000093b,
+  0x00001d3b, 0x8000066e, 0x0000486c, 0x8000066f, 0x0001cc69, 0x00003073,
+  0x00008472, 0x0000f865, 0x00004c6e, 0x00019c6e, 0x0000393b, 0x00017466,
+  0x00011075, 0x00009464, 0x0000e066, 0x0000f865, 0x80000670, 0x0000e93b,
+  0x00018063, 0x00009461, 0x00001c6f, 0x00009463, 0x00017872, 0x80000671,
+  0x0000393b, 0x0006793b, 0x00010c6c, 0x0000ac61, 0x0000e86d, 0x0000293b,
+  0x00018872, 0x00012461, 0x00007d3b, 0x80000672, 0x80000673, 0x80000674,
+  0x0000fc6c, 0x0001b465, 0x0001ec69, 0x0001846e, 0x0001f863, 0x0001e863,
+  0x0000093b, 0x80000675, 0x80000676, 0x00017073, 0x0000f869, 0x00032c74,
+  0x00022073, 0x00016073, 0x0001ec73, 0x0003f13b, 0x0000c472, 0x0003f13b,
+  0x0003ad3b, 0x80000677, 0x00031870, 0x80000678, 0x0001cc66, 0x0000e072,
+  0x0000053b, 0x80000679, 0x0002146e, 0x00000d3b, 0x8000067a, 0x0001b469,
+  0x00019070, 0x0001c46f, 0x0000e866, 0x00007d3b, 0x8000067b, 0x0001a073,
+  0x0001cc70, 0x0001b872, 0x0001b069, 0x0001986d, 0x0000d465, 0x00015875,
+  0x0000053b, 0x8000067c, 0x0001cc63, 0x0000f072, 0x0000053b, 0x8000067d,
+  0x00016874, 0x00014c72, 0x00012861, 0x00013065, 0x0001a06e, 0x0001a869,
+  0x00019c65, 0x0001c46e, 0x0001b46f, 0x0000d073, 0x0000053b, 0x8000067e,
+  0x0000f474, 0x0001d46e, 0x00000d3b, 0x0001a069, 0x00018c6f, 0x8000067f,
+  0x0001d873, 0x80000680, 0x0000e874, 0x0000093b, 0x0000053b, 0x80000681,
+  0x0000e471, 0x00003d3b, 0x80000682, 0x0000d474, 0x0001d072, 0x0000153b,
+  0x0000f072, 0x0000e472, 0x80000683, 0x0001f53b, 0x00002061, 0x0001ac61,
+  0x80000684, 0x00019c69, 0x0001b042, 0x0000553b, 0x0001a075, 0x00019841,
+  0x0000d86c, 0x0001c061, 0x00006d3b, 0x0001d072, 0x0001a861, 0x0000f072,
+  0x00018c48, 0x0003f874, 0x80000685, 0x80000686, 0x80000687, 0x00007072,
+  0x0000e072, 0x0001d474, 0x0000d465, 0x0000153b, 0x0000053b, 0x80000688,
+  0x00018074, 0x00001d3b, 0x80000689, 0x0001046d, 0x00017069, 0x0000fc65,
+  0x000d2066, 0x0000f063, 0x000c2464, 0x000c8865, 0x000f7062, 0x000fa463,
+  0x0000593b, 0x000c0061, 0x000b946e, 0x000bb06f, 0x000b2c6c, 0x000b306d,
+  0x0001a470, 0x0000a865, 0x000d3c68, 0x000d5869, 0x8000068a, 0x0001fc74,
+  0x0008dc74, 0x00094c75, 0x00081872, 0x0008d073, 0x000be870, 0x0001e879,
+  0x000f0867, 0x000f286f, 0x8000068b, 0x000f0076, 0x0001a875, 0x000f0065,
+  0x00082078, 0x8000068c, 0x000fe93b, 0x000ff93b, 0x0000053b, 0x8000068d,
+  0x0000053b, 0x8000068e, 0x0000053b, 0x8000068f, 0x0000053b, 0x80000690,
+  0x0000a472, 0x80000691, 0x0000e870, 0x00000d3b, 0x80000692, 0x00007d3b,
+  0x80000693, 0x0000e073, 0x0000053b, 0x80000694, 0x0000053b, 0x80000695,
+  0x0000e873, 0x0000393b, 0x00004d3b, 0x80000696, 0x0000e86b, 0x00001d3b,
+  0x80000697, 0x0000e070, 0x0000053b, 0x80000698, 0x0000e86c, 0x00000d3b,
+  0x80000699, 0x0001a869, 0x0000e86d, 0x00000d3b, 0x8000069a, 0x0000d46c,
+  0x8000069b, 0x0000053b, 0x0000053b, 0x8000069c, 0x0001b469, 0x0000e46c,
+  0x8000069d, 0x0000053b, 0x0001d461, 0x0000e46f, 0x8000069e, 0x0000053b,
+  0x0001b461, 0x0001c46c, 0x0000293b, 0x0000e873, 0x00019869, 0x00001d3b,
+  0x0001d472, 0x0001106b, 0x8000069f, 0x0000fc72, 0x800006a0, 0x0001bc72,
+  0x0001bc63, 0x0001d462, 0x0000f861, 0x800006a1, 0x00001d3b, 0x00008066,
+  0x00018861, 0x0001dc63, 0x0000193b, 0x0000453b, 0x0001b472, 0x0000e868,
+  0x0001206b, 0x0000453b, 0x800006a2, 0x0000886c, 0x00006873, 0x0000c53b,
+  0x0000c066, 0x00007c70, 0x00011477, 0x00009865, 0x000f386c, 0x00007074,
+  0x800006a3, 0x00004461, 0x00005c62, 0x0000a46b, 0x800006a4, 0x00016c6c,
+  0x00019c64, 0x00018065, 0x800006a5, 0x00005c65, 0x00002064, 0x800006a6,
+  0x00001d3b, 0x00019072, 0x0000cc6e, 0x800006a7, 0x00003d3b, 0x0001fc65,
+  0x0003c865, 0x800006a8, 0x0000e06c, 0x0001e861, 0x0001d86f, 0x0000113b,
+  0x800006a9, 0x0022b46a, 0x0001bc64, 0x0000b075, 0x0001d069, 0x0000cc79,
+  0x0000946e, 0x00011873, 0x00033872, 0x0009d875, 0x800006aa, 0x00002d3b,
+  0x0000193b, 0x00000d3b, 0x800006ab, 0x00024c69, 0x0003006c, 0x0000fc61,
+  0x000cc865, 0x000cd064, 0x000cdc63, 0x00000d3b, 0x800006ac, 0x0001a46c,
+  0x0001a063, 0x000c586e, 0x0001a464, 0x00019868, 0x00021861, 0x00000d3b,
+  0x800006ad, 0x0001c075, 0x0000e86f, 0x00000d3b, 0x800006ae, 0x00030874,
+  0x00000d3b, 0x0003b472, 0x000c7c71, 0x800006af, 0x0001a473, 0x0000e468,
+  0x00018071, 0x00001d3b, 0x800006b0, 0x0000093b, 0x0000e06c, 0x800006b1,
+  0x00014861, 0x0002b86e, 0x0001ec63, 0x00001d3b, 0x800006b2, 0x0001c061,
+  0x0000c867, 0x0001ec72, 0x0000e474, 0x800006b3, 0x00000d3b, 0x00001d3b,
+  0x800006b4, 0x0000e074, 0x0000793b, 0x0000793b, 0x800006b5, 0x800006b6,
+  0x0001c068, 0x0001a473, 0x0000053b, 0x800006b7, 0x0000e474, 0x0001806f,
+  0x0001cc6f, 0x0000e072, 0x0000053b, 0x800006b8, 0x0000053b, 0x800006b9,
+  0x00006472, 0x0001e93b, 0x00003061, 0x00000469, 0x0000153b, 0x00011c64,
+  0x0000706c, 0x800006ba, 0x800006bb, 0x800006bc, 0x800006bd, 0x800006be,
+  0x00065473, 0x0000093b, 0x00013074, 0x0001d468, 0x0007d46f, 0x00000069,
+  0x0001cc72, 0x0001b472, 0x00040075, 0x0001f46f, 0x800006bf, 0x00011473,
+  0x00004870, 0x0006086e, 0x0001dc72, 0x00078c77, 0x00017472, 0x0001bc61,
+  0x00017c6e, 0x0001b869, 0x0001ec67, 0x0000106c, 0x0000093b, 0x00010c61,
+  0x800006c0, 0x0001d461, 0x0001f472, 0x0001b06f, 0x0001506f, 0x00018864,
+  0x0001a868, 0x00018c70, 0x0001c06f, 0x0000113b, 0x00019c6c, 0x0001cc77,
+  0x0001cc65, 0x800006c1, 0x0000806e, 0x0000113b, 0x00062c72, 0x00067873,
+  0x0006ec74, 0x800006c2, 0x0001f875, 0x800006c3, 0x0000c870, 0x00066874,
+  0x00063c61, 0x0001d866, 0x00063c6f, 0x800006c4, 0x00063c72, 0x000000de,
+  0x0007213b, 0x0007553b, 0x00063861, 0x00064072, 0x0001c877, 0x0000e073,
+  0x0007c53b, 0x0001fc72, 0x0001b870, 0x0001b06f, 0x0001a06f, 0x00064068,
+  0x0001c86e, 0x0000e073, 0x0007cd3b, 0x0001d467, 0x0001e069, 0x0001d461,
+  0x0001d468, 0x00018c74, 0x0001d06f, 0x0000313b, 0x0001f072, 0x0001f877,
+  0x00018c72, 0x800006c5, 0x0000d073, 0x0001bc75, 0x0001c871, 0x00016869,
+  0x00013461, 0x0000e53b, 0x00017c67, 0x0001c472, 0x0001b872, 0x0001c46f,
+  0x0001a472, 0x00000477, 0x800006c6, 0x0001c468, 0x00019865, 0x0001a874,
+  0x0001ac69, 0x0001d865, 0x0001906d, 0x0001c465, 0x0000793b, 0x0000e873,
+  0x800006c7, 0x0000093b, 0x0000e067, 0x800006c8, 0x0001a86e, 0x0001b464,
+  0x0001b069, 0x0001f86f, 0x00018473, 0x0001a067, 0x0000113b, 0x0000e871,
+  0x0001d865, 0x0001d874, 0x800006c9, 0x0001f53b, 0x0001c461, 0x0001d861,
+  0x800006ca, 0x0001d472, 0x00010072, 0x0000e072, 0x0000493b, 0x0000413b,
+  0x0001dc6f, 0x0001a468, 0x0001c875, 0x0001b873, 0x0000c06d, 0x0006f476,
+  0x0007d074, 0x0001f463, 0x0000c53b, 0x0003a874, 0x003c6079, 0x00017071,
+  0x800006cb, 0x00000056, 0x0001e475, 0x800006cc, 0x00007472, 0x0000c865,
+  0x00019868, 0x800006cd, 0x00038073, 0x00016c69, 0x00006067, 0x00015c72,
+  0x0001506d, 0x800006ce, 0x00008864, 0x00009c6b, 0x0001bc61, 0x0001706e,
+  0x00037c72, 0x00012862, 0x00036873, 0x0001b869, 0x0001906d, 0x0001c065,
+  0x800006cf, 0x0001c461, 0x00037872, 0x800006d0, 0x0001a06f, 0x0001c474,
+  0x800006d1, 0x00019469, 0x0001b86c, 0x00025470, 0x00030c74, 0x800006d2,
+  0x0002706e, 0x00014c72, 0x00023475, 0x00005d3b, 0x00018c70, 0x0000493b,
+  0x0000313b, 0x0000213b, 0x00036d3b, 0x00025461, 0x0000053b, 0x800006d3,
+  0x0000053b, 0x800006d4, 0x0000e466, 0x00003d3b, 0x800006d5, 0x00000d3b,
+  0x800006d6, 0x0000193b, 0x0002bc6c, 0x800006d7, 0x0000053b, 0x800006d8,
+  0x0000e874, 0x00000d3b, 0x800006d9, 0x0001d461, 0x0001cc72, 0x0000e072,
+  0x0000053b, 0x800006da, 0x0000e86f, 0x00000d3b, 0x800006db, 0x0000f072,
+  0x0000053b, 0x800006dc, 0x0000053b, 0x800006dd, 0x00020861, 0x0000e462,
+  0x00012c63, 0x00001d3b, 0x800006de, 0x0000e46f, 0x800006df, 0x0000053b,
+  0x00000d3b, 0x00003068, 0x00018472, 0x800006e0, 0x0001cc69, 0x0001d468,
+  0x0001e865, 0x0000713b, 0x0001cc71, 0x00009465, 0x00018c6d, 0x800006e1,
+  0x0001c865, 0x0000dc73, 0x0001f075, 0x00019072, 0x800006e2, 0x0000053b,
+  0x0000e869, 0x0000193b, 0x0001f13b, 0x800006e3, 0x00051c6c, 0x0001f53b,
+  0x800006e4, 0x0000fc69, 0x800006e5, 0x0001d474, 0x0001b072, 0x0000093b,
+  0x0001bc68, 0x800006e6, 0x0001ac61, 0x800006e7, 0x00000d3b, 0x00019475,
+  0x0001c86c, 0x00000d3b, 0x800006e8, 0x0001b863, 0x0000153b, 0x00008072,
+  0x003b8066, 0x0000153b, 0x0001ec75, 0x800006e9, 0x800006ea, 0x00035467,
+  0x0000113b, 0x800006eb, 0x0003d861, 0x00018474, 0x800006ec, 0x800006ed,
+  0x0000d86f, 0x0000d065, 0x0001d871, 0x0000f13b, 0x0000c86e, 0x00014875,
+  0x0001a06f, 0x00018865, 0x00018866, 0x003e7c6e, 0x003f646e, 0x0004bd3b,
+  0x800006ee, 0x0000053b, 0x00016c6c, 0x800006ef, 0x0001f472, 0x800006f0,
+  0x0000fc65, 0x0000ac70, 0x0001ac69, 0x0001e072, 0x0000653b, 0x0000e06c,
+  0x0000393b, 0x0000393b, 0x800006f1, 0x800006f2, 0x800006f3, 0x0001b875,
+  0x800006f4, 0x0000c463, 0x003e8c6e, 0x0000153b, 0x003e7872, 0x003f1445,
+  0x003ff93b, 0x0000e870, 0x0001b069, 0x0000e06d, 0x0000053b, 0x800006f5,
+  0x003f9d3b, 0x0001b86f, 0x003e0c69, 0x0001a06c, 0x0000e874, 0x00000d3b,
+  0x800006f6, 0x0000946d, 0x0001c869, 0x00000d3b, 0x800006f7, 0x00001d3b,
+  0x800006f8, 0x0001e46f, 0x800006f9, 0x0000053b, 0x0000d074, 0x00000d3b,
+  0x800006fa, 0x00001d3b, 0x800006fb, 0x00013c41, 0x0000053b, 0x800006fc,
+  0x0001cc72, 0x00001072, 0x0001a472, 0x0001bc68, 0x00000c78, 0x00015861,
+  0x003ffd3b, 0x0000d86b, 0x00005074, 0x800006fd, 0x00000d3b, 0x0000193b,
+  0x0000e477, 0x800006fe, 0x0000793b, 0x00018873, 0x800006ff, 0x0001b86d,
+  0x0000e874, 0x00001d3b, 0x80000700, 0x80000701, 0x0000d469, 0x00016873,
+  0x0000353b, 0x0000a472, 0x00018077, 0x0001d461, 0x0000e472, 0x0001b461,
+  0x0001f93b, 0x0001e463, 0x80000702, 0x0004986f, 0x0002746c, 0x0003d06d,
+  0x00019c75, 0x00004d3b, 0x00029868, 0x0002d069, 0x00017c66, 0x0001a465,
+  0x0000c064, 0x00005c65, 0x003f7462, 0x00014063, 0x0001b062, 0x003f8c61,
+  0x0000b873, 0x0001a86d, 0x003f5069, 0x00002c74, 0x000ad47a, 0x0000306e,
+  0x80000703, 0x003f3064, 0x003eec45, 0x000a6c77, 0x0006ec74, 0x00066475,
+  0x0005c472, 0x00050c73, 0x0004cc70, 0x00047071, 0x80000704, 0x80000705,
+  0x0000093b, 0x0000093b, 0x00013079, 0x00037872, 0x0000313b, 0x0001e468,
+  0x0000f070, 0x80000706, 0x80000707, 0x0001cc72, 0x003ff077, 0x00002c70,
+  0x00005c73, 0x00007d3b, 0x80000708, 0x0000113b, 0x0000153b, 0x0000dc6e,
+  0x00001869, 0x80000709, 0x0000fc79, 0x8000070a, 0x00012c65, 0x00023c72,
+  0x00026069, 0x8000070b, 0x003ff461, 0x003d5863, 0x003fc063, 0x0000906f,
+  0x0003a53b, 0x00026061, 0x0001a874, 0x00023063, 0x0003fd3b, 0x0002586d,
+  0x0000e464, 0x0001f461, 0x00018c72, 0x0001b86c, 0x0001bc61, 0x0001886c,
+  0x0001b465, 0x0000e06c, 0x0000793b, 0x0002106f, 0x8000070c, 0x00000d3b,
+  0x8000070d, 0x00019c6d, 0x0001a867, 0x0000e061, 0x0000053b, 0x8000070e,
+  0x0001f870, 0x0000cc79, 0x0000053b, 0x8000070f, 0x0000053b, 0x80000710,
+  0x0000106d, 0x80000711, 0x0001d86f, 0x0000f93b, 0x0000e874, 0x00001d3b,
+  0x80000712, 0x00000d3b, 0x80000713, 0x00003d3b, 0x80000714, 0x80000715,
+  0x0000053b, 0x80000716, 0x80000717, 0x0000113b, 0x0000093b, 0x00007d3b,
+  0x80000718, 0x0000e065, 0x0000053b, 0x80000719, 0x0001d06c, 0x0001c075,
+  0x0000e873, 0x00003d3b, 0x8000071a, 0x0001c072, 0x0001c461, 0x0000f072,
+  0x0000053b, 0x8000071b, 0x0001cc61, 0x00003472, 0x0000e472, 0x8000071c,
+  0x00000d3b, 0x00040074, 0x0001ac75, 0x00019873, 0x0001e865, 0x0001f869,
+  0x0001a074, 0x0001fc6c, 0x0000193b, 0x0001a866, 0x8000071d, 0x00018c6d,
+  0x0001ac6c, 0x00062075, 0x00011045, 0x00016473, 0x00012c65, 0x00010845,
+  0x00033c6f, 0x0000313b, 0x0001d061, 0x0001986e, 0x0000086c, 0x8000071e,
+  0x000000da, 0x0001f076, 0x0000b473, 0x8000071f, 0x00017869, 0x00017461,
+  0x0001cc68, 0x0000f13b, 0x0001b069, 0x00003470, 0x0000e864, 0x0000213b,
+  0x0000e865, 0x0000493b, 0x0000cc72, 0x00015c70, 0x0000c870, 0x0000413b,
+  0x0001bc6c, 0x80000720, 0x00019063, 0x0001cc71, 0x0001c472, 0x0001f074,
+  0x00011873, 0x0000c479, 0x0000806e, 0x80000721, 0x00018c6c, 0x80000722,
+  0x80000723, 0x0000153b, 0x00074c74, 0x80000724, 0x80000725, 0x0001ac67,
+  0x0000c464, 0x00018465, 0x0007e13b, 0x00061066, 0x0000053b, 0x80000726,
+  0x0000053b, 0x80000727, 0x0000e872, 0x00003d3b, 0x80000728, 0x00000d3b,
+  0x80000729, 0x0000c86c, 0x00019461, 0x00019864, 0x0001c865, 0x00009473,
+  0x8000072a, 0x0000053b, 0x0000053b, 0x8000072b, 0x0000053b, 0x8000072c,
+  0x0000d470, 0x003a8c70, 0x0000053b, 0x8000072d, 0x0000193b, 0x0000d072,
+  0x8000072e, 0x0000093b, 0x0000e070, 0x8000072f, 0x00018063, 0x00011c61,
+  0x80000730, 0x0000053b, 0x80000731, 0x0000e062, 0x0000093b, 0x80000732,
+  0x0001d865, 0x0000393b, 0x0000f474, 0x80000733, 0x00001d3b, 0x0000e471,
+  0x80000734, 0x0000053b, 0x00062873, 0x80000735, 0x00000d3b, 0x80000736,
+  0x00001d3b, 0x00016c75, 0x0000c875, 0x0000f870, 0x0001d865, 0x0000113b,
+  0x0000e074, 0x0000f071, 0x0000093b, 0x80000737, 0x80000738, 0x0001f93b,
+  0x0000fc65, 0x80000739, 0x00019c72, 0x0000f866, 0x0000053b, 0x8000073a,
+  0x00003d3b, 0x00019c72, 0x00066073, 0x8000073b, 0x0000053b, 0x8000073c,
+  0x0001e461, 0x0000093b, 0x00007d3b, 0x8000073d, 0x0001c473, 0x8000073e,
+  0x00009072, 0x00001d3b, 0x8000073f, 0x00013473, 0x0000f86e, 0x0001bc6d,
+  0x00018874, 0x0000e13b, 0x0000bc72, 0x00019062, 0x000c546b, 0x00014469,
+  0x0000a861, 0x00075075, 0x0001986c, 0x80000740, 0x00004c66, 0x00000465,
+  0x00019072, 0x00015461, 0x0000d466, 0x0000b465, 0x0000613b, 0x00034c72,
+  0x00019074, 0x0000493b, 0x00018c65, 0x00039d3b, 0x00008c73, 0x0001e461,
+  0x80000741, 0x00000047, 0x0000b865, 0x00011c6d, 0x0000886e, 0x00025474,
+  0x00026867, 0x80000742, 0x0001a865, 0x80000743, 0x00009c73, 0x00015c65,
+  0x000ce077, 0x00015463, 0x00024073, 0x0003cd3b, 0x00026c61, 0x0003d93b,
+  0x0001a061, 0x00024869, 0x00021468, 0x0001cc65, 0x00022c70, 0x00018c69,
+  0x0001b86c, 0x00024c6f, 0x80000744, 0x00033c69, 0x80000745, 0x0001c06e,
+  0x00009073, 0x0001b468, 0x0001dc70, 0x00000d3b, 0x80000746, 0x0001c072,
+  0x80000747, 0x0000093b, 0x0000093b, 0x80000748, 0x0001d46f, 0x0000e074,
+  0x0000053b, 0x80000749, 0x8000074a, 0x0000053b, 0x0001d46f, 0x00001874,
+  0x00003462, 0x00004c63, 0x0000053b, 0x8000074b, 0x0001b475, 0x0001d86c,
+  0x00027465, 0x0000d074, 0x0000053b, 0x8000074c, 0x0000053b, 0x8000074d,
+  0x0000946e, 0x0000753b, 0x0001b875, 0x000e6c6d, 0x8000074e, 0x0001a86c,
+  0x000e8870, 0x0000f073, 0x0000053b, 0x8000074f, 0x0001cc61, 0x0001f472,
+  0x0000e872, 0x0000093b, 0x0000f474, 0x80000750, 0x0000053b, 0x80000751,
+  0x000c0071, 0x80000752, 0x0000446d, 0x00014045, 0x0000cc64, 0x00011c6e,
+  0x0000093b, 0x0001e465, 0x80000753, 0x00002465, 0x0001b865, 0x0000f864,
+  0x0000f86d, 0x0001b069, 0x80000754, 0x000fd871, 0x0000793b, 0x0000753b,
+  0x80000755, 0x000fac63, 0x80000756, 0x00001d3b, 0x80000757, 0x80000758,
+  0x80000759, 0x00015875, 0x00012070, 0x0001106f, 0x8000075a, 0x0001406c,
+  0x00023066, 0x00000070, 0x0001f073, 0x00002072, 0x0001d470, 0x0001dc65,
+  0x0000b465, 0x00002c62, 0x0000c53b, 0x0000b878, 0x0001f065, 0x00014472,
+  0x00011845, 0x0001246e, 0x0001d075, 0x00008c71, 0x00016c72, 0x000f7c6d,
+  0x000f1c67, 0x8000075b, 0x0000a93b, 0x0000b870, 0x0001c479, 0x0000713b,
+  0x0000e471, 0x000ed473, 0x00003d3b, 0x000e306f, 0x00043d3b, 0x8000075c,
+  0x00018872, 0x8000075d, 0x00001d3b, 0x0001cc70, 0x0001d870, 0x000fe13b,
+  0x000f313b, 0x000f5d3b, 0x000e3c61, 0x000f1078, 0x0001c071, 0x000f0471,
+  0x0001cc65, 0x8000075e, 0x000e2069, 0x00000d3b, 0x8000075f, 0x0001ac69,
+  0x0000093b, 0x0000e86d, 0x80000760, 0x0000793b, 0x0001c473, 0x80000761,
+  0x0000053b, 0x80000762, 0x0000053b, 0x80000763, 0x0000053b, 0x80000764,
+  0x0000053b, 0x80000765, 0x80000766, 0x00001d3b, 0x80000767, 0x0000e074,
+  0x0000053b, 0x80000768, 0x0001246f, 0x00003831, 0x00003c32, 0x00000033,
+  0x00018c75, 0x0000e062, 0x0000053b, 0x80000769, 0x8000076a, 0x0000053b,
+  0x0001c86f, 0x0000c53b, 0x0000e874, 0x00000d3b, 0x8000076b, 0x0001cc6f,
+  0x0000e46c, 0x8000076c, 0x00000d3b, 0x0000153b, 0x0000f062, 0x00018c75,
+  0x8000076d, 0x0000293b, 0x0001cc61, 0x0001c472, 0x0000d872, 0x0001a475,
+  0x0001b473, 0x8000076e, 0x00002c6c, 0x0001f53b, 0x0001f86c, 0x00011474,
+  0x8000076f, 0x0000153b, 0x0000f045, 0x0000253b, 0x80000770, 0x0000293b,
+  0x0003c871, 0x0000ac73, 0x000efc71, 0x0001dc75, 0x80000771, 0x80000772,
+  0x00016865, 0x0000cc73, 0x0003ac74, 0x00002d3b, 0x0000d46d, 0x80000773,
+  0x0000dc6e, 0x0001d445, 0x0000213b, 0x80000774, 0x00010c72, 0x000f1863,
+  0x80000775, 0x000fcc61, 0x0000e93b, 0x80000776, 0x80000777, 0x000f6865,
+  0x00013070, 0x0000d062, 0x00022c69, 0x00018473, 0x00006865, 0x00037071,
+  0x80000778, 0x00010c65, 0x80000779, 0x00008c72, 0x00021872, 0x00015069,
+  0x8000077a, 0x0003306b, 0x0000193b, 0x00000d3b, 0x8000077b, 0x0000053b,
+  0x00002d3b, 0x00009c70, 0x0000ec64, 0x00019c65, 0x0000cc64, 0x0001d075,
+  0x000ff868, 0x8000077c, 0x8000077d, 0x00027065, 0x0000946c, 0x0000cc6d,
+  0x0001fc6e, 0x0003e13b, 0x00034d3b, 0x0003593b, 0x00037d3b, 0x0002a441,
+  0x000ecc68, 0x000ce93b, 0x0003f13b, 0x8000077e, 0x00018077, 0x0001c461,
+  0x0000e872, 0x00001d3b, 0x8000077f, 0x0002186c, 0x0000e867, 0x00007d3b,
+  0x80000780, 0x00019072, 0x00023067, 0x0000f074, 0x0000053b, 0x80000781,
+  0x0000e875, 0x00003d3b, 0x80000782, 0x00027c72, 0x0000053b, 0x80000783,
+  0x0001b872, 0x0001b06f, 0x00008c72, 0x0000006e, 0x00062072, 0x00056873,
+  0x00078c70, 0x0002ec61, 0x0000093b, 0x0005b477, 0x80000784, 0x00019864,
+  0x0001b469, 0x0000fc6c, 0x00011061, 0x80000785, 0x00014c6e, 0x0000193b,
+  0x0001b465, 0x0000693b, 0x00016c62, 0x0001e863, 0x00009879, 0x00014061,
+  0x00000c66, 0x80000786, 0x00018464, 0x00019065, 0x0001d46f, 0x0000f074,
+  0x00003068, 0x00077c69, 0x80000787, 0x0007e06f, 0x0000093b, 0x0000346c,
+  0x00019072, 0x00018465, 0x0000193b, 0x0000e863, 0x80000788, 0x0000e072,
+  0x0000053b, 0x80000789, 0x00029471, 0x8000078a, 0x00018872, 0x00028471,
+  0x00013474, 0x00040065, 0x8000078b, 0x000cc071, 0x0001d46f, 0x0000613b,
+  0x000f646f, 0x0001ac65, 0x0000e465, 0x0003f86e, 0x0000613b, 0x00019872,
+  0x8000078c, 0x0001486f, 0x00015479, 0x00001d3b, 0x8000078d, 0x0006f46b,
+  0x00039c65, 0x00017c69, 0x00076c61, 0x0000153b, 0x0000086d, 0x0001b463,
+  0x8000078e, 0x00018c6b, 0x0001d46f, 0x0001f861, 0x00076065, 0x0001cc70,
+  0x0001d070, 0x0000f478, 0x00019472, 0x0000093b, 0x0001a86e, 0x8000078f,
+  0x80000790, 0x0000e46d, 0x0000c870, 0x00000d3b, 0x0001a069, 0x0001a073,
+  0x80000791, 0x0001d473, 0x0000f870, 0x00064c72, 0x80000792, 0x0000353b,
+  0x0007146d, 0x00001d3b, 0x0001bc69, 0x0006b46d, 0x0007613b, 0x00062461,
+  0x0000053b, 0x80000793, 0x0000e86e, 0x00000d3b, 0x80000794, 0x00062864,
+  0x0001ac6c, 0x0001846d, 0x00019c6e, 0x00001d3b, 0x80000795, 0x0001c065,
+  0x0000e873, 0x00007d3b, 0x80000796, 0x00000d3b, 0x80000797, 0x00061073,
+  0x0000e872, 0x00000d3b, 0x80000798, 0x00003d3b, 0x80000799, 0x0000e074,
+  0x0000053b, 0x8000079a, 0x0000093b, 0x0000e861, 0x8000079b, 0x0000f53b,
+  0x00017065, 0x0001d86f, 0x8000079c, 0x0000f074, 0x0000053b, 0x8000079d,
+  0x0001cc69, 0x0000d072, 0x0000053b, 0x8000079e, 0x0000053b, 0x8000079f,
+  0x0001a872, 0x0000e06b, 0x0000053b, 0x800007a0, 0x0000e861, 0x00000d3b,
+  0x800007a1, 0x0001b872, 0x00069869, 0x00004470, 0x00019c73, 0x0000d465,
+  0x800007a2, 0x0000053b, 0x00001d3b, 0x00018864, 0x0000f465, 0x800007a3,
+  0x0001986e, 0x00006467, 0x800007a4, 0x00010469, 0x00014c66, 0x0000d86e,
+  0x0001a477, 0x0003f865, 0x00002062, 0x00002063, 0x0007ac73, 0x00005861,
+  0x0001a86c, 0x0000b461, 0x0001fc6f, 0x00065c76, 0x0000753b, 0x0000553b,
+  0x0001f064, 0x00016867, 0x00018c65, 0x800007a5, 0x800007a6, 0x0000393b,
+  0x0001f062, 0x00010c66, 0x00018870, 0x0003ac65, 0x800007a7, 0x800007a8,
+  0x0001a869, 0x00038c62, 0x0000e53b, 0x00dd1865, 0x00036474, 0x0000c461,
+  0x800007a9, 0x0001fc68, 0x00018464, 0x0000b065, 0x00004871, 0x800007aa,
+  0x00034074, 0x00008c74, 0x0001dc6f, 0x00003871, 0x800007ab, 0x0001a86d,
+  0x0001dc69, 0x800007ac, 0x00027470, 0x0000753b, 0x0000753b, 0x00013073,
+  0x00026874, 0x0019f471, 0x00003d3b, 0x0001e86e, 0x0001c475, 0x800007ad,
+  0x0000dc73, 0x0001d075, 0x0000e073, 0x00027075, 0x0000806f, 0x0003ed3b,
+  0x0003013b, 0x00023c6c, 0x0003593b, 0x0003853b, 0x800007ae, 0x00000d3b,
+  0x800007af, 0x00018869, 0x0002d06d, 0x00000d3b, 0x800007b0, 0x00020c69,
+  0x0000e86d, 0x00000d3b, 0x800007b1, 0x00018074, 0x0000093b, 0x0000e872,
+  0x800007b2, 0x00019868, 0x0000053b, 0x800007b3, 0x0001d863, 0x0000313b,
+  0x0001ec63, 0x0000d479, 0x0000d479, 0x800007b4, 0x0001a06f, 0x0001b872,
+  0x0000f93b, 0x0000e86b, 0x800007b5, 0x0001ec69, 0x0001d478, 0x0000f074,
+  0x0000093b, 0x0001ac61, 0x800007b6, 0x00019c6f, 0x00019068, 0x0001b465,
+  0x0001ac64, 0x00045066, 0x0001e865, 0x0001906c, 0x0001b461, 0x00018074,
+  0x0001ac66, 0x0001dc72, 0x0001c06f, 0x00018872, 0x0001a472, 0x0000e077,
+  0x0000053b, 0x800007b7, 0x00019869, 0x0001ac67, 0x0001c068, 0x0001c06f,
+  0x00011077, 0x00003861, 0x00018874, 0x800007b8, 0x0001e861, 0x0001c472,
+  0x00005872, 0x0001f13b, 0x0001c041, 0x0000553b, 0x0001cc72, 0x0000e472,
+  0x0000e072, 0x0003f072, 0x00029071, 0x0000613b, 0x00009465, 0x0001b048,
+  0x00002472, 0x0001cc72, 0x800007b9, 0x0001cc75, 0x00001d3b, 0x800007ba,
+  0x00004479, 0x800007bb, 0x0001fc74, 0x0003806c, 0x800007bc, 0x800007bd,
+  0x00010872, 0x001f7075, 0x00032c65, 0x00031c65, 0x0001e863, 0x0003f064,
+  0x00018076, 0x001e1064, 0x001e2867, 0x001e1466, 0x00016461, 0x001c0065,
+  0x001e3c63, 0x00013c62, 0x001f246d, 0x001e986c, 0x001f146f, 0x800007be,
+  0x00018072, 0x001eb068, 0x0001bc72, 0x001f5463, 0x001d4475, 0x001cb474,
+  0x001d7077, 0x001f2c72, 0x001f1c63, 0x001fd470, 0x001cc873, 0x001cd072,
+  0x001e7c6c, 0x00044c34, 0x800007bf, 0x00015863, 0x0000913b, 0x0001ac65,
+  0x00009d3b, 0x800007c0, 0x001e7869, 0x001fed3b, 0x001ff53b, 0x0000193b,
+  0x001e6061, 0x800007c1, 0x001e4461, 0x001e4c62, 0x0000053b, 0x800007c2,
+  0x0001cc61, 0x0000f072, 0x0000093b, 0x00019868, 0x800007c3, 0x0001b469,
+  0x0000a479, 0x0001ac73, 0x0001cc68, 0x0000153b, 0x0000e072, 0x0000f474,
+  0x800007c4, 0x00003d3b, 0x800007c5, 0x0001d061, 0x00018872, 0x00018076,
+  0x0000053b, 0x800007c6, 0x0000e465, 0x0000e93b, 0x0001cc61, 0x0001bc72,
+  0x0000186c, 0x0001a062, 0x0000093b, 0x800007c7, 0x800007c8, 0x0001906c,
+  0x0000e86b, 0x00000d3b, 0x800007c9, 0x0001d06f, 0x0001a063, 0x0001b472,
+  0x0000e86e, 0x00007d3b, 0x800007ca, 0x00000d3b, 0x800007cb, 0x0001d86f,
+  0x0000f872, 0x0000e470, 0x0001a872, 0x0000293b, 0x0001a072, 0x0000e069,
+  0x0000113b, 0x0001c474, 0x00008c72, 0x800007cc, 0x800007cd, 0x00010072,
+  0x00018861, 0x00003063, 0x800007ce, 0x0000c46e, 0x0000193b, 0x0000093b,
+  0x0001ac6f, 0x800007cf, 0x00018467, 0x0000153b, 0x00006d3b, 0x0000793b,
+  0x800007d0, 0x0000cc6c, 0x0001b872, 0x0000653b, 0x00008466, 0x800007d1,
+  0x0001a472, 0x00017070, 0x0001e86f, 0x800007d2, 0x800007d3, 0x00012466,
+  0x0000153b, 0x0000a477, 0x0001c46f, 0x0001286f, 0x00014477, 0x800007d4,
+  0x00013861, 0x0001a470, 0x0001906f, 0x00017461, 0x0001d472, 0x0001706e,
+  0x00014464, 0x00014472, 0x00004877, 0x0001f061, 0x0001b868, 0x00012872,
+  0x00002474, 0x0001a06f, 0x001f086c, 0x0001bc6e, 0x0001f46c, 0x0001d467,
+  0x00019472, 0x0000dc65, 0x0001e468, 0x00026073, 0x00033873, 0x00023875,
+  0x00011c65, 0x800007d5, 0x00021861, 0x00000031, 0x00000032, 0x00037c67,
+  0x0001d069, 0x800007d6, 0x00000036, 0x00031074, 0x0003dd3b, 0x0003f13b,
+  0x0000e869, 0x00001d3b, 0x800007d7, 0x00000d3b, 0x800007d8, 0x0001846f,
+  0x0000e86e, 0x00000d3b, 0x800007d9, 0x00024870, 0x0001cc72, 0x0001b072,
+  0x0001d86f, 0x0001b077, 0x0000e873, 0x00000d3b, 0x800007da, 0x0000f06e,
+  0x0000093b, 0x0001a072, 0x800007db, 0x0000393b, 0x0000d072, 0x800007dc,
+  0x0001d86f, 0x0000193b, 0x0000f070, 0x800007dd, 0x0002086e, 0x0000f53b,
+  0x0001b863, 0x0001186f, 0x800007de, 0x0001b872, 0x0000e869, 0x00000d3b,
+  0x800007df, 0x0001f463, 0x0000e072, 0x800007e0, 0x00016869, 0x0000093b,
+  0x0000e074, 0x0001d46f, 0x0001f872, 0x00007d3b, 0x800007e1, 0x00019c6c,
+  0x00018464, 0x00001d3b, 0x800007e2, 0x0001a069, 0x0000f865, 0x00019874,
+  0x0001e864, 0x0000e069, 0x00001d3b, 0x0000113b, 0x00012472, 0x800007e3,
+  0x00003472, 0x800007e4, 0x00003061, 0x0000e072, 0x00001d3b, 0x0001d46e,
+  0x0000e06c, 0x800007e5, 0x800007e6, 0x0000053b, 0x00000d3b, 0x0001886c,
+  0x00008065, 0x800007e7, 0x0001906d, 0x00007d3b, 0x0000f465, 0x00018861,
+  0x0001b868, 0x0001d067, 0x800007e8, 0x00011870, 0x0000f06c, 0x00011872,
+  0x00011c61, 0x800007e9, 0x00013c61, 0x0001f841, 0x0001b442, 0x0000113b,
+  0x00019444, 0x00001868, 0x001cd53b, 0x800007ea, 0x0000253b, 0x00005c72,
+  0x0004ec7a, 0x00040072, 0x00014473, 0x0000513b, 0x0001f073, 0x00019c66,
+  0x00043470, 0x800007eb, 0x00040872, 0x0004a473, 0x0001946e, 0x0001d872,
+  0x0001c467, 0x0000c474, 0x00065472, 0x800007ec, 0x0000cc6e, 0x00067869,
+  0x00076c6c, 0x0001e870, 0x00043c6e, 0x0004586f, 0x00066074, 0x0001ec61,
+  0x0007e13b, 0x00075463, 0x0007f464, 0x0007f465, 0x0007cc66, 0x00066070,
+  0x00068c65, 0x0001b46c, 0x800007ed, 0x00067c6f, 0x00000d3b, 0x00060061,
+  0x0000e461, 0x800007ee, 0x0001ac68, 0x0006146f, 0x0001a069, 0x0001b46e,
+  0x0001986e, 0x0000e467, 0x0001a86b, 0x00007d3b, 0x800007ef, 0x0000f074,
+  0x0000e869, 0x00001d3b, 0x800007f0, 0x00017470, 0x00016073, 0x00003c72,
+  0x0000053b, 0x800007f1, 0x0001c46f, 0x0001cc70, 0x0001b874, 0x0000e06f,
+  0x0000053b, 0x800007f2, 0x00016c68, 0x00000869, 0x800007f3, 0x0000053b,
+  0x0000e86f, 0x00000d3b, 0x800007f4, 0x0001a069, 0x0001b067, 0x00018c6d,
+  0x0000193b, 0x0000e861, 0x800007f5, 0x0001e073, 0x0001c062, 0x0001c074,
+  0x0001ac65, 0x0001986e, 0x0018d865, 0x0000193b, 0x0000093b, 0x800007f6,
+  0x800007f7, 0x0001f865, 0x0001906e, 0x00002065, 0x00013c72, 0x0001dc75,
+  0x0001c470, 0x0001ac74, 0x0001b073, 0x0001f93b, 0x00011071, 0x800007f8,
+  0x0000053b, 0x800007f9, 0x0001d865, 0x00019068, 0x0001bc74, 0x00005d3b,
+  0x0000d061, 0x00018869, 0x0001d861, 0x0001ec6c, 0x00008c74, 0x0001a867,
+  0x0000bc74, 0x0001e072, 0x800007fa, 0x0001886c, 0x0001e06e, 0x800007fb,
+  0x00001d3b, 0x0001a065, 0x0001a065, 0x00003c79, 0x00018066, 0x800007fc,
+  0x00000d3b, 0x0002bc74, 0x00015467, 0x800007fd, 0x00019469, 0x0001fc72,
+  0x0001dc61, 0x00016c68, 0x0000cc68, 0x0000f93b, 0x0001b873, 0x00037865,
+  0x00008470, 0x0001f461, 0x0000f072, 0x800007fe, 0x00000d3b, 0x0003bc6e,
+  0x0001dc6c, 0x0000b471, 0x800007ff, 0x0000793b, 0x0000ec68, 0x80000800,
+  0x00024872, 0x80000801, 0x00018869, 0x00003071, 0x80000802, 0x0001a86c,
+  0x80000803, 0x0001d871, 0x80000804, 0x0000213b, 0x0000293b, 0x0000153b,
+  0x0000e072, 0x00030072, 0x0003b93b, 0x0003ed3b, 0x00018062, 0x00023c61,
+  0x0000053b, 0x80000805, 0x0001a072, 0x0000d069, 0x0000053b, 0x80000806,
+  0x0001d073, 0x00019075, 0x0000093b, 0x0000e862, 0x80000807, 0x00007d3b,
+  0x80000808, 0x00019070, 0x0000113b, 0x0000e866, 0x0000b874, 0x0005d476,
+  0x80000809, 0x00018072, 0x0001c46f, 0x0000e070, 0x0000053b, 0x8000080a,
+  0x0001c074, 0x0000fd3b, 0x00015c72, 0x0000ac70, 0x00001869, 0x0001c063,
+  0x8000080b, 0x0000f072, 0x0000053b, 0x8000080c, 0x00028c62, 0x00003d3b,
+  0x8000080d, 0x00000d3b, 0x8000080e, 0x0000b06e, 0x0000053b, 0x8000080f,
+  0x0000053b, 0x80000810, 0x00019869, 0x0001e467, 0x0001807a, 0x0001b061,
+  0x0001c470, 0x80000811, 0x00000d3b, 0x0001cc75, 0x0000d467, 0x0001dc69,
+  0x00001d3b, 0x0000e863, 0x00019072, 0x80000812, 0x00010472, 0x0001cc61,
+  0x00004063, 0x00017445, 0x00015445, 0x0001cc64, 0x00000d3b, 0x0001ac66,
+  0x00018465, 0x80000813, 0x00000d3b, 0x000c0065, 0x80000814, 0x80000815,
+  0x00017c6f, 0x0000093b, 0x0001fc69, 0x80000816, 0x00016c73, 0x000fa872,
+  0x00003062, 0x00002070, 0x0001c065, 0x80000817, 0x0001f472, 0x0001ec67,
+  0x00043d3b, 0x00037c62, 0x0000f866, 0x0000b470, 0x0000e872, 0x0000213b,
+  0x00030865, 0x0000e13b, 0x0000293b, 0x0001cc65, 0x0001dc65, 0x00017c70,
+  0x0000e468, 0x0001a474, 0x00002d3b, 0x80000818, 0x0001d863, 0x0001e061,
+  0x80000819, 0x8000081a, 0x0000e072, 0x8000081b, 0x00018474, 0x00007d3b,
+  0x8000081c, 0x8000081d, 0x0000fc70, 0x0000cc70, 0x00018072, 0x000ee06c,
+  0x00001d3b, 0x0000d063, 0x0000093b, 0x000e8861, 0x8000081e, 0x00001d3b,
+  0x8000081f, 0x000e5872, 0x000fd874, 0x000fc466, 0x000fad3b, 0x0001cc63,
+  0x0000e869, 0x0000193b, 0x0001f866, 0x80000820, 0x000e7064, 0x000e1075,
+  0x0000e872, 0x00006d3b, 0x00017468, 0x00004469, 0x00012c6e, 0x0000a06f,
+  0x00003c6c, 0x000e5c6d, 0x00004872, 0x0000f473, 0x80000821, 0x000e4461,
+  0x00006076, 0x00007077, 0x0001f041, 0x0000f075, 0x0001c072, 0x0000153b,
+  0x0000e072, 0x000e7469, 0x80000822, 0x0001c472, 0x0000e872, 0x0000fd3b,
+  0x80000823, 0x0000093b, 0x0001d072, 0x80000824, 0x0000e872, 0x00000d3b,
+  0x80000825, 0x0001f472, 0x0000e472, 0x80000826, 0x00000d3b, 0x0000f070,
+  0x0000053b, 0x80000827, 0x0001c869, 0x00009073, 0x0000053b, 0x80000828,
+  0x000ee06f, 0x00001d3b, 0x80000829, 0x0000093b, 0x00016461, 0x8000082a,
+  0x0001c875, 0x0000e473, 0x8000082b, 0x0000053b, 0x00006c6d, 0x0001b069,
+  0x8000082c, 0x0000053b, 0x00004041, 0x00007064, 0x00011865, 0x0001d441,
+  0x0001c472, 0x00000d3b, 0x8000082d, 0x0000e472, 0x0000053b, 0x8000082e,
+  0x0000193b, 0x0001d072, 0x8000082f, 0x0000f872, 0x0000fc72, 0x0001cc63,
+  0x0001c463, 0x00001474, 0x0000053b, 0x80000830, 0x0001f075, 0x000f3070,
+  0x0000dd3b, 0x0003f079, 0x0000c470, 0x0000d073, 0x0001c075, 0x0001ac70,
+  0x0001cc6c, 0x0001b871, 0x000f5865, 0x00013c74, 0x0000d461, 0x80000831,
+  0x0001bc72, 0x00016861, 0x0000e869, 0x00000d3b, 0x80000832, 0x80000833,
+  0x00027470, 0x00019865, 0x00008465, 0x0001d874, 0x00019865, 0x00037c6e,
+  0x0001e064, 0x00027069, 0x00005d3b, 0x00018867, 0x0001b475, 0x00001d3b,
+  0x80000834, 0x0000313b, 0x0000f865, 0x0001c063, 0x0000d865, 0x80000835,
+  0x0000053b, 0x80000836, 0x80000837, 0x80000838, 0x0000fc79, 0x00030879,
+  0x00025061, 0x00018472, 0x00021063, 0x0000f463, 0x00021c65, 0x0003e53b,
+  0x0003ed3b, 0x0001f866, 0x00019069, 0x00000d3b, 0x80000839, 0x0000f072,
+  0x0000053b, 0x8000083a, 0x0002586f, 0x00028463, 0x0000053b, 0x8000083b,
+  0x00019873, 0x0000f466, 0x00015c75, 0x00000d3b, 0x8000083c, 0x0001f463,
+  0x0000e872, 0x00000d3b, 0x8000083d, 0x0000f079, 0x0000053b, 0x8000083e,
+  0x0000e86c, 0x0000f93b, 0x00010863, 0x8000083f, 0x0001c463, 0x0000386f,
+  0x00002c68, 0x00003469, 0x0001e475, 0x0000c065, 0x0001f864, 0x00003065,
+  0x00004466, 0x0001a474, 0x0000713b, 0x0001b061, 0x0001706d, 0x00003c63,
+  0x80000840, 0x0001b06f, 0x0001b072, 0x0000f06e, 0x0000053b, 0x80000841,
+  0x80000842, 0x0000053b, 0x000d2c71, 0x0001dc6f, 0x0000f474, 0x0000c077,
+  0x0001e13b, 0x00007872, 0x0001c474, 0x00001c73, 0x00002865, 0x00000461,
+  0x000000d7, 0x0000153b, 0x80000843, 0x0000f466, 0x80000844, 0x0000d861,
+  0x80000845, 0x0000e472, 0x0000093b, 0x0000193b, 0x00019463, 0x80000846,
+  0x0001e872, 0x0001cc67, 0x0000e479, 0x0001dc74, 0x0000193b, 0x0000113b,
+  0x80000847, 0x0001fc61, 0x0000313b, 0x80000848, 0x0001d072, 0x00015479,
+  0x80000849, 0x00012463, 0x0000c466, 0x00019c70, 0x0000d872, 0x0000f13b,
+  0x00001072, 0x0000e06a, 0x0000113b, 0x8000084a, 0x000000f1, 0x0023f86e,
+  0x8000084b, 0x0000313b, 0x000000fd, 0x000000fc, 0x000000ff, 0x8000084c,
+  0x000000f9, 0x000000f8, 0x000000fb, 0x000000fa, 0x000000e5, 0x000000e4,
+  0x000ce13b, 0x000000e6, 0x000000e1, 0x000000e0, 0x000000e3, 0x000000e2,
+  0x000000ed, 0x000000ec, 0x000000ef, 0x000000ee, 0x000000e9, 0x000000e8,
+  0x000000eb, 0x000000ea
+};
+
+// Code points of character entity references. Most references have
+// only one code point and their second code points are set to 0.
+const int ENTITY_CODE_POINTS[][2] = {
+  { 198, 0 },  // &AElig;
+  { 38, 0 },  // &AMP;
+  { 193, 0 },  // &Aacute;
+  { 258, 0 },  // &Abreve;
+  { 194, 0 },  // &Acirc;
+  { 1040, 0 },  // &Acy;
+  { 120068, 0 },  // &Afr;
+  { 192, 0 },  // &Agrave;
+  { 913, 0 },  // &Alpha;
+  { 256, 0 },  // &Amacr;
+  { 10835, 0 },  // &And;
+  { 260, 0 },  // &Aogon;
+  { 120120, 0 },  // &Aopf;
+  { 8289, 0 },  // &ApplyFunction;
+  { 197, 0 },  // &Aring;
+  { 119964, 0 },  // &Ascr;
+  { 8788, 0 },  // &Assign;
+  { 195, 0 },  // &Atilde;
+  { 196, 0 },  // &Auml;
+  { 8726, 0 },  // &Backslash;
+  { 10983, 0 },  // &Barv;
+  { 8966, 0 },  // &Barwed;
+  { 1041, 0 },  // &Bcy;
+  { 8757, 0 },  // &Because;
+  { 8492, 0 },  // &Bernoullis;
+  { 914, 0 },  // &Beta;
+  { 120069, 0 },  // &Bfr;
+  { 120121, 0 },  // &Bopf;
+  { 728, 0 },  // &Breve;
+  { 8492, 0 },  // &Bscr;
+  { 8782, 0 },  // &Bumpeq;
+  { 1063, 0 },  // &CHcy;
+  { 169, 0 },  // &COPY;
+  { 262, 0 },  // &Cacute;
+  { 8914, 0 },  // &Cap;
+  { 8517, 0 },  // &CapitalDifferentialD;
+  { 8493, 0 },  // &Cayleys;
+  { 268, 0 },  // &Ccaron;
+  { 199, 0 },  // &Ccedil;
+  { 264, 0 },  // &Ccirc;
+  { 8752, 0 },  // &Cconint;
+  { 266, 0 },  // &Cdot;
+  { 184, 0 },  // &Cedilla;
+  { 183, 0 },  // &CenterDot;
+  { 8493, 0 },  // &Cfr;
+  { 935, 0 },  // &Chi;
+  { 8857, 0 },  // &CircleDot;
+  { 8854, 0 },  // &CircleMinus;
+  { 8853, 0 },  // &CirclePlus;
+  { 8855, 0 },  // &CircleTimes;
+  { 8754, 0 },  // &ClockwiseContourIntegral;
+  { 8221, 0 },  // &CloseCurlyDoubleQuote;
+  { 8217, 0 },  // &CloseCurlyQuote;
+  { 8759, 0 },  // &Colon;
+  { 10868, 0 },  // &Colone;
+  { 8801, 0 },  // &Congruent;
+  { 8751, 0 },  // &Conint;
+  { 8750, 0 },  // &ContourIntegral;
+  { 8450, 0 },  // &Copf;
+  { 8720, 0 },  // &Coproduct;
+  { 8755, 0 },  // &CounterClockwiseContourIntegral;
+  { 10799, 0 },  // &Cross;
+  { 119966, 0 },  // &Cscr;
+  { 8915, 0 },  // &Cup;
+  { 8781, 0 },  // &CupCap;
+  { 8517, 0 },  // &DD;
+  { 10513, 0 },  // &DDotrahd;
+  { 1026, 0 },  // &DJcy;
+  { 1029, 0 },  // &DScy;
+  { 1039, 0 },  // &DZcy;
+  { 8225, 0 },  // &Dagger;
+  { 8609, 0 },  // &Darr;
+  { 10980, 0 },  // &Dashv;
+  { 270, 0 },  // &Dcaron;
+  { 1044, 0 },  // &Dcy;
+  { 8711, 0 },  // &Del;
+  { 916, 0 },  // &Delta;
+  { 120071, 0 },  // &Dfr;
+  { 180, 0 },  // &DiacriticalAcute;
+  { 729, 0 },  // &DiacriticalDot;
+  { 733, 0 },  // &DiacriticalDoubleAcute;
+  { 96, 0 },  // &DiacriticalGrave;
+  { 732, 0 },  // &DiacriticalTilde;
+  { 8900, 0 },  // &Diamond;
+  { 8518, 0 },  // &DifferentialD;
+  { 120123, 0 },  // &Dopf;
+  { 168, 0 },  // &Dot;
+  { 8412, 0 },  // &DotDot;
+  { 8784, 0 },  // &DotEqual;
+  { 8751, 0 },  // &DoubleContourIntegral;
+  { 168, 0 },  // &DoubleDot;
+  { 8659, 0 },  // &DoubleDownArrow;
+  { 8656, 0 },  // &DoubleLeftArrow;
+  { 8660, 0 },  // &DoubleLeftRightArrow;
+  { 10980, 0 },  // &DoubleLeftTee;
+  { 10232, 0 },  // &DoubleLongLeftArrow;
+  { 10234, 0 },  // &DoubleLongLeftRightArrow;
+  { 10233, 0 },  // &DoubleLongRightArrow;
+  { 8658, 0 },  // &DoubleRightArrow;
+  { 8872, 0 },  // &DoubleRightTee;
+  { 8657, 0 },  // &DoubleUpArrow;
+  { 8661, 0 },  // &DoubleUpDownArrow;
+  { 8741, 0 },  // &DoubleVerticalBar;
+  { 8595, 0 },  // &DownArrow;
+  { 10515, 0 },  // &DownArrowBar;
+  { 8693, 0 },  // &DownArrowUpArrow;
+  { 785, 0 },  // &DownBreve;
+  { 10576, 0 },  // &DownLeftRightVector;
+  { 10590, 0 },  // &DownLeftTeeVector;
+  { 8637, 0 },  // &DownLeftVector;
+  { 10582, 0 },  // &DownLeftVectorBar;
+  { 10591, 0 },  // &DownRightTeeVector;
+  { 8641, 0 },  // &DownRightVector;
+  { 10583, 0 },  // &DownRightVectorBar;
+  { 8868, 0 },  // &DownTee;
+  { 8615, 0 },  // &DownTeeArrow;
+  { 8659, 0 },  // &Downarrow;
+  { 119967, 0 },  // &Dscr;
+  { 272, 0 },  // &Dstrok;
+  { 330, 0 },  // &ENG;
+  { 208, 0 },  // &ETH;
+  { 201, 0 },  // &Eacute;
+  { 282, 0 },  // &Ecaron;
+  { 202, 0 },  // &Ecirc;
+  { 1069, 0 },  // &Ecy;
+  { 278, 0 },  // &Edot;
+  { 120072, 0 },  // &Efr;
+  { 200, 0 },  // &Egrave;
+  { 8712, 0 },  // &Element;
+  { 274, 0 },  // &Emacr;
+  { 9723, 0 },  // &EmptySmallSquare;
+  { 9643, 0 },  // &EmptyVerySmallSquare;
+  { 280, 0 },  // &Eogon;
+  { 120124, 0 },  // &Eopf;
+  { 917, 0 },  // &Epsilon;
+  { 10869, 0 },  // &Equal;
+  { 8770, 0 },  // &EqualTilde;
+  { 8652, 0 },  // &Equilibrium;
+  { 8496, 0 },  // &Escr;
+  { 10867, 0 },  // &Esim;
+  { 919, 0 },  // &Eta;
+  { 203, 0 },  // &Euml;
+  { 8707, 0 },  // &Exists;
+  { 8519, 0 },  // &ExponentialE;
+  { 1060, 0 },  // &Fcy;
+  { 120073, 0 },  // &Ffr;
+  { 9724, 0 },  // &FilledSmallSquare;
+  { 9642, 0 },  // &FilledVerySmallSquare;
+  { 120125, 0 },  // &Fopf;
+  { 8704, 0 },  // &ForAll;
+  { 8497, 0 },  // &Fouriertrf;
+  { 8497, 0 },  // &Fscr;
+  { 1027, 0 },  // &GJcy;
+  { 62, 0 },  // &GT;
+  { 915, 0 },  // &Gamma;
+  { 988, 0 },  // &Gammad;
+  { 286, 0 },  // &Gbreve;
+  { 290, 0 },  // &Gcedil;
+  { 284, 0 },  // &Gcirc;
+  { 1043, 0 },  // &Gcy;
+  { 288, 0 },  // &Gdot;
+  { 120074, 0 },  // &Gfr;
+  { 8921, 0 },  // &Gg;
+  { 120126, 0 },  // &Gopf;
+  { 8805, 0 },  // &GreaterEqual;
+  { 8923, 0 },  // &GreaterEqualLess;
+  { 8807, 0 },  // &GreaterFullEqual;
+  { 10914, 0 },  // &GreaterGreater;
+  { 8823, 0 },  // &GreaterLess;
+  { 10878, 0 },  // &GreaterSlantEqual;
+  { 8819, 0 },  // &GreaterTilde;
+  { 119970, 0 },  // &Gscr;
+  { 8811, 0 },  // &Gt;
+  { 1066, 0 },  // &HARDcy;
+  { 711, 0 },  // &Hacek;
+  { 94, 0 },  // &Hat;
+  { 292, 0 },  // &Hcirc;
+  { 8460, 0 },  // &Hfr;
+  { 8459, 0 },  // &HilbertSpace;
+  { 8461, 0 },  // &Hopf;
+  { 9472, 0 },  // &HorizontalLine;
+  { 8459, 0 },  // &Hscr;
+  { 294, 0 },  // &Hstrok;
+  { 8782, 0 },  // &HumpDownHump;
+  { 8783, 0 },  // &HumpEqual;
+  { 1045, 0 },  // &IEcy;
+  { 306, 0 },  // &IJlig;
+  { 1025, 0 },  // &IOcy;
+  { 205, 0 },  // &Iacute;
+  { 206, 0 },  // &Icirc;
+  { 1048, 0 },  // &Icy;
+  { 304, 0 },  // &Idot;
+  { 8465, 0 },  // &Ifr;
+  { 204, 0 },  // &Igrave;
+  { 8465, 0 },  // &Im;
+  { 298, 0 },  // &Imacr;
+  { 8520, 0 },  // &ImaginaryI;
+  { 8658, 0 },  // &Implies;
+  { 8748, 0 },  // &Int;
+  { 8747, 0 },  // &Integral;
+  { 8898, 0 },  // &Intersection;
+  { 8291, 0 },  // &InvisibleComma;
+  { 8290, 0 },  // &InvisibleTimes;
+  { 302, 0 },  // &Iogon;
+  { 120128, 0 },  // &Iopf;
+  { 921, 0 },  // &Iota;
+  { 8464, 0 },  // &Iscr;
+  { 296, 0 },  // &Itilde;
+  { 1030, 0 },  // &Iukcy;
+  { 207, 0 },  // &Iuml;
+  { 308, 0 },  // &Jcirc;
+  { 1049, 0 },  // &Jcy;
+  { 120077, 0 },  // &Jfr;
+  { 120129, 0 },  // &Jopf;
+  { 119973, 0 },  // &Jscr;
+  { 1032, 0 },  // &Jsercy;
+  { 1028, 0 },  // &Jukcy;
+  { 1061, 0 },  // &KHcy;
+  { 1036, 0 },  // &KJcy;
+  { 922, 0 },  // &Kappa;
+  { 310, 0 },  // &Kcedil;
+  { 1050, 0 },  // &Kcy;
+  { 120078, 0 },  // &Kfr;
+  { 120130, 0 },  // &Kopf;
+  { 119974, 0 },  // &Kscr;
+  { 1033, 0 },  // &LJcy;
+  { 60, 0 },  // &LT;
+  { 313, 0 },  // &Lacute;
+  { 923, 0 },  // &Lambda;
+  { 10218, 0 },  // &Lang;
+  { 8466, 0 },  // &Laplacetrf;
+  { 8606, 0 },  // &Larr;
+  { 317, 0 },  // &Lcaron;
+  { 315, 0 },  // &Lcedil;
+  { 1051, 0 },  // &Lcy;
+  { 10216, 0 },  // &LeftAngleBracket;
+  { 8592, 0 },  // &LeftArrow;
+  { 8676, 0 },  // &LeftArrowBar;
+  { 8646, 0 },  // &LeftArrowRightArrow;
+  { 8968, 0 },  // &LeftCeiling;
+  { 10214, 0 },  // &LeftDoubleBracket;
+  { 10593, 0 },  // &LeftDownTeeVector;
+  { 8643, 0 },  // &LeftDownVector;
+  { 10585, 0 },  // &LeftDownVectorBar;
+  { 8970, 0 },  // &LeftFloor;
+  { 8596, 0 },  // &LeftRightArrow;
+  { 10574, 0 },  // &LeftRightVector;
+  { 8867, 0 },  // &LeftTee;
+  { 8612, 0 },  // &LeftTeeArrow;
+  { 10586, 0 },  // &LeftTeeVector;
+  { 8882, 0 },  // &LeftTriangle;
+  { 10703, 0 },  // &LeftTriangleBar;
+  { 8884, 0 },  // &LeftTriangleEqual;
+  { 10577, 0 },  // &LeftUpDownVector;
+  { 10592, 0 },  // &LeftUpTeeVector;
+  { 8639, 0 },  // &LeftUpVector;
+  { 10584, 0 },  // &LeftUpVectorBar;
+  { 8636, 0 },  // &LeftVector;
+  { 10578, 0 },  // &LeftVectorBar;
+  { 8656, 0 },  // &Leftarrow;
+  { 8660, 0 },  // &Leftrightarrow;
+  { 8922, 0 },  // &LessEqualGreater;
+  { 8806, 0 },  // &LessFullEqual;
+  { 8822, 0 },  // &LessGreater;
+  { 10913, 0 },  // &LessLess;
+  { 10877, 0 },  // &LessSlantEqual;
+  { 8818, 0 },  // &LessTilde;
+  { 120079, 0 },  // &Lfr;
+  { 8920, 0 },  // &Ll;
+  { 8666, 0 },  // &Lleftarrow;
+  { 319, 0 },  // &Lmidot;
+  { 10229, 0 },  // &LongLeftArrow;
+  { 10231, 0 },  // &LongLeftRightArrow;
+  { 10230, 0 },  // &LongRightArrow;
+  { 10232, 0 },  // &Longleftarrow;
+  { 10234, 0 },  // &Longleftrightarrow;
+  { 10233, 0 },  // &Longrightarrow;
+  { 120131, 0 },  // &Lopf;
+  { 8601, 0 },  // &LowerLeftArrow;
+  { 8600, 0 },  // &LowerRightArrow;
+  { 8466, 0 },  // &Lscr;
+  { 8624, 0 },  // &Lsh;
+  { 321, 0 },  // &Lstrok;
+  { 8810, 0 },  // &Lt;
+  { 10501, 0 },  // &Map;
+  { 1052, 0 },  // &Mcy;
+  { 8287, 0 },  // &MediumSpace;
+  { 8499, 0 },  // &Mellintrf;
+  { 120080, 0 },  // &Mfr;
+  { 8723, 0 },  // &MinusPlus;
+  { 120132, 0 },  // &Mopf;
+  { 8499, 0 },  // &Mscr;
+  { 924, 0 },  // &Mu;
+  { 1034, 0 },  // &NJcy;
+  { 323, 0 },  // &Nacute;
+  { 327, 0 },  // &Ncaron;
+  { 325, 0 },  // &Ncedil;
+  { 1053, 0 },  // &Ncy;
+  { 8203, 0 },  // &NegativeMediumSpace;
+  { 8203, 0 },  // &NegativeThickSpace;
+  { 8203, 0 },  // &NegativeThinSpace;
+  { 8203, 0 },  // &NegativeVeryThinSpace;
+  { 8811, 0 },  // &NestedGreaterGreater;
+  { 8810, 0 },  // &NestedLessLess;
+  { 10, 0 },  // &NewLine;
+  { 120081, 0 },  // &Nfr;
+  { 8288, 0 },  // &NoBreak;
+  { 160, 0 },  // &NonBreakingSpace;
+  { 8469, 0 },  // &Nopf;
+  { 10988, 0 },  // &Not;
+  { 8802, 0 },  // &NotCongruent;
+  { 8813, 0 },  // &NotCupCap;
+  { 8742, 0 },  // &NotDoubleVerticalBar;
+  { 8713, 0 },  // &NotElement;
+  { 8800, 0 },  // &NotEqual;
+  { 8770, 824 },  // &NotEqualTilde;
+  { 8708, 0 },  // &NotExists;
+  { 8815, 0 },  // &NotGreater;
+  { 8817, 0 },  // &NotGreaterEqual;
+  { 8807, 824 },  // &NotGreaterFullEqual;
+  { 8811, 824 },  // &NotGreaterGreater;
+  { 8825, 0 },  // &NotGreaterLess;
+  { 10878, 824 },  // &NotGreaterSlantEqual;
+  { 8821, 0 },  // &NotGreaterTilde;
+  { 8782, 824 },  // &NotHumpDownHump;
+  { 8783, 824 },  // &NotHumpEqual;
+  { 8938, 0 },  // &NotLeftTriangle;
+  { 10703, 824 },  // &NotLeftTriangleBar;
+  { 8940, 0 },  // &NotLeftTriangleEqual;
+  { 8814, 0 },  // &NotLess;
+  { 8816, 0 },  // &NotLessEqual;
+  { 8824, 0 },  // &NotLessGreater;
+  { 8810, 824 },  // &NotLessLess;
+  { 10877, 824 },  // &NotLessSlantEqual;
+  { 8820, 0 },  // &NotLessTilde;
+  { 10914, 824 },  // &NotNestedGreaterGreater;
+  { 10913, 824 },  // &NotNestedLessLess;
+  { 8832, 0 },  // &NotPrecedes;
+  { 10927, 824 },  // &NotPrecedesEqual;
+  { 8928, 0 },  // &NotPrecedesSlantEqual;
+  { 8716, 0 },  // &NotReverseElement;
+  { 8939, 0 },  // &NotRightTriangle;
+  { 10704, 824 },  // &NotRightTriangleBar;
+  { 8941, 0 },  // &NotRightTriangleEqual;
+  { 8847, 824 },  // &NotSquareSubset;
+  { 8930, 0 },  // &NotSquareSubsetEqual;
+  { 8848, 824 },  // &NotSquareSuperset;
+  { 8931, 0 },  // &NotSquareSupersetEqual;
+  { 8834, 8402 },  // &NotSubset;
+  { 8840, 0 },  // &NotSubsetEqual;
+  { 8833, 0 },  // &NotSucceeds;
+  { 10928, 824 },  // &NotSucceedsEqual;
+  { 8929, 0 },  // &NotSucceedsSlantEqual;
+  { 8831, 824 },  // &NotSucceedsTilde;
+  { 8835, 8402 },  // &NotSuperset;
+  { 8841, 0 },  // &NotSupersetEqual;
+  { 8769, 0 },  // &NotTilde;
+  { 8772, 0 },  // &NotTildeEqual;
+  { 8775, 0 },  // &NotTildeFullEqual;
+  { 8777, 0 },  // &NotTildeTilde;
+  { 8740, 0 },  // &NotVerticalBar;
+  { 119977, 0 },  // &Nscr;
+  { 209, 0 },  // &Ntilde;
+  { 925, 0 },  // &Nu;
+  { 338, 0 },  // &OElig;
+  { 211, 0 },  // &Oacute;
+  { 212, 0 },  // &Ocirc;
+  { 1054, 0 },  // &Ocy;
+  { 336, 0 },  // &Odblac;
+  { 120082, 0 },  // &Ofr;
+  { 210, 0 },  // &Ograve;
+  { 332, 0 },  // &Omacr;
+  { 937, 0 },  // &Omega;
+  { 927, 0 },  // &Omicron;
+  { 120134, 0 },  // &Oopf;
+  { 8220, 0 },  // &OpenCurlyDoubleQuote;
+  { 8216, 0 },  // &OpenCurlyQuote;
+  { 10836, 0 },  // &Or;
+  { 119978, 0 },  // &Oscr;
+  { 216, 0 },  // &Oslash;
+  { 213, 0 },  // &Otilde;
+  { 10807, 0 },  // &Otimes;
+  { 214, 0 },  // &Ouml;
+  { 8254, 0 },  // &OverBar;
+  { 9182, 0 },  // &OverBrace;
+  { 9140, 0 },  // &OverBracket;
+  { 9180, 0 },  // &OverParenthesis;
+  { 8706, 0 },  // &PartialD;
+  { 1055, 0 },  // &Pcy;
+  { 120083, 0 },  // &Pfr;
+  { 934, 0 },  // &Phi;
+  { 928, 0 },  // &Pi;
+  { 177, 0 },  // &PlusMinus;
+  { 8460, 0 },  // &Poincareplane;
+  { 8473, 0 },  // &Popf;
+  { 10939, 0 },  // &Pr;
+  { 8826, 0 },  // &Precedes;
+  { 10927, 0 },  // &PrecedesEqual;
+  { 8828, 0 },  // &PrecedesSlantEqual;
+  { 8830, 0 },  // &PrecedesTilde;
+  { 8243, 0 },  // &Prime;
+  { 8719, 0 },  // &Product;
+  { 8759, 0 },  // &Proportion;
+  { 8733, 0 },  // &Proportional;
+  { 119979, 0 },  // &Pscr;
+  { 936, 0 },  // &Psi;
+  { 34, 0 },  // &QUOT;
+  { 120084, 0 },  // &Qfr;
+  { 8474, 0 },  // &Qopf;
+  { 119980, 0 },  // &Qscr;
+  { 10512, 0 },  // &RBarr;
+  { 174, 0 },  // &REG;
+  { 340, 0 },  // &Racute;
+  { 10219, 0 },  // &Rang;
+  { 8608, 0 },  // &Rarr;
+  { 10518, 0 },  // &Rarrtl;
+  { 344, 0 },  // &Rcaron;
+  { 342, 0 },  // &Rcedil;
+  { 1056, 0 },  // &Rcy;
+  { 8476, 0 },  // &Re;
+  { 8715, 0 },  // &ReverseElement;
+  { 8651, 0 },  // &ReverseEquilibrium;
+  { 10607, 0 },  // &ReverseUpEquilibrium;
+  { 8476, 0 },  // &Rfr;
+  { 929, 0 },  // &Rho;
+  { 10217, 0 },  // &RightAngleBracket;
+  { 8594, 0 },  // &RightArrow;
+  { 8677, 0 },  // &RightArrowBar;
+  { 8644, 0 },  // &RightArrowLeftArrow;
+  { 8969, 0 },  // &RightCeiling;
+  { 10215, 0 },  // &RightDoubleBracket;
+  { 10589, 0 },  // &RightDownTeeVector;
+  { 8642, 0 },  // &RightDownVector;
+  { 10581, 0 },  // &RightDownVectorBar;
+  { 8971, 0 },  // &RightFloor;
+  { 8866, 0 },  // &RightTee;
+  { 8614, 0 },  // &RightTeeArrow;
+  { 10587, 0 },  // &RightTeeVector;
+  { 8883, 0 },  // &RightTriangle;
+  { 10704, 0 },  // &RightTriangleBar;
+  { 8885, 0 },  // &RightTriangleEqual;
+  { 10575, 0 },  // &RightUpDownVector;
+  { 10588, 0 },  // &RightUpTeeVector;
+  { 8638, 0 },  // &RightUpVector;
+  { 10580, 0 },  // &RightUpVectorBar;
+  { 8640, 0 },  // &RightVector;
+  { 10579, 0 },  // &RightVectorBar;
+  { 8658, 0 },  // &Rightarrow;
+  { 8477, 0 },  // &Ropf;
+  { 10608, 0 },  // &RoundImplies;
+  { 8667, 0 },  // &Rrightarrow;
+  { 8475, 0 },  // &Rscr;
+  { 8625, 0 },  // &Rsh;
+  { 10740, 0 },  // &RuleDelayed;
+  { 1065, 0 },  // &SHCHcy;
+  { 1064, 0 },  // &SHcy;
+  { 1068, 0 },  // &SOFTcy;
+  { 346, 0 },  // &Sacute;
+  { 10940, 0 },  // &Sc;
+  { 352, 0 },  // &Scaron;
+  { 350, 0 },  // &Scedil;
+  { 348, 0 },  // &Scirc;
+  { 1057, 0 },  // &Scy;
+  { 120086, 0 },  // &Sfr;
+  { 8595, 0 },  // &ShortDownArrow;
+  { 8592, 0 },  // &ShortLeftArrow;
+  { 8594, 0 },  // &ShortRightArrow;
+  { 8593, 0 },  // &ShortUpArrow;
+  { 931, 0 },  // &Sigma;
+  { 8728, 0 },  // &SmallCircle;
+  { 120138, 0 },  // &Sopf;
+  { 8730, 0 },  // &Sqrt;
+  { 9633, 0 },  // &Square;
+  { 8851, 0 },  // &SquareIntersection;
+  { 8847, 0 },  // &SquareSubset;
+  { 8849, 0 },  // &SquareSubsetEqual;
+  { 8848, 0 },  // &SquareSuperset;
+  { 8850, 0 },  // &SquareSupersetEqual;
+  { 8852, 0 },  // &SquareUnion;
+  { 119982, 0 },  // &Sscr;
+  { 8902, 0 },  // &Star;
+  { 8912, 0 },  // &Sub;
+  { 8912, 0 },  // &Subset;
+  { 8838, 0 },  // &SubsetEqual;
+  { 8827, 0 },  // &Succeeds;
+  { 10928, 0 },  // &SucceedsEqual;
+  { 8829, 0 },  // &SucceedsSlantEqual;
+  { 8831, 0 },  // &SucceedsTilde;
+  { 8715, 0 },  // &SuchThat;
+  { 8721, 0 },  // &Sum;
+  { 8913, 0 },  // &Sup;
+  { 8835, 0 },  // &Superset;
+  { 8839, 0 },  // &SupersetEqual;
+  { 8913, 0 },  // &Supset;
+  { 222, 0 },  // &THORN;
+  { 8482, 0 },  // &TRADE;
+  { 1035, 0 },  // &TSHcy;
+  { 1062, 0 },  // &TScy;
+  { 9, 0 },  // &Tab;
+  { 932, 0 },  // &Tau;
+  { 356, 0 },  // &Tcaron;
+  { 354, 0 },  // &Tcedil;
+  { 1058, 0 },  // &Tcy;
+  { 120087, 0 },  // &Tfr;
+  { 8756, 0 },  // &Therefore;
+  { 920, 0 },  // &Theta;
+  { 8287, 8202 },  // &ThickSpace;
+  { 8201, 0 },  // &ThinSpace;
+  { 8764, 0 },  // &Tilde;
+  { 8771, 0 },  // &TildeEqual;
+  { 8773, 0 },  // &TildeFullEqual;
+  { 8776, 0 },  // &TildeTilde;
+  { 120139, 0 },  // &Topf;
+  { 8411, 0 },  // &TripleDot;
+  { 119983, 0 },  // &Tscr;
+  { 358, 0 },  // &Tstrok;
+  { 218, 0 },  // &Uacute;
+  { 8607, 0 },  // &Uarr;
+  { 10569, 0 },  // &Uarrocir;
+  { 1038, 0 },  // &Ubrcy;
+  { 364, 0 },  // &Ubreve;
+  { 219, 0 },  // &Ucirc;
+  { 1059, 0 },  // &Ucy;
+  { 368, 0 },  // &Udblac;
+  { 120088, 0 },  // &Ufr;
+  { 217, 0 },  // &Ugrave;
+  { 362, 0 },  // &Umacr;
+  { 95, 0 },  // &UnderBar;
+  { 9183, 0 },  // &UnderBrace;
+  { 9141, 0 },  // &UnderBracket;
+  { 9181, 0 },  // &UnderParenthesis;
+  { 8899, 0 },  // &Union;
+  { 8846, 0 },  // &UnionPlus;
+  { 370, 0 },  // &Uogon;
+  { 120140, 0 },  // &Uopf;
+  { 8593, 0 },  // &UpArrow;
+  { 10514, 0 },  // &UpArrowBar;
+  { 8645, 0 },  // &UpArrowDownArrow;
+  { 8597, 0 },  // &UpDownArrow;
+  { 10606, 0 },  // &UpEquilibrium;
+  { 8869, 0 },  // &UpTee;
+  { 8613, 0 },  // &UpTeeArrow;
+  { 8657, 0 },  // &Uparrow;
+  { 8661, 0 },  // &Updownarrow;
+  { 8598, 0 },  // &UpperLeftArrow;
+  { 8599, 0 },  // &UpperRightArrow;
+  { 978, 0 },  // &Upsi;
+  { 933, 0 },  // &Upsilon;
+  { 366, 0 },  // &Uring;
+  { 119984, 0 },  // &Uscr;
+  { 360, 0 },  // &Utilde;
+  { 220, 0 },  // &Uuml;
+  { 8875, 0 },  // &VDash;
+  { 10987, 0 },  // &Vbar;
+  { 1042, 0 },  // &Vcy;
+  { 8873, 0 },  // &Vdash;
+  { 10982, 0 },  // &Vdashl;
+  { 8897, 0 },  // &Vee;
+  { 8214, 0 },  // &Verbar;
+  { 8214, 0 },  // &Vert;
+  { 8739, 0 },  // &VerticalBar;
+  { 124, 0 },  // &VerticalLine;
+  { 10072, 0 },  // &VerticalSeparator;
+  { 8768, 0 },  // &VerticalTilde;
+  { 8202, 0 },  // &VeryThinSpace;
+  { 120089, 0 },  // &Vfr;
+  { 120141, 0 },  // &Vopf;
+  { 119985, 0 },  // &Vscr;
+  { 8874, 0 },  // &Vvdash;
+  { 372, 0 },  // &Wcirc;
+  { 8896, 0 },  // &Wedge;
+  { 120090, 0 },  // &Wfr;
+  { 120142, 0 },  // &Wopf;
+  { 119986, 0 },  // &Wscr;
+  { 120091, 0 },  // &Xfr;
+  { 926, 0 },  // &Xi;
+  { 120143, 0 },  // &Xopf;
+  { 119987, 0 },  // &Xscr;
+  { 1071, 0 },  // &YAcy;
+  { 1031, 0 },  // &YIcy;
+  { 1070, 0 },  // &YUcy;
+  { 221, 0 },  // &Yacute;
+  { 374, 0 },  // &Ycirc;
+  { 1067, 0 },  // &Ycy;
+  { 120092, 0 },  // &Yfr;
+  { 120144, 0 },  // &Yopf;
+  { 119988, 0 },  // &Yscr;
+  { 376, 0 },  // &Yuml;
+  { 1046, 0 },  // &ZHcy;
+  { 377, 0 },  // &Zacute;
+  { 381, 0 },  // &Zcaron;
+  { 1047, 0 },  // &Zcy;
+  { 379, 0 },  // &Zdot;
+  { 8203, 0 },  // &ZeroWidthSpace;
+  { 918, 0 },  // &Zeta;
+  { 8488, 0 },  // &Zfr;
+  { 8484, 0 },  // &Zopf;
+  { 119989, 0 },  // &Zscr;
+  { 225, 0 },  // &aacute;
+  { 259, 0 },  // &abreve;
+  { 8766, 0 },  // &ac;
+  { 8766, 819 },  // &acE;
+  { 8767, 0 },  // &acd;
+  { 226, 0 },  // &acirc;
+  { 180, 0 },  // &acute;
+  { 1072, 0 },  // &acy;
+  { 230, 0 },  // &aelig;
+  { 8289, 0 },  // &af;
+  { 120094, 0 },  // &afr;
+  { 224, 0 },  // &agrave;
+  { 8501, 0 },  // &alefsym;
+  { 8501, 0 },  // &aleph;
+  { 945, 0 },  // &alpha;
+  { 257, 0 },  // &amacr;
+  { 10815, 0 },  // &amalg;
+  { 38, 0 },  // &amp;
+  { 8743, 0 },  // &and;
+  { 10837, 0 },  // &andand;
+  { 10844, 0 },  // &andd;
+  { 10840, 0 },  // &andslope;
+  { 10842, 0 },  // &andv;
+  { 8736, 0 },  // &ang;
+  { 10660, 0 },  // &ange;
+  { 8736, 0 },  // &angle;
+  { 8737, 0 },  // &angmsd;
+  { 10664, 0 },  // &angmsdaa;
+  { 10665, 0 },  // &angmsdab;
+  { 10666, 0 },  // &angmsdac;
+  { 10667, 0 },  // &angmsdad;
+  { 10668, 0 },  // &angmsdae;
+  { 10669, 0 },  // &angmsdaf;
+  { 10670, 0 },  // &angmsdag;
+  { 10671, 0 },  // &angmsdah;
+  { 8735, 0 },  // &angrt;
+  { 8894, 0 },  // &angrtvb;
+  { 10653, 0 },  // &angrtvbd;
+  { 8738, 0 },  // &angsph;
+  { 197, 0 },  // &angst;
+  { 9084, 0 },  // &angzarr;
+  { 261, 0 },  // &aogon;
+  { 120146, 0 },  // &aopf;
+  { 8776, 0 },  // &ap;
+  { 10864, 0 },  // &apE;
+  { 10863, 0 },  // &apacir;
+  { 8778, 0 },  // &ape;
+  { 8779, 0 },  // &apid;
+  { 39, 0 },  // &apos;
+  { 8776, 0 },  // &approx;
+  { 8778, 0 },  // &approxeq;
+  { 229, 0 },  // &aring;
+  { 119990, 0 },  // &ascr;
+  { 42, 0 },  // &ast;
+  { 8776, 0 },  // &asymp;
+  { 8781, 0 },  // &asympeq;
+  { 227, 0 },  // &atilde;
+  { 228, 0 },  // &auml;
+  { 8755, 0 },  // &awconint;
+  { 10769, 0 },  // &awint;
+  { 10989, 0 },  // &bNot;
+  { 8780, 0 },  // &backcong;
+  { 1014, 0 },  // &backepsilon;
+  { 8245, 0 },  // &backprime;
+  { 8765, 0 },  // &backsim;
+  { 8909, 0 },  // &backsimeq;
+  { 8893, 0 },  // &barvee;
+  { 8965, 0 },  // &barwed;
+  { 8965, 0 },  // &barwedge;
+  { 9141, 0 },  // &bbrk;
+  { 9142, 0 },  // &bbrktbrk;
+  { 8780, 0 },  // &bcong;
+  { 1073, 0 },  // &bcy;
+  { 8222, 0 },  // &bdquo;
+  { 8757, 0 },  // &becaus;
+  { 8757, 0 },  // &because;
+  { 10672, 0 },  // &bemptyv;
+  { 1014, 0 },  // &bepsi;
+  { 8492, 0 },  // &bernou;
+  { 946, 0 },  // &beta;
+  { 8502, 0 },  // &beth;
+  { 8812, 0 },  // &between;
+  { 120095, 0 },  // &bfr;
+  { 8898, 0 },  // &bigcap;
+  { 9711, 0 },  // &bigcirc;
+  { 8899, 0 },  // &bigcup;
+  { 10752, 0 },  // &bigodot;
+  { 10753, 0 },  // &bigoplus;
+  { 10754, 0 },  // &bigotimes;
+  { 10758, 0 },  // &bigsqcup;
+  { 9733, 0 },  // &bigstar;
+  { 9661, 0 },  // &bigtriangledown;
+  { 9651, 0 },  // &bigtriangleup;
+  { 10756, 0 },  // &biguplus;
+  { 8897, 0 },  // &bigvee;
+  { 8896, 0 },  // &bigwedge;
+  { 10509, 0 },  // &bkarow;
+  { 10731, 0 },  // &blacklozenge;
+  { 9642, 0 },  // &blacksquare;
+  { 9652, 0 },  // &blacktriangle;
+  { 9662, 0 },  // &blacktriangledown;
+  { 9666, 0 },  // &blacktriangleleft;
+  { 9656, 0 },  // &blacktriangleright;
+  { 9251, 0 },  // &blank;
+  { 9618, 0 },  // &blk12;
+  { 9617, 0 },  // &blk14;
+  { 9619, 0 },  // &blk34;
+  { 9608, 0 },  // &block;
+  { 61, 8421 },  // &bne;
+  { 8801, 8421 },  // &bnequiv;
+  { 8976, 0 },  // &bnot;
+  { 120147, 0 },  // &bopf;
+  { 8869, 0 },  // &bot;
+  { 8869, 0 },  // &bottom;
+  { 8904, 0 },  // &bowtie;
+  { 9559, 0 },  // &boxDL;
+  { 9556, 0 },  // &boxDR;
+  { 9558, 0 },  // &boxDl;
+  { 9555, 0 },  // &boxDr;
+  { 9552, 0 },  // &boxH;
+  { 9574, 0 },  // &boxHD;
+  { 9577, 0 },  // &boxHU;
+  { 9572, 0 },  // &boxHd;
+  { 9575, 0 },  // &boxHu;
+  { 9565, 0 },  // &boxUL;
+  { 9562, 0 },  // &boxUR;
+  { 9564, 0 },  // &boxUl;
+  { 9561, 0 },  // &boxUr;
+  { 9553, 0 },  // &boxV;
+  { 9580, 0 },  // &boxVH;
+  { 9571, 0 },  // &boxVL;
+  { 9568, 0 },  // &boxVR;
+  { 9579, 0 },  // &boxVh;
+  { 9570, 0 },  // &boxVl;
+  { 9567, 0 },  // &boxVr;
+  { 10697, 0 },  // &boxbox;
+  { 9557, 0 },  // &boxdL;
+  { 9554, 0 },  // &boxdR;
+  { 9488, 0 },  // &boxdl;
+  { 9484, 0 },  // &boxdr;
+  { 9472, 0 },  // &boxh;
+  { 9573, 0 },  // &boxhD;
+  { 9576, 0 },  // &boxhU;
+  { 9516, 0 },  // &boxhd;
+  { 9524, 0 },  // &boxhu;
+  { 8863, 0 },  // &boxminus;
+  { 8862, 0 },  // &boxplus;
+  { 8864, 0 },  // &boxtimes;
+  { 9563, 0 },  // &boxuL;
+  { 9560, 0 },  // &boxuR;
+  { 9496, 0 },  // &boxul;
+  { 9492, 0 },  // &boxur;
+  { 9474, 0 },  // &boxv;
+  { 9578, 0 },  // &boxvH;
+  { 9569, 0 },  // &boxvL;
+  { 9566, 0 },  // &boxvR;
+  { 9532, 0 },  // &boxvh;
+  { 9508, 0 },  // &boxvl;
+  { 9500, 0 },  // &boxvr;
+  { 8245, 0 },  // &bprime;
+  { 728, 0 },  // &breve;
+  { 166, 0 },  // &brvbar;
+  { 119991, 0 },  // &bscr;
+  { 8271, 0 },  // &bsemi;
+  { 8765, 0 },  // &bsim;
+  { 8909, 0 },  // &bsime;
+  { 92, 0 },  // &bsol;
+  { 10693, 0 },  // &bsolb;
+  { 10184, 0 },  // &bsolhsub;
+  { 8226, 0 },  // &bull;
+  { 8226, 0 },  // &bullet;
+  { 8782, 0 },  // &bump;
+  { 10926, 0 },  // &bumpE;
+  { 8783, 0 },  // &bumpe;
+  { 8783, 0 },  // &bumpeq;
+  { 263, 0 },  // &cacute;
+  { 8745, 0 },  // &cap;
+  { 10820, 0 },  // &capand;
+  { 10825, 0 },  // &capbrcup;
+  { 10827, 0 },  // &capcap;
+  { 10823, 0 },  // &capcup;
+  { 10816, 0 },  // &capdot;
+  { 8745, 65024 },  // &caps;
+  { 8257, 0 },  // &caret;
+  { 711, 0 },  // &caron;
+  { 10829, 0 },  // &ccaps;
+  { 269, 0 },  // &ccaron;
+  { 231, 0 },  // &ccedil;
+  { 265, 0 },  // &ccirc;
+  { 10828, 0 },  // &ccups;
+  { 10832, 0 },  // &ccupssm;
+  { 267, 0 },  // &cdot;
+  { 184, 0 },  // &cedil;
+  { 10674, 0 },  // &cemptyv;
+  { 162, 0 },  // &cent;
+  { 183, 0 },  // &centerdot;
+  { 120096, 0 },  // &cfr;
+  { 1095, 0 },  // &chcy;
+  { 10003, 0 },  // &check;
+  { 10003, 0 },  // &checkmark;
+  { 967, 0 },  // &chi;
+  { 9675, 0 },  // &cir;
+  { 10691, 0 },  // &cirE;
+  { 710, 0 },  // &circ;
+  { 8791, 0 },  // &circeq;
+  { 8634, 0 },  // &circlearrowleft;
+  { 8635, 0 },  // &circlearrowright;
+  { 174, 0 },  // &circledR;
+  { 9416, 0 },  // &circledS;
+  { 8859, 0 },  // &circledast;
+  { 8858, 0 },  // &circledcirc;
+  { 8861, 0 },  // &circleddash;
+  { 8791, 0 },  // &cire;
+  { 10768, 0 },  // &cirfnint;
+  { 10991, 0 },  // &cirmid;
+  { 10690, 0 },  // &cirscir;
+  { 9827, 0 },  // &clubs;
+  { 9827, 0 },  // &clubsuit;
+  { 58, 0 },  // &colon;
+  { 8788, 0 },  // &colone;
+  { 8788, 0 },  // &coloneq;
+  { 44, 0 },  // &comma;
+  { 64, 0 },  // &commat;
+  { 8705, 0 },  // &comp;
+  { 8728, 0 },  // &compfn;
+  { 8705, 0 },  // &complement;
+  { 8450, 0 },  // &complexes;
+  { 8773, 0 },  // &cong;
+  { 10861, 0 },  // &congdot;
+  { 8750, 0 },  // &conint;
+  { 120148, 0 },  // &copf;
+  { 8720, 0 },  // &coprod;
+  { 169, 0 },  // &copy;
+  { 8471, 0 },  // &copysr;
+  { 8629, 0 },  // &crarr;
+  { 10007, 0 },  // &cross;
+  { 119992, 0 },  // &cscr;
+  { 10959, 0 },  // &csub;
+  { 10961, 0 },  // &csube;
+  { 10960, 0 },  // &csup;
+  { 10962, 0 },  // &csupe;
+  { 8943, 0 },  // &ctdot;
+  { 10552, 0 },  // &cudarrl;
+  { 10549, 0 },  // &cudarrr;
+  { 8926, 0 },  // &cuepr;
+  { 8927, 0 },  // &cuesc;
+  { 8630, 0 },  // &cularr;
+  { 10557, 0 },  // &cularrp;
+  { 8746, 0 },  // &cup;
+  { 10824, 0 },  // &cupbrcap;
+  { 10822, 0 },  // &cupcap;
+  { 10826, 0 },  // &cupcup;
+  { 8845, 0 },  // &cupdot;
+  { 10821, 0 },  // &cupor;
+  { 8746, 65024 },  // &cups;
+  { 8631, 0 },  // &curarr;
+  { 10556, 0 },  // &curarrm;
+  { 8926, 0 },  // &curlyeqprec;
+  { 8927, 0 },  // &curlyeqsucc;
+  { 8910, 0 },  // &curlyvee;
+  { 8911, 0 },  // &curlywedge;
+  { 164, 0 },  // &curren;
+  { 8630, 0 },  // &curvearrowleft;
+  { 8631, 0 },  // &curvearrowright;
+  { 8910, 0 },  // &cuvee;
+  { 8911, 0 },  // &cuwed;
+  { 8754, 0 },  // &cwconint;
+  { 8753, 0 },  // &cwint;
+  { 9005, 0 },  // &cylcty;
+  { 8659, 0 },  // &dArr;
+  { 10597, 0 },  // &dHar;
+  { 8224, 0 },  // &dagger;
+  { 8504, 0 },  // &daleth;
+  { 8595, 0 },  // &darr;
+  { 8208, 0 },  // &dash;
+  { 8867, 0 },  // &dashv;
+  { 10511, 0 },  // &dbkarow;
+  { 733, 0 },  // &dblac;
+  { 271, 0 },  // &dcaron;
+  { 1076, 0 },  // &dcy;
+  { 8518, 0 },  // &dd;
+  { 8225, 0 },  // &ddagger;
+  { 8650, 0 },  // &ddarr;
+  { 10871, 0 },  // &ddotseq;
+  { 176, 0 },  // &deg;
+  { 948, 0 },  // &delta;
+  { 10673, 0 },  // &demptyv;
+  { 10623, 0 },  // &dfisht;
+  { 120097, 0 },  // &dfr;
+  { 8643, 0 },  // &dharl;
+  { 8642, 0 },  // &dharr;
+  { 8900, 0 },  // &diam;
+  { 8900, 0 },  // &diamond;
+  { 9830, 0 },  // &diamondsuit;
+  { 9830, 0 },  // &diams;
+  { 168, 0 },  // &die;
+  { 989, 0 },  // &digamma;
+  { 8946, 0 },  // &disin;
+  { 247, 0 },  // &div;
+  { 247, 0 },  // &divide;
+  { 8903, 0 },  // &divideontimes;
+  { 8903, 0 },  // &divonx;
+  { 1106, 0 },  // &djcy;
+  { 8990, 0 },  // &dlcorn;
+  { 8973, 0 },  // &dlcrop;
+  { 36, 0 },  // &dollar;
+  { 120149, 0 },  // &dopf;
+  { 729, 0 },  // &dot;
+  { 8784, 0 },  // &doteq;
+  { 8785, 0 },  // &doteqdot;
+  { 8760, 0 },  // &dotminus;
+  { 8724, 0 },  // &dotplus;
+  { 8865, 0 },  // &dotsquare;
+  { 8966, 0 },  // &doublebarwedge;
+  { 8595, 0 },  // &downarrow;
+  { 8650, 0 },  // &downdownarrows;
+  { 8643, 0 },  // &downharpoonleft;
+  { 8642, 0 },  // &downharpoonright;
+  { 10512, 0 },  // &drbkarow;
+  { 8991, 0 },  // &drcorn;
+  { 8972, 0 },  // &drcrop;
+  { 119993, 0 },  // &dscr;
+  { 1109, 0 },  // &dscy;
+  { 10742, 0 },  // &dsol;
+  { 273, 0 },  // &dstrok;
+  { 8945, 0 },  // &dtdot;
+  { 9663, 0 },  // &dtri;
+  { 9662, 0 },  // &dtrif;
+  { 8693, 0 },  // &duarr;
+  { 10607, 0 },  // &duhar;
+  { 10662, 0 },  // &dwangle;
+  { 1119, 0 },  // &dzcy;
+  { 10239, 0 },  // &dzigrarr;
+  { 10871, 0 },  // &eDDot;
+  { 8785, 0 },  // &eDot;
+  { 233, 0 },  // &eacute;
+  { 10862, 0 },  // &easter;
+  { 283, 0 },  // &ecaron;
+  { 8790, 0 },  // &ecir;
+  { 234, 0 },  // &ecirc;
+  { 8789, 0 },  // &ecolon;
+  { 1101, 0 },  // &ecy;
+  { 279, 0 },  // &edot;
+  { 8519, 0 },  // &ee;
+  { 8786, 0 },  // &efDot;
+  { 120098, 0 },  // &efr;
+  { 10906, 0 },  // &eg;
+  { 232, 0 },  // &egrave;
+  { 10902, 0 },  // &egs;
+  { 10904, 0 },  // &egsdot;
+  { 10905, 0 },  // &el;
+  { 9191, 0 },  // &elinters;
+  { 8467, 0 },  // &ell;
+  { 10901, 0 },  // &els;
+  { 10903, 0 },  // &elsdot;
+  { 275, 0 },  // &emacr;
+  { 8709, 0 },  // &empty;
+  { 8709, 0 },  // &emptyset;
+  { 8709, 0 },  // &emptyv;
+  { 8196, 0 },  // &emsp13;
+  { 8197, 0 },  // &emsp14;
+  { 8195, 0 },  // &emsp;
+  { 331, 0 },  // &eng;
+  { 8194, 0 },  // &ensp;
+  { 281, 0 },  // &eogon;
+  { 120150, 0 },  // &eopf;
+  { 8917, 0 },  // &epar;
+  { 10723, 0 },  // &eparsl;
+  { 10865, 0 },  // &eplus;
+  { 949, 0 },  // &epsi;
+  { 949, 0 },  // &epsilon;
+  { 1013, 0 },  // &epsiv;
+  { 8790, 0 },  // &eqcirc;
+  { 8789, 0 },  // &eqcolon;
+  { 8770, 0 },  // &eqsim;
+  { 10902, 0 },  // &eqslantgtr;
+  { 10901, 0 },  // &eqslantless;
+  { 61, 0 },  // &equals;
+  { 8799, 0 },  // &equest;
+  { 8801, 0 },  // &equiv;
+  { 10872, 0 },  // &equivDD;
+  { 10725, 0 },  // &eqvparsl;
+  { 8787, 0 },  // &erDot;
+  { 10609, 0 },  // &erarr;
+  { 8495, 0 },  // &escr;
+  { 8784, 0 },  // &esdot;
+  { 8770, 0 },  // &esim;
+  { 951, 0 },  // &eta;
+  { 240, 0 },  // &eth;
+  { 235, 0 },  // &euml;
+  { 8364, 0 },  // &euro;
+  { 33, 0 },  // &excl;
+  { 8707, 0 },  // &exist;
+  { 8496, 0 },  // &expectation;
+  { 8519, 0 },  // &exponentiale;
+  { 8786, 0 },  // &fallingdotseq;
+  { 1092, 0 },  // &fcy;
+  { 9792, 0 },  // &female;
+  { 64259, 0 },  // &ffilig;
+  { 64256, 0 },  // &fflig;
+  { 64260, 0 },  // &ffllig;
+  { 120099, 0 },  // &ffr;
+  { 64257, 0 },  // &filig;
+  { 102, 106 },  // &fjlig;
+  { 9837, 0 },  // &flat;
+  { 64258, 0 },  // &fllig;
+  { 9649, 0 },  // &fltns;
+  { 402, 0 },  // &fnof;
+  { 120151, 0 },  // &fopf;
+  { 8704, 0 },  // &forall;
+  { 8916, 0 },  // &fork;
+  { 10969, 0 },  // &forkv;
+  { 10765, 0 },  // &fpartint;
+  { 189, 0 },  // &frac12;
+  { 8531, 0 },  // &frac13;
+  { 188, 0 },  // &frac14;
+  { 8533, 0 },  // &frac15;
+  { 8537, 0 },  // &frac16;
+  { 8539, 0 },  // &frac18;
+  { 8532, 0 },  // &frac23;
+  { 8534, 0 },  // &frac25;
+  { 190, 0 },  // &frac34;
+  { 8535, 0 },  // &frac35;
+  { 8540, 0 },  // &frac38;
+  { 8536, 0 },  // &frac45;
+  { 8538, 0 },  // &frac56;
+  { 8541, 0 },  // &frac58;
+  { 8542, 0 },  // &frac78;
+  { 8260, 0 },  // &frasl;
+  { 8994, 0 },  // &frown;
+  { 119995, 0 },  // &fscr;
+  { 8807, 0 },  // &gE;
+  { 10892, 0 },  // &gEl;
+  { 501, 0 },  // &gacute;
+  { 947, 0 },  // &gamma;
+  { 989, 0 },  // &gammad;
+  { 10886, 0 },  // &gap;
+  { 287, 0 },  // &gbreve;
+  { 285, 0 },  // &gcirc;
+  { 1075, 0 },  // &gcy;
+  { 289, 0 },  // &gdot;
+  { 8805, 0 },  // &ge;
+  { 8923, 0 },  // &gel;
+  { 8805, 0 },  // &geq;
+  { 8807, 0 },  // &geqq;
+  { 10878, 0 },  // &geqslant;
+  { 10878, 0 },  // &ges;
+  { 10921, 0 },  // &gescc;
+  { 10880, 0 },  // &gesdot;
+  { 10882, 0 },  // &gesdoto;
+  { 10884, 0 },  // &gesdotol;
+  { 8923, 65024 },  // &gesl;
+  { 10900, 0 },  // &gesles;
+  { 120100, 0 },  // &gfr;
+  { 8811, 0 },  // &gg;
+  { 8921, 0 },  // &ggg;
+  { 8503, 0 },  // &gimel;
+  { 1107, 0 },  // &gjcy;
+  { 8823, 0 },  // &gl;
+  { 10898, 0 },  // &glE;
+  { 10917, 0 },  // &gla;
+  { 10916, 0 },  // &glj;
+  { 8809, 0 },  // &gnE;
+  { 10890, 0 },  // &gnap;
+  { 10890, 0 },  // &gnapprox;
+  { 10888, 0 },  // &gne;
+  { 10888, 0 },  // &gneq;
+  { 8809, 0 },  // &gneqq;
+  { 8935, 0 },  // &gnsim;
+  { 120152, 0 },  // &gopf;
+  { 96, 0 },  // &grave;
+  { 8458, 0 },  // &gscr;
+  { 8819, 0 },  // &gsim;
+  { 10894, 0 },  // &gsime;
+  { 10896, 0 },  // &gsiml;
+  { 62, 0 },  // &gt;
+  { 10919, 0 },  // &gtcc;
+  { 10874, 0 },  // &gtcir;
+  { 8919, 0 },  // &gtdot;
+  { 10645, 0 },  // &gtlPar;
+  { 10876, 0 },  // &gtquest;
+  { 10886, 0 },  // &gtrapprox;
+  { 10616, 0 },  // &gtrarr;
+  { 8919, 0 },  // &gtrdot;
+  { 8923, 0 },  // &gtreqless;
+  { 10892, 0 },  // &gtreqqless;
+  { 8823, 0 },  // &gtrless;
+  { 8819, 0 },  // &gtrsim;
+  { 8809, 65024 },  // &gvertneqq;
+  { 8809, 65024 },  // &gvnE;
+  { 8660, 0 },  // &hArr;
+  { 8202, 0 },  // &hairsp;
+  { 189, 0 },  // &half;
+  { 8459, 0 },  // &hamilt;
+  { 1098, 0 },  // &hardcy;
+  { 8596, 0 },  // &harr;
+  { 10568, 0 },  // &harrcir;
+  { 8621, 0 },  // &harrw;
+  { 8463, 0 },  // &hbar;
+  { 293, 0 },  // &hcirc;
+  { 9829, 0 },  // &hearts;
+  { 9829, 0 },  // &heartsuit;
+  { 8230, 0 },  // &hellip;
+  { 8889, 0 },  // &hercon;
+  { 120101, 0 },  // &hfr;
+  { 10533, 0 },  // &hksearow;
+  { 10534, 0 },  // &hkswarow;
+  { 8703, 0 },  // &hoarr;
+  { 8763, 0 },  // &homtht;
+  { 8617, 0 },  // &hookleftarrow;
+  { 8618, 0 },  // &hookrightarrow;
+  { 120153, 0 },  // &hopf;
+  { 8213, 0 },  // &horbar;
+  { 119997, 0 },  // &hscr;
+  { 8463, 0 },  // &hslash;
+  { 295, 0 },  // &hstrok;
+  { 8259, 0 },  // &hybull;
+  { 8208, 0 },  // &hyphen;
+  { 237, 0 },  // &iacute;
+  { 8291, 0 },  // &ic;
+  { 238, 0 },  // &icirc;
+  { 1080, 0 },  // &icy;
+  { 1077, 0 },  // &iecy;
+  { 161, 0 },  // &iexcl;
+  { 8660, 0 },  // &iff;
+  { 120102, 0 },  // &ifr;
+  { 236, 0 },  // &igrave;
+  { 8520, 0 },  // &ii;
+  { 10764, 0 },  // &iiiint;
+  { 8749, 0 },  // &iiint;
+  { 10716, 0 },  // &iinfin;
+  { 8489, 0 },  // &iiota;
+  { 307, 0 },  // &ijlig;
+  { 299, 0 },  // &imacr;
+  { 8465, 0 },  // &image;
+  { 8464, 0 },  // &imagline;
+  { 8465, 0 },  // &imagpart;
+  { 305, 0 },  // &imath;
+  { 8887, 0 },  // &imof;
+  { 437, 0 },  // &imped;
+  { 8712, 0 },  // &in;
+  { 8453, 0 },  // &incare;
+  { 8734, 0 },  // &infin;
+  { 10717, 0 },  // &infintie;
+  { 305, 0 },  // &inodot;
+  { 8747, 0 },  // &int;
+  { 8890, 0 },  // &intcal;
+  { 8484, 0 },  // &integers;
+  { 8890, 0 },  // &intercal;
+  { 10775, 0 },  // &intlarhk;
+  { 10812, 0 },  // &intprod;
+  { 1105, 0 },  // &iocy;
+  { 303, 0 },  // &iogon;
+  { 120154, 0 },  // &iopf;
+  { 953, 0 },  // &iota;
+  { 10812, 0 },  // &iprod;
+  { 191, 0 },  // &iquest;
+  { 119998, 0 },  // &iscr;
+  { 8712, 0 },  // &isin;
+  { 8953, 0 },  // &isinE;
+  { 8949, 0 },  // &isindot;
+  { 8948, 0 },  // &isins;
+  { 8947, 0 },  // &isinsv;
+  { 8712, 0 },  // &isinv;
+  { 8290, 0 },  // &it;
+  { 297, 0 },  // &itilde;
+  { 1110, 0 },  // &iukcy;
+  { 239, 0 },  // &iuml;
+  { 309, 0 },  // &jcirc;
+  { 1081, 0 },  // &jcy;
+  { 120103, 0 },  // &jfr;
+  { 567, 0 },  // &jmath;
+  { 120155, 0 },  // &jopf;
+  { 119999, 0 },  // &jscr;
+  { 1112, 0 },  // &jsercy;
+  { 1108, 0 },  // &jukcy;
+  { 954, 0 },  // &kappa;
+  { 1008, 0 },  // &kappav;
+  { 311, 0 },  // &kcedil;
+  { 1082, 0 },  // &kcy;
+  { 120104, 0 },  // &kfr;
+  { 312, 0 },  // &kgreen;
+  { 1093, 0 },  // &khcy;
+  { 1116, 0 },  // &kjcy;
+  { 120156, 0 },  // &kopf;
+  { 120000, 0 },  // &kscr;
+  { 8666, 0 },  // &lAarr;
+  { 8656, 0 },  // &lArr;
+  { 10523, 0 },  // &lAtail;
+  { 10510, 0 },  // &lBarr;
+  { 8806, 0 },  // &lE;
+  { 10891, 0 },  // &lEg;
+  { 10594, 0 },  // &lHar;
+  { 314, 0 },  // &lacute;
+  { 10676, 0 },  // &laemptyv;
+  { 8466, 0 },  // &lagran;
+  { 955, 0 },  // &lambda;
+  { 10216, 0 },  // &lang;
+  { 10641, 0 },  // &langd;
+  { 10216, 0 },  // &langle;
+  { 10885, 0 },  // &lap;
+  { 171, 0 },  // &laquo;
+  { 8592, 0 },  // &larr;
+  { 8676, 0 },  // &larrb;
+  { 10527, 0 },  // &larrbfs;
+  { 10525, 0 },  // &larrfs;
+  { 8617, 0 },  // &larrhk;
+  { 8619, 0 },  // &larrlp;
+  { 10553, 0 },  // &larrpl;
+  { 10611, 0 },  // &larrsim;
+  { 8610, 0 },  // &larrtl;
+  { 10923, 0 },  // &lat;
+  { 10521, 0 },  // &latail;
+  { 10925, 0 },  // &late;
+  { 10925, 65024 },  // &lates;
+  { 10508, 0 },  // &lbarr;
+  { 10098, 0 },  // &lbbrk;
+  { 123, 0 },  // &lbrace;
+  { 91, 0 },  // &lbrack;
+  { 10635, 0 },  // &lbrke;
+  { 10639, 0 },  // &lbrksld;
+  { 10637, 0 },  // &lbrkslu;
+  { 318, 0 },  // &lcaron;
+  { 316, 0 },  // &lcedil;
+  { 8968, 0 },  // &lceil;
+  { 123, 0 },  // &lcub;
+  { 1083, 0 },  // &lcy;
+  { 10550, 0 },  // &ldca;
+  { 8220, 0 },  // &ldquo;
+  { 8222, 0 },  // &ldquor;
+  { 10599, 0 },  // &ldrdhar;
+  { 10571, 0 },  // &ldrushar;
+  { 8626, 0 },  // &ldsh;
+  { 8804, 0 },  // &le;
+  { 8592, 0 },  // &leftarrow;
+  { 8610, 0 },  // &leftarrowtail;
+  { 8637, 0 },  // &leftharpoondown;
+  { 8636, 0 },  // &leftharpoonup;
+  { 8647, 0 },  // &leftleftarrows;
+  { 8596, 0 },  // &leftrightarrow;
+  { 8646, 0 },  // &leftrightarrows;
+  { 8651, 0 },  // &leftrightharpoons;
+  { 8621, 0 },  // &leftrightsquigarrow;
+  { 8907, 0 },  // &leftthreetimes;
+  { 8922, 0 },  // &leg;
+  { 8804, 0 },  // &leq;
+  { 8806, 0 },  // &leqq;
+  { 10877, 0 },  // &leqslant;
+  { 10877, 0 },  // &les;
+  { 10920, 0 },  // &lescc;
+  { 10879, 0 },  // &lesdot;
+  { 10881, 0 },  // &lesdoto;
+  { 10883, 0 },  // &lesdotor;
+  { 8922, 65024 },  // &lesg;
+  { 10899, 0 },  // &lesges;
+  { 10885, 0 },  // &lessapprox;
+  { 8918, 0 },  // &lessdot;
+  { 8922, 0 },  // &lesseqgtr;
+  { 10891, 0 },  // &lesseqqgtr;
+  { 8822, 0 },  // &lessgtr;
+  { 8818, 0 },  // &lesssim;
+  { 10620, 0 },  // &lfisht;
+  { 8970, 0 },  // &lfloor;
+  { 120105, 0 },  // &lfr;
+  { 8822, 0 },  // &lg;
+  { 10897, 0 },  // &lgE;
+  { 8637, 0 },  // &lhard;
+  { 8636, 0 },  // &lharu;
+  { 10602, 0 },  // &lharul;
+  { 9604, 0 },  // &lhblk;
+  { 1113, 0 },  // &ljcy;
+  { 8810, 0 },  // &ll;
+  { 8647, 0 },  // &llarr;
+  { 8990, 0 },  // &llcorner;
+  { 10603, 0 },  // &llhard;
+  { 9722, 0 },  // &lltri;
+  { 320, 0 },  // &lmidot;
+  { 9136, 0 },  // &lmoust;
+  { 9136, 0 },  // &lmoustache;
+  { 8808, 0 },  // &lnE;
+  { 10889, 0 },  // &lnap;
+  { 10889, 0 },  // &lnapprox;
+  { 10887, 0 },  // &lne;
+  { 10887, 0 },  // &lneq;
+  { 8808, 0 },  // &lneqq;
+  { 8934, 0 },  // &lnsim;
+  { 10220, 0 },  // &loang;
+  { 8701, 0 },  // &loarr;
+  { 10214, 0 },  // &lobrk;
+  { 10229, 0 },  // &longleftarrow;
+  { 10231, 0 },  // &longleftrightarrow;
+  { 10236, 0 },  // &longmapsto;
+  { 10230, 0 },  // &longrightarrow;
+  { 8619, 0 },  // &looparrowleft;
+  { 8620, 0 },  // &looparrowright;
+  { 10629, 0 },  // &lopar;
+  { 120157, 0 },  // &lopf;
+  { 10797, 0 },  // &loplus;
+  { 10804, 0 },  // &lotimes;
+  { 8727, 0 },  // &lowast;
+  { 95, 0 },  // &lowbar;
+  { 9674, 0 },  // &loz;
+  { 9674, 0 },  // &lozenge;
+  { 10731, 0 },  // &lozf;
+  { 40, 0 },  // &lpar;
+  { 10643, 0 },  // &lparlt;
+  { 8646, 0 },  // &lrarr;
+  { 8991, 0 },  // &lrcorner;
+  { 8651, 0 },  // &lrhar;
+  { 10605, 0 },  // &lrhard;
+  { 8206, 0 },  // &lrm;
+  { 8895, 0 },  // &lrtri;
+  { 8249, 0 },  // &lsaquo;
+  { 120001, 0 },  // &lscr;
+  { 8624, 0 },  // &lsh;
+  { 8818, 0 },  // &lsim;
+  { 10893, 0 },  // &lsime;
+  { 10895, 0 },  // &lsimg;
+  { 91, 0 },  // &lsqb;
+  { 8216, 0 },  // &lsquo;
+  { 8218, 0 },  // &lsquor;
+  { 322, 0 },  // &lstrok;
+  { 60, 0 },  // &lt;
+  { 10918, 0 },  // &ltcc;
+  { 10873, 0 },  // &ltcir;
+  { 8918, 0 },  // &ltdot;
+  { 8907, 0 },  // &lthree;
+  { 8905, 0 },  // &ltimes;
+  { 10614, 0 },  // &ltlarr;
+  { 10875, 0 },  // &ltquest;
+  { 10646, 0 },  // &ltrPar;
+  { 9667, 0 },  // &ltri;
+  { 8884, 0 },  // &ltrie;
+  { 9666, 0 },  // &ltrif;
+  { 10570, 0 },  // &lurdshar;
+  { 10598, 0 },  // &luruhar;
+  { 8808, 65024 },  // &lvertneqq;
+  { 8808, 65024 },  // &lvnE;
+  { 8762, 0 },  // &mDDot;
+  { 175, 0 },  // &macr;
+  { 9794, 0 },  // &male;
+  { 10016, 0 },  // &malt;
+  { 10016, 0 },  // &maltese;
+  { 8614, 0 },  // &map;
+  { 8614, 0 },  // &mapsto;
+  { 8615, 0 },  // &mapstodown;
+  { 8612, 0 },  // &mapstoleft;
+  { 8613, 0 },  // &mapstoup;
+  { 9646, 0 },  // &marker;
+  { 10793, 0 },  // &mcomma;
+  { 1084, 0 },  // &mcy;
+  { 8212, 0 },  // &mdash;
+  { 8737, 0 },  // &measuredangle;
+  { 120106, 0 },  // &mfr;
+  { 8487, 0 },  // &mho;
+  { 181, 0 },  // &micro;
+  { 8739, 0 },  // &mid;
+  { 42, 0 },  // &midast;
+  { 10992, 0 },  // &midcir;
+  { 183, 0 },  // &middot;
+  { 8722, 0 },  // &minus;
+  { 8863, 0 },  // &minusb;
+  { 8760, 0 },  // &minusd;
+  { 10794, 0 },  // &minusdu;
+  { 10971, 0 },  // &mlcp;
+  { 8230, 0 },  // &mldr;
+  { 8723, 0 },  // &mnplus;
+  { 8871, 0 },  // &models;
+  { 120158, 0 },  // &mopf;
+  { 8723, 0 },  // &mp;
+  { 120002, 0 },  // &mscr;
+  { 8766, 0 },  // &mstpos;
+  { 956, 0 },  // &mu;
+  { 8888, 0 },  // &multimap;
+  { 8888, 0 },  // &mumap;
+  { 8921, 824 },  // &nGg;
+  { 8811, 8402 },  // &nGt;
+  { 8811, 824 },  // &nGtv;
+  { 8653, 0 },  // &nLeftarrow;
+  { 8654, 0 },  // &nLeftrightarrow;
+  { 8920, 824 },  // &nLl;
+  { 8810, 8402 },  // &nLt;
+  { 8810, 824 },  // &nLtv;
+  { 8655, 0 },  // &nRightarrow;
+  { 8879, 0 },  // &nVDash;
+  { 8878, 0 },  // &nVdash;
+  { 8711, 0 },  // &nabla;
+  { 324, 0 },  // &nacute;
+  { 8736, 8402 },  // &nang;
+  { 8777, 0 },  // &nap;
+  { 10864, 824 },  // &napE;
+  { 8779, 824 },  // &napid;
+  { 329, 0 },  // &napos;
+  { 8777, 0 },  // &napprox;
+  { 9838, 0 },  // &natur;
+  { 9838, 0 },  // &natural;
+  { 8469, 0 },  // &naturals;
+  { 160, 0 },  // &nbsp;
+  { 8782, 824 },  // &nbump;
+  { 8783, 824 },  // &nbumpe;
+  { 10819, 0 },  // &ncap;
+  { 328, 0 },  // &ncaron;
+  { 326, 0 },  // &ncedil;
+  { 8775, 0 },  // &ncong;
+  { 10861, 824 },  // &ncongdot;
+  { 10818, 0 },  // &ncup;
+  { 1085, 0 },  // &ncy;
+  { 8211, 0 },  // &ndash;
+  { 8800, 0 },  // &ne;
+  { 8663, 0 },  // &neArr;
+  { 10532, 0 },  // &nearhk;
+  { 8599, 0 },  // &nearr;
+  { 8599, 0 },  // &nearrow;
+  { 8784, 824 },  // &nedot;
+  { 8802, 0 },  // &nequiv;
+  { 10536, 0 },  // &nesear;
+  { 8770, 824 },  // &nesim;
+  { 8708, 0 },  // &nexist;
+  { 8708, 0 },  // &nexists;
+  { 120107, 0 },  // &nfr;
+  { 8807, 824 },  // &ngE;
+  { 8817, 0 },  // &nge;
+  { 8817, 0 },  // &ngeq;
+  { 8807, 824 },  // &ngeqq;
+  { 10878, 824 },  // &ngeqslant;
+  { 10878, 824 },  // &nges;
+  { 8821, 0 },  // &ngsim;
+  { 8815, 0 },  // &ngt;
+  { 8815, 0 },  // &ngtr;
+  { 8654, 0 },  // &nhArr;
+  { 8622, 0 },  // &nharr;
+  { 10994, 0 },  // &nhpar;
+  { 8715, 0 },  // &ni;
+  { 8956, 0 },  // &nis;
+  { 8954, 0 },  // &nisd;
+  { 8715, 0 },  // &niv;
+  { 1114, 0 },  // &njcy;
+  { 8653, 0 },  // &nlArr;
+  { 8806, 824 },  // &nlE;
+  { 8602, 0 },  // &nlarr;
+  { 8229, 0 },  // &nldr;
+  { 8816, 0 },  // &nle;
+  { 8602, 0 },  // &nleftarrow;
+  { 8622, 0 },  // &nleftrightarrow;
+  { 8816, 0 },  // &nleq;
+  { 8806, 824 },  // &nleqq;
+  { 10877, 824 },  // &nleqslant;
+  { 10877, 824 },  // &nles;
+  { 8814, 0 },  // &nless;
+  { 8820, 0 },  // &nlsim;
+  { 8814, 0 },  // &nlt;
+  { 8938, 0 },  // &nltri;
+  { 8940, 0 },  // &nltrie;
+  { 8740, 0 },  // &nmid;
+  { 120159, 0 },  // &nopf;
+  { 172, 0 },  // &not;
+  { 8713, 0 },  // &notin;
+  { 8953, 824 },  // &notinE;
+  { 8949, 824 },  // &notindot;
+  { 8713, 0 },  // &notinva;
+  { 8951, 0 },  // &notinvb;
+  { 8950, 0 },  // &notinvc;
+  { 8716, 0 },  // &notni;
+  { 8716, 0 },  // &notniva;
+  { 8958, 0 },  // &notnivb;
+  { 8957, 0 },  // &notnivc;
+  { 8742, 0 },  // &npar;
+  { 8742, 0 },  // &nparallel;
+  { 11005, 8421 },  // &nparsl;
+  { 8706, 824 },  // &npart;
+  { 10772, 0 },  // &npolint;
+  { 8832, 0 },  // &npr;
+  { 8928, 0 },  // &nprcue;
+  { 10927, 824 },  // &npre;
+  { 8832, 0 },  // &nprec;
+  { 10927, 824 },  // &npreceq;
+  { 8655, 0 },  // &nrArr;
+  { 8603, 0 },  // &nrarr;
+  { 10547, 824 },  // &nrarrc;
+  { 8605, 824 },  // &nrarrw;
+  { 8603, 0 },  // &nrightarrow;
+  { 8939, 0 },  // &nrtri;
+  { 8941, 0 },  // &nrtrie;
+  { 8833, 0 },  // &nsc;
+  { 8929, 0 },  // &nsccue;
+  { 10928, 824 },  // &nsce;
+  { 120003, 0 },  // &nscr;
+  { 8740, 0 },  // &nshortmid;
+  { 8742, 0 },  // &nshortparallel;
+  { 8769, 0 },  // &nsim;
+  { 8772, 0 },  // &nsime;
+  { 8772, 0 },  // &nsimeq;
+  { 8740, 0 },  // &nsmid;
+  { 8742, 0 },  // &nspar;
+  { 8930, 0 },  // &nsqsube;
+  { 8931, 0 },  // &nsqsupe;
+  { 8836, 0 },  // &nsub;
+  { 10949, 824 },  // &nsubE;
+  { 8840, 0 },  // &nsube;
+  { 8834, 8402 },  // &nsubset;
+  { 8840, 0 },  // &nsubseteq;
+  { 10949, 824 },  // &nsubseteqq;
+  { 8833, 0 },  // &nsucc;
+  { 10928, 824 },  // &nsucceq;
+  { 8837, 0 },  // &nsup;
+  { 10950, 824 },  // &nsupE;
+  { 8841, 0 },  // &nsupe;
+  { 8835, 8402 },  // &nsupset;
+  { 8841, 0 },  // &nsupseteq;
+  { 10950, 824 },  // &nsupseteqq;
+  { 8825, 0 },  // &ntgl;
+  { 241, 0 },  // &ntilde;
+  { 8824, 0 },  // &ntlg;
+  { 8938, 0 },  // &ntriangleleft;
+  { 8940, 0 },  // &ntrianglelefteq;
+  { 8939, 0 },  // &ntriangleright;
+  { 8941, 0 },  // &ntrianglerighteq;
+  { 957, 0 },  // &nu;
+  { 35, 0 },  // &num;
+  { 8470, 0 },  // &numero;
+  { 8199, 0 },  // &numsp;
+  { 8877, 0 },  // &nvDash;
+  { 10500, 0 },  // &nvHarr;
+  { 8781, 8402 },  // &nvap;
+  { 8876, 0 },  // &nvdash;
+  { 8805, 8402 },  // &nvge;
+  { 62, 8402 },  // &nvgt;
+  { 10718, 0 },  // &nvinfin;
+  { 10498, 0 },  // &nvlArr;
+  { 8804, 8402 },  // &nvle;
+  { 60, 8402 },  // &nvlt;
+  { 8884, 8402 },  // &nvltrie;
+  { 10499, 0 },  // &nvrArr;
+  { 8885, 8402 },  // &nvrtrie;
+  { 8764, 8402 },  // &nvsim;
+  { 8662, 0 },  // &nwArr;
+  { 10531, 0 },  // &nwarhk;
+  { 8598, 0 },  // &nwarr;
+  { 8598, 0 },  // &nwarrow;
+  { 10535, 0 },  // &nwnear;
+  { 9416, 0 },  // &oS;
+  { 243, 0 },  // &oacute;
+  { 8859, 0 },  // &oast;
+  { 8858, 0 },  // &ocir;
+  { 244, 0 },  // &ocirc;
+  { 1086, 0 },  // &ocy;
+  { 8861, 0 },  // &odash;
+  { 337, 0 },  // &odblac;
+  { 10808, 0 },  // &odiv;
+  { 8857, 0 },  // &odot;
+  { 10684, 0 },  // &odsold;
+  { 339, 0 },  // &oelig;
+  { 10687, 0 },  // &ofcir;
+  { 120108, 0 },  // &ofr;
+  { 731, 0 },  // &ogon;
+  { 242, 0 },  // &ograve;
+  { 10689, 0 },  // &ogt;
+  { 10677, 0 },  // &ohbar;
+  { 937, 0 },  // &ohm;
+  { 8750, 0 },  // &oint;
+  { 8634, 0 },  // &olarr;
+  { 10686, 0 },  // &olcir;
+  { 10683, 0 },  // &olcross;
+  { 8254, 0 },  // &oline;
+  { 10688, 0 },  // &olt;
+  { 333, 0 },  // &omacr;
+  { 969, 0 },  // &omega;
+  { 959, 0 },  // &omicron;
+  { 10678, 0 },  // &omid;
+  { 8854, 0 },  // &ominus;
+  { 120160, 0 },  // &oopf;
+  { 10679, 0 },  // &opar;
+  { 10681, 0 },  // &operp;
+  { 8853, 0 },  // &oplus;
+  { 8744, 0 },  // &or;
+  { 8635, 0 },  // &orarr;
+  { 10845, 0 },  // &ord;
+  { 8500, 0 },  // &order;
+  { 8500, 0 },  // &orderof;
+  { 170, 0 },  // &ordf;
+  { 186, 0 },  // &ordm;
+  { 8886, 0 },  // &origof;
+  { 10838, 0 },  // &oror;
+  { 10839, 0 },  // &orslope;
+  { 10843, 0 },  // &orv;
+  { 8500, 0 },  // &oscr;
+  { 248, 0 },  // &oslash;
+  { 8856, 0 },  // &osol;
+  { 245, 0 },  // &otilde;
+  { 8855, 0 },  // &otimes;
+  { 10806, 0 },  // &otimesas;
+  { 246, 0 },  // &ouml;
+  { 9021, 0 },  // &ovbar;
+  { 8741, 0 },  // &par;
+  { 182, 0 },  // &para;
+  { 8741, 0 },  // &parallel;
+  { 10995, 0 },  // &parsim;
+  { 11005, 0 },  // &parsl;
+  { 8706, 0 },  // &part;
+  { 1087, 0 },  // &pcy;
+  { 37, 0 },  // &percnt;
+  { 46, 0 },  // &period;
+  { 8240, 0 },  // &permil;
+  { 8869, 0 },  // &perp;
+  { 8241, 0 },  // &pertenk;
+  { 120109, 0 },  // &pfr;
+  { 966, 0 },  // &phi;
+  { 981, 0 },  // &phiv;
+  { 8499, 0 },  // &phmmat;
+  { 9742, 0 },  // &phone;
+  { 960, 0 },  // &pi;
+  { 8916, 0 },  // &pitchfork;
+  { 982, 0 },  // &piv;
+  { 8463, 0 },  // &planck;
+  { 8462, 0 },  // &planckh;
+  { 8463, 0 },  // &plankv;
+  { 43, 0 },  // &plus;
+  { 10787, 0 },  // &plusacir;
+  { 8862, 0 },  // &plusb;
+  { 10786, 0 },  // &pluscir;
+  { 8724, 0 },  // &plusdo;
+  { 10789, 0 },  // &plusdu;
+  { 10866, 0 },  // &pluse;
+  { 177, 0 },  // &plusmn;
+  { 10790, 0 },  // &plussim;
+  { 10791, 0 },  // &plustwo;
+  { 177, 0 },  // &pm;
+  { 10773, 0 },  // &pointint;
+  { 120161, 0 },  // &popf;
+  { 163, 0 },  // &pound;
+  { 8826, 0 },  // &pr;
+  { 10931, 0 },  // &prE;
+  { 10935, 0 },  // &prap;
+  { 8828, 0 },  // &prcue;
+  { 10927, 0 },  // &pre;
+  { 8826, 0 },  // &prec;
+  { 10935, 0 },  // &precapprox;
+  { 8828, 0 },  // &preccurlyeq;
+  { 10927, 0 },  // &preceq;
+  { 10937, 0 },  // &precnapprox;
+  { 10933, 0 },  // &precneqq;
+  { 8936, 0 },  // &precnsim;
+  { 8830, 0 },  // &precsim;
+  { 8242, 0 },  // &prime;
+  { 8473, 0 },  // &primes;
+  { 10933, 0 },  // &prnE;
+  { 10937, 0 },  // &prnap;
+  { 8936, 0 },  // &prnsim;
+  { 8719, 0 },  // &prod;
+  { 9006, 0 },  // &profalar;
+  { 8978, 0 },  // &profline;
+  { 8979, 0 },  // &profsurf;
+  { 8733, 0 },  // &prop;
+  { 8733, 0 },  // &propto;
+  { 8830, 0 },  // &prsim;
+  { 8880, 0 },  // &prurel;
+  { 120005, 0 },  // &pscr;
+  { 968, 0 },  // &psi;
+  { 8200, 0 },  // &puncsp;
+  { 120110, 0 },  // &qfr;
+  { 10764, 0 },  // &qint;
+  { 120162, 0 },  // &qopf;
+  { 8279, 0 },  // &qprime;
+  { 120006, 0 },  // &qscr;
+  { 8461, 0 },  // &quaternions;
+  { 10774, 0 },  // &quatint;
+  { 63, 0 },  // &quest;
+  { 8799, 0 },  // &questeq;
+  { 34, 0 },  // &quot;
+  { 8667, 0 },  // &rAarr;
+  { 8658, 0 },  // &rArr;
+  { 10524, 0 },  // &rAtail;
+  { 10511, 0 },  // &rBarr;
+  { 10596, 0 },  // &rHar;
+  { 8765, 817 },  // &race;
+  { 341, 0 },  // &racute;
+  { 8730, 0 },  // &radic;
+  { 10675, 0 },  // &raemptyv;
+  { 10217, 0 },  // &rang;
+  { 10642, 0 },  // &rangd;
+  { 10661, 0 },  // &range;
+  { 10217, 0 },  // &rangle;
+  { 187, 0 },  // &raquo;
+  { 8594, 0 },  // &rarr;
+  { 10613, 0 },  // &rarrap;
+  { 8677, 0 },  // &rarrb;
+  { 10528, 0 },  // &rarrbfs;
+  { 10547, 0 },  // &rarrc;
+  { 10526, 0 },  // &rarrfs;
+  { 8618, 0 },  // &rarrhk;
+  { 8620, 0 },  // &rarrlp;
+  { 10565, 0 },  // &rarrpl;
+  { 10612, 0 },  // &rarrsim;
+  { 8611, 0 },  // &rarrtl;
+  { 8605, 0 },  // &rarrw;
+  { 10522, 0 },  // &ratail;
+  { 8758, 0 },  // &ratio;
+  { 8474, 0 },  // &rationals;
+  { 10509, 0 },  // &rbarr;
+  { 10099, 0 },  // &rbbrk;
+  { 125, 0 },  // &rbrace;
+  { 93, 0 },  // &rbrack;
+  { 10636, 0 },  // &rbrke;
+  { 10638, 0 },  // &rbrksld;
+  { 10640, 0 },  // &rbrkslu;
+  { 345, 0 },  // &rcaron;
+  { 343, 0 },  // &rcedil;
+  { 8969, 0 },  // &rceil;
+  { 125, 0 },  // &rcub;
+  { 1088, 0 },  // &rcy;
+  { 10551, 0 },  // &rdca;
+  { 10601, 0 },  // &rdldhar;
+  { 8221, 0 },  // &rdquo;
+  { 8221, 0 },  // &rdquor;
+  { 8627, 0 },  // &rdsh;
+  { 8476, 0 },  // &real;
+  { 8475, 0 },  // &realine;
+  { 8476, 0 },  // &realpart;
+  { 8477, 0 },  // &reals;
+  { 9645, 0 },  // &rect;
+  { 174, 0 },  // &reg;
+  { 10621, 0 },  // &rfisht;
+  { 8971, 0 },  // &rfloor;
+  { 120111, 0 },  // &rfr;
+  { 8641, 0 },  // &rhard;
+  { 8640, 0 },  // &rharu;
+  { 10604, 0 },  // &rharul;
+  { 961, 0 },  // &rho;
+  { 1009, 0 },  // &rhov;
+  { 8594, 0 },  // &rightarrow;
+  { 8611, 0 },  // &rightarrowtail;
+  { 8641, 0 },  // &rightharpoondown;
+  { 8640, 0 },  // &rightharpoonup;
+  { 8644, 0 },  // &rightleftarrows;
+  { 8652, 0 },  // &rightleftharpoons;
+  { 8649, 0 },  // &rightrightarrows;
+  { 8605, 0 },  // &rightsquigarrow;
+  { 8908, 0 },  // &rightthreetimes;
+  { 730, 0 },  // &ring;
+  { 8787, 0 },  // &risingdotseq;
+  { 8644, 0 },  // &rlarr;
+  { 8652, 0 },  // &rlhar;
+  { 8207, 0 },  // &rlm;
+  { 9137, 0 },  // &rmoust;
+  { 9137, 0 },  // &rmoustache;
+  { 10990, 0 },  // &rnmid;
+  { 10221, 0 },  // &roang;
+  { 8702, 0 },  // &roarr;
+  { 10215, 0 },  // &robrk;
+  { 10630, 0 },  // &ropar;
+  { 120163, 0 },  // &ropf;
+  { 10798, 0 },  // &roplus;
+  { 10805, 0 },  // &rotimes;
+  { 41, 0 },  // &rpar;
+  { 10644, 0 },  // &rpargt;
+  { 10770, 0 },  // &rppolint;
+  { 8649, 0 },  // &rrarr;
+  { 8250, 0 },  // &rsaquo;
+  { 120007, 0 },  // &rscr;
+  { 8625, 0 },  // &rsh;
+  { 93, 0 },  // &rsqb;
+  { 8217, 0 },  // &rsquo;
+  { 8217, 0 },  // &rsquor;
+  { 8908, 0 },  // &rthree;
+  { 8906, 0 },  // &rtimes;
+  { 9657, 0 },  // &rtri;
+  { 8885, 0 },  // &rtrie;
+  { 9656, 0 },  // &rtrif;
+  { 10702, 0 },  // &rtriltri;
+  { 10600, 0 },  // &ruluhar;
+  { 8478, 0 },  // &rx;
+  { 347, 0 },  // &sacute;
+  { 8218, 0 },  // &sbquo;
+  { 8827, 0 },  // &sc;
+  { 10932, 0 },  // &scE;
+  { 10936, 0 },  // &scap;
+  { 353, 0 },  // &scaron;
+  { 8829, 0 },  // &sccue;
+  { 10928, 0 },  // &sce;
+  { 351, 0 },  // &scedil;
+  { 349, 0 },  // &scirc;
+  { 10934, 0 },  // &scnE;
+  { 10938, 0 },  // &scnap;
+  { 8937, 0 },  // &scnsim;
+  { 10771, 0 },  // &scpolint;
+  { 8831, 0 },  // &scsim;
+  { 1089, 0 },  // &scy;
+  { 8901, 0 },  // &sdot;
+  { 8865, 0 },  // &sdotb;
+  { 10854, 0 },  // &sdote;
+  { 8664, 0 },  // &seArr;
+  { 10533, 0 },  // &searhk;
+  { 8600, 0 },  // &searr;
+  { 8600, 0 },  // &searrow;
+  { 167, 0 },  // &sect;
+  { 59, 0 },  // &semi;
+  { 10537, 0 },  // &seswar;
+  { 8726, 0 },  // &setminus;
+  { 8726, 0 },  // &setmn;
+  { 10038, 0 },  // &sext;
+  { 120112, 0 },  // &sfr;
+  { 8994, 0 },  // &sfrown;
+  { 9839, 0 },  // &sharp;
+  { 1097, 0 },  // &shchcy;
+  { 1096, 0 },  // &shcy;
+  { 8739, 0 },  // &shortmid;
+  { 8741, 0 },  // &shortparallel;
+  { 173, 0 },  // &shy;
+  { 963, 0 },  // &sigma;
+  { 962, 0 },  // &sigmaf;
+  { 962, 0 },  // &sigmav;
+  { 8764, 0 },  // &sim;
+  { 10858, 0 },  // &simdot;
+  { 8771, 0 },  // &sime;
+  { 8771, 0 },  // &simeq;
+  { 10910, 0 },  // &simg;
+  { 10912, 0 },  // &simgE;
+  { 10909, 0 },  // &siml;
+  { 10911, 0 },  // &simlE;
+  { 8774, 0 },  // &simne;
+  { 10788, 0 },  // &simplus;
+  { 10610, 0 },  // &simrarr;
+  { 8592, 0 },  // &slarr;
+  { 8726, 0 },  // &smallsetminus;
+  { 10803, 0 },  // &smashp;
+  { 10724, 0 },  // &smeparsl;
+  { 8739, 0 },  // &smid;
+  { 8995, 0 },  // &smile;
+  { 10922, 0 },  // &smt;
+  { 10924, 0 },  // &smte;
+  { 10924, 65024 },  // &smtes;
+  { 1100, 0 },  // &softcy;
+  { 47, 0 },  // &sol;
+  { 10692, 0 },  // &solb;
+  { 9023, 0 },  // &solbar;
+  { 120164, 0 },  // &sopf;
+  { 9824, 0 },  // &spades;
+  { 9824, 0 },  // &spadesuit;
+  { 8741, 0 },  // &spar;
+  { 8851, 0 },  // &sqcap;
+  { 8851, 65024 },  // &sqcaps;
+  { 8852, 0 },  // &sqcup;
+  { 8852, 65024 },  // &sqcups;
+  { 8847, 0 },  // &sqsub;
+  { 8849, 0 },  // &sqsube;
+  { 8847, 0 },  // &sqsubset;
+  { 8849, 0 },  // &sqsubseteq;
+  { 8848, 0 },  // &sqsup;
+  { 8850, 0 },  // &sqsupe;
+  { 8848, 0 },  // &sqsupset;
+  { 8850, 0 },  // &sqsupseteq;
+  { 9633, 0 },  // &squ;
+  { 9633, 0 },  // &square;
+  { 9642, 0 },  // &squarf;
+  { 9642, 0 },  // &squf;
+  { 8594, 0 },  // &srarr;
+  { 120008, 0 },  // &sscr;
+  { 8726, 0 },  // &ssetmn;
+  { 8995, 0 },  // &ssmile;
+  { 8902, 0 },  // &sstarf;
+  { 9734, 0 },  // &star;
+  { 9733, 0 },  // &starf;
+  { 1013, 0 },  // &straightepsilon;
+  { 981, 0 },  // &straightphi;
+  { 175, 0 },  // &strns;
+  { 8834, 0 },  // &sub;
+  { 10949, 0 },  // &subE;
+  { 10941, 0 },  // &subdot;
+  { 8838, 0 },  // &sube;
+  { 10947, 0 },  // &subedot;
+  { 10945, 0 },  // &submult;
+  { 10955, 0 },  // &subnE;
+  { 8842, 0 },  // &subne;
+  { 10943, 0 },  // &subplus;
+  { 10617, 0 },  // &subrarr;
+  { 8834, 0 },  // &subset;
+  { 8838, 0 },  // &subseteq;
+  { 10949, 0 },  // &subseteqq;
+  { 8842, 0 },  // &subsetneq;
+  { 10955, 0 },  // &subsetneqq;
+  { 10951, 0 },  // &subsim;
+  { 10965, 0 },  // &subsub;
+  { 10963, 0 },  // &subsup;
+  { 8827, 0 },  // &succ;
+  { 10936, 0 },  // &succapprox;
+  { 8829, 0 },  // &succcurlyeq;
+  { 10928, 0 },  // &succeq;
+  { 10938, 0 },  // &succnapprox;
+  { 10934, 0 },  // &succneqq;
+  { 8937, 0 },  // &succnsim;
+  { 8831, 0 },  // &succsim;
+  { 8721, 0 },  // &sum;
+  { 9834, 0 },  // &sung;
+  { 185, 0 },  // &sup1;
+  { 178, 0 },  // &sup2;
+  { 179, 0 },  // &sup3;
+  { 8835, 0 },  // &sup;
+  { 10950, 0 },  // &supE;
+  { 10942, 0 },  // &supdot;
+  { 10968, 0 },  // &supdsub;
+  { 8839, 0 },  // &supe;
+  { 10948, 0 },  // &supedot;
+  { 10185, 0 },  // &suphsol;
+  { 10967, 0 },  // &suphsub;
+  { 10619, 0 },  // &suplarr;
+  { 10946, 0 },  // &supmult;
+  { 10956, 0 },  // &supnE;
+  { 8843, 0 },  // &supne;
+  { 10944, 0 },  // &supplus;
+  { 8835, 0 },  // &supset;
+  { 8839, 0 },  // &supseteq;
+  { 10950, 0 },  // &supseteqq;
+  { 8843, 0 },  // &supsetneq;
+  { 10956, 0 },  // &supsetneqq;
+  { 10952, 0 },  // &supsim;
+  { 10964, 0 },  // &supsub;
+  { 10966, 0 },  // &supsup;
+  { 8665, 0 },  // &swArr;
+  { 10534, 0 },  // &swarhk;
+  { 8601, 0 },  // &swarr;
+  { 8601, 0 },  // &swarrow;
+  { 10538, 0 },  // &swnwar;
+  { 223, 0 },  // &szlig;
+  { 8982, 0 },  // &target;
+  { 964, 0 },  // &tau;
+  { 9140, 0 },  // &tbrk;
+  { 357, 0 },  // &tcaron;
+  { 355, 0 },  // &tcedil;
+  { 1090, 0 },  // &tcy;
+  { 8411, 0 },  // &tdot;
+  { 8981, 0 },  // &telrec;
+  { 120113, 0 },  // &tfr;
+  { 8756, 0 },  // &there4;
+  { 8756, 0 },  // &therefore;
+  { 952, 0 },  // &theta;
+  { 977, 0 },  // &thetasym;
+  { 977, 0 },  // &thetav;
+  { 8776, 0 },  // &thickapprox;
+  { 8764, 0 },  // &thicksim;
+  { 8201, 0 },  // &thinsp;
+  { 8776, 0 },  // &thkap;
+  { 8764, 0 },  // &thksim;
+  { 254, 0 },  // &thorn;
+  { 732, 0 },  // &tilde;
+  { 215, 0 },  // &times;
+  { 8864, 0 },  // &timesb;
+  { 10801, 0 },  // &timesbar;
+  { 10800, 0 },  // &timesd;
+  { 8749, 0 },  // &tint;
+  { 10536, 0 },  // &toea;
+  { 8868, 0 },  // &top;
+  { 9014, 0 },  // &topbot;
+  { 10993, 0 },  // &topcir;
+  { 120165, 0 },  // &topf;
+  { 10970, 0 },  // &topfork;
+  { 10537, 0 },  // &tosa;
+  { 8244, 0 },  // &tprime;
+  { 8482, 0 },  // &trade;
+  { 9653, 0 },  // &triangle;
+  { 9663, 0 },  // &triangledown;
+  { 9667, 0 },  // &triangleleft;
+  { 8884, 0 },  // &trianglelefteq;
+  { 8796, 0 },  // &triangleq;
+  { 9657, 0 },  // &triangleright;
+  { 8885, 0 },  // &trianglerighteq;
+  { 9708, 0 },  // &tridot;
+  { 8796, 0 },  // &trie;
+  { 10810, 0 },  // &triminus;
+  { 10809, 0 },  // &triplus;
+  { 10701, 0 },  // &trisb;
+  { 10811, 0 },  // &tritime;
+  { 9186, 0 },  // &trpezium;
+  { 120009, 0 },  // &tscr;
+  { 1094, 0 },  // &tscy;
+  { 1115, 0 },  // &tshcy;
+  { 359, 0 },  // &tstrok;
+  { 8812, 0 },  // &twixt;
+  { 8606, 0 },  // &twoheadleftarrow;
+  { 8608, 0 },  // &twoheadrightarrow;
+  { 8657, 0 },  // &uArr;
+  { 10595, 0 },  // &uHar;
+  { 250, 0 },  // &uacute;
+  { 8593, 0 },  // &uarr;
+  { 1118, 0 },  // &ubrcy;
+  { 365, 0 },  // &ubreve;
+  { 251, 0 },  // &ucirc;
+  { 1091, 0 },  // &ucy;
+  { 8645, 0 },  // &udarr;
+  { 369, 0 },  // &udblac;
+  { 10606, 0 },  // &udhar;
+  { 10622, 0 },  // &ufisht;
+  { 120114, 0 },  // &ufr;
+  { 249, 0 },  // &ugrave;
+  { 8639, 0 },  // &uharl;
+  { 8638, 0 },  // &uharr;
+  { 9600, 0 },  // &uhblk;
+  { 8988, 0 },  // &ulcorn;
+  { 8988, 0 },  // &ulcorner;
+  { 8975, 0 },  // &ulcrop;
+  { 9720, 0 },  // &ultri;
+  { 363, 0 },  // &umacr;
+  { 168, 0 },  // &uml;
+  { 371, 0 },  // &uogon;
+  { 120166, 0 },  // &uopf;
+  { 8593, 0 },  // &uparrow;
+  { 8597, 0 },  // &updownarrow;
+  { 8639, 0 },  // &upharpoonleft;
+  { 8638, 0 },  // &upharpoonright;
+  { 8846, 0 },  // &uplus;
+  { 965, 0 },  // &upsi;
+  { 978, 0 },  // &upsih;
+  { 965, 0 },  // &upsilon;
+  { 8648, 0 },  // &upuparrows;
+  { 8989, 0 },  // &urcorn;
+  { 8989, 0 },  // &urcorner;
+  { 8974, 0 },  // &urcrop;
+  { 367, 0 },  // &uring;
+  { 9721, 0 },  // &urtri;
+  { 120010, 0 },  // &uscr;
+  { 8944, 0 },  // &utdot;
+  { 361, 0 },  // &utilde;
+  { 9653, 0 },  // &utri;
+  { 9652, 0 },  // &utrif;
+  { 8648, 0 },  // &uuarr;
+  { 252, 0 },  // &uuml;
+  { 10663, 0 },  // &uwangle;
+  { 8661, 0 },  // &vArr;
+  { 10984, 0 },  // &vBar;
+  { 10985, 0 },  // &vBarv;
+  { 8872, 0 },  // &vDash;
+  { 10652, 0 },  // &vangrt;
+  { 1013, 0 },  // &varepsilon;
+  { 1008, 0 },  // &varkappa;
+  { 8709, 0 },  // &varnothing;
+  { 981, 0 },  // &varphi;
+  { 982, 0 },  // &varpi;
+  { 8733, 0 },  // &varpropto;
+  { 8597, 0 },  // &varr;
+  { 1009, 0 },  // &varrho;
+  { 962, 0 },  // &varsigma;
+  { 8842, 65024 },  // &varsubsetneq;
+  { 10955, 65024 },  // &varsubsetneqq;
+  { 8843, 65024 },  // &varsupsetneq;
+  { 10956, 65024 },  // &varsupsetneqq;
+  { 977, 0 },  // &vartheta;
+  { 8882, 0 },  // &vartriangleleft;
+  { 8883, 0 },  // &vartriangleright;
+  { 1074, 0 },  // &vcy;
+  { 8866, 0 },  // &vdash;
+  { 8744, 0 },  // &vee;
+  { 8891, 0 },  // &veebar;
+  { 8794, 0 },  // &veeeq;
+  { 8942, 0 },  // &vellip;
+  { 124, 0 },  // &verbar;
+  { 124, 0 },  // &vert;
+  { 120115, 0 },  // &vfr;
+  { 8882, 0 },  // &vltri;
+  { 8834, 8402 },  // &vnsub;
+  { 8835, 8402 },  // &vnsup;
+  { 120167, 0 },  // &vopf;
+  { 8733, 0 },  // &vprop;
+  { 8883, 0 },  // &vrtri;
+  { 120011, 0 },  // &vscr;
+  { 10955, 65024 },  // &vsubnE;
+  { 8842, 65024 },  // &vsubne;
+  { 10956, 65024 },  // &vsupnE;
+  { 8843, 65024 },  // &vsupne;
+  { 10650, 0 },  // &vzigzag;
+  { 373, 0 },  // &wcirc;
+  { 10847, 0 },  // &wedbar;
+  { 8743, 0 },  // &wedge;
+  { 8793, 0 },  // &wedgeq;
+  { 8472, 0 },  // &weierp;
+  { 120116, 0 },  // &wfr;
+  { 120168, 0 },  // &wopf;
+  { 8472, 0 },  // &wp;
+  { 8768, 0 },  // &wr;
+  { 8768, 0 },  // &wreath;
+  { 120012, 0 },  // &wscr;
+  { 8898, 0 },  // &xcap;
+  { 9711, 0 },  // &xcirc;
+  { 8899, 0 },  // &xcup;
+  { 9661, 0 },  // &xdtri;
+  { 120117, 0 },  // &xfr;
+  { 10234, 0 },  // &xhArr;
+  { 10231, 0 },  // &xharr;
+  { 958, 0 },  // &xi;
+  { 10232, 0 },  // &xlArr;
+  { 10229, 0 },  // &xlarr;
+  { 10236, 0 },  // &xmap;
+  { 8955, 0 },  // &xnis;
+  { 10752, 0 },  // &xodot;
+  { 120169, 0 },  // &xopf;
+  { 10753, 0 },  // &xoplus;
+  { 10754, 0 },  // &xotime;
+  { 10233, 0 },  // &xrArr;
+  { 10230, 0 },  // &xrarr;
+  { 120013, 0 },  // &xscr;
+  { 10758, 0 },  // &xsqcup;
+  { 10756, 0 },  // &xuplus;
+  { 9651, 0 },  // &xutri;
+  { 8897, 0 },  // &xvee;
+  { 8896, 0 },  // &xwedge;
+  { 253, 0 },  // &yacute;
+  { 1103, 0 },  // &yacy;
+  { 375, 0 },  // &ycirc;
+  { 1099, 0 },  // &ycy;
+  { 165, 0 },  // &yen;
+  { 120118, 0 },  // &yfr;
+  { 1111, 0 },  // &yicy;
+  { 120170, 0 },  // &yopf;
+  { 120014, 0 },  // &yscr;
+  { 1102, 0 },  // &yucy;
+  { 255, 0 },  // &yuml;
+  { 378, 0 },  // &zacute;
+  { 382, 0 },  // &zcaron;
+  { 1079, 0 },  // &zcy;
+  { 380, 0 },  // &zdot;
+  { 8488, 0 },  // &zeetrf;
+  { 950, 0 },  // &zeta;
+  { 120119, 0 },  // &zfr;
+  { 1078, 0 },  // &zhcy;
+  { 8669, 0 },  // &zigrarr;
+  { 120171, 0 },  // &zopf;
+  { 120015, 0 },  // &zscr;
+  { 8205, 0 },  // &zwj;
+  { 8204, 0 },  // &zwnj;
+};
+
+}  // namespace
+}  // namespace nwc_toolkit
+
+#endif  // NWC_TOOLKIT_CHARACTER_ENTITY_TABLE_H_
@@ -0,0 +1,242 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <nwc-toolkit/digest-set.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <nwc-toolkit/sha1-digest.h>
+
+namespace nwc_toolkit {
+namespace {
+
+// A saved file starts with MAGIC and the number of digests, which is
+// followed by the digests. A digest is written as its high and low words,
+// and every word takes 8 bytes.
+const char MAGIC[] = "NWCDGS01";
+
+enum {
+  WORD_SIZE = 8,
+  DIGEST_SIZE = WORD_SIZE * 2,
+  NUM_BUFFERED_DIGESTS = 1 << 12
+};
+
+void EncodeWord(unsigned long long word, unsigned char *bytes) {
+  for (std::size_t i = 0; i < WORD_SIZE; ++i) {
+    bytes[i] = static_cast<unsigned char>(word >> (i * 8));
+  }
+}
+
+unsigned long long DecodeWord(const unsigned char *bytes) {
+  unsigned long long word = 0;
+  for (std::size_t i = 0; i < WORD_SIZE; ++i) {
+    word |= static_cast<unsigned long long>(bytes[i]) << (i * 8);
+  }
+  return word;
+}
+
+}  // namespace
+
+DigestSet::DigestSet()
+    : slots_(NULL),
+      num_slots_(0),
+      num_digests_(0),
+      memory_limit_(DEFAULT_MEMORY_LIMIT) {}
+
+void DigestSet::Reset(std::size_t memory_limit) {
+  Clear();
+  if (memory_limit == 0) {
+    memory_limit = DEFAULT_MEMORY_LIMIT;
+  } else if (memory_limit < MIN_MEMORY_LIMIT) {
+    memory_limit = MIN_MEMORY_LIMIT;
+  }
+  memory_limit_ = memory_limit;
+}
+
+void DigestSet::Clear() {
+  delete [] slots_;
+  slots_ = NULL;
+  num_slots_ = 0;
+  num_digests_ = 0;
+}
+
+bool DigestSet::Insert(const Digest &digest) {
+  Digest fixed_digest = FixDigest(digest);
+  if (slots_ != NULL) {
+    Digest *slot = Find(fixed_digest);
+    if (*slot == fixed_digest) {
+      return true;
+    }
+  }
+  // The table is kept at most 3/4 full, so an empty slot is always found.
+  if ((num_digests_ >= (num_slots_ - (num_slots_ / 4))) && !Grow()) {
+    return false;
+  }
+  *Find(fixed_digest) = fixed_digest;
+  ++num_digests_;
+  return true;
+}
+
+bool DigestSet::Contains(const Digest &digest) const {
+  if (slots_ == NULL) {
+    return false;
+  }
+  Digest fixed_digest = FixDigest(digest);
+  return *Find(fixed_digest) == fixed_digest;
+}
+
+bool DigestSet::Save(const String &path) const {
+  std::string path_str(path.ptr(), path.length());
+  std::string temp_path = path_str + ".tmp";
+  std::FILE *file = std::fopen(temp_path.c_str(), "wb");
+  if (file == NULL) {
+    return false;
+  }
+
+  unsigned char buf[NUM_BUFFERED_DIGESTS * DIGEST_SIZE];
+  std::fwrite(MAGIC, 1, WORD_SIZE, file);
+  EncodeWord(num_digests_, buf);
+  std::fwrite(buf, 1, WORD_SIZE, file);
+
+  std::size_t num_buffered = 0;
+  for (std::size_t i = 0; i < num_slots_; ++i) {
+    if (!IsEmpty(slots_[i])) {
+      unsigned char *bytes = buf + (num_buffered * DIGEST_SIZE);
+      EncodeWord(slots_[i].high, bytes);
+      EncodeWord(slots_[i].low, bytes + WORD_SIZE);
+      if (++num_buffered == NUM_BUFFERED_DIGESTS) {
+        std::fwrite(buf, DIGEST_SIZE, num_buffered, file);
+        num_buffered = 0;
+      }
+    }
+  }
+  std::fwrite(buf, DIGEST_SIZE, num_buffered, file);
+
+  bool is_ok = !std::ferror(file);
+  if ((std::fclose(file) != 0) || !is_ok ||
+      (std::rename(temp_path.c_str(), path_str.c_str()) != 0)) {
+    std::remove(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool DigestSet::Load(const String &path) {
+  std::string path_str(path.ptr(), path.length());
+  std::FILE *file = std::fopen(path_str.c_str(), "rb");
+  if (file == NULL) {
+    return false;
+  }
+
+  unsigned char buf[NUM_BUFFERED_DIGESTS * DIGEST_SIZE];
+  if ((std::fread(buf, 1, WORD_SIZE * 2, file) != (WORD_SIZE * 2)) ||
+      !std::equal(MAGIC, MAGIC + WORD_SIZE, buf)) {
+    std::fclose(file);
+    return false;
+  }
+
+  unsigned long long num_digests = DecodeWord(buf + WORD_SIZE);
+  while (num_digests > 0) {
+    std::size_t num_buffered = (num_digests < NUM_BUFFERED_DIGESTS)
+        ? static_cast<std::size_t>(num_digests)
+        : static_cast<std::size_t>(NUM_BUFFERED_DIGESTS);
+    if (std::fread(buf, DIGEST_SIZE, num_buffered, file) != num_buffered) {
+      break;
+    }
+    for (std::size_t i = 0; i < num_buffered; ++i) {
+      const unsigned char *bytes = buf + (i * DIGEST_SIZE);
+      Digest digest;
+      digest.high = DecodeWord(bytes);
+      digest.low = DecodeWord(bytes + WORD_SIZE);
+      if (!Insert(digest)) {
+        std::fclose(file);
+        return false;
+      }
+    }
+    num_digests -= num_buffered;
+  }
+
+  // The file must end just after the last digest.
+  bool is_ok = (num_digests == 0) && (std::fgetc(file) == EOF) &&
+      !std::ferror(file);
+  std::fclose(file);
+  return is_ok;
+}
+
+// The words of a SHA-1 hash are in the byte order of the host, so the
+// digest is the same as that of the hexadecimal form on any host.
+DigestSet::Digest DigestSet::Calculate(const String &str) {
+  Sha1Digest sha1;
+  sha1.Append(str);
+  sha1.Finish();
+  unsigned int words[5];
+  std::memcpy(words, sha1.digest().ptr(), sizeof(words));
+
+  Digest digest;
+  digest.high = (static_cast<unsigned long long>(words[0]) << 32) | words[1];
+  digest.low = (static_cast<unsigned long long>(words[2]) << 32) | words[3];
+  return digest;
+}
+
+bool DigestSet::Parse(const String &hex_digest, Digest *digest) {
+  if (hex_digest.length() != 40) {
+    return false;
+  }
+  unsigned long long words[2] = { 0, 0 };
+  for (std::size_t i = 0; i < hex_digest.length(); ++i) {
+    unsigned int value;
+    if ((hex_digest[i] >= '0') && (hex_digest[i] <= '9')) {
+      value = hex_digest[i] - '0';
+    } else if ((hex_digest[i] >= 'a') && (hex_digest[i] <= 'f')) {
+      value = hex_digest[i] - 'a' + 10;
+    } else if ((hex_digest[i] >= 'A') && (hex_digest[i] <= 'F')) {
+      value = hex_digest[i] - 'A' + 10;
+    } else {
+      return false;
+    }
+    if (i < 32) {
+      words[i / 16] = (words[i / 16] << 4) | value;
+    }
+  }
+  digest->high = words[0];
+  digest->low = words[1];
+  return true;
+}
+
+DigestSet::Digest *DigestSet::Find(const Digest &digest) const {
+  std::size_t mask = num_slots_ - 1;
+  std::size_t slot_id = static_cast<std::size_t>(digest.high) & mask;
+  while (!IsEmpty(slots_[slot_id]) && !(slots_[slot_id] == digest)) {
+    slot_id = (slot_id + 1) & mask;
+  }
+  return &slots_[slot_id];
+}
+
+bool DigestSet::Grow() {
+  std::size_t new_num_slots = (num_slots_ != 0)
+      ? (num_slots_ * 2) : static_cast<std::size_t>(MIN_NUM_SLOTS);
+  // The old slots are freed after the new slots are filled.
+  if (((num_slots_ + new_num_slots) * sizeof(Digest)) > memory_limit_) {
+    return false;
+  }
+
+  Digest *old_slots = slots_;
+  std::size_t old_num_slots = num_slots_;
+
+  slots_ = new Digest[new_num_slots];
+  Digest empty_digest = { 0, 0 };
+  std::fill(slots_, slots_ + new_num_slots, empty_digest);
+  num_slots_ = new_num_slots;
+
+  for (std::size_t i = 0; i < old_num_slots; ++i) {
+    if (!IsEmpty(old_slots[i])) {
+      *Find(old_slots[i]) = old_slots[i];
+    }
+  }
+  delete [] old_slots;
+  return true;
+}
+
+}  // namespace nwc_toolkit
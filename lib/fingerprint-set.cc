@@ -0,0 +1,220 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <nwc-toolkit/fingerprint-set.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace nwc_toolkit {
+namespace {
+
+// A saved file starts with MAGIC and the number of fingerprints, which is
+// followed by the fingerprints. Every integer takes 8 bytes.
+const char MAGIC[] = "NWCFPS01";
+
+enum {
+  FINGERPRINT_SIZE = 8,
+  NUM_BUFFERED_FINGERPRINTS = 1 << 12
+};
+
+void EncodeFingerprint(unsigned long long fingerprint, unsigned char *bytes) {
+  for (std::size_t i = 0; i < FINGERPRINT_SIZE; ++i) {
+    bytes[i] = static_cast<unsigned char>(fingerprint >> (i * 8));
+  }
+}
+
+unsigned long long DecodeFingerprint(const unsigned char *bytes) {
+  unsigned long long fingerprint = 0;
+  for (std::size_t i = 0; i < FINGERPRINT_SIZE; ++i) {
+    fingerprint |= static_cast<unsigned long long>(bytes[i]) << (i * 8);
+  }
+  return fingerprint;
+}
+
+}  // namespace
+
+FingerprintSet::FingerprintSet()
+    : slots_(NULL),
+      num_buckets_(0),
+      num_fingerprints_(0),
+      memory_limit_(DEFAULT_MEMORY_LIMIT) {}
+
+void FingerprintSet::Reset(std::size_t memory_limit) {
+  Clear();
+  if (memory_limit == 0) {
+    memory_limit = DEFAULT_MEMORY_LIMIT;
+  } else if (memory_limit < MIN_MEMORY_LIMIT) {
+    memory_limit = MIN_MEMORY_LIMIT;
+  }
+  memory_limit_ = memory_limit;
+}
+
+void FingerprintSet::Clear() {
+  delete [] slots_;
+  slots_ = NULL;
+  num_buckets_ = 0;
+  num_fingerprints_ = 0;
+}
+
+bool FingerprintSet::Insert(unsigned long long fingerprint) {
+  fingerprint = FixFingerprint(fingerprint);
+  if (slots_ == NULL) {
+    Grow();
+  }
+
+  unsigned long long *slot = Find(fingerprint);
+  if (slot == NULL) {
+    // The fingerprint is not in the set and its buckets are full.
+    return Grow() && Insert(fingerprint);
+  } else if (*slot == fingerprint) {
+    return true;
+  }
+
+  *slot = fingerprint;
+  if (++num_fingerprints_ > (num_buckets_ * BUCKET_SIZE / 4 * 3)) {
+    Grow();
+  }
+  return true;
+}
+
+bool FingerprintSet::Contains(unsigned long long fingerprint) const {
+  if (slots_ == NULL) {
+    return false;
+  }
+  fingerprint = FixFingerprint(fingerprint);
+  const unsigned long long *slot = Find(fingerprint);
+  return (slot != NULL) && (*slot == fingerprint);
+}
+
+bool FingerprintSet::Save(const String &path) const {
+  std::string path_str(path.ptr(), path.length());
+  std::string temp_path = path_str + ".tmp";
+  std::FILE *file = std::fopen(temp_path.c_str(), "wb");
+  if (file == NULL) {
+    return false;
+  }
+
+  unsigned char buf[NUM_BUFFERED_FINGERPRINTS * FINGERPRINT_SIZE];
+  std::fwrite(MAGIC, 1, FINGERPRINT_SIZE, file);
+  EncodeFingerprint(num_fingerprints_, buf);
+  std::fwrite(buf, 1, FINGERPRINT_SIZE, file);
+
+  std::size_t num_buffered = 0;
+  for (std::size_t i = 0; i < (num_buckets_ * BUCKET_SIZE); ++i) {
+    if (slots_[i] != 0) {
+      EncodeFingerprint(slots_[i], buf + (num_buffered * FINGERPRINT_SIZE));
+      if (++num_buffered == NUM_BUFFERED_FINGERPRINTS) {
+        std::fwrite(buf, FINGERPRINT_SIZE, num_buffered, file);
+        num_buffered = 0;
+      }
+    }
+  }
+  std::fwrite(buf, FINGERPRINT_SIZE, num_buffered, file);
+
+  bool is_ok = !std::ferror(file);
+  if ((std::fclose(file) != 0) || !is_ok ||
+      (std::rename(temp_path.c_str(), path_str.c_str()) != 0)) {
+    std::remove(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool FingerprintSet::Load(const String &path) {
+  std::string path_str(path.ptr(), path.length());
+  std::FILE *file = std::fopen(path_str.c_str(), "rb");
+  if (file == NULL) {
+    return false;
+  }
+
+  unsigned char buf[NUM_BUFFERED_FINGERPRINTS * FINGERPRINT_SIZE];
+  if ((std::fread(buf, 1, FINGERPRINT_SIZE * 2, file) !=
+      (FINGERPRINT_SIZE * 2)) ||
+      !std::equal(MAGIC, MAGIC + FINGERPRINT_SIZE, buf)) {
+    std::fclose(file);
+    return false;
+  }
+
+  unsigned long long num_fingerprints = DecodeFingerprint(
+      buf + FINGERPRINT_SIZE);
+  while (num_fingerprints > 0) {
+    std::size_t num_buffered = (num_fingerprints < NUM_BUFFERED_FINGERPRINTS)
+        ? static_cast<std::size_t>(num_fingerprints)
+        : static_cast<std::size_t>(NUM_BUFFERED_FINGERPRINTS);
+    if (std::fread(buf, FINGERPRINT_SIZE, num_buffered, file) !=
+        num_buffered) {
+      break;
+    }
+    for (std::size_t i = 0; i < num_buffered; ++i) {
+      if (!Insert(DecodeFingerprint(buf + (i * FINGERPRINT_SIZE)))) {
+        std::fclose(file);
+        return false;
+      }
+    }
+    num_fingerprints -= num_buffered;
+  }
+
+  // The file must end just after the last fingerprint.
+  bool is_ok = (num_fingerprints == 0) && (std::fgetc(file) == EOF) &&
+      !std::ferror(file);
+  std::fclose(file);
+  return is_ok;
+}
+
+// Slots are filled in probe order and never emptied, so a fingerprint is
+// not found after the first empty slot.
+unsigned long long *FingerprintSet::Find(
+    unsigned long long fingerprint) const {
+  std::size_t mask = num_buckets_ - 1;
+  std::size_t bucket_id = fingerprint & mask;
+  for (std::size_t i = 0; i < MAX_NUM_PROBES; ++i) {
+    unsigned long long *bucket =
+        slots_ + (((bucket_id + i) & mask) * BUCKET_SIZE);
+    for (std::size_t j = 0; j < BUCKET_SIZE; ++j) {
+      if ((bucket[j] == fingerprint) || (bucket[j] == 0)) {
+        return &bucket[j];
+      }
+    }
+  }
+  return NULL;
+}
+
+bool FingerprintSet::Grow() {
+  std::size_t new_num_buckets = (num_buckets_ != 0)
+      ? (num_buckets_ * 2) : static_cast<std::size_t>(MIN_NUM_BUCKETS);
+  std::size_t new_size = new_num_buckets * BUCKET_SIZE;
+  std::size_t old_size = num_buckets_ * BUCKET_SIZE;
+  // The old slots are freed after the new slots are filled.
+  if ((num_buckets_ != 0) &&
+      (((old_size + new_size) * sizeof(unsigned long long)) >
+       memory_limit_)) {
+    return false;
+  }
+
+  unsigned long long *old_slots = slots_;
+  std::size_t old_num_buckets = num_buckets_;
+
+  slots_ = new unsigned long long[new_size];
+  std::fill(slots_, slots_ + new_size, 0ULL);
+  num_buckets_ = new_num_buckets;
+
+  // The old slots are kept if a fingerprint does not fit in the new slots,
+  // which is very unlikely, because no fingerprint may be lost.
+  for (std::size_t i = 0; i < old_size; ++i) {
+    if (old_slots[i] != 0) {
+      unsigned long long *slot = Find(old_slots[i]);
+      if (slot == NULL) {
+        delete [] slots_;
+        slots_ = old_slots;
+        num_buckets_ = old_num_buckets;
+        return false;
+      }
+      *slot = old_slots[i];
+    }
+  }
+  delete [] old_slots;
+  return true;
+}
+
+}  // namespace nwc_toolkit
@@ -5,6 +5,7 @@
 #include <cstdlib>
 #include <limits>
 
+#include <nwc-toolkit/character-converter.h>
 #include <nwc-toolkit/character-encoding.h>
 
 namespace nwc_toolkit {
@@ -14,9 +15,10 @@ void HtmlArchiveEntry::Clear() {
   status_code_ = 0;
   header_.Clear();
   body_.Clear();
+  is_truncated_ = false;
 }
 
-bool HtmlArchiveEntry::Read(InputFile *file) {
+bool HtmlArchiveEntry::Read(InputFile *file, std::size_t max_body_length) {
   String url_line;
   if (!file->ReadLine(&url_line)) {
     return false;
@@ -43,11 +45,19 @@ bool HtmlArchiveEntry::Read(InputFile *file) {
   if (!ReadInt(file, &body_length)) {
     return false;
   }
+  std::size_t length = static_cast<std::size_t>(body_length);
+  is_truncated_ = (max_body_length != 0) && (length > max_body_length);
+  if (is_truncated_) {
+    length = max_body_length;
+  }
   String body;
-  if (!file->Read(body_length, &body)) {
+  if (!file->Read(length, &body)) {
     return false;
   }
   set_body(body);
+  if (is_truncated_ && !file->Skip(body_length - length)) {
+    return false;
+  }
   return true;
 }
 
@@ -118,6 +128,54 @@ bool HtmlArchiveEntry::ExtractUnicodeBody(StringBuilder *unicode_body,
   return false;
 }
 
+bool HtmlArchiveEntry::DetectUnicodeEncoding(std::size_t test_length,
+    StringBuilder *src_encoding) const {
+  // If the test body is a part of the body, an incomplete multibyte sequence
+  // at its end is not regarded as an error.
+  String test_body = body();
+  if (test_length < test_body.length()) {
+    test_body = test_body.SubString(0, test_length);
+  }
+  bool is_partial = (test_body.length() < body_.length()) || is_truncated_;
+
+  if (CharacterEncoding::DetectFromBOM(body(), src_encoding)) {
+    if (TestEncoding(src_encoding->str(), test_body, is_partial)) {
+      return true;
+    }
+  }
+
+  int encoding_flags = 0;
+
+  if (CharacterEncoding::DetectFromResponseHeader(header(), src_encoding)) {
+    if (TestEncoding(src_encoding->str(), test_body, is_partial)) {
+      return true;
+    }
+    encoding_flags |= DetectEncodingFlags(src_encoding->str());
+  }
+
+  if (CharacterEncoding::DetectFromXmlHeader(body(), src_encoding)) {
+    if (TestEncoding(src_encoding->str(), test_body, is_partial)) {
+      return true;
+    }
+    encoding_flags |= DetectEncodingFlags(src_encoding->str());
+  }
+
+  if (CharacterEncoding::DetectFromHtmlHeader(test_body, src_encoding)) {
+    if (TestEncoding(src_encoding->str(), test_body, is_partial)) {
+      return true;
+    }
+    encoding_flags |= DetectEncodingFlags(src_encoding->str());
+  }
+
+  if (TestEncodings(encoding_flags, test_body, is_partial, src_encoding) ||
+      TestEncodings(~encoding_flags, test_body, is_partial, src_encoding)) {
+    return true;
+  }
+
+  src_encoding->Clear();
+  return false;
+}
+
 bool HtmlArchiveEntry::ExtractContentType(StringBuilder *content_type) const {
   static const String CONTENT_TYPE_FIELD_NAME = "Content-Type:";
 
@@ -191,42 +249,56 @@ int HtmlArchiveEntry::DetectEncodingFlags(const String &encoding) {
   return encoding_flags;
 }
 
+// Candidates are tested in this order by both versions of TestEncodings().
+const HtmlArchiveEntry::EncodingCandidate
+    HtmlArchiveEntry::ENCODING_CANDIDATES[] = {
+  { SHIFT_JIS_FLAG, "CP932" },
+  { EUC_JP_FLAG, "EUC-JP-MS" },
+  { ISO_2022_JP_FLAG, "ISO-2022-JP-MS" },
+  { ISO_2022_JP_FLAG, "ISO-2022-JP-2" },
+  { UTF_8_FLAG, "UTF-8" },
+  { 0, NULL }
+};
+
 bool HtmlArchiveEntry::TestEncodings(int encoding_flags,
     StringBuilder *unicode_body, StringBuilder *src_encoding) const {
-  if (((encoding_flags & SHIFT_JIS_FLAG) == SHIFT_JIS_FLAG)) {
-    if (CharacterEncoding::Convert("CP932", body(), "UTF-8", unicode_body)) {
-      src_encoding->Assign("CP932");
-      return true;
-    }
-  }
-
-  if ((encoding_flags & EUC_JP_FLAG) == EUC_JP_FLAG) {
-    if (CharacterEncoding::Convert("EUC-JP-MS", body(),
+  for (const EncodingCandidate *candidate = ENCODING_CANDIDATES;
+      candidate->encoding != NULL; ++candidate) {
+    if (((encoding_flags & candidate->flag) == candidate->flag) &&
+        CharacterEncoding::Convert(candidate->encoding, body(),
         "UTF-8", unicode_body)) {
-      src_encoding->Assign("EUC-JP-MS");
+      src_encoding->Assign(candidate->encoding);
       return true;
     }
   }
+  return false;
+}
 
-  if ((encoding_flags & ISO_2022_JP_FLAG) == ISO_2022_JP_FLAG) {
-    if (CharacterEncoding::Convert("ISO-2022-JP-MS", body(),
-        "UTF-8", unicode_body)) {
-      src_encoding->Assign("ISO-2022-JP-MS");
-      return true;
-    } else if (CharacterEncoding::Convert("ISO-2022-JP-2", body(),
-        "UTF-8", unicode_body)) {
-      src_encoding->Assign("ISO-2022-JP-2");
+bool HtmlArchiveEntry::TestEncodings(int encoding_flags,
+    const String &test_body, bool is_partial, StringBuilder *src_encoding) {
+  for (const EncodingCandidate *candidate = ENCODING_CANDIDATES;
+      candidate->encoding != NULL; ++candidate) {
+    if (((encoding_flags & candidate->flag) == candidate->flag) &&
+        TestEncoding(candidate->encoding, test_body, is_partial)) {
+      src_encoding->Assign(candidate->encoding);
       return true;
     }
   }
+  return false;
+}
 
-  if ((encoding_flags & UTF_8_FLAG) == UTF_8_FLAG) {
-    if (CharacterEncoding::Convert("UTF-8", body(), "UTF-8", unicode_body)) {
-      src_encoding->Assign("UTF-8");
-      return true;
-    }
+bool HtmlArchiveEntry::TestEncoding(const String &encoding,
+    const String &test_body, bool is_partial) {
+  CharacterConverter converter;
+  if (!converter.Open(encoding, "UTF-8")) {
+    return false;
   }
-  return false;
+  StringBuilder unicode_body;
+  String test_body_left;
+  if (!converter.Convert(test_body, &unicode_body, &test_body_left)) {
+    return false;
+  }
+  return is_partial || test_body_left.is_empty();
 }
 
 }  // namespace nwc_toolkit
@@ -2,8 +2,14 @@
 
 #include <nwc-toolkit/html-document.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif  // __SSE2__
+
+#include <cstring>
 #include <tr1/unordered_set>
 
+#include <nwc-toolkit/character-converter.h>
 #include <nwc-toolkit/character-encoding.h>
 #include <nwc-toolkit/character-reference.h>
 #include <nwc-toolkit/string-hash.h>
@@ -13,29 +19,61 @@ namespace {
 
 typedef std::tr1::unordered_set<String, StringHash> TagNameSet;
 
-const TagNameSet &GetBlockTagNameSet() {
-  const char *tag_names[] = {
-    "address", "article", "aside", "blockquote", "br", "caption", "center",
-    "dd", "dialog", "dir", "div", "dl", "dt", "fieldset", "figure",
-    "footer", "form", "frame", "h1", "h2", "h3", "h4", "h5", "h6",
-    "header", "hr", "isindex", "legenda", "li", "menu", "multicol", "nav",
-    "noframes", "noscript", "ol", "p", "pre", "section", "table", "tbody",
-    "td", "textarea", "tfoot", "th", "thead", "title", "tr", "ul", "xmp"
-  };
-
-  static bool is_initialized = false;
-  static TagNameSet tag_name_set;
-
-  if (!is_initialized) {
+// BlockTagNameSet is built in its constructor, so that the function-local
+// static object in GetBlockTagNameSet() is safely initialized even if
+// documents are parsed in multiple threads.
+class BlockTagNameSet : public TagNameSet {
+ public:
+  BlockTagNameSet() : TagNameSet() {
+    const char *tag_names[] = {
+      "address", "article", "aside", "blockquote", "br", "caption",
+      "center", "dd", "dialog", "dir", "div", "dl", "dt", "fieldset",
+      "figure", "footer", "form", "frame", "h1", "h2", "h3", "h4", "h5",
+      "h6", "header", "hr", "isindex", "legenda", "li", "menu", "multicol",
+      "nav", "noframes", "noscript", "ol", "p", "pre", "section", "table",
+      "tbody", "td", "textarea", "tfoot", "th", "thead", "title", "tr",
+      "ul", "xmp"
+    };
     std::size_t num_keys = sizeof(tag_names) / sizeof(tag_names[0]);
     for (std::size_t i = 0; i < num_keys; ++i) {
-      tag_name_set.insert(tag_names[i]);
+      insert(tag_names[i]);
     }
-    is_initialized = true;
   }
+};
+
+const TagNameSet &GetBlockTagNameSet() {
+  static const BlockTagNameSet tag_name_set;
   return tag_name_set;
 }
 
+// Returns a pointer to the first space or control character in [begin, end),
+// or `end' if there is no such character. The tools do not call setlocale(),
+// so the characters are the same as IsSpace() and IsCntrl() in "C" locale,
+// that is, 0x00-0x20 and 0x7F.
+const char *FindSpaceOrCntrl(const char *begin, const char *end) {
+#ifdef __SSE2__
+  const __m128i max_space_or_cntrl = _mm_set1_epi8(0x20);
+  const __m128i del = _mm_set1_epi8(0x7F);
+  while (end - begin >= 16) {
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+    __m128i is_space_or_cntrl = _mm_or_si128(
+        _mm_cmpeq_epi8(_mm_min_epu8(bytes, max_space_or_cntrl), bytes),
+        _mm_cmpeq_epi8(bytes, del));
+    int mask = _mm_movemask_epi8(is_space_or_cntrl);
+    if (mask != 0) {
+      return begin + __builtin_ctz(mask);
+    }
+    begin += 16;
+  }
+#endif  // __SSE2__
+
+  static const CharTable SPACE_OR_CNTRL_TABLE("\0-\x20\x7F", 4);
+  while ((begin < end) && !SPACE_OR_CNTRL_TABLE.Get(*begin)) {
+    ++begin;
+  }
+  return begin;
+}
+
 }  // namespace
 
 HtmlDocument::HtmlDocument()
@@ -43,26 +81,47 @@ HtmlDocument::HtmlDocument()
       src_encoding_(),
       content_type_(),
       parser_mode_(UNDEFINED_MODE),
+      attribute_handler_(NORMALIZE_ATTRIBUTES),
       units_(),
       attributes_(),
       string_pool_(),
       temp_buf_(),
-      symbol_stack_() {}
+      symbol_stack_(),
+      window_state_(TEXT_STATE),
+      window_size_(0),
+      open_tag_name_() {}
 
 void HtmlDocument::Clear() {
   body_.Clear();
   src_encoding_.Clear();
   content_type_.Clear();
   ClearUnits();
+  window_state_ = TEXT_STATE;
+  open_tag_name_.Clear();
 }
 
 bool HtmlDocument::Parse(const HtmlArchiveEntry &entry) {
+  return Decode(entry) && ParseDecodedBody();
+}
+
+bool HtmlDocument::Decode(const HtmlArchiveEntry &entry) {
   Clear();
 
   if (!entry.ExtractUnicodeBody(&body_, &src_encoding_)) {
     return false;
   }
 
+  // The parser mode is tentatively set here and ParseDecodedBody() refers
+  // to it.
+  String path(entry.url().begin(), entry.url().FindFirstOf("?#").begin());
+  entry.ExtractContentType(&content_type_);
+  if ((content_type_.str() == "text/plain") || path.EndsWith(".txt")) {
+    parser_mode_ = PLAIN_TEXT_MODE;
+  }
+  return true;
+}
+
+bool HtmlDocument::ParseDecodedBody() {
   static const String UTF_8_BOM = "\xEF\xBB\xBF";
 
   String body = body_.str();
@@ -70,10 +129,7 @@ bool HtmlDocument::Parse(const HtmlArchiveEntry &entry) {
     body = body.SubString(UTF_8_BOM.length());
   }
 
-  String path(entry.url().begin(), entry.url().FindFirstOf("?#").begin());
-  entry.ExtractContentType(&content_type_);
-
-  if ((content_type_.str() == "text/plain") || path.EndsWith(".txt")) {
+  if (parser_mode_ == PLAIN_TEXT_MODE) {
     if (ParseAsPlainText(body)) {
       return true;
     }
@@ -90,15 +146,129 @@ void HtmlDocument::ExtractText(StringBuilder *dest) {
   if (parser_mode() == PLAIN_TEXT_MODE) {
     mode_flags |= PLAINTEXT_MODE_FLAG;
   }
+  AppendUnitsToText(&mode_flags, dest);
+  AppendEndOfLineToText(dest);
+}
+
+bool HtmlDocument::ExtractText(const HtmlArchiveEntry &entry,
+    std::size_t window_size, StringBuilder *dest) {
+  // A window must be able to hold any multibyte sequence.
+  static const std::size_t MIN_WINDOW_SIZE = 16;
+
+  Clear();
+  if (window_size < MIN_WINDOW_SIZE) {
+    window_size = MIN_WINDOW_SIZE;
+  }
+  window_size_ = window_size;
+
+  CharacterConverter converter;
+  if (!entry.DetectUnicodeEncoding(window_size, &src_encoding_) ||
+      !converter.Open(src_encoding_.str(), "UTF-8")) {
+    Clear();
+    return false;
+  }
+
+  String path(entry.url().begin(), entry.url().FindFirstOf("?#").begin());
+  entry.ExtractContentType(&content_type_);
+
+  ParserMode parser_mode = HTML_MODE;
+  int mode_flags = 0;
+  if ((content_type_.str() == "text/plain") || path.EndsWith(".txt")) {
+    parser_mode = PLAIN_TEXT_MODE;
+    mode_flags |= PLAINTEXT_MODE_FLAG;
+    window_state_ = PLAINTEXT_STATE;
+  }
+
+  static const String UTF_8_BOM = "\xEF\xBB\xBF";
+  static const String REPLACEMENT_CHARACTER = "\xEF\xBF\xBD";
+
+  std::size_t dest_length = dest->length();
+  bool is_first_window = true;
+  for (String src_left = entry.body(); ; ) {
+    String src_window = src_left.SubString(0,
+        (src_left.length() < window_size) ? src_left.length() : window_size);
+    bool is_last_window = (src_window.end() == src_left.end());
+
+    // An incomplete multibyte sequence at the end of a window is left in
+    // `src_left' and converted together with the next window.
+    // If the first window is not valid in the detected encoding, the body
+    // is parsed as a whole. In a later window, an invalid byte is replaced
+    // with U+FFFD instead, because parsing the whole body would need as
+    // much memory as Parse() does.
+    String src_window_left;
+    while (!converter.Convert(src_window, &body_, &src_window_left) ||
+        (is_last_window && !src_window_left.is_empty() &&
+         !entry.is_truncated())) {
+      if (is_first_window) {
+        dest->Resize(dest_length);
+        return ExtractTextFromWholeBody(entry, dest);
+      }
+      body_.Append(REPLACEMENT_CHARACTER);
+      src_window = src_window_left.SubString(1);
+    }
+    src_left.set_begin(src_window_left.begin());
 
+    String window = body_.str();
+    if (is_first_window) {
+      while (window.StartsWith(UTF_8_BOM)) {
+        window = window.SubString(UTF_8_BOM.length());
+      }
+      // A body which may be parsed in XML mode is parsed as a whole.
+      if ((parser_mode == HTML_MODE) &&
+          window.StartsWith("<?xml", ToLower())) {
+        return ExtractTextFromWholeBody(entry, dest);
+      }
+      is_first_window = false;
+    }
+
+    String window_left = ParseHtmlWindow(window, is_last_window);
+    AppendUnitsToText(&mode_flags, dest);
+    if (is_last_window) {
+      break;
+    }
+
+    // Moves the unparsed part of the window to the front of the buffer.
+    std::memmove(body_.buf(), window_left.ptr(), window_left.length());
+    body_.Resize(window_left.length());
+  }
+  AppendEndOfLineToText(dest);
+
+  ClearUnits();
+  body_.Clear();
+  parser_mode_ = parser_mode;
+  window_state_ = TEXT_STATE;
+  open_tag_name_.Clear();
+  return true;
+}
+
+// Parses the whole body as Parse() does and leaves the same members as the
+// window-by-window extraction.
+bool HtmlDocument::ExtractTextFromWholeBody(const HtmlArchiveEntry &entry,
+    StringBuilder *dest) {
+  if (!Parse(entry)) {
+    return false;
+  }
+  ExtractText(dest);
+  ClearUnits();
+  body_.Clear();
+  return true;
+}
+
+bool HtmlDocument::IsBlockTag(const String &tag_name) {
+  static const TagNameSet &block_tag_name_set = GetBlockTagNameSet();
+  return block_tag_name_set.find(tag_name) != block_tag_name_set.end();
+}
+
+void HtmlDocument::AppendUnitsToText(int *mode_flags,
+    StringBuilder *dest) const {
   for (std::size_t i = 0; i < num_units(); ++i) {
     const HtmlUnit &unit = this->unit(i);
     switch (unit.type()) {
       case HtmlUnit::TEXT_UNIT: {
-        if ((mode_flags & INVISIBLE_MODE_FLAGS) != 0) {
+        if ((*mode_flags & INVISIBLE_MODE_FLAGS) != 0) {
           break;
         } else if (unit.is_cdata_section() ||
-            ((mode_flags & (PLAIN_MODE_FLAGS | PRE_MODE_FLAGS)) != 0)) {
+            ((*mode_flags & (PLAIN_MODE_FLAGS | PRE_MODE_FLAGS)) != 0)) {
           AppendToText(unit.text_content(), KEEP_END_OF_LINE, dest);
         } else {
           AppendToText(unit.text_content(), REPLACE_END_OF_LINE, dest);
@@ -106,7 +276,7 @@ void HtmlDocument::ExtractText(StringBuilder *dest) {
         break;
       }
       case HtmlUnit::TAG_UNIT: {
-        UpdateTextExtractorModeFlags(unit, &mode_flags);
+        UpdateTextExtractorModeFlags(unit, mode_flags);
         if (IsBlockTag(unit.tag_name())) {
           AppendEndOfLineToText(dest);
         }
@@ -119,12 +289,6 @@ void HtmlDocument::ExtractText(StringBuilder *dest) {
       }
     }
   }
-  AppendEndOfLineToText(dest);
-}
-
-bool HtmlDocument::IsBlockTag(const String &tag_name) {
-  static const TagNameSet &block_tag_name_set = GetBlockTagNameSet();
-  return block_tag_name_set.find(tag_name) != block_tag_name_set.end();
 }
 
 void HtmlDocument::ClearUnits() {
@@ -185,7 +349,9 @@ bool HtmlDocument::ParseAsXml(const String &body) {
   AppendTextUnit(body_left, body_left);
 
   FixTagUnits();
-  FixAttributes();
+  if (attribute_handler_ == NORMALIZE_ATTRIBUTES) {
+    FixAttributes();
+  }
   return true;
 }
 
@@ -193,6 +359,68 @@ bool HtmlDocument::ParseAsHtml(const String &body) {
   ClearUnits();
   parser_mode_ = HTML_MODE;
 
+  ParseHtmlUnits(body, true);
+
+  FixTagUnits();
+  if (attribute_handler_ == NORMALIZE_ATTRIBUTES) {
+    FixAttributes();
+  }
+  return true;
+}
+
+// Parses a window of an HTML body and returns its unparsed part, which must
+// be given again at the beginning of the next window.
+String HtmlDocument::ParseHtmlWindow(const String &window,
+    bool is_last_window) {
+  ClearUnits();
+  parser_mode_ = HTML_MODE;
+
+  String avail = window;
+  switch (window_state_) {
+    case COMMENT_STATE: {
+      String tag_end = avail.Find("-->");
+      if (tag_end.is_empty()) {
+        // Keeps the last 2 bytes because they may be a part of "-->".
+        if (!is_last_window && (avail.length() > 2)) {
+          avail = avail.SubString(avail.length() - 2);
+        }
+        return is_last_window ? avail.SubString(avail.length()) : avail;
+      }
+      avail.set_begin(tag_end.end());
+      window_state_ = TEXT_STATE;
+      break;
+    }
+    case SPECIAL_ELEMENT_STATE: {
+      if (!ParseHtmlSpecialElement(open_tag_name_.str(),
+          is_last_window, &avail)) {
+        FixTagUnits();
+        return avail;
+      }
+      break;
+    }
+    case PLAINTEXT_STATE: {
+      AppendTextUnit(avail, avail, PLAIN_TEXT_FLAG);
+      return avail.SubString(avail.length());
+    }
+    case TEXT_STATE:
+    default: {
+      break;
+    }
+  }
+
+  String window_left = ParseHtmlUnits(avail, is_last_window);
+
+  FixTagUnits();
+  if (attribute_handler_ == NORMALIZE_ATTRIBUTES) {
+    FixAttributes();
+  }
+  return window_left;
+}
+
+// Parses `body' into units and returns its unparsed part. If `body' is not
+// the last window, a unit which may continue in the next window is not
+// parsed, or parsed partially with `window_state_' updated.
+String HtmlDocument::ParseHtmlUnits(const String &body, bool is_last_window) {
   String body_left = body;
   for (String avail = body; !avail.is_empty(); ) {
     String tag(avail.FindFirstOf('<').begin(), avail.end());
@@ -202,12 +430,36 @@ bool HtmlDocument::ParseAsHtml(const String &body) {
       String text_content(body_left.begin(), tag.begin());
       AppendTextUnit(text_content, text_content);
 
+      std::size_t num_units_backup = units_.size();
+      std::size_t num_attributes_backup = attributes_.size();
       if (tag.StartsWith("<!--")) {
         ParseHtmlCommentUnit(&tag);
+        if (!is_last_window && (tag.end() == body.end()) &&
+            ((tag.length() < 7) || !tag.EndsWith("-->"))) {
+          units_.resize(num_units_backup);
+          window_state_ = COMMENT_STATE;
+          String comment = tag.SubString(4);
+          return comment.SubString(comment.length()
+              - ((comment.length() < 2) ? comment.length() : 2));
+        }
       } else if (tag.StartsWith("<!") || tag.StartsWith("<?")) {
         ParseHtmlOtherUnit(&tag);
       } else {
         ParseHtmlTagUnit(&tag);
+      }
+
+      // An incomplete unit is parsed again in the next window, unless it is
+      // too long to be carried over.
+      static const std::size_t MAX_UNIT_LENGTH = 1 << 16;
+      if (!is_last_window && (tag.end() == body.end()) &&
+          (tag.length() < MAX_UNIT_LENGTH) &&
+          (units_.back().type() != HtmlUnit::COMMENT_UNIT)) {
+        units_.resize(num_units_backup);
+        attributes_.resize(num_attributes_backup);
+        return tag;
+      }
+
+      if (units_.back().type() == HtmlUnit::TAG_UNIT) {
         const String &tag_name = units_.back().tag_name();
         if (!units_.back().is_end_tag() &&
             ((tag_name.Compare("script", ToLower()) == 0) ||
@@ -215,10 +467,16 @@ bool HtmlDocument::ParseAsHtml(const String &body) {
              (tag_name.Compare("textarea", ToLower()) == 0) ||
              (tag_name.Compare("xmp", ToLower()) == 0))) {
           avail.set_begin(tag.end());
-          ParseHtmlSpecialTag(avail, tag_name, &tag);
+          if (!ParseHtmlSpecialElement(tag_name, is_last_window, &avail)) {
+            return avail;
+          }
+          tag.set_end(avail.begin());
         } else if (tag_name.Compare("plaintext", ToLower()) == 0) {
           avail.set_begin(tag.end());
           AppendTextUnit(avail, avail, PLAIN_TEXT_FLAG);
+          if (!is_last_window) {
+            window_state_ = PLAINTEXT_STATE;
+          }
           body_left.Clear();
           avail.Clear();
           break;
@@ -230,11 +488,15 @@ bool HtmlDocument::ParseAsHtml(const String &body) {
     }
     avail.set_begin(tag.end());
   }
-  AppendTextUnit(body_left, body_left);
 
-  FixTagUnits();
-  FixAttributes();
-  return true;
+  if (is_last_window) {
+    AppendTextUnit(body_left, body_left);
+    return body_left.SubString(body_left.length());
+  }
+  String window_left = GetWindowTail(body_left);
+  String text_content(body_left.begin(), window_left.begin());
+  AppendTextUnit(text_content, text_content);
+  return window_left;
 }
 
 bool HtmlDocument::ParseXmlTextUnit(String *tag) {
@@ -529,7 +791,61 @@ void HtmlDocument::ParseHtmlOtherUnit(String *tag) {
   AppendOtherUnit(*tag, *tag);
 }
 
-void HtmlDocument::ParseHtmlSpecialTag(const String &body_left,
+// Parses the content of a special element, e.g. <script>, and its end tag.
+// `avail' starts with the content. If the element continues in the next
+// window, ParseHtmlSpecialElement() parses a part of the content, sets
+// `avail' to the unparsed part and returns false.
+bool HtmlDocument::ParseHtmlSpecialElement(const String &tag_name,
+    bool is_last_window, String *avail) {
+  // The tail of the content may be a part of the end tag.
+  static const std::size_t MAX_END_TAG_LENGTH = 64;
+
+  std::size_t num_units_backup = units_.size();
+  std::size_t num_attributes_backup = attributes_.size();
+  String tag;
+  bool has_end_tag = ParseHtmlSpecialTag(*avail, tag_name, &tag);
+  if (has_end_tag && (is_last_window || (tag.end() != avail->end()) ||
+      (tag.length() > MAX_END_TAG_LENGTH))) {
+    avail->set_begin(tag.end());
+    window_state_ = TEXT_STATE;
+    return true;
+  } else if (is_last_window) {
+    AppendTextUnit(*avail, *avail, PLAIN_TEXT_FLAG);
+    avail->set_begin(avail->end());
+    window_state_ = TEXT_STATE;
+    return true;
+  }
+  units_.resize(num_units_backup);
+  attributes_.resize(num_attributes_backup);
+
+  String window_left = GetWindowTail(*avail);
+  if (has_end_tag && (tag.begin() < window_left.begin())) {
+    window_left.set_begin(tag.begin());
+  }
+  // The content of <textarea> is plain text only if the element is not
+  // closed, so it is held until the end tag or the end of the body. Content
+  // longer than a window is not held but parsed as text, as if the element
+  // were closed.
+  if (tag_name.Compare("textarea", ToLower()) == 0) {
+    if (avail->length() < window_size_) {
+      window_left = *avail;
+    } else {
+      String text_content(avail->begin(), window_left.begin());
+      AppendTextUnit(text_content, text_content);
+    }
+  } else {
+    String text_content(avail->begin(), window_left.begin());
+    AppendTextUnit(text_content, text_content, PLAIN_TEXT_FLAG);
+  }
+  if (window_state_ != SPECIAL_ELEMENT_STATE) {
+    open_tag_name_.Assign(tag_name, ToLower());
+    window_state_ = SPECIAL_ELEMENT_STATE;
+  }
+  *avail = window_left;
+  return false;
+}
+
+bool HtmlDocument::ParseHtmlSpecialTag(const String &body_left,
     const String &tag_name, String *tag) {
   for (String avail = body_left; !avail.is_empty(); ) {
     String start_mark = avail.Find("</");
@@ -548,11 +864,11 @@ void HtmlDocument::ParseHtmlSpecialTag(const String &body_left,
           AppendTextUnit(text_content, text_content);
         }
         ParseHtmlTagUnit(tag);
-        return;
+        return true;
       }
     }
   }
-  AppendTextUnit(body_left, body_left, PLAIN_TEXT_FLAG);
+  return false;
 }
 
 void HtmlDocument::AppendTextUnit(const String &src,
@@ -565,7 +881,8 @@ void HtmlDocument::AppendTextUnit(const String &src,
   unit.set_type(HtmlUnit::TEXT_UNIT);
   unit.set_src(src);
   unit.set_text_content(text_content);
-  if ((text_unit_flags & (CDATA_SECTION_FLAG | PLAIN_TEXT_FLAG)) == 0) {
+  if (((text_unit_flags & (CDATA_SECTION_FLAG | PLAIN_TEXT_FLAG)) == 0) &&
+      text_content.Contains('&')) {
     temp_buf_.Clear();
     if (CharacterReference::Decode(text_content, &temp_buf_)) {
       unit.set_text_content(string_pool_.Append(temp_buf_.str()));
@@ -639,6 +956,9 @@ void HtmlDocument::FixAttributes() {
     temp_buf_.Assign(attributes_[i].name(), ToLower());
     attributes_[i].set_name(string_pool_.Append(temp_buf_.str()));
 
+    if (!attributes_[i].value().Contains('&')) {
+      continue;
+    }
     temp_buf_.Clear();
     if (CharacterReference::Decode(attributes_[i].value(), &temp_buf_)) {
       attributes_[i].set_value(string_pool_.Append(temp_buf_.str()));
@@ -646,6 +966,16 @@ void HtmlDocument::FixAttributes() {
   }
 }
 
+// Returns the tail of `text' which may be an incomplete tag or character
+// reference and must not be parsed until the next window is available.
+String HtmlDocument::GetWindowTail(const String &text) {
+  static const std::size_t MAX_TAIL_LENGTH = 64;
+
+  String tail = text.SubString((text.length() > MAX_TAIL_LENGTH) ?
+      (text.length() - MAX_TAIL_LENGTH) : 0);
+  return String(tail.FindFirstOf("<&").begin(), text.end());
+}
+
 void HtmlDocument::AppendEndOfLineToText(StringBuilder *text) {
   if (text->is_empty()) {
     return;
@@ -656,20 +986,33 @@ void HtmlDocument::AppendEndOfLineToText(StringBuilder *text) {
   }
 }
 
+// Spaces are collapsed into one and control characters are removed. Runs of
+// other characters are copied at once.
 void HtmlDocument::AppendToText(const String &str,
     EndOfLineHandler end_of_line_handler, StringBuilder *text) {
-  for (std::size_t i = 0; i < str.length(); ++i) {
-    if (IsSpace()(str[i])) {
-      if (text->is_empty()) {
-        continue;
-      } else if ((end_of_line_handler == KEEP_END_OF_LINE) &&
-          ((str[i] == '\r') || (str[i] == '\n'))) {
-        AppendEndOfLineToText(text);
-      } else if (!IsSpace()((*text)[text->length() - 1])) {
-        text->Append(' ');
-      }
-    } else if (!IsCntrl()(str[i])) {
-      text->Append(str[i]);
+  text->Reserve(text->length() + str.length());
+
+  bool ends_with_space = !text->is_empty() &&
+      IsSpace()((*text)[text->length() - 1]);
+  for (const char *avail = str.begin(); avail < str.end(); ) {
+    const char *run_end = FindSpaceOrCntrl(avail, str.end());
+    if (run_end != avail) {
+      text->Append(avail, run_end - avail);
+      ends_with_space = false;
+      avail = run_end;
+      continue;
+    }
+
+    char c = *avail++;
+    if (!IsSpace()(c) || text->is_empty()) {
+      continue;
+    } else if ((end_of_line_handler == KEEP_END_OF_LINE) &&
+        ((c == '\r') || (c == '\n'))) {
+      AppendEndOfLineToText(text);
+      ends_with_space = true;
+    } else if (!ends_with_space) {
+      text->Append(' ');
+      ends_with_space = true;
     }
   }
 }
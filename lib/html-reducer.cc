@@ -13,6 +13,8 @@ void HtmlReducer::Reduce(const HtmlDocument &src, StringBuilder *dest) {
 
 void HtmlReducer::Reduce(const HtmlDocument &src) {
   dest_->Clear();
+  has_raw_attributes_ =
+      (src.attribute_handler() == HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
   for (std::size_t i = 0; i < src.num_units(); ++i) {
     const nwc_toolkit::HtmlUnit &unit = src.unit(i);
     switch (unit.type()) {
@@ -55,11 +57,19 @@ void HtmlReducer::ReduceTag(const nwc_toolkit::HtmlUnit &unit) {
   }
   dest_->Append(unit.tag_name());
   for (std::size_t i = 0; i < unit.num_attributes(); ++i) {
+    // Raw attributes are normalized here, only if they are used.
     const nwc_toolkit::HtmlAttribute &attribute = unit.attribute(i);
-    if ((attribute.name() == "class") || (attribute.name() == "id") ||
-        (attribute.name() == "name")) {
-      dest_->Append(' ').Append(attribute.name()).Append("=\"");
-      nwc_toolkit::CharacterReference::Encode(attribute.value(), dest_,
+    if ((attribute.name().Compare("class", ToLower()) == 0) ||
+        (attribute.name().Compare("id", ToLower()) == 0) ||
+        (attribute.name().Compare("name", ToLower()) == 0)) {
+      dest_->Append(' ').Append(attribute.name(), ToLower()).Append("=\"");
+      String value = attribute.value();
+      if (has_raw_attributes_ && value.Contains('&')) {
+        value_buf_.Clear();
+        nwc_toolkit::CharacterReference::Decode(value, &value_buf_);
+        value = value_buf_.str();
+      }
+      nwc_toolkit::CharacterReference::Encode(value, dest_,
           nwc_toolkit::CharacterReference::EncodeQuotes());
       dest_->Append('"');
     }
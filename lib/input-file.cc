@@ -87,6 +87,25 @@ bool InputFile::Read(std::size_t size, String *data) {
   return true;
 }
 
+bool InputFile::Skip(std::size_t size) {
+  if (!is_open()) {
+    return false;
+  }
+
+  while (size > avail_) {
+    size -= avail_;
+    next_ += avail_;
+    avail_ = 0;
+    ShiftToFront(0);
+    if (!FillBuf()) {
+      return false;
+    }
+  }
+  next_ += size;
+  avail_ -= size;
+  return true;
+}
+
 bool InputFile::ReadLine(char delim, String *line) {
   if (!is_open()) {
     return false;
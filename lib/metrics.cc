@@ -0,0 +1,311 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <nwc-toolkit/metrics.h>
+
+#include <stdio.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <ctime>
+
+namespace nwc_toolkit {
+namespace {
+
+const double HISTOGRAM_UPPER_BOUNDS[] = {
+  0.000001, 0.00001, 0.0001, 0.001, 0.01, 0.1, 1.0, 10.0, 100.0
+};
+
+// Returns the resident set size in bytes, or 0 if it is not available.
+long long GetResidentSetSize() {
+  long long size = 0;
+  long long resident = 0;
+  std::FILE *file = std::fopen("/proc/self/statm", "r");
+  if (file == NULL) {
+    return 0;
+  }
+  if (std::fscanf(file, "%lld %lld", &size, &resident) != 2) {
+    resident = 0;
+  }
+  std::fclose(file);
+  return resident * ::sysconf(_SC_PAGESIZE);
+}
+
+double ToSeconds(const struct ::timeval &tv) {
+  return tv.tv_sec + (tv.tv_usec / 1000000.0);
+}
+
+}  // namespace
+
+Metrics::Histogram::Histogram(const String &name)
+    : name_(name.ptr(), name.length()), count_(0), sum_(0.0), buckets_() {
+  for (std::size_t i = 0; i < NUM_BUCKETS; ++i) {
+    buckets_[i] = 0;
+  }
+}
+
+double Metrics::Histogram::upper_bound(std::size_t index) {
+  return HISTOGRAM_UPPER_BOUNDS[index];
+}
+
+void Metrics::Histogram::Observe(double value) {
+  ++count_;
+  sum_ += value;
+  std::size_t index = 0;
+  while ((index < NUM_BOUNDED_BUCKETS) &&
+      (value > HISTOGRAM_UPPER_BOUNDS[index])) {
+    ++index;
+  }
+  ++buckets_[index];
+}
+
+Metrics::Metrics()
+    : job_(),
+      path_(),
+      format_(JSON_LINES_FORMAT),
+      interval_(DEFAULT_INTERVAL),
+      start_time_(GetTime()),
+      last_time_(start_time_),
+      counters_(),
+      gauges_(),
+      histograms_() {}
+
+bool Metrics::Open(const String &job, const String &path, double interval) {
+  Close();
+  if (path.is_empty() || (interval <= 0.0)) {
+    return false;
+  }
+
+  std::string path_str(path.ptr(), path.length());
+  std::FILE *file = std::fopen(path_str.c_str(), "a");
+  if (file == NULL) {
+    return false;
+  }
+  std::fclose(file);
+
+  job_.assign(job.ptr(), job.length());
+  path_ = path_str;
+  format_ = ((path.length() > 5) && (path.SubString(path.length() - 5) ==
+      ".prom")) ? PROMETHEUS_FORMAT : JSON_LINES_FORMAT;
+  interval_ = interval;
+  last_time_ = GetTime();
+  return true;
+}
+
+Metrics::~Metrics() {
+  Close();
+  for (std::size_t i = 0; i < counters_.size(); ++i) {
+    delete counters_[i];
+  }
+  for (std::size_t i = 0; i < gauges_.size(); ++i) {
+    delete gauges_[i];
+  }
+  for (std::size_t i = 0; i < histograms_.size(); ++i) {
+    delete histograms_[i];
+  }
+}
+
+void Metrics::Close() {
+  if (is_open()) {
+    Flush();
+    path_.clear();
+  }
+}
+
+Metrics::Counter *Metrics::AddCounter(const String &name) {
+  counters_.push_back(new Counter(name));
+  return counters_.back();
+}
+
+Metrics::Gauge *Metrics::AddGauge(const String &name) {
+  gauges_.push_back(new Gauge(name));
+  return gauges_.back();
+}
+
+Metrics::Histogram *Metrics::AddHistogram(const String &name) {
+  histograms_.push_back(new Histogram(name));
+  return histograms_.back();
+}
+
+bool Metrics::Update() {
+  if (!is_open()) {
+    return true;
+  }
+  double now = GetTime();
+  if ((now - last_time_) < interval_) {
+    return true;
+  }
+  return Flush();
+}
+
+bool Metrics::Flush() {
+  if (!is_open()) {
+    return false;
+  }
+  double now = GetTime();
+  bool is_ok = (format_ == PROMETHEUS_FORMAT) ?
+      WritePrometheusFile(now) : WriteJsonLine(now);
+  for (std::size_t i = 0; i < counters_.size(); ++i) {
+    counters_[i]->last_value_ = counters_[i]->value_;
+  }
+  last_time_ = now;
+  return is_ok;
+}
+
+double Metrics::GetTime() {
+  struct ::timespec ts;
+  ::clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+bool Metrics::WriteJsonLine(double now) {
+  std::FILE *file = std::fopen(path_.c_str(), "a");
+  if (file == NULL) {
+    return false;
+  }
+
+  double period = now - last_time_;
+  std::fprintf(file, "{\"job\":\"%s\",\"pid\":%ld,\"time\":%ld,"
+      "\"elapsed\":%.3f", job_.c_str(), static_cast<long>(::getpid()),
+      static_cast<long>(std::time(NULL)), now - start_time_);
+  WriteProcessStatus(file, true);
+
+  std::fprintf(file, ",\"counters\":{");
+  for (std::size_t i = 0; i < counters_.size(); ++i) {
+    const Counter &counter = *counters_[i];
+    double rate = (period > 0.0) ?
+        ((counter.value_ - counter.last_value_) / period) : 0.0;
+    std::fprintf(file, "%s\"%s\":{\"value\":%lld,\"rate\":%.3f}",
+        (i != 0) ? "," : "", counter.name_.c_str(), counter.value_, rate);
+  }
+  std::fprintf(file, "},\"gauges\":{");
+  for (std::size_t i = 0; i < gauges_.size(); ++i) {
+    std::fprintf(file, "%s\"%s\":%.6g", (i != 0) ? "," : "",
+        gauges_[i]->name().c_str(), gauges_[i]->value());
+  }
+  std::fprintf(file, "},\"histograms\":{");
+  for (std::size_t i = 0; i < histograms_.size(); ++i) {
+    const Histogram &histogram = *histograms_[i];
+    std::fprintf(file, "%s\"%s\":{\"count\":%lld,\"sum\":%.6f,\"buckets\":[",
+        (i != 0) ? "," : "", histogram.name().c_str(),
+        histogram.count(), histogram.sum());
+    for (std::size_t j = 0; j < Histogram::NUM_BUCKETS; ++j) {
+      std::fprintf(file, "%s%lld", (j != 0) ? "," : "", histogram.bucket(j));
+    }
+    std::fprintf(file, "]}");
+  }
+  std::fprintf(file, "}}\n");
+
+  bool is_ok = !std::ferror(file);
+  return (std::fclose(file) == 0) && is_ok;
+}
+
+// The file is written to a temporary file and then renamed so that a
+// collector never reads a partial snapshot.
+bool Metrics::WritePrometheusFile(double now) {
+  std::string temp_path = path_ + ".tmp";
+  std::FILE *file = std::fopen(temp_path.c_str(), "w");
+  if (file == NULL) {
+    return false;
+  }
+
+  const char *job = job_.c_str();
+  std::fprintf(file, "# TYPE nwc_toolkit_elapsed_seconds gauge\n"
+      "nwc_toolkit_elapsed_seconds{job=\"%s\"} %.3f\n",
+      job, now - start_time_);
+  WriteProcessStatus(file, false);
+
+  for (std::size_t i = 0; i < counters_.size(); ++i) {
+    const char *name = counters_[i]->name().c_str();
+    std::fprintf(file, "# TYPE nwc_toolkit_%s_total counter\n"
+        "nwc_toolkit_%s_total{job=\"%s\"} %lld\n",
+        name, name, job, counters_[i]->value());
+  }
+  for (std::size_t i = 0; i < gauges_.size(); ++i) {
+    const char *name = gauges_[i]->name().c_str();
+    std::fprintf(file, "# TYPE nwc_toolkit_%s gauge\n"
+        "nwc_toolkit_%s{job=\"%s\"} %.6g\n",
+        name, name, job, gauges_[i]->value());
+  }
+  for (std::size_t i = 0; i < histograms_.size(); ++i) {
+    const Histogram &histogram = *histograms_[i];
+    const char *name = histogram.name().c_str();
+    std::fprintf(file, "# TYPE nwc_toolkit_%s histogram\n", name);
+    long long count = 0;
+    for (std::size_t j = 0; j < Histogram::NUM_BOUNDED_BUCKETS; ++j) {
+      count += histogram.bucket(j);
+      std::fprintf(file, "nwc_toolkit_%s_bucket{job=\"%s\",le=\"%g\"} %lld\n",
+          name, job, Histogram::upper_bound(j), count);
+    }
+    std::fprintf(file, "nwc_toolkit_%s_bucket{job=\"%s\",le=\"+Inf\"} %lld\n"
+        "nwc_toolkit_%s_sum{job=\"%s\"} %.6f\n"
+        "nwc_toolkit_%s_count{job=\"%s\"} %lld\n",
+        name, job, histogram.count(), name, job, histogram.sum(),
+        name, job, histogram.count());
+  }
+
+  bool is_ok = !std::ferror(file);
+  if ((std::fclose(file) != 0) || !is_ok) {
+    return false;
+  }
+  return std::rename(temp_path.c_str(), path_.c_str()) == 0;
+}
+
+void Metrics::WriteProcessStatus(std::FILE *file, bool is_json) const {
+  struct ::rusage usage;
+  if (::getrusage(RUSAGE_SELF, &usage) != 0) {
+    return;
+  }
+  long long rss = GetResidentSetSize();
+  long long peak_rss = static_cast<long long>(usage.ru_maxrss) * 1024;
+  double cpu_seconds = ToSeconds(usage.ru_utime) + ToSeconds(usage.ru_stime);
+  if (is_json) {
+    std::fprintf(file, ",\"rss_bytes\":%lld,\"peak_rss_bytes\":%lld,"
+        "\"cpu_seconds\":%.3f", rss, peak_rss, cpu_seconds);
+  } else {
+    const char *job = job_.c_str();
+    std::fprintf(file, "# TYPE nwc_toolkit_rss_bytes gauge\n"
+        "nwc_toolkit_rss_bytes{job=\"%s\"} %lld\n"
+        "# TYPE nwc_toolkit_peak_rss_bytes gauge\n"
+        "nwc_toolkit_peak_rss_bytes{job=\"%s\"} %lld\n"
+        "# TYPE nwc_toolkit_cpu_seconds_total counter\n"
+        "nwc_toolkit_cpu_seconds_total{job=\"%s\"} %.3f\n",
+        job, rss, job, peak_rss, job, cpu_seconds);
+  }
+}
+
+bool MetricsOptions::Parse(int option, const char *arg) {
+  switch (option) {
+    case METRICS_OPTION: {
+      path_ = arg;
+      return true;
+    }
+    case METRICS_INTERVAL_OPTION: {
+      char *end_of_value;
+      double interval = std::strtod(arg, &end_of_value);
+      if ((*end_of_value != '\0') || !(interval > 0.0)) {
+        return false;
+      }
+      interval_ = interval;
+      return true;
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
+bool MetricsOptions::Open(const String &job, Metrics *metrics) const {
+  return path_.is_empty() || metrics->Open(job, path_, interval_);
+}
+
+const char *MetricsOptions::help() {
+  return "      --metrics=[FILE] export metrics to FILE periodically\n"
+      "                       in Prometheus format if FILE ends with .prom,\n"
+      "                       or in JSON lines otherwise\n"
+      "      --metrics-interval=[N]\n"
+      "                       export metrics every N seconds (default: 10)\n";
+}
+
+}  // namespace nwc_toolkit
@@ -0,0 +1,274 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <nwc-toolkit/min-hash.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif  // __SSE2__
+
+// The AVX2 kernel is compiled with a target attribute and chosen at
+// runtime, so the library runs on CPUs without AVX2.
+#if defined(__GNUC__) && !defined(__clang__) && \
+    ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9))) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define NWC_TOOLKIT_MIN_HASH_AVX2
+#include <immintrin.h>
+#endif  // defined(__GNUC__) && ...
+
+#include <tr1/random>
+
+#include <nwc-toolkit/string-hash.h>
+
+namespace nwc_toolkit {
+namespace {
+
+// Seeds of the hash functions are fixed, so that signatures can be
+// compared across processes.
+enum { SEED_OF_SEEDS = 0x5EED };
+
+bool IsSpaceByte(unsigned char byte) {
+  return (byte == ' ') || (byte == '\t') || (byte == '\n') ||
+      (byte == '\r') || (byte == '\f') || (byte == '\v');
+}
+
+// The finalizer of MurmurHash3, which is a bijection on 32-bit integers.
+unsigned int Mix(unsigned int x) {
+  x ^= x >> 16;
+  x *= 0x85EBCA6BU;
+  x ^= x >> 13;
+  x *= 0xC2B2AE35U;
+  x ^= x >> 16;
+  return x;
+}
+
+#ifdef __SSE2__
+
+// SSE2 has no 32-bit multiplication, so odd and even lanes are multiplied
+// separately and the lower halves are interleaved.
+__m128i MultiplyLow(__m128i x, __m128i y) {
+  __m128i even = _mm_mul_epu32(x, y);
+  __m128i odd = _mm_mul_epu32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+      _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+__m128i Mix(__m128i x) {
+  x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+  x = MultiplyLow(x, _mm_set1_epi32(static_cast<int>(0x85EBCA6BU)));
+  x = _mm_xor_si128(x, _mm_srli_epi32(x, 13));
+  x = MultiplyLow(x, _mm_set1_epi32(static_cast<int>(0xC2B2AE35U)));
+  x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+  return x;
+}
+
+#endif  // __SSE2__
+
+#ifdef NWC_TOOLKIT_MIN_HASH_AVX2
+
+bool HasAvx2() {
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2;
+}
+
+// AVX2 has 32-bit multiplication and unsigned minimums, and processes 8
+// hash functions at once. Returns the number of processed hash functions.
+__attribute__((target("avx2")))
+std::size_t UpdateValuesWithAvx2(const std::vector<unsigned int> &seeds,
+    const std::vector<unsigned int> &shingle_hashes,
+    std::vector<unsigned int> *values) {
+  const __m256i multiplier_1 = _mm256_set1_epi32(
+      static_cast<int>(0x85EBCA6BU));
+  const __m256i multiplier_2 = _mm256_set1_epi32(
+      static_cast<int>(0xC2B2AE35U));
+  std::size_t i = 0;
+  for ( ; i + 8 <= seeds.size(); i += 8) {
+    __m256i seed = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i *>(&seeds[i]));
+    __m256i min_values = _mm256_set1_epi32(-1);
+    for (std::size_t j = 0; j < shingle_hashes.size(); ++j) {
+      __m256i x = _mm256_xor_si256(
+          _mm256_set1_epi32(static_cast<int>(shingle_hashes[j])), seed);
+      x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+      x = _mm256_mullo_epi32(x, multiplier_1);
+      x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 13));
+      x = _mm256_mullo_epi32(x, multiplier_2);
+      x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+      min_values = _mm256_min_epu32(min_values, x);
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&(*values)[i]),
+        min_values);
+  }
+  return i;
+}
+
+#endif  // NWC_TOOLKIT_MIN_HASH_AVX2
+
+}  // namespace
+
+MinHash::MinHash()
+    : num_bands_(0),
+      num_rows_(0),
+      shingle_size_(0),
+      seeds_(),
+      values_(),
+      char_codes_(),
+      shingle_hashes_() {
+  Reset();
+}
+
+unsigned long long MinHash::band_key(std::size_t band_id) const {
+  String band(reinterpret_cast<const char *>(&values_[band_id * num_rows_]),
+      sizeof(unsigned int) * num_rows_);
+  return StringHash64()(band) ^ ((band_id + 1) * 0x9E3779B97F4A7C15ULL);
+}
+
+bool MinHash::Reset(std::size_t num_bands, std::size_t num_rows,
+    std::size_t shingle_size) {
+  if (num_bands == 0) {
+    num_bands = DEFAULT_NUM_BANDS;
+  }
+  if (num_rows == 0) {
+    num_rows = DEFAULT_NUM_ROWS;
+  }
+  if (shingle_size == 0) {
+    shingle_size = DEFAULT_SHINGLE_SIZE;
+  }
+  if ((num_bands > MAX_NUM_HASHES) || (num_rows > MAX_NUM_HASHES) ||
+      ((num_bands * num_rows) > MAX_NUM_HASHES)) {
+    return false;
+  }
+  num_bands_ = num_bands;
+  num_rows_ = num_rows;
+  shingle_size_ = shingle_size;
+
+  std::tr1::mt19937 mt_rand(SEED_OF_SEEDS);
+  seeds_.resize(num_bands_ * num_rows_);
+  for (std::size_t i = 0; i < seeds_.size(); ++i) {
+    seeds_[i] = static_cast<unsigned int>(mt_rand());
+  }
+  values_.resize(seeds_.size());
+  Clear();
+  return true;
+}
+
+void MinHash::Clear() {
+  values_.assign(values_.size(), ~0U);
+  char_codes_.clear();
+  shingle_hashes_.clear();
+}
+
+bool MinHash::Calculate(const String &text) {
+  ExtractChars(text);
+  HashShingles();
+  UpdateValues();
+  return !shingle_hashes_.empty();
+}
+
+double MinHash::EstimateSimilarity(const MinHash &lhs, const MinHash &rhs) {
+  if (lhs.num_hashes() == 0) {
+    return 0.0;
+  }
+  return EstimateSimilarity(&lhs.values_[0], &rhs.values_[0],
+      lhs.num_hashes());
+}
+
+double MinHash::EstimateSimilarity(const unsigned int *lhs,
+    const unsigned int *rhs, std::size_t num_hashes) {
+  if (num_hashes == 0) {
+    return 0.0;
+  }
+  std::size_t num_matches = 0;
+  for (std::size_t i = 0; i < num_hashes; ++i) {
+    if (lhs[i] == rhs[i]) {
+      ++num_matches;
+    }
+  }
+  return static_cast<double>(num_matches) / num_hashes;
+}
+
+// Removes white spaces and packs the bytes of each UTF-8 character into
+// an integer. Bytes of other encodings are also accepted and split at the
+// same positions.
+void MinHash::ExtractChars(const String &text) {
+  char_codes_.clear();
+  for (std::size_t i = 0; i < text.length(); ++i) {
+    unsigned char byte = static_cast<unsigned char>(text[i]);
+    if (IsSpaceByte(byte)) {
+      continue;
+    } else if (((byte & 0xC0) != 0x80) || char_codes_.empty()) {
+      char_codes_.push_back(byte);
+    } else {
+      char_codes_.back() = (char_codes_.back() << 8) | byte;
+    }
+  }
+}
+
+// Shingles are hashed by a rolling polynomial hash, so each shingle takes
+// O(1) time. A text shorter than a shingle is handled as one shingle.
+void MinHash::HashShingles() {
+  const unsigned long long BASE = 0x100000001B3ULL;
+  const unsigned long long MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+  shingle_hashes_.clear();
+  if (char_codes_.empty()) {
+    return;
+  }
+  std::size_t shingle_size = (char_codes_.size() > shingle_size_) ?
+      shingle_size_ : char_codes_.size();
+  unsigned long long hash = 0;
+  unsigned long long power = 1;
+  for (std::size_t i = 0; i < shingle_size; ++i) {
+    hash = (hash * BASE) + char_codes_[i];
+    power *= BASE;
+  }
+  shingle_hashes_.push_back(
+      static_cast<unsigned int>((hash * MULTIPLIER) >> 32));
+  for (std::size_t i = shingle_size; i < char_codes_.size(); ++i) {
+    hash = (hash * BASE) + char_codes_[i] -
+        (char_codes_[i - shingle_size] * power);
+    shingle_hashes_.push_back(
+        static_cast<unsigned int>((hash * MULTIPLIER) >> 32));
+  }
+}
+
+// The i-th hash function is Mix(x ^ seeds_[i]). SSE2 has no unsigned
+// minimums, so they are taken as signed ones by flipping the highest bits.
+void MinHash::UpdateValues() {
+  std::size_t i = 0;
+#ifdef NWC_TOOLKIT_MIN_HASH_AVX2
+  if (HasAvx2()) {
+    i = UpdateValuesWithAvx2(seeds_, shingle_hashes_, &values_);
+  }
+#endif  // NWC_TOOLKIT_MIN_HASH_AVX2
+#ifdef __SSE2__
+  const __m128i flip = _mm_set1_epi32(static_cast<int>(0x80000000U));
+  for ( ; i + 4 <= seeds_.size(); i += 4) {
+    __m128i seeds = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(&seeds_[i]));
+    __m128i min_values = _mm_set1_epi32(0x7FFFFFFF);
+    for (std::size_t j = 0; j < shingle_hashes_.size(); ++j) {
+      __m128i x = _mm_xor_si128(
+          _mm_set1_epi32(static_cast<int>(shingle_hashes_[j])), seeds);
+      x = _mm_xor_si128(Mix(x), flip);
+      __m128i is_less = _mm_cmplt_epi32(x, min_values);
+      min_values = _mm_or_si128(_mm_and_si128(is_less, x),
+          _mm_andnot_si128(is_less, min_values));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&values_[i]),
+        _mm_xor_si128(min_values, flip));
+  }
+#endif  // __SSE2__
+
+  for ( ; i < seeds_.size(); ++i) {
+    unsigned int min_value = ~0U;
+    for (std::size_t j = 0; j < shingle_hashes_.size(); ++j) {
+      unsigned int value = Mix(shingle_hashes_[j] ^ seeds_[i]);
+      if (value < min_value) {
+        min_value = value;
+      }
+    }
+    values_[i] = min_value;
+  }
+}
+
+}  // namespace nwc_toolkit
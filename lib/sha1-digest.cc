@@ -4,7 +4,361 @@
 
 #include <cstring>
 
+// The kernels for x86 are compiled with target attributes and chosen at
+// runtime, so the library runs on CPUs without them.
+#if defined(__GNUC__) && !defined(__clang__) && \
+    ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9))) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define NWC_TOOLKIT_SHA1_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#endif  // defined(__GNUC__) && ...
+
 namespace nwc_toolkit {
+namespace {
+
+const unsigned int INITIAL_DIGEST[] = {
+  0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0
+};
+
+const unsigned int MAGIC_NUMBERS[] = {
+  0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6
+};
+
+inline unsigned int ReadWord(const unsigned char *bytes) {
+  return (static_cast<unsigned int>(bytes[0]) << 24)
+      | (static_cast<unsigned int>(bytes[1]) << 16)
+      | (static_cast<unsigned int>(bytes[2]) << 8)
+      | static_cast<unsigned int>(bytes[3]);
+}
+
+// Builds the last blocks of a message from its last `tail_length' bytes,
+// where `length' is the length of the whole message. `blocks' must have
+// 128 bytes, and the number of blocks (1 or 2) is returned.
+std::size_t PadMessage(const unsigned char *tail, std::size_t tail_length,
+    unsigned long long length, unsigned char *blocks) {
+  std::size_t num_blocks = (tail_length < 56) ? 1 : 2;
+  std::memcpy(blocks, tail, tail_length);
+  blocks[tail_length] = 0x80;
+  std::memset(blocks + tail_length + 1, 0,
+      (num_blocks * 64) - tail_length - 1);
+  unsigned char *length_bytes = blocks + (num_blocks * 64) - 8;
+  for (int i = 0; i < 8; ++i) {
+    length_bytes[i] = static_cast<unsigned char>(
+        (length * 8) >> ((7 - i) * 8));
+  }
+  return num_blocks;
+}
+
+#ifdef NWC_TOOLKIT_SHA1_X86
+
+struct CpuFeatures {
+  CpuFeatures() : has_sse2(false), has_avx2(false), has_sha(false) {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+      return;
+    }
+    has_sse2 = (edx & (1U << 26)) != 0;
+    bool has_ssse3 = (ecx & (1U << 9)) != 0;
+    bool has_sse41 = (ecx & (1U << 19)) != 0;
+    bool has_ymm_state = false;
+    if ((ecx & (1U << 27)) && (ecx & (1U << 28))) {
+      // OSXSAVE and AVX: the OS must save the YMM registers.
+      unsigned int xcr0_low, xcr0_high;
+      __asm__ __volatile__("xgetbv"
+          : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+      has_ymm_state = (xcr0_low & 6) == 6;
+    }
+    if (__get_cpuid_max(0, NULL) < 7) {
+      return;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    has_avx2 = has_ymm_state && ((ebx & (1U << 5)) != 0);
+    has_sha = has_ssse3 && has_sse41 && ((ebx & (1U << 29)) != 0);
+  }
+
+  bool has_sse2;
+  bool has_avx2;
+  bool has_sha;
+};
+
+const CpuFeatures &GetCpuFeatures() {
+  static const CpuFeatures cpu_features;
+  return cpu_features;
+}
+
+// The SHA extensions process 4 rounds per instruction. Group `G' is rounds
+// 4G to 4G + 3, and the message words of a group are prepared by sha1msg1,
+// xor and sha1msg2 in the 3 preceding groups.
+template <int G>
+__attribute__((target("sha,ssse3,sse4.1"), always_inline))
+inline void ShaRounds(__m128i *abcd, __m128i *es, __m128i *messages) {
+  __m128i &e = es[G & 1];
+  __m128i &next_e = es[(G & 1) ^ 1];
+  if (G == 0) {
+    e = _mm_add_epi32(e, messages[0]);
+  } else {
+    e = _mm_sha1nexte_epu32(e, messages[G & 3]);
+  }
+  next_e = *abcd;
+  if ((G >= 3) && (G <= 18)) {
+    messages[(G + 1) & 3] =
+        _mm_sha1msg2_epu32(messages[(G + 1) & 3], messages[G & 3]);
+  }
+  *abcd = _mm_sha1rnds4_epu32(*abcd, e, G / 5);
+  if ((G >= 1) && (G <= 16)) {
+    messages[(G + 3) & 3] =
+        _mm_sha1msg1_epu32(messages[(G + 3) & 3], messages[G & 3]);
+  }
+  if ((G >= 2) && (G <= 17)) {
+    messages[(G + 2) & 3] =
+        _mm_xor_si128(messages[(G + 2) & 3], messages[G & 3]);
+  }
+}
+
+__attribute__((target("sha,ssse3,sse4.1")))
+void ProcessBlocksWithSha(unsigned int *digest,
+    const unsigned char *blocks, std::size_t num_blocks) {
+  const __m128i byte_order =
+      _mm_set_epi64x(0x0001020304050607ULL, 0x08090A0B0C0D0E0FULL);
+
+  __m128i abcd = _mm_shuffle_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(digest)), 0x1B);
+  __m128i e = _mm_set_epi32(static_cast<int>(digest[4]), 0, 0, 0);
+  for (std::size_t i = 0; i < num_blocks; ++i, blocks += 64) {
+    __m128i messages[4];
+    for (int j = 0; j < 4; ++j) {
+      messages[j] = _mm_shuffle_epi8(_mm_loadu_si128(
+          reinterpret_cast<const __m128i *>(blocks + (j * 16))), byte_order);
+    }
+    __m128i prev_abcd = abcd;
+    __m128i es[2] = { e, _mm_setzero_si128() };
+
+    ShaRounds<0>(&abcd, es, messages);
+    ShaRounds<1>(&abcd, es, messages);
+    ShaRounds<2>(&abcd, es, messages);
+    ShaRounds<3>(&abcd, es, messages);
+    ShaRounds<4>(&abcd, es, messages);
+    ShaRounds<5>(&abcd, es, messages);
+    ShaRounds<6>(&abcd, es, messages);
+    ShaRounds<7>(&abcd, es, messages);
+    ShaRounds<8>(&abcd, es, messages);
+    ShaRounds<9>(&abcd, es, messages);
+    ShaRounds<10>(&abcd, es, messages);
+    ShaRounds<11>(&abcd, es, messages);
+    ShaRounds<12>(&abcd, es, messages);
+    ShaRounds<13>(&abcd, es, messages);
+    ShaRounds<14>(&abcd, es, messages);
+    ShaRounds<15>(&abcd, es, messages);
+    ShaRounds<16>(&abcd, es, messages);
+    ShaRounds<17>(&abcd, es, messages);
+    ShaRounds<18>(&abcd, es, messages);
+    ShaRounds<19>(&abcd, es, messages);
+
+    // After group 19, es[0] has the state from which e is derived.
+    e = _mm_sha1nexte_epu32(es[0], e);
+    abcd = _mm_add_epi32(abcd, prev_abcd);
+  }
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(digest),
+      _mm_shuffle_epi32(abcd, 0x1B));
+  digest[4] = static_cast<unsigned int>(_mm_extract_epi32(e, 3));
+}
+
+// Lanes are GCC vector extensions, so the same code is compiled into SSE2
+// or AVX2 instructions depending on the target of the caller.
+typedef unsigned int Lanes4 __attribute__((vector_size(16)));
+typedef unsigned int Lanes8 __attribute__((vector_size(32)));
+
+template <typename Lanes>
+__attribute__((always_inline))
+inline void RotateLanes(int num_bits, Lanes *lanes) {
+  *lanes = (*lanes << num_bits) | (*lanes >> (32 - num_bits));
+}
+
+// Processes one block for each lane. The blocks are transposed so that
+// each vector has the same word of all the lanes.
+template <typename Lanes>
+__attribute__((always_inline))
+inline void ProcessBlockInLanes(Lanes *digest,
+    const unsigned char * const *blocks) {
+  enum { NUM_LANES = sizeof(Lanes) / sizeof(unsigned int) };
+
+  Lanes words[16];
+  for (int i = 0; i < 16; ++i) {
+    for (int j = 0; j < NUM_LANES; ++j) {
+      words[i][j] = ReadWord(blocks[j] + (i * 4));
+    }
+  }
+
+  Lanes magic_numbers[4];
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < NUM_LANES; ++j) {
+      magic_numbers[i][j] = MAGIC_NUMBERS[i];
+    }
+  }
+
+  Lanes a = digest[0];
+  Lanes b = digest[1];
+  Lanes c = digest[2];
+  Lanes d = digest[3];
+  Lanes e = digest[4];
+  for (int i = 0; i < 80; ++i) {
+    Lanes word = words[i & 15];
+    if (i >= 16) {
+      word = words[(i - 3) & 15] ^ words[(i - 8) & 15]
+          ^ words[(i - 14) & 15] ^ words[i & 15];
+      RotateLanes(1, &word);
+      words[i & 15] = word;
+    }
+    Lanes f;
+    if (i < 20) {
+      f = (b & c) | (~b & d);
+    } else if ((i >= 40) && (i < 60)) {
+      f = (b & c) | (b & d) | (c & d);
+    } else {
+      f = b ^ c ^ d;
+    }
+    Lanes temp = a;
+    RotateLanes(5, &temp);
+    temp += f + e + magic_numbers[i / 20] + word;
+    e = d;
+    d = c;
+    c = b;
+    RotateLanes(30, &c);
+    b = a;
+    a = temp;
+  }
+  digest[0] += a;
+  digest[1] += b;
+  digest[2] += c;
+  digest[3] += d;
+  digest[4] += e;
+}
+
+// Each lane hashes one message at a time and takes the next message when
+// it finishes, so that messages of different lengths keep the lanes busy.
+template <typename Lanes>
+__attribute__((always_inline))
+inline void CalculateInLanes(const String *messages,
+    unsigned int * const *digests, std::size_t num_messages) {
+  enum { NUM_LANES = sizeof(Lanes) / sizeof(unsigned int) };
+  static const unsigned char EMPTY_BLOCK[64] = {};
+
+  Lanes lane_digest[5];
+  const unsigned char *blocks[NUM_LANES];
+  std::size_t message_ids[NUM_LANES];
+  std::size_t block_ids[NUM_LANES];
+  std::size_t num_full_blocks[NUM_LANES];
+  std::size_t num_blocks[NUM_LANES];
+  unsigned char last_blocks[NUM_LANES][128];
+
+  std::size_t num_busy_lanes = 0;
+  std::size_t next_message_id = 0;
+  for (int i = 0; i < NUM_LANES; ++i) {
+    message_ids[i] = num_messages;
+  }
+  for ( ; ; ) {
+    for (int i = 0; i < NUM_LANES; ++i) {
+      if ((message_ids[i] == num_messages) &&
+          (next_message_id < num_messages)) {
+        const String &message = messages[next_message_id];
+        const unsigned char *bytes =
+            reinterpret_cast<const unsigned char *>(message.ptr());
+        message_ids[i] = next_message_id++;
+        block_ids[i] = 0;
+        num_full_blocks[i] = message.length() / 64;
+        num_blocks[i] = num_full_blocks[i] + PadMessage(
+            bytes + (num_full_blocks[i] * 64), message.length() % 64,
+            message.length(), last_blocks[i]);
+        for (int j = 0; j < 5; ++j) {
+          lane_digest[j][i] = INITIAL_DIGEST[j];
+        }
+        ++num_busy_lanes;
+      }
+      if (message_ids[i] == num_messages) {
+        blocks[i] = EMPTY_BLOCK;
+      } else if (block_ids[i] < num_full_blocks[i]) {
+        blocks[i] = reinterpret_cast<const unsigned char *>(
+            messages[message_ids[i]].ptr()) + (block_ids[i] * 64);
+      } else {
+        blocks[i] = last_blocks[i] + ((block_ids[i] - num_full_blocks[i]) * 64);
+      }
+    }
+    if (num_busy_lanes == 0) {
+      break;
+    }
+
+    ProcessBlockInLanes(lane_digest, blocks);
+
+    for (int i = 0; i < NUM_LANES; ++i) {
+      if ((message_ids[i] != num_messages) &&
+          (++block_ids[i] == num_blocks[i])) {
+        for (int j = 0; j < 5; ++j) {
+          digests[message_ids[i]][j] = lane_digest[j][i];
+        }
+        message_ids[i] = num_messages;
+        --num_busy_lanes;
+      }
+    }
+  }
+}
+
+__attribute__((target("sse2")))
+void CalculateInSse2Lanes(const String *messages,
+    unsigned int * const *digests, std::size_t num_messages) {
+  CalculateInLanes<Lanes4>(messages, digests, num_messages);
+}
+
+__attribute__((target("avx2")))
+void CalculateInAvx2Lanes(const String *messages,
+    unsigned int * const *digests, std::size_t num_messages) {
+  CalculateInLanes<Lanes8>(messages, digests, num_messages);
+}
+
+#endif  // NWC_TOOLKIT_SHA1_X86
+
+bool IsSupportedKernel(Sha1Digest::Kernel kernel) {
+  switch (kernel) {
+    case Sha1Digest::GENERIC_KERNEL: {
+      return true;
+    }
+#ifdef NWC_TOOLKIT_SHA1_X86
+    case Sha1Digest::SSE2_KERNEL: {
+      return GetCpuFeatures().has_sse2;
+    }
+    case Sha1Digest::AVX2_KERNEL: {
+      return GetCpuFeatures().has_avx2;
+    }
+    case Sha1Digest::SHA_KERNEL: {
+      return GetCpuFeatures().has_sha;
+    }
+#endif  // NWC_TOOLKIT_SHA1_X86
+    default: {
+      return false;
+    }
+  }
+}
+
+// The SHA extensions are several times faster than the others for a single
+// message and as fast as AVX2 lanes for many messages.
+Sha1Digest::Kernel ChooseKernel() {
+  static const Sha1Digest::Kernel KERNELS[] = {
+    Sha1Digest::SHA_KERNEL, Sha1Digest::AVX2_KERNEL, Sha1Digest::SSE2_KERNEL
+  };
+  for (std::size_t i = 0; i < (sizeof(KERNELS) / sizeof(KERNELS[0])); ++i) {
+    if (IsSupportedKernel(KERNELS[i])) {
+      return KERNELS[i];
+    }
+  }
+  return Sha1Digest::GENERIC_KERNEL;
+}
+
+Sha1Digest::Kernel &GetKernel() {
+  static Sha1Digest::Kernel kernel = ChooseKernel();
+  return kernel;
+}
+
+}  // namespace
 
 Sha1Digest::Sha1Digest()
     : digest_(),
@@ -15,55 +369,116 @@ Sha1Digest::Sha1Digest()
 }
 
 void Sha1Digest::Clear() {
-  digest_[0] = 0x67452301;
-  digest_[1] = 0xEFCDAB89;
-  digest_[2] = 0x98BADCFE;
-  digest_[3] = 0x10325476;
-  digest_[4] = 0xC3D2E1F0;
+  std::memcpy(digest_, INITIAL_DIGEST, sizeof(digest_));
   std::memset(hex_digest_, 0, sizeof(hex_digest_));
   length_ = 0;
   std::memset(block_, 0, sizeof(block_));
 }
 
+// Whole blocks are processed directly from `message', and only a partial
+// block is copied into `block_'.
 void Sha1Digest::Append(const String &message) {
+  const unsigned char *next_in =
+      reinterpret_cast<const unsigned char *>(message.ptr());
   std::size_t avail_in = message.length();
-  const char *next_in = message.ptr();
-
-  unsigned int avail_out = static_cast<unsigned int>(64 - (length_ % 64));
-  unsigned char *next_out = block_ + 64 - avail_out;
-
-  while (avail_in != 0) {
-    *next_out = static_cast<unsigned char>(*next_in);
-    --avail_in;
-    ++next_in;
-    --avail_out;
-    if (avail_out == 0) {
-      ProcessBlock();
-      avail_out = 64;
-      next_out = block_;
-    } else {
-      ++next_out;
+
+  std::size_t block_length = static_cast<std::size_t>(length_ % 64);
+  length_ += message.length();
+  if (block_length != 0) {
+    std::size_t copy_length = 64 - block_length;
+    if (copy_length > avail_in) {
+      copy_length = avail_in;
+    }
+    std::memcpy(block_ + block_length, next_in, copy_length);
+    next_in += copy_length;
+    avail_in -= copy_length;
+    if ((block_length + copy_length) < 64) {
+      return;
     }
+    ProcessBlocks(block_, 1);
   }
-  length_ += message.length();
+
+  if (avail_in >= 64) {
+    ProcessBlocks(next_in, avail_in / 64);
+    next_in += avail_in - (avail_in % 64);
+    avail_in %= 64;
+  }
+  std::memcpy(block_, next_in, avail_in);
 }
 
 void Sha1Digest::Finish() {
-  unsigned int index = static_cast<unsigned int>(length_ % 64);
-  block_[index++] = 0x80;
-  if (index > 56) {
-    memset(block_ + index, 0, 64 - index);
-    ProcessBlock();
-    index = 0;
+  unsigned char last_blocks[128];
+  std::size_t num_last_blocks = PadMessage(block_,
+      static_cast<std::size_t>(length_ % 64), length_, last_blocks);
+  ProcessBlocks(last_blocks, num_last_blocks);
+  EncodeHexDigest();
+}
+
+void Sha1Digest::Calculate(const String *messages,
+    std::size_t num_messages, Sha1Digest *digests) {
+#ifdef NWC_TOOLKIT_SHA1_X86
+  if ((GetKernel() == SSE2_KERNEL) || (GetKernel() == AVX2_KERNEL)) {
+    enum { MAX_NUM_MESSAGES_PER_CALL = 256 };
+    unsigned int *digest_words[MAX_NUM_MESSAGES_PER_CALL];
+    for (std::size_t begin = 0; begin < num_messages;
+         begin += MAX_NUM_MESSAGES_PER_CALL) {
+      std::size_t end = begin + MAX_NUM_MESSAGES_PER_CALL;
+      if (end > num_messages) {
+        end = num_messages;
+      }
+      for (std::size_t i = begin; i < end; ++i) {
+        digests[i].Clear();
+        digest_words[i - begin] = digests[i].digest_;
+      }
+      if (GetKernel() == AVX2_KERNEL) {
+        CalculateInAvx2Lanes(messages + begin, digest_words, end - begin);
+      } else {
+        CalculateInSse2Lanes(messages + begin, digest_words, end - begin);
+      }
+      for (std::size_t i = begin; i < end; ++i) {
+        digests[i].length_ = messages[i].length();
+        digests[i].EncodeHexDigest();
+      }
+    }
+    return;
   }
+#endif  // NWC_TOOLKIT_SHA1_X86
 
-  memset(block_ + index, 0, 56 - index);
-  for (index = 56; index < 64; ++index) {
-    block_[index] = static_cast<unsigned char>(
-        (length_ * 8) >> ((63 - index) * 8));
+  for (std::size_t i = 0; i < num_messages; ++i) {
+    digests[i].Clear();
+    digests[i].Append(messages[i]);
+    digests[i].Finish();
   }
-  ProcessBlock();
+}
+
+Sha1Digest::Kernel Sha1Digest::kernel() {
+  return GetKernel();
+}
+
+bool Sha1Digest::set_kernel(Kernel kernel) {
+  if (kernel == AUTO_KERNEL) {
+    kernel = ChooseKernel();
+  } else if (!IsSupportedKernel(kernel)) {
+    return false;
+  }
+  GetKernel() = kernel;
+  return true;
+}
 
+void Sha1Digest::ProcessBlocks(const unsigned char *blocks,
+    std::size_t num_blocks) {
+#ifdef NWC_TOOLKIT_SHA1_X86
+  if (GetKernel() == SHA_KERNEL) {
+    ProcessBlocksWithSha(digest_, blocks, num_blocks);
+    return;
+  }
+#endif  // NWC_TOOLKIT_SHA1_X86
+  for (std::size_t i = 0; i < num_blocks; ++i) {
+    ProcessBlock(digest_, blocks + (i * 64));
+  }
+}
+
+void Sha1Digest::EncodeHexDigest() {
   char *next_hex = hex_digest_;
   for (int i = 0; i < 5; ++i) {
     for (int j = 0; j < 8; ++j) {
@@ -72,18 +487,14 @@ void Sha1Digest::Finish() {
   }
 }
 
-void Sha1Digest::ProcessBlock() {
-  static const unsigned int MAGIC_NUMBERS[] = {
-    0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6
-  };
-
+void Sha1Digest::ProcessBlock(unsigned int *digest,
+    const unsigned char *block) {
   unsigned int buf[85];
   for (int i = 0; i < 5; ++i) {
-    buf[i] = digest_[4 - i];
+    buf[i] = digest[4 - i];
   }
   for (int i = 0; i < 16; ++i) {
-    buf[i + 5] = (block_[(i * 4)] << 24) | (block_[(i * 4) + 1] << 16)
-        | (block_[(i * 4) + 2] << 8) | (block_[(i * 4) + 3]);
+    buf[i + 5] = ReadWord(block + (i * 4));
   }
   for (int i = 16; i < 80; ++i) {
     buf[i + 5] = Shift(1, buf[i + 2] ^ buf[i - 3] ^ buf[i - 9] ^ buf[i - 11]);
@@ -110,7 +521,7 @@ void Sha1Digest::ProcessBlock() {
   }
 
   for (int i = 0; i < 5; ++i) {
-    digest_[i] += w[4 - i];
+    digest[i] += w[4 - i];
   }
 }
 
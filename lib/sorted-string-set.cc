@@ -0,0 +1,233 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <nwc-toolkit/sorted-string-set.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace nwc_toolkit {
+namespace {
+
+// Returns the line which starts at `begin', without its '\n'.
+String GetLine(const char *begin, const char *end) {
+  const void *delim = std::memchr(begin, '\n', end - begin);
+  return String(begin, (delim != NULL) ?
+      static_cast<const char *>(delim) : end);
+}
+
+// Returns the beginning of the line next to `line'.
+const char *GetNextLine(const String &line, const char *end) {
+  return (line.end() < end) ? (line.end() + 1) : end;
+}
+
+// The finalizer of MurmurHash3, which chooses bits in a block independently
+// of the block.
+unsigned long long Mix(unsigned long long x) {
+  x ^= x >> 33;
+  x *= 0xFF51AFD7ED558CCDULL;
+  x ^= x >> 33;
+  x *= 0xC4CEB9FE1A85EC53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+bool WriteLine(const String &line, std::FILE *file) {
+  return (std::fwrite(line.ptr(), 1, line.length(), file) == line.length())
+      && (std::fputc('\n', file) != EOF);
+}
+
+}  // namespace
+
+SortedStringSet::SortedStringSet()
+    : file_(NULL),
+      file_size_(0),
+      num_file_strings_(0),
+      filter_(),
+      pool_(),
+      new_strings_() {}
+
+bool SortedStringSet::Open(const String &path) {
+  Close();
+
+  std::string path_str(path.ptr(), path.length());
+  int fd = ::open(path_str.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return false;
+  }
+  struct stat stat_buf;
+  if (::fstat(fd, &stat_buf) != 0) {
+    ::close(fd);
+    return false;
+  }
+  // An empty file has no strings and cannot be mapped.
+  if (stat_buf.st_size == 0) {
+    ::close(fd);
+    return true;
+  }
+
+  void *address = ::mmap(NULL, static_cast<std::size_t>(stat_buf.st_size),
+      PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    return false;
+  }
+  file_ = static_cast<const char *>(address);
+  file_size_ = static_cast<std::size_t>(stat_buf.st_size);
+
+  if (!BuildFilter()) {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+void SortedStringSet::Close() {
+  if (file_ != NULL) {
+    ::munmap(const_cast<char *>(file_), file_size_);
+  }
+  file_ = NULL;
+  file_size_ = 0;
+  num_file_strings_ = 0;
+  std::vector<unsigned long long>().swap(filter_);
+  pool_.Clear();
+  new_strings_.clear();
+}
+
+bool SortedStringSet::Insert(const String &str) {
+  if (Contains(str)) {
+    return false;
+  }
+  new_strings_.insert(pool_.Append(str));
+  return true;
+}
+
+// The strings in the file and the sorted new strings are merged.
+bool SortedStringSet::Save(const String &path) const {
+  std::vector<String> new_strings(new_strings_.begin(), new_strings_.end());
+  std::sort(new_strings.begin(), new_strings.end());
+
+  std::string path_str(path.ptr(), path.length());
+  std::string temp_path = path_str + ".tmp";
+  std::FILE *file = std::fopen(temp_path.c_str(), "wb");
+  if (file == NULL) {
+    return false;
+  }
+
+  bool is_ok = true;
+  const char *end = file_ + file_size_;
+  const char *next = file_;
+  std::vector<String>::const_iterator it = new_strings.begin();
+  while (is_ok && ((next < end) || (it != new_strings.end()))) {
+    if ((next < end) &&
+        ((it == new_strings.end()) || (GetLine(next, end) < *it))) {
+      String line = GetLine(next, end);
+      is_ok = WriteLine(line, file);
+      next = GetNextLine(line, end);
+    } else {
+      is_ok = WriteLine(*it, file);
+      ++it;
+    }
+  }
+
+  is_ok = is_ok && !std::ferror(file);
+  if ((std::fclose(file) != 0) || !is_ok ||
+      (std::rename(temp_path.c_str(), path_str.c_str()) != 0)) {
+    std::remove(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+// A binary search over bytes. `begin' and `end' are always at the
+// beginnings of lines, and the line containing the middle byte is compared.
+bool SortedStringSet::FileContains(const String &str) const {
+  if ((file_ == NULL) || !FilterContains(str)) {
+    return false;
+  }
+
+  const char *begin = file_;
+  const char *end = file_ + file_size_;
+  while (begin < end) {
+    const char *middle = begin + ((end - begin) / 2);
+    const char *line_begin = middle;
+    while ((line_begin > begin) && (line_begin[-1] != '\n')) {
+      --line_begin;
+    }
+    String line = GetLine(line_begin, end);
+    int result = str.Compare(line);
+    if (result == 0) {
+      return true;
+    } else if (result < 0) {
+      end = line_begin;
+    } else {
+      begin = GetNextLine(line, end);
+    }
+  }
+  return false;
+}
+
+// A string sets NUM_PROBES bits in a block of BLOCK_SIZE words, so that a
+// lookup touches only one cache line.
+bool SortedStringSet::FilterContains(const String &str) const {
+  unsigned long long hash = StringHash64()(str);
+  const unsigned long long *block =
+      &filter_[(hash % (filter_.size() / BLOCK_SIZE)) * BLOCK_SIZE];
+  unsigned long long bits = Mix(hash);
+  for (std::size_t i = 0; i < NUM_PROBES; ++i) {
+    std::size_t bit_id = static_cast<std::size_t>(bits) &
+        ((BLOCK_SIZE * 64) - 1);
+    if ((block[bit_id / 64] & (1ULL << (bit_id % 64))) == 0) {
+      return false;
+    }
+    bits >>= PROBE_BITS;
+  }
+  return true;
+}
+
+void SortedStringSet::AddToFilter(const String &str) {
+  unsigned long long hash = StringHash64()(str);
+  unsigned long long *block =
+      &filter_[(hash % (filter_.size() / BLOCK_SIZE)) * BLOCK_SIZE];
+  unsigned long long bits = Mix(hash);
+  for (std::size_t i = 0; i < NUM_PROBES; ++i) {
+    std::size_t bit_id = static_cast<std::size_t>(bits) &
+        ((BLOCK_SIZE * 64) - 1);
+    block[bit_id / 64] |= 1ULL << (bit_id % 64);
+    bits >>= PROBE_BITS;
+  }
+}
+
+// The first pass counts and checks the lines, and the second pass fills
+// the filter which is sized by the number of lines.
+bool SortedStringSet::BuildFilter() {
+  const char *end = file_ + file_size_;
+  String prev_line;
+  for (const char *next = file_; next < end; ) {
+    String line = GetLine(next, end);
+    if ((num_file_strings_ != 0) && !(prev_line < line)) {
+      return false;
+    }
+    ++num_file_strings_;
+    prev_line = line;
+    next = GetNextLine(line, end);
+  }
+
+  std::size_t num_blocks = ((num_file_strings_ * BITS_PER_STRING) +
+      (BLOCK_SIZE * 64) - 1) / (BLOCK_SIZE * 64);
+  filter_.assign(num_blocks * BLOCK_SIZE, 0ULL);
+  for (const char *next = file_; next < end; ) {
+    String line = GetLine(next, end);
+    AddToFilter(line);
+    next = GetNextLine(line, end);
+  }
+  return true;
+}
+
+}  // namespace nwc_toolkit
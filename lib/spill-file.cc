@@ -0,0 +1,97 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <nwc-toolkit/spill-file.h>
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <string>
+
+namespace nwc_toolkit {
+
+bool SpillFile::Open(const String &directory) {
+  Close();
+
+  std::string path;
+  if (!directory.is_empty()) {
+    path.assign(directory.ptr(), directory.length());
+  } else if (std::getenv("TMPDIR") != NULL) {
+    path = std::getenv("TMPDIR");
+  } else {
+    path = "/tmp";
+  }
+  path += "/nwc-toolkit.XXXXXX";
+  int fd = ::mkstemp(&path[0]);
+  if (fd == -1) {
+    return false;
+  }
+  ::unlink(path.c_str());
+  file_ = ::fdopen(fd, "w+b");
+  if (file_ == NULL) {
+    ::close(fd);
+    return false;
+  }
+  has_error_ = false;
+  return true;
+}
+
+void SpillFile::Close() {
+  if (file_ != NULL) {
+    std::fclose(file_);
+    file_ = NULL;
+  }
+}
+
+// A key and a value are each written after its length.
+bool SpillFile::Write(const String &key, const String &value) {
+  unsigned int key_length = static_cast<unsigned int>(key.length());
+  unsigned int value_length = static_cast<unsigned int>(value.length());
+  if ((std::fwrite(&key_length, sizeof(key_length), 1, file_) != 1) ||
+      (std::fwrite(key.ptr(), 1, key_length, file_) != key_length) ||
+      (std::fwrite(&value_length, sizeof(value_length), 1, file_) != 1) ||
+      (std::fwrite(value.ptr(), 1, value_length, file_) != value_length)) {
+    has_error_ = true;
+    return false;
+  }
+  return true;
+}
+
+bool SpillFile::Rewind() {
+  if (std::fflush(file_) != 0) {
+    has_error_ = true;
+    return false;
+  }
+  std::rewind(file_);
+  return true;
+}
+
+bool SpillFile::Read(StringBuilder *key, StringBuilder *value) {
+  unsigned int key_length;
+  std::size_t size_read = std::fread(&key_length, 1, sizeof(key_length),
+      file_);
+  if (size_read != sizeof(key_length)) {
+    // A file which ends in the middle of a record is broken.
+    if ((size_read != 0) || std::ferror(file_)) {
+      has_error_ = true;
+    }
+    return false;
+  }
+  key->Resize(key_length);
+  if ((std::fread(key->buf(), 1, key_length, file_) != key_length) ||
+      !ReadString(value)) {
+    has_error_ = true;
+    return false;
+  }
+  return true;
+}
+
+bool SpillFile::ReadString(StringBuilder *str) {
+  unsigned int length;
+  if (std::fread(&length, sizeof(length), 1, file_) != 1) {
+    return false;
+  }
+  str->Resize(length);
+  return std::fread(str->buf(), 1, length, file_) == length;
+}
+
+}  // namespace nwc_toolkit
@@ -4,47 +4,239 @@
 
 namespace nwc_toolkit {
 
-void TextFilter::Filter(const String &src, StringBuilder *dest) {
-  enum { MIN_COUNT = 6, MAX_COUNT = 1023 };
-  enum { MIN_NIHONGO_PERCENT = 70 };
-  enum { MIN_HIRAGANA_PERCENT = 5 };
+namespace {
 
-  String avail = src;
-  String sentence;
-  while (ExtractSentence(avail, &avail, &sentence)) {
-    std::size_t dest_length = dest->length();
-    std::size_t count = 0;
-    std::size_t nihongo_count = 0;
-    std::size_t hiragana_count = 0;
-
-    int code_point = 0;
-    String character;
-    while (ExtractCharacter(sentence, &sentence, &character, &code_point)) {
-      if (IsControl(code_point)) {
-        continue;
-      } else if (IsSpace()(character[0])) {
-        if ((dest->length() > dest_length) &&
-            !IsSpace()((*dest)[dest->length() - 1])) {
-          dest->Append(' ');
+enum {
+  MIN_COUNT = 6,
+  MAX_COUNT = 1023,
+  MIN_NIHONGO_PERCENT = 70,
+  MIN_HIRAGANA_PERCENT = 5
+};
+
+// The classes are bit flags so that counters are updated without branches.
+// HIRAGANA_CHAR has NIHONGO_BIT because every Hiragana is Nihongo.
+enum {
+  NIHONGO_BIT = 1,
+  HIRAGANA_BIT = 2
+};
+
+enum CharClass {
+  OTHER_CHAR = 0,
+  NIHONGO_CHAR = NIHONGO_BIT,
+  HIRAGANA_CHAR = NIHONGO_BIT | HIRAGANA_BIT,
+  CONTROL_CHAR = 4
+};
+
+// CharClassTable gives the length of a UTF-8 sequence from its first byte
+// and the class of a BMP code point from a table of 16 code point blocks.
+// Every Nihongo range starts and ends on a block boundary, and a block that
+// contains control characters is marked so that its code points are tested
+// one by one.
+class CharClassTable {
+ public:
+  CharClassTable() : lengths_(), classes_() {
+    for (int i = 0; i < 0x100; ++i) {
+      int byte = i;
+      unsigned char length = 1;
+      if (byte >= 0x80) {
+        while (byte & 0x40) {
+          ++length;
+          byte <<= 1;
         }
+      }
+      lengths_[i] = length;
+    }
+    for (int i = 0; i < NUM_BLOCKS; ++i) {
+      int code_point = i << BLOCK_BITS;
+      classes_[i] = OTHER_CHAR;
+      for (int j = 0; j < (1 << BLOCK_BITS); ++j) {
+        if (TextFilter::IsControl(code_point + j)) {
+          classes_[i] = CONTROL_CHAR;
+        }
+      }
+      if (classes_[i] != CONTROL_CHAR) {
+        if (TextFilter::IsHiragana(code_point)) {
+          classes_[i] = HIRAGANA_CHAR;
+        } else if (TextFilter::IsNihongo(code_point)) {
+          classes_[i] = NIHONGO_CHAR;
+        }
+      }
+    }
+  }
+
+  std::size_t GetLength(char first_byte) const {
+    return lengths_[static_cast<unsigned char>(first_byte)];
+  }
+  CharClass GetClass(int code_point) const {
+    if (static_cast<unsigned int>(code_point) > 0xFFFF) {
+      return ClassifySlowly(code_point);
+    }
+    CharClass char_class =
+        static_cast<CharClass>(classes_[code_point >> BLOCK_BITS]);
+    if (char_class == CONTROL_CHAR) {
+      return ClassifySlowly(code_point);
+    }
+    return char_class;
+  }
+
+ private:
+  enum { BLOCK_BITS = 4, NUM_BLOCKS = 0x10000 >> BLOCK_BITS };
+
+  unsigned char lengths_[0x100];
+  unsigned char classes_[NUM_BLOCKS];
+
+  static CharClass ClassifySlowly(int code_point) {
+    if (TextFilter::IsControl(code_point)) {
+      return CONTROL_CHAR;
+    } else if (TextFilter::IsHiragana(code_point)) {
+      return HIRAGANA_CHAR;
+    } else if (TextFilter::IsNihongo(code_point)) {
+      return NIHONGO_CHAR;
+    }
+    return OTHER_CHAR;
+  }
+};
+
+const CharClassTable CHAR_CLASS_TABLE;
+
+// Decodes a sequence in the same way as TextFilter::ExtractCharacter().
+// Invalid bytes are not rejected but a sequence never exceeds `length'.
+inline int DecodeCharacter(const char *ptr, std::size_t length) {
+  unsigned int code_point = static_cast<unsigned char>(ptr[0]);
+  if (length == 1) {
+    return (code_point < 0x80) ? code_point : (code_point & 0x3F);
+  }
+  code_point &= 0x3F >> (length - 1);
+  for (std::size_t i = 1; i < length; ++i) {
+    code_point = (code_point << 6) |
+        (static_cast<unsigned char>(ptr[i]) & 0x3F);
+  }
+  return static_cast<int>(code_point);
+}
+
+inline std::size_t GetCharLength(const char *ptr, const char *end) {
+  std::size_t length = CHAR_CLASS_TABLE.GetLength(*ptr);
+  if (length > static_cast<std::size_t>(end - ptr)) {
+    length = end - ptr;
+  }
+  return length;
+}
+
+inline CharClass GetCharClass(const char *ptr, std::size_t length) {
+  if (length == 3) {
+    // This is the common case of Japanese text.
+    int code_point = ((static_cast<unsigned char>(ptr[0]) & 0x0F) << 12) |
+        ((static_cast<unsigned char>(ptr[1]) & 0x3F) << 6) |
+        (static_cast<unsigned char>(ptr[2]) & 0x3F);
+    return CHAR_CLASS_TABLE.GetClass(code_point);
+  } else if (length == 2) {
+    // A 2-byte sequence is never a Nihongo or control character.
+    return OTHER_CHAR;
+  }
+  return CHAR_CLASS_TABLE.GetClass(DecodeCharacter(ptr, length));
+}
+
+// Counts characters in `sentence' and tests whether the sentence passes the
+// filter. `is_verbatim' is set to false if the sentence contains control
+// characters or spaces to be collapsed, because then the sentence cannot be
+// copied as is.
+bool TestSentence(const String &sentence, bool *is_verbatim) {
+  std::size_t count = 0;
+  std::size_t nihongo_count = 0;
+  std::size_t hiragana_count = 0;
+  *is_verbatim = true;
+
+  bool follows_space = true;
+  const char *ptr = sentence.begin();
+  const char *end = sentence.end();
+  while (ptr < end) {
+    unsigned char byte = static_cast<unsigned char>(*ptr);
+    if (byte < 0x80) {
+      if (IsSpace()(byte)) {
+        if ((byte != ' ') || follows_space) {
+          *is_verbatim = false;
+        }
+        follows_space = true;
       } else {
         if (++count > MAX_COUNT) {
-          break;
-        } else if (IsNihongo(code_point)) {
-          ++nihongo_count;
-          if (IsHiragana(code_point)) {
-            ++hiragana_count;
-          }
+          return false;
         }
-        dest->Append(character);
+        follows_space = false;
+      }
+      ++ptr;
+      continue;
+    }
+
+    std::size_t length = GetCharLength(ptr, end);
+    CharClass char_class = GetCharClass(ptr, length);
+    if (char_class == CONTROL_CHAR) {
+      *is_verbatim = false;
+    } else {
+      if (++count > MAX_COUNT) {
+        return false;
+      }
+      nihongo_count += char_class & NIHONGO_BIT;
+      hiragana_count += (char_class & HIRAGANA_BIT) >> 1;
+    }
+    // An invalid sequence may end with a space.
+    follows_space = IsSpace()(ptr[length - 1]);
+    ptr += length;
+  }
+  if (follows_space) {
+    *is_verbatim = false;
+  }
+
+  return (count >= MIN_COUNT) &&
+      ((100 * nihongo_count / count) >= MIN_NIHONGO_PERCENT) &&
+      ((100 * hiragana_count / count) >= MIN_HIRAGANA_PERCENT);
+}
+
+// Appends `sentence' without control characters. Spaces are collapsed into
+// one and leading spaces are removed.
+void AppendFilteredSentence(const String &sentence, StringBuilder *dest) {
+  std::size_t dest_length = dest->length();
+  const char *run_begin = sentence.begin();
+  const char *ptr = sentence.begin();
+  const char *end = sentence.end();
+  while (ptr < end) {
+    if (IsSpace()(*ptr)) {
+      dest->Append(run_begin, ptr - run_begin);
+      if ((dest->length() > dest_length) &&
+          !IsSpace()((*dest)[dest->length() - 1])) {
+        dest->Append(' ');
       }
+      run_begin = ++ptr;
+      continue;
+    }
+    std::size_t length = GetCharLength(ptr, end);
+    if ((length != 1) && (GetCharClass(ptr, length) == CONTROL_CHAR)) {
+      dest->Append(run_begin, ptr - run_begin);
+      run_begin = ptr + length;
+    }
+    ptr += length;
+  }
+  dest->Append(run_begin, ptr - run_begin);
+}
+
+}  // namespace
+
+// Each sentence is tested before anything is written, so a rejected sentence
+// costs only one scan and an accepted sentence is usually copied at once.
+void TextFilter::Filter(const String &src, StringBuilder *dest) {
+  String avail = src;
+  String sentence;
+  while (ExtractSentence(avail, &avail, &sentence)) {
+    bool is_verbatim;
+    if (!TestSentence(sentence, &is_verbatim)) {
+      continue;
+    } else if (is_verbatim) {
+      dest->Append(sentence);
+      dest->Append('\n');
+      continue;
     }
 
-    if ((count < MIN_COUNT) || (count > MAX_COUNT) ||
-        ((100 * nihongo_count / count) < MIN_NIHONGO_PERCENT) ||
-        ((100 * hiragana_count / count) < MIN_HIRAGANA_PERCENT)) {
-      dest->Resize(dest_length);
-    } else if (IsSpace()((*dest)[dest->length() - 1])) {
+    AppendFilteredSentence(sentence, dest);
+    if (IsSpace()((*dest)[dest->length() - 1])) {
       (*dest)[dest->length() - 1] = '\n';
     } else {
       dest->Append('\n');
@@ -57,19 +249,8 @@ bool TextFilter::ExtractCharacter(const String &src,
   if (src.is_empty()) {
     return false;
   }
-  *code_point = static_cast<unsigned char>(src[0]);
-  std::size_t length = 1;
-  if (*code_point >= 0x80) {
-    while (*code_point & 0x40) {
-      ++length;
-      *code_point <<= 1;
-    }
-    *code_point = (*code_point & 0x3F) >> (length - 1);
-    for (std::size_t i = 1; i < length; ++i) {
-      *code_point <<= 6;
-      *code_point |= static_cast<unsigned char>(src[i]) & 0x3F;
-    }
-  }
+  std::size_t length = GetCharLength(src.begin(), src.end());
+  *code_point = DecodeCharacter(src.begin(), length);
   *character = src.SubString(0, length);
   *src_left = src.SubString(length);
   return true;
@@ -2,91 +2,240 @@
 
 #include <nwc-toolkit/unicode-normalizer.h>
 
-#include <unicode/normlzr.h>
-#include <unicode/unistr.h>
+#include <unicode/uchar.h>
+#include <unicode/ustring.h>
 
 namespace nwc_toolkit {
 namespace {
 
-::UNormalizationMode ConvertFormToMode(
-    UnicodeNormalizer::NormalizationForm form) {
-  switch (form) {
-    case UnicodeNormalizer::DEFAULT_FORM: {
-      return UNORM_DEFAULT;
+// Decodes a UTF-8 character which starts at `src[pos]' and returns its
+// length. If the bytes are not a well-formed UTF-8 character, e.g. a
+// surrogate or an overlong form, DecodeUtf8Char() returns 0.
+std::size_t DecodeUtf8Char(const String &src, std::size_t pos,
+    ::UChar32 *c) {
+  const unsigned char *bytes =
+      reinterpret_cast<const unsigned char *>(src.ptr()) + pos;
+  std::size_t avail = src.length() - pos;
+  if (bytes[0] < 0x80) {
+    *c = bytes[0];
+    return 1;
+  } else if ((bytes[0] < 0xC2) || (bytes[0] > 0xF4)) {
+    return 0;
+  }
+
+  std::size_t length = (bytes[0] < 0xE0) ? 2 : ((bytes[0] < 0xF0) ? 3 : 4);
+  if (avail < length) {
+    return 0;
+  }
+  *c = bytes[0] & (0xFF >> (length + 1));
+  for (std::size_t i = 1; i < length; ++i) {
+    if ((bytes[i] & 0xC0) != 0x80) {
+      return 0;
     }
-    case UnicodeNormalizer::NFC: {
-      return UNORM_NFC;
+    *c = (*c << 6) | (bytes[i] & 0x3F);
+  }
+
+  static const ::UChar32 MIN_CODE_POINTS[] = { 0, 0, 0x80, 0x800, 0x10000 };
+  if ((*c < MIN_CODE_POINTS[length]) || (*c > 0x10FFFF) ||
+      ((*c >= 0xD800) && (*c <= 0xDFFF))) {
+    return 0;
+  }
+  return length;
+}
+
+}  // namespace
+
+UnicodeNormalizer::UnicodeNormalizer()
+    : normalizer_(NULL),
+      converter_(NULL),
+      quick_check_property_(UCHAR_NFC_QUICK_CHECK),
+      illegal_input_handler_(DEFAULT_HANDLER),
+      unicode_src_(),
+      unicode_dest_() {}
+
+bool UnicodeNormalizer::Open(NormalizationForm form,
+    IllegalInputHandler illegal_input_handler) {
+  Close();
+
+  const char *name;
+  ::UNormalization2Mode mode;
+  switch (form) {
+    case DEFAULT_FORM:
+    case NFC: {
+      name = "nfc";
+      mode = UNORM2_COMPOSE;
+      quick_check_property_ = UCHAR_NFC_QUICK_CHECK;
+      break;
     }
-    case UnicodeNormalizer::NFKC: {
-      return UNORM_NFKC;
+    case NFKC: {
+      name = "nfkc";
+      mode = UNORM2_COMPOSE;
+      quick_check_property_ = UCHAR_NFKC_QUICK_CHECK;
+      break;
     }
-    case UnicodeNormalizer::NFD: {
-      return UNORM_NFD;
+    case NFD: {
+      name = "nfc";
+      mode = UNORM2_DECOMPOSE;
+      quick_check_property_ = UCHAR_NFD_QUICK_CHECK;
+      break;
     }
-    case UnicodeNormalizer::NFKD: {
-      return UNORM_NFKD;
+    case NFKD: {
+      name = "nfkc";
+      mode = UNORM2_DECOMPOSE;
+      quick_check_property_ = UCHAR_NFKD_QUICK_CHECK;
+      break;
     }
     default: {
-      // Returns UNORM_NONE if the given `form' is undefined.
-      return UNORM_NONE;
+      return false;
     }
   }
+  illegal_input_handler_ = illegal_input_handler;
+
+  // Normalizer2 instances are owned by ICU and must not be deleted.
+  ::UErrorCode status = U_ZERO_ERROR;
+  normalizer_ = icu::Normalizer2::getInstance(NULL, name, mode, status);
+  if (U_FAILURE(status)) {
+    normalizer_ = NULL;
+    return false;
+  }
+
+  converter_ = ::ucnv_open("UTF-8", &status);
+  if (U_FAILURE(status)) {
+    Close();
+    return false;
+  }
+  return true;
 }
 
-void ExtractStringFromUnicodeString(const UnicodeString &unistr,
-    ::int32_t begin, ::int32_t end, StringBuilder *dest) {
-  if (begin >= end) {
-    return;
+void UnicodeNormalizer::Close() {
+  normalizer_ = NULL;
+  if (converter_ != NULL) {
+    ::ucnv_close(converter_);
+    converter_ = NULL;
+  }
+}
+
+// Stable characters are copied from `src' as is, and only the unstable parts
+// are converted into UTF-16 and normalized by ICU. An unstable part starts
+// with the stable character just before it, because the character may be
+// composed with the following characters. Illegal bytes are unstable, so
+// that ICU replaces them with U+FFFDs.
+bool UnicodeNormalizer::Normalize(const String &src, StringBuilder *dest) {
+  if (!is_open()) {
+    return false;
   }
-  std::size_t offset = dest->length();
 
-  // ::UnicodeString::extract() of ICU 4.2.1 is endless when the capacity of
-  // its target buffer is 0. The next line expands the target buffer so as to
-  // avoid this problem.
-  dest->Reserve(offset + 1);
+  std::size_t copy_begin = 0;
+  std::size_t last_stable_char_begin = 0;
+  for (std::size_t pos = 0; pos < src.length(); ) {
+    if (static_cast<unsigned char>(src[pos]) < 0x80) {
+      last_stable_char_begin = pos++;
+      continue;
+    }
 
-  dest->Resize(dest->size());
-  std::size_t avail = dest->length() - offset;
+    ::UChar32 c;
+    std::size_t char_length = DecodeUtf8Char(src, pos, &c);
+    if ((char_length != 0) && IsStableChar(c)) {
+      last_stable_char_begin = pos;
+      pos += char_length;
+      continue;
+    }
 
-  ::int32_t length = unistr.extract(begin, end - begin,
-      dest->buf() + offset, avail, "UTF-8");
-  dest->Resize(offset + length);
-  if (static_cast<std::size_t>(length) > avail) {
-    unistr.extract(begin, end - begin, dest->buf() + offset, length, "UTF-8");
+    std::size_t segment_begin =
+        (pos > copy_begin) ? last_stable_char_begin : pos;
+    do {
+      pos += (char_length != 0) ? char_length : 1;
+      if (pos >= src.length()) {
+        break;
+      } else if (static_cast<unsigned char>(src[pos]) < 0x80) {
+        break;
+      }
+      char_length = DecodeUtf8Char(src, pos, &c);
+    } while ((char_length == 0) || !IsStableChar(c));
+
+    dest->Append(src.SubString(copy_begin, segment_begin - copy_begin));
+    if (!NormalizeSegment(
+        src.SubString(segment_begin, pos - segment_begin), dest)) {
+      return false;
+    }
+    copy_begin = pos;
   }
+  dest->Append(src.SubString(copy_begin));
+  return true;
 }
 
-}  // namespace
-
 bool UnicodeNormalizer::Normalize(NormalizationForm form,
     IllegalInputHandler illegal_input_handler,
     const String &src, StringBuilder *dest) {
-  ::UNormalizationMode mode = ConvertFormToMode(form);
-  if (mode == UNORM_NONE) {
+  UnicodeNormalizer normalizer;
+  return normalizer.Open(form, illegal_input_handler) &&
+      normalizer.Normalize(src, dest);
+}
+
+// A character is stable if it is not changed by normalization and it never
+// interacts with its neighbors, that is, its quick check property is YES and
+// its canonical combining class is 0. The normalization of a string is the
+// concatenation of the normalization of its parts if they are separated
+// before stable characters. U+FFFD is regarded as unstable if it must be
+// removed.
+bool UnicodeNormalizer::IsStableChar(::UChar32 c) const {
+  if ((c == 0xFFFD) &&
+      (illegal_input_handler_ == REMOVE_REPLACEMENT_CHARACTERS)) {
     return false;
   }
+  return (u_getCombiningClass(c) == 0) &&
+      (u_getIntPropertyValue(c, quick_check_property_) == UNORM_YES);
+}
 
-  ::UnicodeString unicode_src(src.ptr(), src.length(), "UTF-8");
-  ::UnicodeString unicode_dest;
+// Converts `src' into UTF-16, normalizes it and appends the result to `dest'
+// in UTF-8. The UTF-16 buffers are reused.
+bool UnicodeNormalizer::NormalizeSegment(const String &src,
+    StringBuilder *dest) {
   ::UErrorCode status = U_ZERO_ERROR;
-  icu::Normalizer::normalize(unicode_src, mode, 0, unicode_dest, status);
+
+  // A UTF-8 character never requires more UTF-16 code units than its bytes.
+  ::int32_t capacity = static_cast< ::int32_t>(src.length()) + 1;
+  ::UChar *unicode_src_buf = unicode_src_.getBuffer(capacity);
+  if (unicode_src_buf == NULL) {
+    return false;
+  }
+  ::int32_t unicode_src_length = ::ucnv_toUChars(converter_,
+      unicode_src_buf, unicode_src_.getCapacity(),
+      src.ptr(), static_cast< ::int32_t>(src.length()), &status);
+  unicode_src_.releaseBuffer(U_SUCCESS(status) ? unicode_src_length : 0);
+  if (U_FAILURE(status)) {
+    return false;
+  }
+
+  normalizer_->normalize(unicode_src_, unicode_dest_, status);
   if (U_FAILURE(status)) {
     return false;
   }
 
-  ::int32_t last_pos = 0;
-  if (illegal_input_handler == REMOVE_REPLACEMENT_CHARACTERS) {
-    for (::int32_t pos = 0; pos < unicode_dest.length(); ++pos) {
-      // ICU replaces illegal input with U+FFFDs, and the U+FFFDs are
-      // skipped here if `REMOVE_REPLACEMENT_CHARACTERS' is given.
-      if (unicode_dest[pos] == 0xFFFD) {
-        ExtractStringFromUnicodeString(unicode_dest, last_pos, pos, dest);
-        last_pos = pos + 1;
+  // ICU replaces illegal input with U+FFFDs, and the U+FFFDs are removed
+  // here if `REMOVE_REPLACEMENT_CHARACTERS' is given.
+  if (illegal_input_handler_ == REMOVE_REPLACEMENT_CHARACTERS) {
+    ::int32_t length = 0;
+    for (::int32_t pos = 0; pos < unicode_dest_.length(); ++pos) {
+      if (unicode_dest_[pos] != 0xFFFD) {
+        unicode_dest_.setCharAt(length++, unicode_dest_[pos]);
       }
     }
+    unicode_dest_.truncate(length);
   }
-  ExtractStringFromUnicodeString(unicode_dest,
-      last_pos, unicode_dest.length(), dest);
+
+  // A UTF-16 code unit never requires more than 3 bytes in UTF-8.
+  std::size_t offset = dest->length();
+  dest->Resize(offset + (unicode_dest_.length() * 3));
+  ::int32_t length = 0;
+  ::u_strToUTF8(dest->buf() + offset,
+      static_cast< ::int32_t>(dest->length() - offset), &length,
+      unicode_dest_.getBuffer(), unicode_dest_.length(), &status);
+  if (U_FAILURE(status)) {
+    dest->Resize(offset);
+    return false;
+  }
+  dest->Resize(offset + length);
   return true;
 }
 
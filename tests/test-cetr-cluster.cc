@@ -89,6 +89,23 @@ int main() {
     double default_total_dist = TotalizeDistances(points, default_centroids);
     double total_dist = TotalizeDistances(points, centroids);
     assert(total_dist < default_total_dist);
+
+    std::vector<int> same_clusters;
+    nwc_toolkit::CetrCluster::Cluster(points, &same_clusters);
+    assert(same_clusters == clusters);
+
+    nwc_toolkit::CetrCluster::Cluster(points, &same_clusters,
+        NUM_CLUSTERS, 1, 1, i);
+    assert(same_clusters.size() == points.size());
+    for (std::size_t j = 0; j < same_clusters.size(); ++j) {
+      assert((same_clusters[j] >= 0) && (same_clusters[j] < NUM_CLUSTERS));
+    }
+  }
+
+  std::vector<nwc_toolkit::CetrPoint> same_points(NUM_POINTS);
+  nwc_toolkit::CetrCluster::Cluster(same_points, &clusters);
+  for (std::size_t i = 0; i < clusters.size(); ++i) {
+    assert(clusters[i] == 0);
   }
 
   return 0;
@@ -1,9 +1,42 @@
 // Copyright 2010 Susumu Yata <syata@acm.org>
 
 #include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
 
 #include <nwc-toolkit/cetr-document.h>
 
+namespace {
+
+void TestSmoothHistogram(std::size_t num_values, int max_value) {
+  std::vector<double> src(num_values);
+  for (std::size_t i = 0; i < num_values; ++i) {
+    src[i] = (std::rand() % 4 == 0) ? (std::rand() % max_value) : 0.0;
+  }
+
+  std::vector<double> exact;
+  std::vector<double> fast;
+  nwc_toolkit::CetrDocument::SmoothHistogram(src,
+      nwc_toolkit::CetrDocument::EXACT_SMOOTHING, &exact);
+  nwc_toolkit::CetrDocument::SmoothHistogram(src,
+      nwc_toolkit::CetrDocument::FAST_SMOOTHING, &fast);
+  assert(exact.size() == num_values);
+  assert(fast.size() == num_values);
+
+  // The error of each kernel weight is less than 0.01% of the largest one,
+  // and the weights sum to less than 2.
+  double total = 0.0;
+  for (std::size_t i = 0; i < num_values; ++i) {
+    total += src[i];
+  }
+  for (std::size_t i = 0; i < num_values; ++i) {
+    assert(std::fabs(exact[i] - fast[i]) <= (0.0001 * 2.0 * total) + 1e-9);
+  }
+}
+
+}  // namespace
+
 int main(int argc, char *argv[]) {
   nwc_toolkit::String html_str =
     "<html lang=\"ja\">\n"
@@ -54,5 +87,55 @@ int main(int argc, char *argv[]) {
   assert(cetr.num_units() == 0);
   assert(cetr.num_points() == 0);
 
+  assert(cetr.smoothing_mode() ==
+      nwc_toolkit::CetrDocument::DEFAULT_SMOOTHING_MODE);
+  nwc_toolkit::CetrDocument exact_cetr;
+  exact_cetr.set_smoothing_mode(nwc_toolkit::CetrDocument::EXACT_SMOOTHING);
+  cetr.Parse(html_doc);
+  exact_cetr.Parse(html_doc);
+  for (std::size_t i = 0; i < cetr.num_lines(); ++i) {
+    assert(cetr.is_content(i) == exact_cetr.is_content(i));
+  }
+
+  enum { WINDOW_SIZE = nwc_toolkit::CetrDocument::DEFAULT_WINDOW_SIZE };
+  for (std::size_t i = 0; i < cetr.num_lines(); ++i) {
+    std::size_t window_size = ((i + WINDOW_SIZE) < cetr.num_lines())
+        ? static_cast<std::size_t>(WINDOW_SIZE) : (cetr.num_lines() - i);
+    double derivate = 0.0;
+    for (std::size_t j = 0; j < window_size; ++j) {
+      derivate += cetr.smoothed_tag_ratio(i + j);
+    }
+    derivate = (derivate / window_size) - cetr.smoothed_tag_ratio(i);
+    // Derivates are printed by tools, so they must not be rounded differently.
+    assert(cetr.derivate(i) == derivate);
+  }
+
+  nwc_toolkit::HtmlDocument small_html_doc;
+  assert(small_html_doc.Parse("<p>a</p>\n<p>b</p>"));
+  cetr.Parse(small_html_doc);
+  cetr.Parse(html_doc);
+  assert(cetr.num_lines() == exact_cetr.num_lines());
+  for (std::size_t i = 0; i < cetr.num_lines(); ++i) {
+    assert(cetr.is_content(i) == exact_cetr.is_content(i));
+  }
+
+  std::vector<double> values;
+  std::vector<double> smoothed_values;
+  nwc_toolkit::CetrDocument::SmoothHistogram(values,
+      nwc_toolkit::CetrDocument::FAST_SMOOTHING, &smoothed_values);
+  assert(smoothed_values.empty());
+
+  values.assign(5, 3.0);
+  nwc_toolkit::CetrDocument::SmoothHistogram(values,
+      nwc_toolkit::CetrDocument::FAST_SMOOTHING, &smoothed_values);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    assert(smoothed_values[i] == 3.0);
+  }
+
+  TestSmoothHistogram(10, 100);
+  TestSmoothHistogram(100, 1000);
+  TestSmoothHistogram(1000, 100);
+  TestSmoothHistogram(5000, 5000);
+
   return 0;
 }
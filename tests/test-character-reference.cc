@@ -31,5 +31,23 @@ int main() {
       &dest) == true);
   assert(dest.str() == "ABCA<B>\"C\"P<L\"U\"S");
 
+  dest.Clear();
+
+  assert(nwc_toolkit::CharacterReference::Decode(
+      "&hellip;&#x41;&#66;&amp", &dest) == true);
+  assert(dest.str() == "\xE2\x80\xA6" "AB&amp");
+
+  dest.Clear();
+
+  assert(nwc_toolkit::CharacterReference::Decode(
+      "&NotEqualTilde;&Bopf;&unknown;", &dest) == true);
+  assert(dest.str() == "\xE2\x89\x82\xCC\xB8" "\xF0\x9D\x94\xB9"
+      "&unknown;");
+
+  dest.Clear();
+
+  assert(nwc_toolkit::CharacterReference::Decode("A & B", &dest) == false);
+  assert(dest.str() == "A & B");
+
   return 0;
 }
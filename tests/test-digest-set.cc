@@ -0,0 +1,170 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <cassert>
+#include <cstdio>
+#include <ctime>
+#include <tr1/random>
+#include <vector>
+
+#include <nwc-toolkit/digest-set.h>
+
+namespace {
+
+std::tr1::mt19937 mt_rand(static_cast<unsigned int>(time(NULL)));
+
+nwc_toolkit::DigestSet::Digest GenerateDigest() {
+  nwc_toolkit::DigestSet::Digest digest;
+  digest.high = (static_cast<unsigned long long>(mt_rand()) << 32) | mt_rand();
+  digest.low = (static_cast<unsigned long long>(mt_rand()) << 32) | mt_rand();
+  return digest;
+}
+
+void TestDigests() {
+  nwc_toolkit::DigestSet::Digest digest;
+  assert(nwc_toolkit::DigestSet::Parse(
+      "a9993e364706816aba3e25717850c26c9cd0d89d", &digest));
+  assert(digest.high == 0xA9993E364706816AULL);
+  assert(digest.low == 0xBA3E25717850C26CULL);
+  assert(nwc_toolkit::DigestSet::Calculate("abc") == digest);
+
+  assert(nwc_toolkit::DigestSet::Parse(
+      "A9993E364706816ABA3E25717850C26C9CD0D89D", &digest));
+  assert(nwc_toolkit::DigestSet::Calculate("abc") == digest);
+
+  assert(!nwc_toolkit::DigestSet::Parse(
+      "a9993e364706816aba3e25717850c26c9cd0d89", &digest));
+  assert(!nwc_toolkit::DigestSet::Parse(
+      "a9993e364706816aba3e25717850c26c9cd0d89g", &digest));
+}
+
+void TestStrings() {
+  nwc_toolkit::DigestSet set;
+  assert(set.is_empty());
+  assert(set.memory_limit() == nwc_toolkit::DigestSet::DEFAULT_MEMORY_LIMIT);
+
+  assert(set.Insert("Copyright (C) 2010"));
+  assert(set.Insert("All rights reserved."));
+  assert(set.Insert("Copyright (C) 2010"));
+  assert(set.Insert(""));
+  assert(set.Insert(""));
+  assert(set.num_digests() == 3);
+
+  assert(set.Contains("All rights reserved."));
+  assert(!set.Contains("All rights reserved"));
+
+  // 0 is reserved for empty slots.
+  nwc_toolkit::DigestSet::Digest zero = { 0, 0 };
+  assert(!set.Contains(zero));
+  assert(set.Insert(zero));
+  assert(set.Contains(zero));
+  assert(set.num_digests() == 4);
+
+  set.Clear();
+  assert(set.is_empty());
+  assert(!set.Contains("Copyright (C) 2010"));
+  assert(set.Insert("Copyright (C) 2010"));
+}
+
+void TestMemoryLimit() {
+  enum { NUM_DIGESTS = 1 << 16 };
+
+  nwc_toolkit::DigestSet set;
+  set.Reset(1);
+  assert(set.memory_limit() == nwc_toolkit::DigestSet::MIN_MEMORY_LIMIT);
+  set.Reset(1 << 20);
+  assert(set.memory_limit() == (1 << 20));
+
+  std::vector<nwc_toolkit::DigestSet::Digest> digests;
+  std::vector<bool> is_inserted;
+  std::size_t num_inserted = 0;
+  for (std::size_t i = 0; i < NUM_DIGESTS; ++i) {
+    digests.push_back(GenerateDigest());
+    is_inserted.push_back(set.Insert(digests.back()));
+    if (is_inserted.back()) {
+      ++num_inserted;
+    }
+    assert(set.memory_usage() <= set.memory_limit());
+  }
+  // The old table also fits in the limit while the table is doubled.
+  assert((set.memory_usage() + (set.memory_usage() / 2)) <=
+      set.memory_limit());
+  assert(num_inserted < NUM_DIGESTS);
+  assert(set.num_digests() == num_inserted);
+
+  // No digest is lost, and a rejected digest is rejected again.
+  for (std::size_t i = 0; i < digests.size(); ++i) {
+    assert(set.Contains(digests[i]) == is_inserted[i]);
+    assert(set.Insert(digests[i]) == is_inserted[i]);
+  }
+  assert(set.num_digests() == num_inserted);
+
+  // A set which is too small to load a file is reported.
+  const char PATH[] = "test-digest-set.dat";
+  assert(set.Save(PATH));
+  nwc_toolkit::DigestSet small_set;
+  small_set.Reset(nwc_toolkit::DigestSet::MIN_MEMORY_LIMIT);
+  assert(!small_set.Load(PATH));
+  std::remove(PATH);
+}
+
+void TestSaveLoad() {
+  enum { NUM_DIGESTS = 1 << 14 };
+
+  const char PATH[] = "test-digest-set.dat";
+  std::remove(PATH);
+
+  nwc_toolkit::DigestSet set;
+  assert(!set.Load(PATH));
+  assert(set.Save(PATH));
+  assert(set.Load(PATH));
+  assert(set.is_empty());
+
+  std::vector<nwc_toolkit::DigestSet::Digest> digests;
+  for (std::size_t i = 0; i < NUM_DIGESTS; ++i) {
+    digests.push_back(GenerateDigest());
+    set.Insert(digests.back());
+  }
+  assert(set.Save(PATH));
+
+  nwc_toolkit::DigestSet another_set;
+  assert(another_set.Insert("Copyright (C) 2010"));
+  assert(another_set.Load(PATH));
+  assert(another_set.num_digests() == set.num_digests() + 1);
+  assert(another_set.Contains("Copyright (C) 2010"));
+  for (std::size_t i = 0; i < digests.size(); ++i) {
+    assert(another_set.Contains(digests[i]));
+  }
+
+  // A loaded set can be saved and loaded again.
+  assert(another_set.Save(PATH));
+  assert(set.Load(PATH));
+  assert(set.num_digests() == another_set.num_digests());
+
+  // A broken file is rejected.
+  std::FILE *file = std::fopen(PATH, "ab");
+  assert(file != NULL);
+  std::fputc('\0', file);
+  std::fclose(file);
+  assert(!set.Load(PATH));
+
+  // A file of FingerprintSet is rejected.
+  file = std::fopen(PATH, "wb");
+  assert(file != NULL);
+  std::fputs("NWCFPS01", file);
+  std::fwrite("\0\0\0\0\0\0\0\0", 1, 8, file);
+  std::fclose(file);
+  assert(!set.Load(PATH));
+
+  std::remove(PATH);
+}
+
+}  // namespace
+
+int main() {
+  TestDigests();
+  TestStrings();
+  TestMemoryLimit();
+  TestSaveLoad();
+
+  return 0;
+}
@@ -73,6 +73,30 @@ void TestInputText(const char *path, const nwc_toolkit::String &text) {
 
   assert(file.Close());
   assert(file.is_open() == false);
+
+  assert(file.Open(path));
+  assert(file.is_open());
+
+  avail = text.length();
+  while (avail > 0) {
+    std::size_t io_size = mt_rand() % (MAX_IO_SIZE + 1);
+    if (io_size > avail) {
+      io_size = avail;
+    }
+    std::size_t skip_size = mt_rand() % (MAX_IO_SIZE * 4 + 1);
+    if (skip_size > avail - io_size) {
+      skip_size = avail - io_size;
+    }
+    nwc_toolkit::String chunk;
+    assert(file.Read(io_size, &chunk));
+    assert(chunk == text.SubString(text.length() - avail, io_size));
+    assert(file.Skip(skip_size));
+    avail -= io_size + skip_size;
+  }
+  assert(file.Skip(1) == false);
+
+  assert(file.Close());
+  assert(file.is_open() == false);
 }
 
 void TestOutputLines(const char *path,
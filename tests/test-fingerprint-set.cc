@@ -0,0 +1,174 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <cassert>
+#include <cstdio>
+#include <ctime>
+#include <tr1/random>
+#include <tr1/unordered_set>
+#include <vector>
+
+#include <nwc-toolkit/fingerprint-set.h>
+
+namespace {
+
+std::tr1::mt19937 mt_rand(static_cast<unsigned int>(time(NULL)));
+
+unsigned long long GenerateFingerprint() {
+  return (static_cast<unsigned long long>(mt_rand()) << 32) | mt_rand();
+}
+
+void TestStrings() {
+  nwc_toolkit::FingerprintSet set;
+  assert(set.is_empty());
+  assert(set.memory_limit() ==
+      nwc_toolkit::FingerprintSet::DEFAULT_MEMORY_LIMIT);
+
+  assert(set.Insert("Copyright (C) 2010"));
+  assert(set.Insert("All rights reserved."));
+  assert(set.Insert("Copyright (C) 2010"));
+  assert(set.Insert(""));
+  assert(set.Insert(""));
+  assert(set.num_fingerprints() == 3);
+
+  assert(set.Contains("All rights reserved."));
+  assert(!set.Contains("All rights reserved"));
+
+  // 0 is reserved for empty slots.
+  assert(!set.Contains(0ULL));
+  assert(set.Insert(0ULL));
+  assert(set.Contains(0ULL));
+  assert(set.num_fingerprints() == 4);
+
+  set.Clear();
+  assert(set.is_empty());
+  assert(!set.Contains("Copyright (C) 2010"));
+  assert(set.Insert("Copyright (C) 2010"));
+}
+
+void TestExactness() {
+  enum { NUM_FINGERPRINTS = 1 << 18 };
+
+  std::vector<unsigned long long> fingerprints;
+  std::tr1::unordered_set<unsigned long long> answers;
+  while (fingerprints.size() < NUM_FINGERPRINTS) {
+    unsigned long long fingerprint = GenerateFingerprint();
+    if (answers.insert(fingerprint).second) {
+      fingerprints.push_back(fingerprint);
+    }
+  }
+
+  nwc_toolkit::FingerprintSet set;
+  for (std::size_t i = 0; i < fingerprints.size(); ++i) {
+    assert(!set.Contains(fingerprints[i]));
+    assert(set.Insert(fingerprints[i]));
+    assert(set.num_fingerprints() == i + 1);
+  }
+  for (std::size_t i = 0; i < fingerprints.size(); ++i) {
+    assert(set.Contains(fingerprints[i]));
+    assert(set.Insert(fingerprints[i]));
+  }
+  assert(set.num_fingerprints() == fingerprints.size());
+}
+
+void TestMemoryLimit() {
+  enum { NUM_FINGERPRINTS = 1 << 18 };
+
+  nwc_toolkit::FingerprintSet set;
+  set.Reset(1);
+  assert(set.memory_limit() == nwc_toolkit::FingerprintSet::MIN_MEMORY_LIMIT);
+  set.Reset(1 << 20);
+  assert(set.memory_limit() == (1 << 20));
+
+  std::vector<unsigned long long> fingerprints;
+  std::tr1::unordered_set<unsigned long long> inserted, rejected;
+  for (std::size_t i = 0; i < NUM_FINGERPRINTS; ++i) {
+    fingerprints.push_back(GenerateFingerprint());
+    if (set.Insert(fingerprints.back())) {
+      inserted.insert(fingerprints.back());
+    } else {
+      rejected.insert(fingerprints.back());
+    }
+    assert(set.memory_usage() <= set.memory_limit());
+  }
+  // The old buckets also fit in the limit while the buckets are doubled.
+  assert((set.memory_usage() + (set.memory_usage() / 2)) <=
+      set.memory_limit());
+  assert(!rejected.empty());
+  assert(set.num_fingerprints() == inserted.size());
+
+  // No fingerprint is lost, and a rejected fingerprint is rejected again.
+  for (std::size_t i = 0; i < fingerprints.size(); ++i) {
+    bool is_inserted = (inserted.count(fingerprints[i]) != 0);
+    assert(set.Contains(fingerprints[i]) == is_inserted);
+    assert(set.Insert(fingerprints[i]) == is_inserted);
+  }
+  assert(set.num_fingerprints() == inserted.size());
+
+  // A set which is too small to load a file is reported.
+  const char PATH[] = "test-fingerprint-set.dat";
+  assert(set.Save(PATH));
+  nwc_toolkit::FingerprintSet small_set;
+  small_set.Reset(nwc_toolkit::FingerprintSet::MIN_MEMORY_LIMIT);
+  assert(!small_set.Load(PATH));
+  std::remove(PATH);
+}
+
+void TestSaveLoad() {
+  enum { NUM_FINGERPRINTS = 1 << 14 };
+
+  const char PATH[] = "test-fingerprint-set.dat";
+  std::remove(PATH);
+
+  nwc_toolkit::FingerprintSet set;
+  assert(!set.Load(PATH));
+  assert(set.Save(PATH));
+  assert(set.Load(PATH));
+  assert(set.is_empty());
+
+  std::vector<unsigned long long> fingerprints;
+  for (std::size_t i = 0; i < NUM_FINGERPRINTS; ++i) {
+    fingerprints.push_back(GenerateFingerprint());
+    set.Insert(fingerprints.back());
+  }
+  assert(set.Save(PATH));
+
+  nwc_toolkit::FingerprintSet another_set;
+  assert(another_set.Insert("Copyright (C) 2010"));
+  assert(another_set.Load(PATH));
+  assert(another_set.num_fingerprints() == set.num_fingerprints() + 1);
+  assert(another_set.Contains("Copyright (C) 2010"));
+  for (std::size_t i = 0; i < fingerprints.size(); ++i) {
+    assert(another_set.Contains(fingerprints[i]));
+  }
+
+  // A loaded set can be saved and loaded again.
+  assert(another_set.Save(PATH));
+  assert(set.Load(PATH));
+  assert(set.num_fingerprints() == another_set.num_fingerprints());
+
+  // A broken file is rejected.
+  std::FILE *file = std::fopen(PATH, "ab");
+  assert(file != NULL);
+  std::fputc('\0', file);
+  std::fclose(file);
+  assert(!set.Load(PATH));
+
+  file = std::fopen(PATH, "wb");
+  assert(file != NULL);
+  std::fputs("NWCFPS01", file);
+  std::fclose(file);
+  assert(!set.Load(PATH));
+
+  std::remove(PATH);
+}
+
+}  // namespace
+
+int main() {
+  TestStrings();
+  TestExactness();
+  TestMemoryLimit();
+  TestSaveLoad();
+
+  return 0;
+}
@@ -44,6 +44,19 @@ int main() {
   assert(entry.header() == "Content-type: text/html\n");
   assert(entry.body() == "<html></html>\n");
 
+  assert(input_file.Open("test-html-archive-entry.dat"));
+  assert(entry.Read(&input_file, 8));
+  assert(entry.body() == "<html></");
+  assert(entry.is_truncated());
+  assert(entry.Read(&input_file, 8) == false);
+  assert(input_file.Close());
+
+  assert(input_file.Open("test-html-archive-entry.dat"));
+  assert(entry.Read(&input_file, 14));
+  assert(entry.body() == "<html></html>\n");
+  assert(entry.is_truncated() == false);
+  assert(input_file.Close());
+
   entry.Clear();
 
   nwc_toolkit::StringBuilder unicode_body;
@@ -88,5 +101,13 @@ int main() {
   assert(entry.ExtractContentType(&content_type));
   assert(content_type.str() == "application/xhtml+xml");
 
+  entry.set_header("");
+  entry.set_body("\x95\xB6\x8E\x9A\x83\x52\x81\x5B\x83\x68");
+
+  assert(entry.DetectUnicodeEncoding(3, &src_encoding));
+  assert(src_encoding.str() == "CP932");
+  assert(entry.DetectUnicodeEncoding(0, &src_encoding));
+  assert(src_encoding.str() == "CP932");
+
   return 0;
 }
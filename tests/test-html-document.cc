@@ -1,8 +1,11 @@
 // Copyright 2010 Susumu Yata <syata@acm.org>
 
 #include <cassert>
+#include <ctime>
+#include <tr1/random>
 
 #include <nwc-toolkit/html-document.h>
+#include <nwc-toolkit/html-reducer.h>
 
 namespace {
 
@@ -388,6 +391,209 @@ void TestComplexHtmlDocuments() {
   assert(text.str() == "<A></A>\n");
 }
 
+void TestAttributeHandler() {
+  nwc_toolkit::HtmlDocument document;
+  assert(document.attribute_handler() ==
+      nwc_toolkit::HtmlDocument::NORMALIZE_ATTRIBUTES);
+
+  document.set_attribute_handler(
+      nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
+  assert(document.attribute_handler() ==
+      nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
+
+  nwc_toolkit::HtmlArchiveEntry entry;
+  entry.set_body("<DIV Class=\"A&amp;B\" TITLE=\"&lt;\">Text</DIV>");
+
+  assert(document.Parse(entry));
+  assert(document.attribute_handler() ==
+      nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
+
+  assert(document.num_units() == 3);
+
+  assert(document.unit(0).type() == nwc_toolkit::HtmlUnit::TAG_UNIT);
+  assert(document.unit(0).tag_name() == "div");
+  assert(document.unit(0).num_attributes() == 2);
+  assert(document.unit(0).attribute(0).name() == "Class");
+  assert(document.unit(0).attribute(0).value() == "A&amp;B");
+  assert(document.unit(0).attribute(1).name() == "TITLE");
+  assert(document.unit(0).attribute(1).value() == "&lt;");
+
+  nwc_toolkit::StringBuilder text;
+  document.ExtractText(&text);
+  assert(text.str() == "Text\n");
+
+  nwc_toolkit::StringBuilder reduced_html;
+  nwc_toolkit::HtmlReducer::Reduce(document, &reduced_html);
+  assert(reduced_html.str() == "<div class=\"A&amp;B\">Aaaa</div>");
+
+  document.set_attribute_handler(
+      nwc_toolkit::HtmlDocument::NORMALIZE_ATTRIBUTES);
+
+  assert(document.Parse(entry));
+
+  assert(document.unit(0).attribute(0).name() == "class");
+  assert(document.unit(0).attribute(0).value() == "A&B");
+  assert(document.unit(0).attribute(1).name() == "title");
+  assert(document.unit(0).attribute(1).value() == "<");
+
+  nwc_toolkit::HtmlReducer::Reduce(document, &reduced_html);
+  assert(reduced_html.str() == "<div class=\"A&amp;B\">Aaaa</div>");
+}
+
+void TestWindowByWindowExtraction(const nwc_toolkit::HtmlArchiveEntry &entry) {
+  nwc_toolkit::HtmlDocument document;
+  assert(document.Parse(entry));
+
+  nwc_toolkit::StringBuilder text;
+  document.ExtractText(&text);
+  nwc_toolkit::StringBuilder src_encoding;
+  src_encoding.Assign(document.src_encoding());
+
+  for (std::size_t window_size = 1;
+      window_size <= entry.body().length() + 1; ++window_size) {
+    nwc_toolkit::StringBuilder window_text;
+    assert(document.ExtractText(entry, window_size, &window_text));
+    assert(window_text.str() == text.str());
+    assert(document.num_units() == 0);
+    assert(document.src_encoding() == src_encoding.str());
+  }
+}
+
+void TestWindowByWindowExtraction() {
+  static const char * const BODIES[] = {
+    "<p>Hello,\n  world &amp; &lt;everyone&gt;!</p>\n",
+    "<!DOCTYPE html><html><head><title>Title</title>"
+    "<script type=\"text/javascript\">if (a < b && c) { x = '</p>'; }"
+    "</script><style>p { color: red; }</STYLE ></head>\n"
+    "<body><!-- <p>comment</p> --><div class=\"a\" id='b'>Text"
+    "<br/>&#x3042;&#12354;&hellip;</div><pre>  pre\n  text </pre>"
+    "<textarea>&lt;A&gt;</textarea><xmp><b>&amp;</b></xmp>"
+    "<![CDATA[ data ]]><? pi ?>1 < 2 &unknown; &amp</body></html>\n",
+    "<P>Text<!-- unterminated comment <p>text</p>",
+    "<SCRIPT>unterminated script <p>text</p>",
+    "<div>Text<plaintext><p>&amp;</p>\n",
+    "<div title=\"unterminated value>Text</div>",
+    "\xEF\xBB\xBF<p>\xE6\x96\x87\xE5\xAD\x97</p>",
+    "<p>Text</p><textarea>&lt;A&gt; &hellip; <p>closed textarea, whose"
+    " content is longer than windows &amp; so on</p>\n</textarea>",
+    "<?xml version=\"1.0\"?><html><body><p>&amp;</p>"
+    "<![CDATA[ <p>&amp;</p> ]]></body></html>\n"
+  };
+
+  nwc_toolkit::HtmlArchiveEntry entry;
+  std::size_t num_bodies = sizeof(BODIES) / sizeof(BODIES[0]);
+  for (std::size_t i = 0; i < num_bodies; ++i) {
+    entry.set_body(BODIES[i]);
+    TestWindowByWindowExtraction(entry);
+  }
+
+  entry.set_header("Content-Type: text/html; charset=Shift_JIS\n");
+  entry.set_body("<p>\x95\xB6\x8E\x9A\x83\x52\x81\x5B\x83\x68</p>");
+  TestWindowByWindowExtraction(entry);
+
+  entry.set_header("Content-Type: text/plain\n");
+  entry.set_body("<p>1 &lt; 2</p>\n\n");
+  TestWindowByWindowExtraction(entry);
+
+  entry.set_header("");
+  entry.set_body("<p>Text</p><p>Text</p>\xFF\xFF");
+  nwc_toolkit::HtmlDocument document;
+  nwc_toolkit::StringBuilder text;
+  text.Assign("Text");
+  assert(document.ExtractText(entry, 32, &text) == false);
+  assert(text.str() == "Text");
+
+  // Invalid bytes after the first window are replaced with U+FFFD.
+  text.Clear();
+  assert(document.ExtractText(entry, 16, &text));
+  assert(text.str() == "Text\nText\n\xEF\xBF\xBD\xEF\xBF\xBD\n");
+
+  // The content of an unclosed textarea is plain text if it fits in a
+  // window, or text otherwise.
+  entry.set_body("<p>Text</p><textarea>&lt;A&gt; &amp; so on, so on, so on,"
+      " so on, so on, so on, so on, so on, so on, so on, so on, so on");
+  text.Clear();
+  assert(document.ExtractText(entry, 256, &text));
+  assert(text.str() == "Text\n&lt;A&gt; &amp; so on, so on, so on, so on,"
+      " so on, so on, so on, so on, so on, so on, so on, so on\n");
+  text.Clear();
+  assert(document.ExtractText(entry, 16, &text));
+  assert(text.str() == "Text\n<A> & so on, so on, so on, so on,"
+      " so on, so on, so on, so on, so on, so on, so on, so on\n");
+}
+
+// Extracts text from a text unit byte by byte, as HtmlDocument once did.
+void ExtractTextByteByByte(const nwc_toolkit::String &str,
+    nwc_toolkit::StringBuilder *text) {
+  for (std::size_t i = 0; i < str.length(); ++i) {
+    if (nwc_toolkit::IsSpace()(str[i])) {
+      if (text->is_empty()) {
+        continue;
+      } else if (!nwc_toolkit::IsSpace()((*text)[text->length() - 1])) {
+        text->Append(' ');
+      }
+    } else if (!nwc_toolkit::IsCntrl()(str[i])) {
+      text->Append(str[i]);
+    }
+  }
+  if (!text->is_empty() &&
+      nwc_toolkit::IsSpace()((*text)[text->length() - 1])) {
+    (*text)[text->length() - 1] = '\n';
+  } else if (!text->is_empty()) {
+    text->Append('\n');
+  }
+}
+
+void TestSpaceCollapsing() {
+  std::tr1::mt19937 mt_rand(static_cast<unsigned int>(std::time(NULL)));
+
+  nwc_toolkit::HtmlDocument document;
+  nwc_toolkit::HtmlArchiveEntry entry;
+  nwc_toolkit::StringBuilder body;
+  nwc_toolkit::StringBuilder text;
+  nwc_toolkit::StringBuilder expected_text;
+  entry.set_header("Content-Type: text/html; charset=utf-8\n");
+  for (int i = 0; i < 1000; ++i) {
+    body.Clear();
+    std::size_t length = mt_rand() % 256;
+    for (std::size_t j = 0; j < length; ++j) {
+      char c;
+      switch (mt_rand() % 4) {
+        case 0: {
+          c = " \t\r\n\v\f"[mt_rand() % 6];
+          break;
+        }
+        case 1: {
+          c = static_cast<char>(mt_rand() % 0x20);
+          break;
+        }
+        case 2: {
+          body.Append("\xE3\x81\x82");
+          continue;
+        }
+        default: {
+          c = static_cast<char>(mt_rand() % 0x80);
+          break;
+        }
+      }
+      if ((c != '<') && (c != '&')) {
+        body.Append(c);
+      }
+    }
+
+    entry.set_body(body.str());
+    assert(document.Parse(entry));
+    assert(document.num_units() <= 1);
+
+    text.Clear();
+    document.ExtractText(&text);
+
+    expected_text.Clear();
+    ExtractTextByteByByte(body.str(), &expected_text);
+    assert(text.str() == expected_text.str());
+  }
+}
+
 }  // namespace
 
 int main() {
@@ -395,6 +601,9 @@ int main() {
   TestXml();
   TestSimpleHtmlDocuments();
   TestComplexHtmlDocuments();
+  TestAttributeHandler();
+  TestWindowByWindowExtraction();
+  TestSpaceCollapsing();
 
   return 0;
 }
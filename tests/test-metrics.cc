@@ -0,0 +1,170 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <nwc-toolkit/metrics.h>
+
+namespace {
+
+std::vector<std::string> ReadLines(const char *path) {
+  std::vector<std::string> lines;
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+bool Contains(const std::string &str, const char *pattern) {
+  return str.find(pattern) != std::string::npos;
+}
+
+void TestHistogram() {
+  nwc_toolkit::Metrics::Histogram histogram("parse_seconds");
+  assert(histogram.name() == "parse_seconds");
+  assert(histogram.count() == 0);
+
+  histogram.Observe(0.0);
+  histogram.Observe(0.000001);
+  histogram.Observe(0.005);
+  histogram.Observe(1000.0);
+  assert(histogram.count() == 4);
+  assert(histogram.sum() > 1000.0);
+  assert(histogram.bucket(0) == 2);
+  assert(histogram.bucket(4) == 1);
+  assert(histogram.bucket(
+      nwc_toolkit::Metrics::Histogram::NUM_BUCKETS - 1) == 1);
+}
+
+void TestJsonLines() {
+  const char PATH[] = "test-metrics.dat";
+  std::remove(PATH);
+
+  nwc_toolkit::Metrics metrics;
+  assert(!metrics.is_open());
+
+  // Objects can be used before Open().
+  nwc_toolkit::Metrics::Counter *entries = metrics.AddCounter("entries");
+  nwc_toolkit::Metrics::Gauge *buffer = metrics.AddGauge("buffer_bytes");
+  nwc_toolkit::Metrics::Histogram *parse = metrics.AddHistogram("parse");
+  entries->Increment();
+  assert(metrics.Update());
+  assert(!metrics.Flush());
+
+  assert(!metrics.Open("test", "", 1.0));
+  assert(metrics.Open("test", PATH, 3600.0));
+  assert(metrics.is_open());
+  assert(metrics.format() == nwc_toolkit::Metrics::JSON_LINES_FORMAT);
+
+  entries->Add(9);
+  buffer->Set(4096);
+  parse->Observe(0.5);
+  assert(metrics.Update());
+  assert(ReadLines(PATH).empty());
+
+  assert(metrics.Flush());
+  entries->Add(10);
+  metrics.Close();
+  assert(!metrics.is_open());
+
+  std::vector<std::string> lines = ReadLines(PATH);
+  assert(lines.size() == 2);
+  assert(Contains(lines[0], "{\"job\":\"test\","));
+  assert(Contains(lines[0], "\"rss_bytes\":"));
+  assert(Contains(lines[0], "\"entries\":{\"value\":10,"));
+  assert(Contains(lines[0], "\"buffer_bytes\":4096"));
+  assert(Contains(lines[0],
+      "\"parse\":{\"count\":1,\"sum\":0.500000,\"buckets\":[0,0,0,0,0,0,1,"));
+  assert(Contains(lines[1], "\"entries\":{\"value\":20,"));
+  assert(lines[1][lines[1].length() - 1] == '}');
+
+  std::remove(PATH);
+}
+
+void TestPrometheus() {
+  const char PATH[] = "test-metrics.prom";
+  std::remove(PATH);
+
+  nwc_toolkit::Metrics metrics;
+  assert(metrics.Open("test", PATH, 3600.0));
+  assert(metrics.format() == nwc_toolkit::Metrics::PROMETHEUS_FORMAT);
+
+  nwc_toolkit::Metrics::Counter *entries = metrics.AddCounter("entries");
+  nwc_toolkit::Metrics::Histogram *parse = metrics.AddHistogram("parse");
+  entries->Add(3);
+  parse->Observe(0.002);
+  assert(metrics.Flush());
+  entries->Add(4);
+  metrics.Close();
+
+  // The file is replaced with the last snapshot.
+  std::vector<std::string> lines = ReadLines(PATH);
+  std::ostringstream text;
+  for (std::size_t i = 0; i < lines.size(); ++i) {
+    text << lines[i] << '\n';
+  }
+  assert(Contains(text.str(), "nwc_toolkit_entries_total{job=\"test\"} 7\n"));
+  assert(Contains(text.str(),
+      "nwc_toolkit_parse_bucket{job=\"test\",le=\"0.001\"} 0\n"));
+  assert(Contains(text.str(),
+      "nwc_toolkit_parse_bucket{job=\"test\",le=\"0.01\"} 1\n"));
+  assert(Contains(text.str(),
+      "nwc_toolkit_parse_bucket{job=\"test\",le=\"+Inf\"} 1\n"));
+  assert(Contains(text.str(), "nwc_toolkit_parse_count{job=\"test\"} 1\n"));
+  assert(Contains(text.str(), "# TYPE nwc_toolkit_peak_rss_bytes gauge\n"));
+
+  std::remove(PATH);
+}
+
+void TestOptions() {
+  const char PATH[] = "test-metrics-options.jsonl";
+  std::remove(PATH);
+
+  nwc_toolkit::MetricsOptions options;
+  assert(options.path().is_empty());
+  assert(options.interval() == nwc_toolkit::Metrics::DEFAULT_INTERVAL);
+
+  // Nothing is opened without --metrics.
+  nwc_toolkit::Metrics metrics;
+  assert(options.Open("test", &metrics));
+  assert(!metrics.is_open());
+
+  assert(!options.Parse(
+      nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION, "0"));
+  assert(!options.Parse(
+      nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION, "1s"));
+  assert(options.interval() == nwc_toolkit::Metrics::DEFAULT_INTERVAL);
+  assert(options.Parse(
+      nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION, "0.5"));
+  assert(options.interval() == 0.5);
+  assert(options.Parse(nwc_toolkit::MetricsOptions::METRICS_OPTION, PATH));
+  assert(options.path() == PATH);
+  assert(!options.Parse('h', NULL));
+
+  assert(options.Open("test", &metrics));
+  assert(metrics.is_open());
+  metrics.Close();
+
+  std::string help = nwc_toolkit::MetricsOptions::help();
+  assert(Contains(help, "      --metrics=[FILE] "));
+  assert(Contains(help, "      --metrics-interval=[N]\n"));
+
+  std::remove(PATH);
+}
+
+}  // namespace
+
+int main() {
+  TestHistogram();
+  TestJsonLines();
+  TestPrometheus();
+  TestOptions();
+
+  return 0;
+}
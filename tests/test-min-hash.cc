@@ -0,0 +1,208 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <cassert>
+#include <cmath>
+#include <ctime>
+#include <set>
+#include <string>
+#include <tr1/random>
+#include <vector>
+
+#include <nwc-toolkit/min-hash.h>
+
+namespace {
+
+std::tr1::mt19937 mt_rand(static_cast<unsigned int>(time(NULL)));
+
+std::string GenerateText(std::size_t length) {
+  std::string text;
+  for (std::size_t i = 0; i < length; ++i) {
+    text += static_cast<char>('a' + (mt_rand() % 26));
+  }
+  return text;
+}
+
+nwc_toolkit::String ToString(const std::string &str) {
+  return nwc_toolkit::String(str.data(), str.length());
+}
+
+double CalculateJaccardSimilarity(const std::string &lhs,
+    const std::string &rhs, std::size_t shingle_size) {
+  std::set<std::string> lhs_shingles;
+  for (std::size_t i = 0; i + shingle_size <= lhs.length(); ++i) {
+    lhs_shingles.insert(lhs.substr(i, shingle_size));
+  }
+  std::set<std::string> rhs_shingles;
+  for (std::size_t i = 0; i + shingle_size <= rhs.length(); ++i) {
+    rhs_shingles.insert(rhs.substr(i, shingle_size));
+  }
+  std::size_t num_common_shingles = 0;
+  for (std::set<std::string>::const_iterator it = lhs_shingles.begin();
+       it != lhs_shingles.end(); ++it) {
+    num_common_shingles += rhs_shingles.count(*it);
+  }
+  return static_cast<double>(num_common_shingles) /
+      (lhs_shingles.size() + rhs_shingles.size() - num_common_shingles);
+}
+
+void TestParameters() {
+  nwc_toolkit::MinHash min_hash;
+  assert(min_hash.num_bands() == nwc_toolkit::MinHash::DEFAULT_NUM_BANDS);
+  assert(min_hash.num_rows() == nwc_toolkit::MinHash::DEFAULT_NUM_ROWS);
+  assert(min_hash.num_hashes() == static_cast<std::size_t>(
+      nwc_toolkit::MinHash::DEFAULT_NUM_BANDS *
+      nwc_toolkit::MinHash::DEFAULT_NUM_ROWS));
+  assert(min_hash.shingle_size() ==
+      nwc_toolkit::MinHash::DEFAULT_SHINGLE_SIZE);
+
+  assert(min_hash.Reset(3, 7, 2));
+  assert(min_hash.num_bands() == 3);
+  assert(min_hash.num_rows() == 7);
+  assert(min_hash.num_hashes() == 21);
+  assert(min_hash.shingle_size() == 2);
+
+  assert(!min_hash.Reset(nwc_toolkit::MinHash::MAX_NUM_HASHES, 2));
+  assert(min_hash.num_hashes() == 21);
+}
+
+void TestShingles() {
+  nwc_toolkit::MinHash min_hash;
+  assert(!min_hash.Calculate(""));
+  assert(!min_hash.Calculate(" \t\r\n"));
+  assert(min_hash.num_shingles() == 0);
+  for (std::size_t i = 0; i < min_hash.num_hashes(); ++i) {
+    assert(min_hash.value(i) == ~0U);
+  }
+
+  assert(min_hash.Calculate("abc"));
+  assert(min_hash.num_shingles() == 1);
+  assert(min_hash.Calculate("abcdefg"));
+  assert(min_hash.num_shingles() == 3);
+
+  // Characters are counted in UTF-8.
+  assert(min_hash.Calculate("\xE3\x81\x82\xE3\x81\x84\xE3\x81\x86"
+      "\xE3\x81\x88\xE3\x81\x8A\xE3\x81\x8B"));
+  assert(min_hash.num_shingles() == 2);
+
+  // White spaces are ignored.
+  nwc_toolkit::MinHash another_min_hash;
+  assert(another_min_hash.Calculate("ab cd\nef g"));
+  assert(another_min_hash.num_shingles() == 3);
+  assert(min_hash.Calculate("abcdefg"));
+  for (std::size_t i = 0; i < min_hash.num_hashes(); ++i) {
+    assert(min_hash.value(i) == another_min_hash.value(i));
+  }
+  assert(nwc_toolkit::MinHash::EstimateSimilarity(
+      min_hash, another_min_hash) == 1.0);
+}
+
+// Values calculated in parallel lanes must be the same as those calculated
+// one by one.
+void TestLanes() {
+  std::string text = GenerateText(1000);
+
+  nwc_toolkit::MinHash min_hash;
+  nwc_toolkit::MinHash another_min_hash;
+  for (std::size_t num_hashes = 1; num_hashes <= 9; ++num_hashes) {
+    assert(min_hash.Reset(1, num_hashes));
+    assert(another_min_hash.Reset(num_hashes, 1));
+    assert(min_hash.Calculate(ToString(text)));
+    assert(another_min_hash.Calculate(ToString(text)));
+    nwc_toolkit::MinHash first_min_hash;
+    assert(first_min_hash.Reset(1, 1));
+    assert(first_min_hash.Calculate(ToString(text)));
+    for (std::size_t i = 0; i < num_hashes; ++i) {
+      assert(min_hash.value(i) == another_min_hash.value(i));
+    }
+    assert(min_hash.value(0) == first_min_hash.value(0));
+  }
+
+  assert(min_hash.Reset(1, 12));
+  assert(another_min_hash.Reset(1, 11));
+  assert(min_hash.Calculate(ToString(text)));
+  assert(another_min_hash.Calculate(ToString(text)));
+  for (std::size_t i = 0; i < another_min_hash.num_hashes(); ++i) {
+    assert(min_hash.value(i) == another_min_hash.value(i));
+  }
+}
+
+void TestSimilarity() {
+  enum { TEXT_LENGTH = 2000 };
+
+  nwc_toolkit::MinHash min_hash;
+  nwc_toolkit::MinHash another_min_hash;
+  assert(min_hash.Reset(32, 8));
+  assert(another_min_hash.Reset(32, 8));
+
+  std::string text = GenerateText(TEXT_LENGTH);
+  for (std::size_t num_changes = 0; num_changes <= 100; num_changes += 10) {
+    std::string another_text = text;
+    for (std::size_t i = 0; i < num_changes; ++i) {
+      another_text[mt_rand() % TEXT_LENGTH] =
+          static_cast<char>('A' + (mt_rand() % 26));
+    }
+    assert(min_hash.Calculate(ToString(text)));
+    assert(another_min_hash.Calculate(ToString(another_text)));
+
+    double similarity = CalculateJaccardSimilarity(text, another_text,
+        min_hash.shingle_size());
+    double estimated_similarity = nwc_toolkit::MinHash::EstimateSimilarity(
+        min_hash, another_min_hash);
+    assert(std::fabs(similarity - estimated_similarity) < 0.2);
+
+    // Signatures copied out of MinHash give the same estimate.
+    std::vector<unsigned int> values, another_values;
+    for (std::size_t i = 0; i < min_hash.num_hashes(); ++i) {
+      values.push_back(min_hash.value(i));
+      another_values.push_back(another_min_hash.value(i));
+    }
+    assert(nwc_toolkit::MinHash::EstimateSimilarity(&values[0],
+        &another_values[0], values.size()) == estimated_similarity);
+
+    if (num_changes == 0) {
+      for (std::size_t i = 0; i < min_hash.num_bands(); ++i) {
+        assert(min_hash.band_key(i) == another_min_hash.band_key(i));
+      }
+    }
+  }
+}
+
+void TestBandKeys() {
+  nwc_toolkit::MinHash min_hash;
+  assert(min_hash.Reset(4, 1));
+  assert(min_hash.Calculate(ToString(GenerateText(100))));
+
+  nwc_toolkit::MinHash another_min_hash;
+  assert(another_min_hash.Reset(4, 1));
+  assert(another_min_hash.Calculate(ToString(GenerateText(100))));
+
+  std::set<unsigned long long> keys;
+  for (std::size_t i = 0; i < min_hash.num_bands(); ++i) {
+    keys.insert(min_hash.band_key(i));
+    for (std::size_t j = 0; j < another_min_hash.num_bands(); ++j) {
+      assert((min_hash.band_key(i) == another_min_hash.band_key(j)) ==
+          ((i == j) && (min_hash.value(i) == another_min_hash.value(j))));
+    }
+  }
+  assert(keys.size() == min_hash.num_bands());
+
+  // Keys of empty signatures are different for each band.
+  assert(!min_hash.Calculate(""));
+  keys.clear();
+  for (std::size_t i = 0; i < min_hash.num_bands(); ++i) {
+    keys.insert(min_hash.band_key(i));
+  }
+  assert(keys.size() == min_hash.num_bands());
+}
+
+}  // namespace
+
+int main() {
+  TestParameters();
+  TestShingles();
+  TestLanes();
+  TestSimilarity();
+  TestBandKeys();
+
+  return 0;
+}
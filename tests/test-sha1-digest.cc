@@ -1,6 +1,9 @@
 // Copyright 2010 Susumu Yata <syata@acm.org>
 
 #include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
 
 #include <nwc-toolkit/sha1-digest.h>
 
@@ -44,7 +47,105 @@ void TestLongPair() {
   assert(digest.length() == src.length());
   digest.Finish();
   assert(digest.hex_digest() == dest);
+}
+
+void TestKnownPairs() {
+  static const char * const PAIRS[][2] = {
+    { "", "da39a3ee5e6b4b0d3255bfef95601890afd80709" },
+    { "abc", "a9993e364706816aba3e25717850c26c9cd0d89d" },
+    { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+      "84983e441c3bd26ebaae4aa1f95129e5e54670f1" },
+    { "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+      "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+      "a49b2446a02c645bf419f995b67091253a04a259" }
+  };
+
+  for (std::size_t i = 0; i < (sizeof(PAIRS) / sizeof(PAIRS[0])); ++i) {
+    nwc_toolkit::Sha1Digest digest;
+    digest.Append(PAIRS[i][0]);
+    digest.Finish();
+    assert(digest.hex_digest() == PAIRS[i][1]);
+  }
+
+  std::string million_a(1000000, 'a');
+  nwc_toolkit::Sha1Digest digest;
+  digest.Append(nwc_toolkit::String(million_a.data(), million_a.length()));
+  digest.Finish();
+  assert(digest.hex_digest() == "34aa973cd4c4daa4f61eeb2bdbad27316534016f");
+}
 
+// Every kernel must give the same digests as the generic kernel for both
+// Append() in random pieces and Calculate().
+void TestKernels() {
+  enum { NUM_MESSAGES = 300, MAX_LENGTH = 1000 };
+
+  std::srand(1);
+  std::vector<std::string> strs(NUM_MESSAGES);
+  std::vector<nwc_toolkit::String> messages(NUM_MESSAGES);
+  for (std::size_t i = 0; i < strs.size(); ++i) {
+    strs[i].resize((i < 200) ? i : (std::rand() % MAX_LENGTH));
+    for (std::size_t j = 0; j < strs[i].length(); ++j) {
+      strs[i][j] = static_cast<char>(std::rand() % 256);
+    }
+    messages[i] = nwc_toolkit::String(strs[i].data(), strs[i].length());
+  }
+
+  nwc_toolkit::Sha1Digest::Kernel auto_kernel =
+      nwc_toolkit::Sha1Digest::kernel();
+  assert(auto_kernel != nwc_toolkit::Sha1Digest::AUTO_KERNEL);
+
+  assert(nwc_toolkit::Sha1Digest::set_kernel(
+      nwc_toolkit::Sha1Digest::GENERIC_KERNEL));
+  std::vector<std::string> hex_digests(NUM_MESSAGES);
+  for (std::size_t i = 0; i < messages.size(); ++i) {
+    nwc_toolkit::Sha1Digest digest;
+    digest.Append(messages[i]);
+    digest.Finish();
+    hex_digests[i].assign(digest.hex_digest().ptr(), 40);
+  }
+
+  static const nwc_toolkit::Sha1Digest::Kernel KERNELS[] = {
+    nwc_toolkit::Sha1Digest::GENERIC_KERNEL,
+    nwc_toolkit::Sha1Digest::SSE2_KERNEL,
+    nwc_toolkit::Sha1Digest::AVX2_KERNEL,
+    nwc_toolkit::Sha1Digest::SHA_KERNEL
+  };
+  for (std::size_t i = 0; i < (sizeof(KERNELS) / sizeof(KERNELS[0])); ++i) {
+    if (!nwc_toolkit::Sha1Digest::set_kernel(KERNELS[i])) {
+      continue;
+    }
+    assert(nwc_toolkit::Sha1Digest::kernel() == KERNELS[i]);
+
+    for (std::size_t j = 0; j < messages.size(); ++j) {
+      nwc_toolkit::Sha1Digest digest;
+      nwc_toolkit::String avail = messages[j];
+      while (!avail.is_empty()) {
+        std::size_t length = std::rand() % 150;
+        if (length > avail.length()) {
+          length = avail.length();
+        }
+        digest.Append(avail.SubString(0, length));
+        avail = avail.SubString(length);
+      }
+      assert(digest.length() == messages[j].length());
+      digest.Finish();
+      assert(digest.hex_digest() == hex_digests[j].c_str());
+    }
+
+    nwc_toolkit::Sha1Digest *digests =
+        new nwc_toolkit::Sha1Digest[NUM_MESSAGES];
+    nwc_toolkit::Sha1Digest::Calculate(&messages[0], messages.size(),
+        digests);
+    for (std::size_t j = 0; j < messages.size(); ++j) {
+      assert(digests[j].length() == messages[j].length());
+      assert(digests[j].hex_digest() == hex_digests[j].c_str());
+    }
+    delete [] digests;
+  }
+
+  assert(nwc_toolkit::Sha1Digest::set_kernel(
+      nwc_toolkit::Sha1Digest::AUTO_KERNEL));
+  assert(nwc_toolkit::Sha1Digest::kernel() == auto_kernel);
 }
 
 }  // namespace
@@ -52,6 +153,8 @@ void TestLongPair() {
 int main() {
   TestShortPair();
   TestLongPair();
+  TestKnownPairs();
+  TestKernels();
 
   return 0;
 }
@@ -0,0 +1,158 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <cassert>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <set>
+#include <string>
+#include <tr1/random>
+#include <vector>
+
+#include <nwc-toolkit/sorted-string-set.h>
+
+namespace {
+
+std::tr1::mt19937 mt_rand(static_cast<unsigned int>(time(NULL)));
+
+const char PATH[] = "test-sorted-string-set.dat";
+
+std::string GenerateHost() {
+  std::string host;
+  std::size_t length = 1 + (mt_rand() % 12);
+  for (std::size_t i = 0; i < length; ++i) {
+    host += static_cast<char>('a' + (mt_rand() % 26));
+  }
+  return host + ".example.com";
+}
+
+nwc_toolkit::String ToString(const std::string &str) {
+  return nwc_toolkit::String(str.data(), str.length());
+}
+
+void WriteFile(const std::string &content) {
+  std::ofstream file(PATH, std::ios::binary);
+  file << content;
+}
+
+std::vector<std::string> ReadLines() {
+  std::vector<std::string> lines;
+  std::ifstream file(PATH, std::ios::binary);
+  std::string line;
+  while (std::getline(file, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+void TestInsert() {
+  std::remove(PATH);
+
+  nwc_toolkit::SortedStringSet set;
+  assert(!set.Open(PATH));
+  assert(set.num_strings() == 0);
+
+  assert(set.Insert("www.example.com"));
+  assert(set.Insert("ftp.example.com"));
+  assert(!set.Insert("www.example.com"));
+  assert(set.Insert(""));
+  assert(!set.Insert(""));
+  assert(set.num_strings() == 3);
+  assert(set.num_new_strings() == 3);
+  assert(set.Contains("ftp.example.com"));
+  assert(!set.Contains("example.com"));
+
+  assert(set.Save(PATH));
+  std::vector<std::string> lines = ReadLines();
+  assert(lines.size() == 3);
+  assert(lines[0] == "");
+  assert(lines[1] == "ftp.example.com");
+  assert(lines[2] == "www.example.com");
+
+  set.Close();
+  assert(set.num_strings() == 0);
+  assert(!set.Contains("ftp.example.com"));
+
+  std::remove(PATH);
+}
+
+void TestFile() {
+  WriteFile("");
+  nwc_toolkit::SortedStringSet set;
+  assert(set.Open(PATH));
+  assert(set.num_file_strings() == 0);
+  assert(!set.Contains(""));
+
+  // The last line may have no '\n'.
+  WriteFile("a\nbb\nc");
+  assert(set.Open(PATH));
+  assert(set.num_file_strings() == 3);
+  assert(set.Contains("a"));
+  assert(set.Contains("bb"));
+  assert(set.Contains("c"));
+  assert(!set.Contains("b"));
+  assert(!set.Contains(""));
+  assert(!set.Insert("c"));
+  assert(set.Insert("b"));
+  assert(set.Save(PATH));
+  assert(set.Open(PATH));
+  assert(set.num_file_strings() == 4);
+  assert(set.Contains("b"));
+
+  // Lines must be sorted and unique.
+  WriteFile("b\na\n");
+  assert(!set.Open(PATH));
+  WriteFile("a\na\n");
+  assert(!set.Open(PATH));
+  // Bytes are compared as unsigned.
+  WriteFile("a\n\xE3\x81\x82\n");
+  assert(set.Open(PATH));
+  assert(set.Contains("\xE3\x81\x82"));
+
+  std::remove(PATH);
+}
+
+void TestShards() {
+  enum { NUM_SHARDS = 4, NUM_HOSTS_PER_SHARD = 5000 };
+
+  std::remove(PATH);
+
+  std::set<std::string> answers;
+  for (int i = 0; i < NUM_SHARDS; ++i) {
+    nwc_toolkit::SortedStringSet set;
+    assert(set.Open(PATH) == (i != 0));
+    assert(set.num_file_strings() == answers.size());
+
+    for (std::size_t j = 0; j < NUM_HOSTS_PER_SHARD; ++j) {
+      std::string host = GenerateHost();
+      bool is_new = answers.insert(host).second;
+      assert(set.Insert(ToString(host)) == is_new);
+    }
+    assert(set.num_strings() == answers.size());
+    assert(set.Save(PATH));
+  }
+
+  nwc_toolkit::SortedStringSet set;
+  assert(set.Open(PATH));
+  std::vector<std::string> lines = ReadLines();
+  assert(lines == std::vector<std::string>(answers.begin(), answers.end()));
+  for (std::set<std::string>::const_iterator it = answers.begin();
+       it != answers.end(); ++it) {
+    assert(set.Contains(ToString(*it)));
+    assert(!set.Contains(ToString(*it + ".")));
+    assert(set.Contains(ToString(it->substr(1))) ==
+        (answers.count(it->substr(1)) != 0));
+  }
+
+  std::remove(PATH);
+}
+
+}  // namespace
+
+int main() {
+  TestInsert();
+  TestFile();
+  TestShards();
+
+  return 0;
+}
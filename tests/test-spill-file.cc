@@ -0,0 +1,74 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <cassert>
+#include <sstream>
+#include <string>
+
+#include <nwc-toolkit/spill-file.h>
+
+namespace {
+
+void TestRecords() {
+  enum { NUM_RECORDS = 1 << 12 };
+
+  nwc_toolkit::SpillFile file;
+  assert(!file.is_open());
+  assert(file.Open(""));
+  assert(file.is_open());
+
+  for (std::size_t i = 0; i < NUM_RECORDS; ++i) {
+    std::ostringstream key, value;
+    key << i;
+    value << std::string(i % 17, 'x') << i;
+    assert(file.Write(key.str().c_str(), value.str().c_str()));
+  }
+  assert(file.Write("", ""));
+
+  // Records can be read twice.
+  for (int round = 0; round < 2; ++round) {
+    assert(file.Rewind());
+    nwc_toolkit::StringBuilder key, value;
+    for (std::size_t i = 0; i < NUM_RECORDS; ++i) {
+      std::ostringstream expected_key, expected_value;
+      expected_key << i;
+      expected_value << std::string(i % 17, 'x') << i;
+      assert(file.Read(&key, &value));
+      assert(key.str() == expected_key.str().c_str());
+      assert(value.str() == expected_value.str().c_str());
+    }
+    assert(file.Read(&key, &value));
+    assert(key.is_empty());
+    assert(value.is_empty());
+    assert(!file.Read(&key, &value));
+    assert(!file.has_error());
+  }
+
+  file.Close();
+  assert(!file.is_open());
+
+  // A directory which does not exist is rejected.
+  assert(!file.Open("./no-such-directory/"));
+  assert(!file.is_open());
+}
+
+void TestPartitionID() {
+  assert(nwc_toolkit::SpillFile::GetPartitionID(0ULL, 0) == 0);
+  assert(nwc_toolkit::SpillFile::GetPartitionID(
+      0x123456789ABCDEF0ULL, 0) == 0x1);
+  assert(nwc_toolkit::SpillFile::GetPartitionID(
+      0x123456789ABCDEF0ULL, 1) == 0x2);
+  assert(nwc_toolkit::SpillFile::GetPartitionID(
+      0x123456789ABCDEF0ULL, nwc_toolkit::SpillFile::MAX_NUM_LEVELS - 1)
+      == 0x0);
+  assert(nwc_toolkit::SpillFile::GetPartitionID(~0ULL, 3) ==
+      (nwc_toolkit::SpillFile::NUM_PARTITIONS - 1));
+}
+
+}  // namespace
+
+int main() {
+  TestRecords();
+  TestPartitionID();
+
+  return 0;
+}
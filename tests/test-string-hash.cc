@@ -49,5 +49,22 @@ int main() {
     assert(key_set.find(keys[i]) != key_set.end());
   }
 
+  std::tr1::unordered_set<unsigned long long> fingerprints;
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    fingerprints.insert(nwc_toolkit::StringHash64()(keys[i]));
+  }
+  assert(fingerprints.size() == keys.size());
+
+  // Prefixes cover every tail length.
+  fingerprints.clear();
+  for (std::size_t i = 0; i <= KEY_LENGTH; ++i) {
+    fingerprints.insert(nwc_toolkit::StringHash64()(keys[0].SubString(0, i)));
+  }
+  assert(fingerprints.size() == KEY_LENGTH + 1);
+
+  std::string key_copy(keys[0].ptr(), keys[0].length());
+  assert(nwc_toolkit::StringHash64()(keys[0]) ==
+      nwc_toolkit::StringHash64()(key_copy.c_str()));
+
   return 0;
 }
@@ -180,6 +180,9 @@ void TestFindOf() {
 
   assert(str.FindFirstOf('B') == "B");
   assert(str.FindFirstOf('X') == "");
+  assert(str.FindFirstOf('X').begin() == str.end());
+  assert(str.FindFirstOf('0').begin() == str.begin());
+  assert(nwc_toolkit::String().FindFirstOf('X').is_empty());
   assert(str.FindFirstOf(nwc_toolkit::IsAlpha()) == "A");
 
   assert(str.FindFirstNotOf("0123456789") == "A");
@@ -1,11 +1,15 @@
 // Copyright 2010 Susumu Yata <syata@acm.org>
 
 #include <cassert>
+#include <ctime>
+#include <tr1/random>
 
 #include <nwc-toolkit/text-filter.h>
 
 namespace {
 
+std::tr1::mt19937 mt_rand(static_cast<unsigned int>(time(NULL)));
+
 void TestCodePoints() {
   nwc_toolkit::String src = "012。！．";
   nwc_toolkit::String character;
@@ -120,12 +124,100 @@ void TestFilter() {
   assert(dest.str() == "制御文字は取り除かれる\n");
 }
 
+// Filters text character by character.
+void FilterSlowly(const nwc_toolkit::String &src,
+    nwc_toolkit::StringBuilder *dest) {
+  enum { MIN_COUNT = 6, MAX_COUNT = 1023 };
+  enum { MIN_NIHONGO_PERCENT = 70 };
+  enum { MIN_HIRAGANA_PERCENT = 5 };
+
+  nwc_toolkit::String avail = src;
+  nwc_toolkit::String sentence;
+  while (nwc_toolkit::TextFilter::ExtractSentence(
+      avail, &avail, &sentence)) {
+    std::size_t dest_length = dest->length();
+    std::size_t count = 0;
+    std::size_t nihongo_count = 0;
+    std::size_t hiragana_count = 0;
+
+    int code_point = 0;
+    nwc_toolkit::String character;
+    while (nwc_toolkit::TextFilter::ExtractCharacter(
+        sentence, &sentence, &character, &code_point)) {
+      if (nwc_toolkit::TextFilter::IsControl(code_point)) {
+        continue;
+      } else if (nwc_toolkit::IsSpace()(character[0])) {
+        if ((dest->length() > dest_length) &&
+            !nwc_toolkit::IsSpace()((*dest)[dest->length() - 1])) {
+          dest->Append(' ');
+        }
+      } else {
+        if (++count > MAX_COUNT) {
+          break;
+        } else if (nwc_toolkit::TextFilter::IsNihongo(code_point)) {
+          ++nihongo_count;
+          if (nwc_toolkit::TextFilter::IsHiragana(code_point)) {
+            ++hiragana_count;
+          }
+        }
+        dest->Append(character);
+      }
+    }
+
+    if ((count < MIN_COUNT) || (count > MAX_COUNT) ||
+        ((100 * nihongo_count / count) < MIN_NIHONGO_PERCENT) ||
+        ((100 * hiragana_count / count) < MIN_HIRAGANA_PERCENT)) {
+      dest->Resize(dest_length);
+    } else if (nwc_toolkit::IsSpace()((*dest)[dest->length() - 1])) {
+      (*dest)[dest->length() - 1] = '\n';
+    } else {
+      dest->Append('\n');
+    }
+  }
+}
+
+void TestRandomText() {
+  static const char * const PIECES[] = {
+    "あ", "ん", "ア", "ヶ", "亜", "龍", "豈", "ㇰ", "㐀", "한", "Ä", "𠀋",
+    "a", "Z", "0", "%", " ", " ", "  ", "\t", "\v", "\r\n",
+    "。", "！", "．", "？", ".", "!", "?", "、", "　",
+    "\xEF\xBB\xBF", "\xE2\x80\x8E", "\xE2\x80\xAE", "\xEF\xBF\xBD",
+    "\x80", "\xBF", "\xF0\x83\x81\x81", "\xE3\x81"
+  };
+  static const std::size_t NUM_PIECES = sizeof(PIECES) / sizeof(PIECES[0]);
+  enum { NUM_PIECES_FOR_HIRAGANA = 2, NUM_PIECES_FOR_NIHONGO = 10 };
+
+  for (int i = 0; i < 1024; ++i) {
+    nwc_toolkit::StringBuilder src;
+    std::size_t length = mt_rand() % ((i % 16 == 0) ? 4096 : 64);
+    for (std::size_t j = 0; j < length; ++j) {
+      // Japanese pieces are chosen more often so that sentences pass the
+      // filter.
+      std::size_t id = mt_rand() % (NUM_PIECES * 4);
+      if (id >= NUM_PIECES * 2) {
+        id %= NUM_PIECES_FOR_HIRAGANA;
+      } else if (id >= NUM_PIECES) {
+        id %= NUM_PIECES_FOR_NIHONGO;
+      }
+      src.Append(PIECES[id]);
+    }
+    src.Append('\n');
+
+    nwc_toolkit::StringBuilder dest;
+    nwc_toolkit::StringBuilder answer;
+    nwc_toolkit::TextFilter::Filter(src.str(), &dest);
+    FilterSlowly(src.str(), &answer);
+    assert(dest.str() == answer.str());
+  }
+}
+
 }  // namespace
 
 int main() {
   TestCodePoints();
   TestDelimitors();
   TestFilter();
+  TestRandomText();
 
   return 0;
 }
@@ -1,9 +1,90 @@
 // Copyright 2010 Susumu Yata <syata@acm.org>
 
 #include <cassert>
+#include <ctime>
+#include <tr1/random>
+
+#include <unicode/normlzr.h>
+#include <unicode/unistr.h>
 
 #include <nwc-toolkit/unicode-normalizer.h>
 
+namespace {
+
+// Normalizes the whole `src' with ICU.
+void NormalizeAtOnce(::UNormalizationMode mode, bool removes_fffd,
+    const nwc_toolkit::String &src, nwc_toolkit::StringBuilder *dest) {
+  ::UnicodeString unicode_src(src.ptr(), src.length(), "UTF-8");
+  ::UnicodeString unicode_dest;
+  ::UErrorCode status = U_ZERO_ERROR;
+  icu::Normalizer::normalize(unicode_src, mode, 0, unicode_dest, status);
+  assert(U_SUCCESS(status));
+
+  ::UnicodeString filtered_dest;
+  for (::int32_t i = 0; i < unicode_dest.length(); ++i) {
+    if (!removes_fffd || (unicode_dest[i] != 0xFFFD)) {
+      filtered_dest.append(unicode_dest[i]);
+    }
+  }
+
+  dest->Clear();
+  dest->Resize(filtered_dest.length() * 3);
+  dest->Resize(filtered_dest.extract(0, filtered_dest.length(),
+      dest->buf(), dest->length(), "UTF-8"));
+}
+
+void TestRandomStrings() {
+  static const char * const PIECES[] = {
+    "a", "A", " ", "e", "\xCC\x81", "\xCC\xA3", "\xC3\xA9", "\xE3\x81\x8B",
+    "\xE3\x82\x99", "\xE3\x81\x8C", "\xEF\xBD\xB6", "\xEF\xBE\x9E",
+    "\xEF\xBC\xA1", "\xE3\x80\x80", "\xE6\x97\xA5", "\xE1\x84\x80",
+    "\xE1\x85\xA1", "\xE1\x86\xA8", "\xEA\xB0\x80", "\xE2\x84\xAB",
+    "\xEF\xBF\xBD", "\xF0\x9F\x98\x80", "\xE3\x8C\xA7", "\xFF", "\x80",
+    "\xE3\x81", "\xED\xA0\x80", "\xC0\xAF", "\xF4\x90\x80\x80"
+  };
+  static const struct {
+    nwc_toolkit::UnicodeNormalizer::NormalizationForm form;
+    ::UNormalizationMode mode;
+  } FORMS[] = {
+    { nwc_toolkit::UnicodeNormalizer::NFC, UNORM_NFC },
+    { nwc_toolkit::UnicodeNormalizer::NFKC, UNORM_NFKC },
+    { nwc_toolkit::UnicodeNormalizer::NFD, UNORM_NFD },
+    { nwc_toolkit::UnicodeNormalizer::NFKD, UNORM_NFKD }
+  };
+
+  std::tr1::mt19937 mt_rand(static_cast<unsigned int>(std::time(NULL)));
+  std::size_t num_pieces = sizeof(PIECES) / sizeof(PIECES[0]);
+  std::size_t num_forms = sizeof(FORMS) / sizeof(FORMS[0]);
+
+  nwc_toolkit::StringBuilder src;
+  nwc_toolkit::StringBuilder dest;
+  nwc_toolkit::StringBuilder expected_dest;
+  for (int i = 0; i < 10000; ++i) {
+    src.Clear();
+    std::size_t num_src_pieces = mt_rand() % 16;
+    for (std::size_t j = 0; j < num_src_pieces; ++j) {
+      src.Append(PIECES[mt_rand() % num_pieces]);
+    }
+
+    for (std::size_t j = 0; j < num_forms; ++j) {
+      dest.Clear();
+      assert(nwc_toolkit::UnicodeNormalizer::Normalize(FORMS[j].form,
+          src.str(), &dest));
+      NormalizeAtOnce(FORMS[j].mode, false, src.str(), &expected_dest);
+      assert(dest.str() == expected_dest.str());
+
+      dest.Clear();
+      assert(nwc_toolkit::UnicodeNormalizer::Normalize(FORMS[j].form,
+          nwc_toolkit::UnicodeNormalizer::REMOVE_REPLACEMENT_CHARACTERS,
+          src.str(), &dest));
+      NormalizeAtOnce(FORMS[j].mode, true, src.str(), &expected_dest);
+      assert(dest.str() == expected_dest.str());
+    }
+  }
+}
+
+}  // namespace
+
 int main() {
   nwc_toolkit::StringBuilder dest;
 
@@ -39,5 +120,29 @@ int main() {
       "\xFF\xFF", &dest));
   assert(dest.str().is_empty());
 
+  nwc_toolkit::UnicodeNormalizer normalizer;
+  assert(normalizer.is_open() == false);
+  assert(normalizer.Normalize("ｶﾞ", &dest) == false);
+
+  assert(normalizer.Open(nwc_toolkit::UnicodeNormalizer::NFKC));
+  assert(normalizer.is_open());
+
+  dest.Clear();
+  assert(normalizer.Normalize("ｶﾞ", &dest));
+  assert(normalizer.Normalize(" ＡＢＣ", &dest));
+  assert(dest.str() == "ガ ABC");
+
+  assert(normalizer.Open(nwc_toolkit::UnicodeNormalizer::NFD,
+      nwc_toolkit::UnicodeNormalizer::REMOVE_REPLACEMENT_CHARACTERS));
+
+  dest.Clear();
+  assert(normalizer.Normalize("ガ\xFF", &dest));
+  assert(dest.str() == "カ\xE3\x82\x99");
+
+  normalizer.Close();
+  assert(normalizer.is_open() == false);
+
+  TestRandomStrings();
+
   return 0;
 }
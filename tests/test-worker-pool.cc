@@ -0,0 +1,295 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <cassert>
+#include <ctime>
+#include <string>
+#include <tr1/random>
+#include <vector>
+
+#include <nwc-toolkit/worker-pool.h>
+
+namespace {
+
+std::tr1::mt19937 mt_rand(static_cast<unsigned int>(time(NULL)));
+
+struct Job {
+  Job() : id(0), num_steps(0), result(0) {}
+
+  // Jobs are read from JobInput by ProcessJobsInOrder().
+  template <typename Input>
+  bool Read(Input *input) {
+    return input->Next(this);
+  }
+
+  int id;
+  int num_steps;
+  long long result;
+};
+
+class Worker {
+ public:
+  Worker() {}
+
+  void operator()(Job *job) const {
+    long long result = job->id;
+    for (int i = 0; i < job->num_steps; ++i) {
+      result = (result * 31) % 1000003;
+    }
+    job->result = result;
+  }
+
+ private:
+  // Disallows copy and assignment.
+  Worker(const Worker &);
+  Worker &operator=(const Worker &);
+};
+
+void TestOpen() {
+  nwc_toolkit::WorkerPool<Job, Worker> pool;
+  assert(!pool.is_open());
+  assert(pool.num_threads() == 0);
+
+  assert(!pool.Open(0));
+
+  assert(pool.Open(3));
+  assert(pool.is_open());
+  assert(pool.num_threads() == 3);
+  assert(pool.max_num_jobs() == 6);
+  assert(pool.is_empty());
+  assert(!pool.is_full());
+
+  assert(pool.Open(2, 1));
+  assert(pool.num_threads() == 2);
+  assert(pool.max_num_jobs() == 1);
+
+  pool.Close();
+  assert(!pool.is_open());
+  assert(pool.num_threads() == 0);
+}
+
+void TestOrder(std::size_t num_threads, std::size_t max_num_jobs) {
+  enum { NUM_JOBS = 1 << 12 };
+
+  std::vector<int> num_steps(NUM_JOBS);
+  std::vector<long long> answers(NUM_JOBS);
+  for (std::size_t i = 0; i < num_steps.size(); ++i) {
+    Job job;
+    job.id = static_cast<int>(i);
+    job.num_steps = mt_rand() % 4096;
+    Worker()(&job);
+    num_steps[i] = job.num_steps;
+    answers[i] = job.result;
+  }
+
+  nwc_toolkit::WorkerPool<Job, Worker> pool;
+  assert(pool.Open(num_threads, max_num_jobs));
+
+  std::size_t num_results = 0;
+  for (std::size_t i = 0; i < num_steps.size(); ++i) {
+    Job *job = pool.AcquireJob();
+    job->id = static_cast<int>(i);
+    job->num_steps = num_steps[i];
+    pool.SubmitJob();
+    assert(!pool.is_empty());
+    if (pool.is_full()) {
+      job = pool.WaitForJob();
+      assert(job->id == static_cast<int>(num_results));
+      assert(job->result == answers[num_results]);
+      pool.ReleaseJob();
+      ++num_results;
+    }
+  }
+  while (!pool.is_empty()) {
+    Job *job = pool.WaitForJob();
+    assert(job->id == static_cast<int>(num_results));
+    assert(job->result == answers[num_results]);
+    pool.ReleaseJob();
+    ++num_results;
+  }
+  assert(num_results == num_steps.size());
+}
+
+// JobInput numbers jobs in order.
+class JobInput {
+ public:
+  explicit JobInput(const std::vector<int> &num_steps)
+      : num_steps_(num_steps),
+        num_jobs_(0) {}
+
+  bool Next(Job *job) {
+    if (num_jobs_ == num_steps_.size()) {
+      return false;
+    }
+    job->id = static_cast<int>(num_jobs_);
+    job->num_steps = num_steps_[num_jobs_++];
+    return true;
+  }
+
+ private:
+  const std::vector<int> &num_steps_;
+  std::size_t num_jobs_;
+
+  // Disallows copy and assignment.
+  JobInput(const JobInput &);
+  JobInput &operator=(const JobInput &);
+};
+
+class JobWriter {
+ public:
+  explicit JobWriter(const std::vector<long long> &answers)
+      : answers_(answers),
+        num_results_(0) {}
+
+  std::size_t num_results() const {
+    return num_results_;
+  }
+
+  void operator()(const Job *job) {
+    assert(job->id == static_cast<int>(num_results_));
+    assert(job->result == answers_[num_results_]);
+    ++num_results_;
+  }
+
+ private:
+  const std::vector<long long> &answers_;
+  std::size_t num_results_;
+
+  // Disallows copy and assignment.
+  JobWriter(const JobWriter &);
+  JobWriter &operator=(const JobWriter &);
+};
+
+void TestProcessJobsInOrder(std::size_t num_threads, std::size_t num_jobs) {
+  std::vector<int> num_steps(num_jobs);
+  std::vector<long long> answers(num_jobs);
+  for (std::size_t i = 0; i < num_jobs; ++i) {
+    Job job;
+    job.id = static_cast<int>(i);
+    job.num_steps = mt_rand() % 4096;
+    Worker()(&job);
+    num_steps[i] = job.num_steps;
+    answers[i] = job.result;
+  }
+
+  JobInput input(num_steps);
+  JobWriter writer(answers);
+  assert((nwc_toolkit::ProcessJobsInOrder<Job, Worker>(
+      &input, &writer, num_threads)));
+  assert(writer.num_results() == num_jobs);
+
+  assert(!(nwc_toolkit::ProcessJobsInOrder<Job, Worker>(
+      &input, &writer, 0)));
+}
+
+// Entry reads bodies of the lengths given by EntryInput.
+class Entry {
+ public:
+  Entry() : body_() {}
+
+  const std::string &body() const {
+    return body_;
+  }
+
+  template <typename Input>
+  bool Read(Input *input) {
+    if (input->empty()) {
+      return false;
+    }
+    body_.assign(input->front(), 'x');
+    input->erase(input->begin());
+    return true;
+  }
+
+ private:
+  std::string body_;
+};
+
+void TestEntryBatch() {
+  enum { MAX_NUM_ENTRIES = 4, BODY_THRESHOLD = 10 };
+
+  std::vector<std::size_t> input;
+  input.push_back(1);
+  input.push_back(2);
+  input.push_back(3);
+  input.push_back(4);
+  input.push_back(5);
+  input.push_back(20);
+  input.push_back(0);
+
+  nwc_toolkit::EntryBatch<Entry, MAX_NUM_ENTRIES, BODY_THRESHOLD> batch;
+  assert(batch.Read(&input));
+  assert(batch.num_entries == 4);
+  assert(batch.entries[3].body().length() == 4);
+  assert(batch.Read(&input));
+  assert(batch.num_entries == 2);
+  assert(batch.entries[1].body().length() == 20);
+  assert(batch.Read(&input));
+  assert(batch.num_entries == 1);
+  assert(batch.entries[0].body().empty());
+  assert(!batch.Read(&input));
+  assert(batch.num_entries == 0);
+}
+
+// LineInput gives lines as InputFile::ReadLine() does.
+class LineInput {
+ public:
+  LineInput() : lines_() {}
+
+  void Append(const char *line) {
+    lines_.push_back(line);
+  }
+
+  bool ReadLine(nwc_toolkit::String *line) {
+    if (lines_.empty()) {
+      return false;
+    }
+    *line = lines_.front();
+    lines_.erase(lines_.begin());
+    return true;
+  }
+
+ private:
+  std::vector<nwc_toolkit::String> lines_;
+};
+
+void TestLineChunk() {
+  enum { THRESHOLD = 8 };
+
+  LineInput input;
+  input.Append("abc\n");
+  input.Append("defg\n");
+  input.Append("h\n");
+  input.Append("ijklmnopq\n");
+  input.Append("r");
+
+  nwc_toolkit::LineChunk<THRESHOLD> chunk;
+  assert(chunk.Read(&input));
+  assert(chunk.src.str() == "abc\ndefg\n");
+  assert(chunk.Read(&input));
+  assert(chunk.src.str() == "h\nijklmnopq\n");
+  assert(chunk.Read(&input));
+  assert(chunk.src.str() == "r");
+  assert(!chunk.Read(&input));
+  assert(chunk.src.is_empty());
+}
+
+}  // namespace
+
+int main() {
+  TestOpen();
+
+  TestOrder(1, 1);
+  TestOrder(1, 4);
+  TestOrder(4, 8);
+  TestOrder(8, 3);
+
+  TestProcessJobsInOrder(1, 0);
+  TestProcessJobsInOrder(1, 100);
+  TestProcessJobsInOrder(4, 1 << 12);
+  TestProcessJobsInOrder(8, 5);
+
+  TestEntryBatch();
+  TestLineChunk();
+
+  return 0;
+}
@@ -3,6 +3,7 @@
 
 import cgi
 import cgitb
+import os
 import re
 import sys
 
@@ -12,6 +13,17 @@ USER_AGENT = """Mozilla/5.0 (compatible; nwc-toolkit; http://code.google.com/p/n
 
 AVAILABLE_SCHEMES = frozenset(["http", "https", "ftp"])
 
+# The path of a Unix domain socket on which nwc-toolkit-extraction-server
+# serves requests. The server is used only if the path is given, because a
+# socket in a shared directory such as /tmp can be created by anyone. If the
+# path is not given or the server is not available, a process is spawned for
+# each request.
+EXTRACTION_SERVER_SOCKET = os.environ.get("NWC_TOOLKIT_EXTRACTION_SERVER")
+
+# The options are given to both the server and the spawned process, so that
+# the result does not depend on how the server was started.
+TEXT_EXTRACTOR_OPTIONS = "--NFKC --filter"
+
 RESPONSE_HEADER = """Content-Type: text/html; charset=utf-8\n\n"""
 
 HTML_HEADER = """<!DOCTYPE HTML PUBLIC "-//W3C//DTD HTML 4.01//EN" "http://www.w3.org/TR/html4/strict.dtd">
@@ -323,10 +335,40 @@ def PrintText(text):
   sys.stdout.write(TEXT_BODY % (string_io.getvalue()))
   string_io.close()
 
+def RequestExtractionServer(command, archive):
+  """Sends a request to nwc-toolkit-extraction-server and returns a pair of
+  whether the server is available and the result (None on error)."""
+  if not EXTRACTION_SERVER_SOCKET:
+    return (False, None)
+  import socket
+  try:
+    client = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    client.connect(EXTRACTION_SERVER_SOCKET)
+  except socket.error:
+    return (False, None)
+  try:
+    client.sendall("%s\n%s" % (command, archive))
+    response = client.makefile("rb")
+    status = response.readline().strip()
+    result = response.read(int(response.readline()))
+    response.close()
+  except (socket.error, ValueError):
+    return (True, None)
+  finally:
+    client.close()
+  if status != "OK":
+    return (True, None)
+  return (True, result)
+
 def ExtractTextFromArchive(archive):
+  (is_available, result) = RequestExtractionServer(
+      "text " + TEXT_EXTRACTOR_OPTIONS, archive)
+  if is_available:
+    return result
+
   import subprocess
   sub_process = subprocess.Popen(
-      "nwc-toolkit-text-extractor --archive -n 1 --NFKC --filter",
+      "nwc-toolkit-text-extractor --archive -n 1 " + TEXT_EXTRACTOR_OPTIONS,
       shell = True, stdin = subprocess.PIPE, stdout = subprocess.PIPE)
   sub_process.stdin.write(archive)
   sub_process.stdin.close()
@@ -339,9 +381,15 @@ def ExtractTextFromArchive(archive):
     return text
 
 def ExtractTextFromDocument(document):
+  (is_available, result) = RequestExtractionServer(
+      "text " + TEXT_EXTRACTOR_OPTIONS,
+      "\n0\n0\n%d\n%s" % (len(document), document))
+  if is_available:
+    return result
+
   import subprocess
   sub_process = subprocess.Popen(
-      "nwc-toolkit-text-extractor --single --NFKC --filter",
+      "nwc-toolkit-text-extractor --single " + TEXT_EXTRACTOR_OPTIONS,
       shell = True, stdin = subprocess.PIPE, stdout = subprocess.PIPE)
   sub_process.stdin.write(document)
   sub_process.stdin.close()
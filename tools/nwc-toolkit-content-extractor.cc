@@ -13,6 +13,7 @@
 #include <nwc-toolkit/cetr-cluster.h>
 #include <nwc-toolkit/cetr-document.h>
 #include <nwc-toolkit/character-reference.h>
+#include <nwc-toolkit/worker-pool.h>
 
 #define NWC_TOOLKIT_ERROR(fmt, ...) \
   error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
@@ -44,18 +45,38 @@ enum {
   DEFAULT_NUM_CLUSTERS = nwc_toolkit::CetrCluster::DEFAULT_NUM_CLUSTERS
 };
 
+enum {
+  MIN_NUM_THREADS = 1,
+  MAX_NUM_THREADS = 256
+};
+
 enum OutputFormat {
   TEXT_DOCUMENT,
   XML_DOCUMENT,
   DEFAULT_OUTPUT_FORMAT = TEXT_DOCUMENT
 };
 
+// A batch is closed when it has MAX_BATCH_SIZE entries or its bodies reach
+// BATCH_BODY_THRESHOLD bytes.
+enum {
+  MAX_BATCH_SIZE = 64,
+  BATCH_BODY_THRESHOLD = 1 << 20
+};
+
+// Long options without short names.
+enum {
+  THREADS_OPTION = 0x100
+};
+
 InputFormat input_format = DEFAULT_INPUT_FORMAT;
 int num_chars_threshold = DEFAULT_NUM_CHARS_THRESHOLD;
 int window_size = DEFAULT_WINDOW_SIZE;
 int num_clusters = DEFAULT_NUM_CLUSTERS;
+nwc_toolkit::CetrDocument::SmoothingMode smoothing_mode =
+    nwc_toolkit::CetrDocument::DEFAULT_SMOOTHING_MODE;
 OutputFormat output_format = DEFAULT_OUTPUT_FORMAT;
 nwc_toolkit::String output_file_name;
+std::size_t num_threads = 1;
 bool is_help_mode = false;
 
 int ParseIntegerValue(const char *arg, long min_value, long max_value) {
@@ -74,16 +95,18 @@ void ParseOptions(int argc, char *argv[]) {
     { "chars", 1, NULL, 'n' },
     { "window", 1, NULL, 'w' },
     { "clusters", 1, NULL, 'c' },
+    { "exact", 0, NULL, 'e' },
     { "text", 0, NULL, 't' },
     { "xml", 0, NULL, 'x' },
     { "output", 1, NULL, 'o' },
+    { "threads", 1, NULL, THREADS_OPTION },
     { "help", 0, NULL, 'h' },
     { NULL, 0, NULL, '\0' }
   };
 
   int value;
   while ((value = ::getopt_long(argc, argv,
-      "asn:w:c:txo:h", long_options, NULL)) != -1) {
+      "asn:w:c:etxo:h", long_options, NULL)) != -1) {
     switch (value) {
       case 'a': {
         input_format = HTML_ARCHIVE;
@@ -117,6 +140,10 @@ void ParseOptions(int argc, char *argv[]) {
         }
         break;
       }
+      case 'e': {
+        smoothing_mode = nwc_toolkit::CetrDocument::EXACT_SMOOTHING;
+        break;
+      }
       case 't': {
         output_format = TEXT_DOCUMENT;
         break;
@@ -129,6 +156,15 @@ void ParseOptions(int argc, char *argv[]) {
         output_file_name = optarg;
         break;
       }
+      case THREADS_OPTION: {
+        int num_threads_value = ParseIntegerValue(optarg,
+            MIN_NUM_THREADS, MAX_NUM_THREADS);
+        if (num_threads_value < 0) {
+          NWC_TOOLKIT_ERROR("invalid argument: --threads, %s", optarg);
+        }
+        num_threads = static_cast<std::size_t>(num_threads_value);
+        break;
+      }
       case 'h': {
         is_help_mode = true;
         break;
@@ -154,9 +190,11 @@ void PrintHelp(const char *command) {
       "  -c, --clusters=[N]   "
       "limit the number of clusters to N (default: "
       << DEFAULT_NUM_CLUSTERS << ")\n"
+      "  -e, --exact    smooth histograms exactly (slow)\n"
       "  -t, --text     output result in text-format (default)\n"
       "  -x, --xml      output result in xml-format\n"
       "  -o, --output=[FILE]  write result to FILE (default: stdout)\n"
+      "      --threads=[N]    extract contents in N threads (default: 1)\n"
       "  -h, --help     print this help\n"
       << std::flush;
 }
@@ -286,55 +324,144 @@ void GetResult(const nwc_toolkit::CetrDocument &doc,
   }
 }
 
-void ExtractContentsFromHtmlArchvie(nwc_toolkit::InputFile *input_file,
-    nwc_toolkit::OutputFile *output_file) {
-  std::time_t start_time = std::time(NULL);
+// Entries of a batch are processed in one thread and their results are
+// concatenated in input order.
+struct Batch : public nwc_toolkit::EntryBatch<nwc_toolkit::HtmlArchiveEntry,
+    MAX_BATCH_SIZE, BATCH_BODY_THRESHOLD> {
+  Batch()
+      : nwc_toolkit::EntryBatch<nwc_toolkit::HtmlArchiveEntry,
+            MAX_BATCH_SIZE, BATCH_BODY_THRESHOLD>(),
+        result(),
+        status_error_count(0),
+        parse_error_count(0) {}
 
-  nwc_toolkit::HtmlDocument html_doc;
-  nwc_toolkit::CetrDocument cetr_doc;
   nwc_toolkit::StringBuilder result;
+  long long status_error_count;
+  long long parse_error_count;
+};
+
+// BatchExtractor keeps the documents which are reused for every entry.
+// Each thread has its own BatchExtractor.
+class BatchExtractor {
+ public:
+  BatchExtractor() : html_doc_(), cetr_doc_() {
+    html_doc_.set_attribute_handler(
+        nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
+    cetr_doc_.set_smoothing_mode(smoothing_mode);
+  }
+
+  void operator()(Batch *batch);
 
-  long long num_entries = 0;
-  long long status_error_count = 0;
-  long long parse_error_count = 0;
-  nwc_toolkit::HtmlArchiveEntry entry;
-  while (entry.Read(input_file)) {
-    html_doc.Clear();
-    cetr_doc.Clear();
-    result.Clear();
+ private:
+  nwc_toolkit::HtmlDocument html_doc_;
+  nwc_toolkit::CetrDocument cetr_doc_;
+
+  // Disallows copy and assignment.
+  BatchExtractor(const BatchExtractor &);
+  BatchExtractor &operator=(const BatchExtractor &);
+};
+
+void BatchExtractor::operator()(Batch *batch) {
+  batch->result.Clear();
+  batch->status_error_count = 0;
+  batch->parse_error_count = 0;
+  for (std::size_t i = 0; i < batch->num_entries; ++i) {
+    const nwc_toolkit::HtmlArchiveEntry &entry = batch->entries[i];
+    html_doc_.Clear();
+    cetr_doc_.Clear();
 
     if (entry.status_code() != 200) {
-      ++status_error_count;
-    } else if (!html_doc.Parse(entry)) {
-      ++parse_error_count;
+      ++batch->status_error_count;
+    } else if (!html_doc_.Parse(entry)) {
+      ++batch->parse_error_count;
     } else {
-      cetr_doc.Parse(html_doc);
+      cetr_doc_.Parse(html_doc_);
     }
+    GetResult(cetr_doc_, &batch->result);
+  }
+}
 
-    GetResult(cetr_doc, &result);
-    if (!output_file->Write(result.str())) {
-      NWC_TOOLKIT_ERROR("failed to write result");
+class ProgressReporter {
+ public:
+  ProgressReporter()
+      : start_time_(std::time(NULL)),
+        num_entries_(0),
+        status_error_count_(0),
+        parse_error_count_(0) {}
+
+  // Prints the progress whenever the number of entries passes a multiple
+  // of 100.
+  void Update(const Batch &batch) {
+    long long prev_num_entries = num_entries_;
+    num_entries_ += batch.num_entries;
+    status_error_count_ += batch.status_error_count;
+    parse_error_count_ += batch.parse_error_count;
+    if ((num_entries_ / 100) != (prev_num_entries / 100)) {
+      Print();
     }
+  }
+  void Finish() {
+    Print();
+    std::cerr << std::endl;
+  }
 
-    if ((++num_entries % 100) == 0) {
-      std::cerr << '\r' << status_error_count << " ("
-          << std::fixed << std::setw(5) << std::setprecision(2)
-          << (100.0 * status_error_count / num_entries)
-          << "%) / " << parse_error_count << " ("
-          << std::fixed << std::setw(5) << std::setprecision(2)
-          << (100.0 * parse_error_count / num_entries)
-          << "%) / " << num_entries
-          << " (" << (std::time(NULL) - start_time) << "sec)";
+ private:
+  std::time_t start_time_;
+  long long num_entries_;
+  long long status_error_count_;
+  long long parse_error_count_;
+
+  void Print() const {
+    std::cerr << '\r' << status_error_count_ << " ("
+        << std::fixed << std::setw(5) << std::setprecision(2)
+        << ((num_entries_ != 0) ?
+            (100.0 * status_error_count_ / num_entries_) : 0.0)
+        << "%) / " << parse_error_count_ << " ("
+        << std::fixed << std::setw(5) << std::setprecision(2)
+        << ((num_entries_ != 0) ?
+            (100.0 * parse_error_count_ / num_entries_) : 0.0)
+        << "%) / " << num_entries_
+        << " (" << (std::time(NULL) - start_time_) << "sec)";
+  }
+
+  // Disallows copy and assignment.
+  ProgressReporter(const ProgressReporter &);
+  ProgressReporter &operator=(const ProgressReporter &);
+};
+
+class BatchWriter {
+ public:
+  BatchWriter(nwc_toolkit::OutputFile *output_file,
+      ProgressReporter *reporter)
+      : output_file_(output_file),
+        reporter_(reporter) {}
+
+  void operator()(const Batch *batch) {
+    if (!output_file_->Write(batch->result.str())) {
+      NWC_TOOLKIT_ERROR("failed to write result");
     }
+    reporter_->Update(*batch);
+  }
+
+ private:
+  nwc_toolkit::OutputFile *output_file_;
+  ProgressReporter *reporter_;
+
+  // Disallows copy and assignment.
+  BatchWriter(const BatchWriter &);
+  BatchWriter &operator=(const BatchWriter &);
+};
+
+void ExtractContentsFromHtmlArchvie(nwc_toolkit::InputFile *input_file,
+    nwc_toolkit::OutputFile *output_file) {
+  ProgressReporter reporter;
+  BatchWriter writer(output_file, &reporter);
+  if (!nwc_toolkit::ProcessJobsInOrder<Batch, BatchExtractor>(
+      input_file, &writer, num_threads)) {
+    NWC_TOOLKIT_ERROR("failed to start threads: %lu",
+        static_cast<unsigned long>(num_threads));
   }
-  std::cerr << '\r' << status_error_count << " ("
-      << std::fixed << std::setw(5) << std::setprecision(2)
-      << ((num_entries != 0) ? (100.0 * status_error_count / num_entries) : 0.0)
-      << "%) / " << parse_error_count << " ("
-      << std::fixed << std::setw(5) << std::setprecision(2)
-      << ((num_entries != 0) ? (100.0 * parse_error_count / num_entries) : 0.0)
-      << "%) / " << num_entries
-      << " (" << (std::time(NULL) - start_time) << "sec)" << std::endl;
+  reporter.Finish();
 }
 
 void ExtractContentsFromSingleHtmlDocument(nwc_toolkit::InputFile *input_file,
@@ -346,11 +473,14 @@ void ExtractContentsFromSingleHtmlDocument(nwc_toolkit::InputFile *input_file,
   }
 
   nwc_toolkit::HtmlDocument html_doc;
+  html_doc.set_attribute_handler(
+      nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
   if (!html_doc.Parse(body.str())) {
     NWC_TOOLKIT_ERROR("failed to parse html document");
   }
 
   nwc_toolkit::CetrDocument cetr_doc;
+  cetr_doc.set_smoothing_mode(smoothing_mode);
   cetr_doc.Parse(html_doc);
 
   nwc_toolkit::StringBuilder result;
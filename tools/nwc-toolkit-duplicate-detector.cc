@@ -4,37 +4,80 @@
 #include <error.h>
 #include <getopt.h>
 
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 
+#include <nwc-toolkit/digest-set.h>
 #include <nwc-toolkit/input-file.h>
+#include <nwc-toolkit/metrics.h>
 #include <nwc-toolkit/output-file.h>
+#include <nwc-toolkit/spill-file.h>
 
 #define NWC_TOOLKIT_ERROR(fmt, ...) \
   error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
 
 namespace {
 
+enum { DEFAULT_MEMORY_LIMIT = 1024 };
+
 nwc_toolkit::String output_file_name;
+std::size_t memory_limit = static_cast<std::size_t>(DEFAULT_MEMORY_LIMIT) << 20;
+nwc_toolkit::String temporary_directory;
+nwc_toolkit::MetricsOptions metrics_options;
 bool is_help_mode = false;
 
+nwc_toolkit::Metrics metrics;
+nwc_toolkit::Metrics::Counter *input_counter = metrics.AddCounter("lines");
+nwc_toolkit::Metrics::Counter *output_counter =
+    metrics.AddCounter("duplicates");
+nwc_toolkit::Metrics::Counter *spill_counter =
+    metrics.AddCounter("spilled_lines");
+
 void ParseOptions(int argc, char *argv[]) {
   static const struct option long_options[] = {
     { "output", 1, NULL, 'o' },
+    { "memory", 1, NULL, 'l' },
+    { "temporary-directory", 1, NULL, 'T' },
+    NWC_TOOLKIT_METRICS_LONG_OPTIONS,
     { "help", 0, NULL, 'h' },
     { NULL, 0, NULL, '\0' }
   };
 
   int value;
   while ((value = ::getopt_long(argc, argv,
-      "o:h", long_options, NULL)) != -1) {
+      "o:l:T:h", long_options, NULL)) != -1) {
     switch (value) {
       case 'o': {
         output_file_name = optarg;
         break;
       }
+      case 'l': {
+        char *end_of_value;
+        long long value = std::strtoll(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value <= 0) ||
+            (value > static_cast<long long>(
+            std::numeric_limits<std::size_t>::max() >> 20))) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        memory_limit = static_cast<std::size_t>(value) << 20;
+        break;
+      }
+      case 'T': {
+        temporary_directory = optarg;
+        break;
+      }
+      case nwc_toolkit::MetricsOptions::METRICS_OPTION:
+      case nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION: {
+        if (!metrics_options.Parse(value, optarg)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
       case 'h': {
         is_help_mode = true;
         break;
@@ -50,19 +93,102 @@ void PrintHelp(const char *command) {
   std::cerr << "Usage: " << command << " [OPTION]... [FILE]...\n\n"
       "Options:\n"
       "  -o, --output=[FILE]  write result to FILE (default: stdout)\n"
+      "  -l, --memory=[N]     limit the memory usage to N MiB (default: "
+      << DEFAULT_MEMORY_LIMIT << ")\n"
+      "                       input is split into temporary files\n"
+      "                       once the limit is reached\n"
+      "  -T, --temporary-directory=[DIR]\n"
+      "                       create temporary files in DIR\n"
+      "                       (default: $TMPDIR or /tmp)\n"
+      << nwc_toolkit::MetricsOptions::help() <<
       "  -h, --help    print this help\n"
       << std::flush;
 }
 
+typedef nwc_toolkit::DigestSet::Digest Digest;
+
+nwc_toolkit::DigestSet digest_set;
+std::time_t start_time;
+long long input_count;
+long long output_count;
+
+void PrintProgress() {
+  std::cerr << '\r' << output_count << " / " << input_count << " ("
+      << std::fixed << std::setw(5) << std::setprecision(2)
+      << ((input_count != 0) ? (100.0 * output_count / input_count) : 0.0)
+      << "%) (" << (std::time(NULL) - start_time) << "sec)";
+}
+
+// Writes `url' if `digest' has already appeared, or remembers `digest'.
+// Lines whose digests cannot be remembered go to `partitions', which are
+// split by the low word of the digests.
+void Check(const Digest &digest, const nwc_toolkit::String &url, int level,
+    nwc_toolkit::SpillFile *partitions,
+    nwc_toolkit::OutputFile *output_file) {
+  if (digest_set.Contains(digest)) {
+    if (!output_file->Write(url)) {
+      NWC_TOOLKIT_ERROR("failed to write result");
+    }
+    ++output_count;
+    output_counter->Increment();
+  } else if (!digest_set.Insert(digest)) {
+    if (level >= nwc_toolkit::SpillFile::MAX_NUM_LEVELS) {
+      NWC_TOOLKIT_ERROR("too many hashes: memory limit is too small");
+    }
+    nwc_toolkit::SpillFile *partition = &partitions[
+        nwc_toolkit::SpillFile::GetPartitionID(digest.low, level)];
+    if (!partition->is_open() && !partition->Open(temporary_directory)) {
+      NWC_TOOLKIT_ERROR("failed to create temporary file");
+    }
+    if (!partition->Write(nwc_toolkit::String(
+        reinterpret_cast<const char *>(&digest), sizeof(digest)), url)) {
+      NWC_TOOLKIT_ERROR("failed to write temporary file");
+    }
+    spill_counter->Increment();
+  }
+}
+
+void DetectInPartitions(nwc_toolkit::SpillFile *partitions, int level,
+    nwc_toolkit::OutputFile *output_file) {
+  for (std::size_t i = 0; i < nwc_toolkit::SpillFile::NUM_PARTITIONS; ++i) {
+    if (!partitions[i].is_open()) {
+      continue;
+    }
+    digest_set.Reset(memory_limit);
+    nwc_toolkit::SpillFile next_partitions[
+        nwc_toolkit::SpillFile::NUM_PARTITIONS];
+    if (!partitions[i].Rewind()) {
+      NWC_TOOLKIT_ERROR("failed to write temporary file");
+    }
+    nwc_toolkit::StringBuilder key, url;
+    while (partitions[i].Read(&key, &url)) {
+      Digest digest;
+      std::memcpy(&digest, key.ptr(), sizeof(digest));
+      Check(digest, url.str(), level + 1, next_partitions, output_file);
+    }
+    if (partitions[i].has_error()) {
+      NWC_TOOLKIT_ERROR("failed to read temporary file");
+    }
+    partitions[i].Close();
+    metrics.Update();
+    PrintProgress();
+    DetectInPartitions(next_partitions, level + 1, output_file);
+  }
+}
+
+// Writes the URLs of the lines whose hashes have appeared in the previous
+// lines. Once the memory limit is reached, hashes which are not in memory
+// are processed later, so the order of URLs is not kept.
 void Detect(nwc_toolkit::InputFile *input_file,
     nwc_toolkit::OutputFile *output_file) {
-  std::time_t start_time = std::time(NULL);
+  start_time = std::time(NULL);
+  input_count = 0;
+  output_count = 0;
 
-  long long input_count = 0;
-  long long output_count = 0;
+  digest_set.Reset(memory_limit);
+  nwc_toolkit::SpillFile partitions[nwc_toolkit::SpillFile::NUM_PARTITIONS];
 
   nwc_toolkit::String line;
-  nwc_toolkit::StringBuilder last_hash;
   while (input_file->ReadLine(&line)) {
     nwc_toolkit::String delim = line.FindFirstOf('\t');
     if (delim.is_empty()) {
@@ -71,34 +197,26 @@ void Detect(nwc_toolkit::InputFile *input_file,
     }
 
     nwc_toolkit::String hash(line.begin(), delim.begin());
-    if (hash.length() != 40) {
+    Digest digest;
+    if (!nwc_toolkit::DigestSet::Parse(hash, &digest)) {
       NWC_TOOLKIT_ERROR("invalid format: 1st field must be SHA-1 hash: %.*s",
           static_cast<int>(line.length()), line.ptr());
     }
 
-    if (hash == last_hash.str()) {
-      nwc_toolkit::String url(delim.end(), line.end());
-      if (!output_file->Write(url)) {
-        NWC_TOOLKIT_ERROR("failed to write result");
-      }
-      ++output_count;
-    } else if (hash < last_hash.str()) {
-      NWC_TOOLKIT_ERROR("invalid order: input must be sorted");
-    } else {
-      last_hash = hash;
-    }
+    nwc_toolkit::String url(delim.end(), line.end());
+    Check(digest, url, 0, partitions, output_file);
 
+    input_counter->Increment();
     if ((++input_count % 1000) == 0) {
-      std::cerr << '\r' << output_count << " / " << input_count << " ("
-          << std::fixed << std::setw(5) << std::setprecision(2)
-          << ((input_count != 0) ? (100.0 * output_count / input_count) : 0.0)
-          << "%) (" << (std::time(NULL) - start_time) << "sec)";
+      metrics.Update();
+      PrintProgress();
     }
   }
-  std::cerr << '\r' << output_count << " / " << input_count << " ("
-      << std::fixed << std::setw(5) << std::setprecision(2)
-      << ((input_count != 0) ? (100.0 * output_count / input_count) : 0.0)
-      << "%) (" << (std::time(NULL) - start_time) << "sec)" << std::endl;
+  DetectInPartitions(partitions, 0, output_file);
+  digest_set.Clear();
+
+  PrintProgress();
+  std::cerr << std::endl;
 }
 
 }  // namespace
@@ -118,6 +236,11 @@ int main(int argc, char *argv[]) {
         output_file_name.ptr());
   }
 
+  if (!metrics_options.Open("duplicate-detector", &metrics)) {
+    NWC_TOOLKIT_ERROR("failed to open metrics file: %s",
+        metrics_options.path().ptr());
+  }
+
   if (optind == argc) {
     nwc_toolkit::InputFile input_file;
     std::cerr << "input: (standard input)" << std::endl;
@@ -138,6 +261,7 @@ int main(int argc, char *argv[]) {
     }
     Detect(&input_file, &output_file);
   }
+  metrics.Close();
 
   return 0;
 }
@@ -0,0 +1,844 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <errno.h>
+#include <error.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <nwc-toolkit/cetr-document.h>
+#include <nwc-toolkit/character-reference.h>
+#include <nwc-toolkit/html-document.h>
+#include <nwc-toolkit/metrics.h>
+#include <nwc-toolkit/text-filter.h>
+#include <nwc-toolkit/unicode-normalizer.h>
+
+#define NWC_TOOLKIT_ERROR(fmt, ...) \
+  error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
+
+namespace {
+
+enum {
+  DEFAULT_NUM_THREADS = 4,
+  MAX_NUM_THREADS = 256,
+  DEFAULT_MAX_LENGTH = 64 << 20,
+  DEFAULT_TIMEOUT = 60
+};
+
+enum {
+  TIMEOUT_OPTION = 0x100
+};
+
+nwc_toolkit::String socket_path;
+std::size_t num_threads = DEFAULT_NUM_THREADS;
+std::size_t max_length = DEFAULT_MAX_LENGTH;
+long timeout = DEFAULT_TIMEOUT;
+
+// TextOptions specifies the postprocessing of the `text' command. The
+// options given to the server are used unless a request has its own.
+struct TextOptions {
+  bool with_unicode_normalization;
+  nwc_toolkit::UnicodeNormalizer::NormalizationForm normalization_form;
+  nwc_toolkit::UnicodeNormalizer::IllegalInputHandler illegal_input_handler;
+  bool with_text_filter;
+};
+
+const TextOptions NO_TEXT_OPTIONS = {
+  false,
+  nwc_toolkit::UnicodeNormalizer::DEFAULT_FORM,
+  nwc_toolkit::UnicodeNormalizer::DEFAULT_HANDLER,
+  false
+};
+
+TextOptions default_text_options = NO_TEXT_OPTIONS;
+nwc_toolkit::MetricsOptions metrics_options;
+bool is_help_mode = false;
+
+// Metrics is not thread-safe, so the counters are updated with
+// `metrics_mutex' locked.
+nwc_toolkit::Metrics metrics;
+::pthread_mutex_t metrics_mutex = PTHREAD_MUTEX_INITIALIZER;
+nwc_toolkit::Metrics::Counter *request_counter =
+    metrics.AddCounter("requests");
+nwc_toolkit::Metrics::Counter *error_counter =
+    metrics.AddCounter("request_errors");
+nwc_toolkit::Metrics::Counter *input_counter =
+    metrics.AddCounter("input_bytes");
+nwc_toolkit::Metrics::Counter *output_counter =
+    metrics.AddCounter("output_bytes");
+nwc_toolkit::Metrics::Counter *connection_counter =
+    metrics.AddCounter("connections");
+nwc_toolkit::Metrics::Histogram *request_histogram =
+    metrics.AddHistogram("request_seconds");
+
+void ParseOptions(int argc, char *argv[]) {
+  static const struct option long_options[] = {
+    { "socket", 1, NULL, 'u' },
+    { "threads", 1, NULL, 't' },
+    { "budget", 1, NULL, 'b' },
+    { "timeout", 1, NULL, TIMEOUT_OPTION },
+    { "NFC", 0, NULL, 'c' },
+    { "NFD", 0, NULL, 'd' },
+    { "NFKC", 0, NULL, 'C' },
+    { "NFKD", 0, NULL, 'D' },
+    { "keep", 0, NULL, 'k' },
+    { "remove", 0, NULL, 'r' },
+    { "filter", 0, NULL, 'f' },
+    NWC_TOOLKIT_METRICS_LONG_OPTIONS,
+    { "help", 0, NULL, 'h' },
+    { NULL, 0, NULL, '\0' }
+  };
+
+  int value;
+  while ((value = ::getopt_long(argc, argv,
+      "u:t:b:cdCDkrfh", long_options, NULL)) != -1) {
+    switch (value) {
+      case 'u': {
+        socket_path = optarg;
+        break;
+      }
+      case 't': {
+        char *end_of_value;
+        long value = std::strtol(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value <= 0) ||
+            (value > MAX_NUM_THREADS)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        num_threads = static_cast<std::size_t>(value);
+        break;
+      }
+      case 'b': {
+        char *end_of_value;
+        long long value = std::strtoll(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value <= 0)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        max_length = static_cast<std::size_t>(value);
+        break;
+      }
+      case TIMEOUT_OPTION: {
+        char *end_of_value;
+        timeout = std::strtol(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (timeout <= 0)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
+      case 'c': {
+        default_text_options.normalization_form =
+            nwc_toolkit::UnicodeNormalizer::NFC;
+        default_text_options.with_unicode_normalization = true;
+        break;
+      }
+      case 'd': {
+        default_text_options.normalization_form =
+            nwc_toolkit::UnicodeNormalizer::NFD;
+        default_text_options.with_unicode_normalization = true;
+        break;
+      }
+      case 'C': {
+        default_text_options.normalization_form =
+            nwc_toolkit::UnicodeNormalizer::NFKC;
+        default_text_options.with_unicode_normalization = true;
+        break;
+      }
+      case 'D': {
+        default_text_options.normalization_form =
+            nwc_toolkit::UnicodeNormalizer::NFKD;
+        default_text_options.with_unicode_normalization = true;
+        break;
+      }
+      case 'k': {
+        default_text_options.illegal_input_handler =
+            nwc_toolkit::UnicodeNormalizer::KEEP_REPLACEMENT_CHARACTERS;
+        break;
+      }
+      case 'r': {
+        default_text_options.illegal_input_handler =
+            nwc_toolkit::UnicodeNormalizer::REMOVE_REPLACEMENT_CHARACTERS;
+        break;
+      }
+      case 'f': {
+        default_text_options.with_text_filter = true;
+        break;
+      }
+      case nwc_toolkit::MetricsOptions::METRICS_OPTION:
+      case nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION: {
+        if (!metrics_options.Parse(value, optarg)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
+      case 'h': {
+        is_help_mode = true;
+        break;
+      }
+      default: {
+        NWC_TOOLKIT_ERROR("invalid option");
+      }
+    }
+  }
+}
+
+void PrintHelp(const char *command) {
+  std::cerr << "Usage: " << command << " [OPTION]...\n\n"
+      "Options:\n"
+      "  -u, --socket=[PATH]  "
+      "serve requests on a Unix domain socket PATH\n"
+      "                       (default: standard input and output)\n"
+      "  -t, --threads=[N]    "
+      "serve requests in N threads (default: "
+      << DEFAULT_NUM_THREADS << ")\n"
+      "  -b, --budget=[N]     "
+      "reject a request whose header or body is longer\n"
+      "                       than N bytes (default: "
+      << DEFAULT_MAX_LENGTH << ")\n"
+      "      --timeout=[N]    "
+      "close a connection idle for N seconds (default: "
+      << DEFAULT_TIMEOUT << ")\n"
+      "  -c, --NFC      Normalization Form C (default)\n"
+      "  -d, --NFD      Normalization Form D\n"
+      "  -C, --NFKC     Normalization Form KC\n"
+      "  -D, --NFKD     Normalization Form KD\n"
+      "                 C = Composition, D = Decomposition, K = Compatibility\n"
+      "  -k, --keep     keep replacement characters (default)\n"
+      "  -r, --remove   remove replacement characters\n"
+      "  -f, --filter   apply text filter\n"
+      << nwc_toolkit::MetricsOptions::help() <<
+      "  -h, --help     print this help\n"
+      "\n"
+      "Request:  COMMAND [OPTION]...\\n HTML-ARCHIVE-ENTRY\n"
+      "          COMMAND is `text' or `content'\n"
+      "          OPTIONs of `text' (--NFC, --NFD, --NFKC, --NFKD,\n"
+      "          --keep, --remove and --filter) override those of\n"
+      "          the server\n"
+      "Response: STATUS\\n LENGTH\\n RESULT\n"
+      "          STATUS is `OK' or `ERROR'\n"
+      << std::flush;
+}
+
+// Parses options which follow a command, such as "--NFKC --filter". The
+// options replace `options' as a whole, so a request does not depend on the
+// options given to the server. Returns false if an option is unknown.
+bool ParseTextOptions(const nwc_toolkit::String &str, TextOptions *options) {
+  *options = NO_TEXT_OPTIONS;
+  nwc_toolkit::String avail = str;
+  while (!avail.is_empty()) {
+    nwc_toolkit::String delim = avail.FindFirstOf(' ');
+    nwc_toolkit::String option(avail.begin(), delim.begin());
+    avail.set_begin(delim.end());
+    if (option.is_empty()) {
+      continue;
+    } else if (option == "--NFC") {
+      options->normalization_form = nwc_toolkit::UnicodeNormalizer::NFC;
+      options->with_unicode_normalization = true;
+    } else if (option == "--NFD") {
+      options->normalization_form = nwc_toolkit::UnicodeNormalizer::NFD;
+      options->with_unicode_normalization = true;
+    } else if (option == "--NFKC") {
+      options->normalization_form = nwc_toolkit::UnicodeNormalizer::NFKC;
+      options->with_unicode_normalization = true;
+    } else if (option == "--NFKD") {
+      options->normalization_form = nwc_toolkit::UnicodeNormalizer::NFKD;
+      options->with_unicode_normalization = true;
+    } else if (option == "--keep") {
+      options->illegal_input_handler =
+          nwc_toolkit::UnicodeNormalizer::KEEP_REPLACEMENT_CHARACTERS;
+    } else if (option == "--remove") {
+      options->illegal_input_handler =
+          nwc_toolkit::UnicodeNormalizer::REMOVE_REPLACEMENT_CHARACTERS;
+    } else if (option == "--filter") {
+      options->with_text_filter = true;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Connection reads requests from and writes responses to a pair of file
+// descriptors. InputFile is not used because fread() waits until its buffer
+// is filled, whereas a client waits for the response before sending the
+// next request.
+class Connection {
+ public:
+  enum {
+    MIN_READ_SIZE = 1 << 16,
+    MAX_LINE_LENGTH = 1 << 16
+  };
+
+  Connection(int input_fd, int output_fd)
+      : input_fd_(input_fd), output_fd_(output_fd), buf_(), begin_(0) {}
+  ~Connection() {}
+
+  // Reads a request and returns false at the end of input. If a request is
+  // rejected, `error_message' is set and true is returned. If a request is
+  // broken, `error_message' is set and false is returned.
+  bool ReadRequest(nwc_toolkit::StringBuilder *command,
+      nwc_toolkit::HtmlArchiveEntry *entry, const char **error_message);
+  bool WriteResponse(const char *status, const nwc_toolkit::String &result);
+
+ private:
+  int input_fd_;
+  int output_fd_;
+  nwc_toolkit::StringBuilder buf_;
+  std::size_t begin_;
+
+  // The returned string is available until the next call.
+  bool ReadLine(nwc_toolkit::String *line);
+  bool ReadLength(std::size_t *length);
+  bool Read(std::size_t size, nwc_toolkit::String *data);
+  bool Skip(std::size_t size);
+  bool FillBuf();
+  bool WriteAll(const char *ptr, std::size_t size);
+
+  // Disallows copy and assignment.
+  Connection(const Connection &);
+  Connection &operator=(const Connection &);
+};
+
+bool Connection::ReadRequest(nwc_toolkit::StringBuilder *command,
+    nwc_toolkit::HtmlArchiveEntry *entry, const char **error_message) {
+  *error_message = NULL;
+  entry->Clear();
+
+  nwc_toolkit::String line;
+  if (!ReadLine(&line)) {
+    return false;
+  }
+  command->Assign(line.StripRight());
+
+  *error_message = "broken request";
+  if (!ReadLine(&line)) {
+    return false;
+  }
+  entry->set_url(line.StripRight());
+
+  std::size_t status_code;
+  if (!ReadLength(&status_code)) {
+    return false;
+  }
+  entry->set_status_code(static_cast<int>(status_code));
+
+  // A too long header or body is skipped without being buffered, so that
+  // the next request can be read.
+  std::size_t length;
+  if (!ReadLength(&length)) {
+    return false;
+  }
+  const char *rejection = NULL;
+  if (length > max_length) {
+    if (!Skip(length)) {
+      return false;
+    }
+    rejection = "too long header";
+  } else if (Read(length, &line)) {
+    entry->set_header(line);
+  } else {
+    return false;
+  }
+
+  if (!ReadLength(&length)) {
+    return false;
+  }
+  if (length > max_length) {
+    if (!Skip(length)) {
+      return false;
+    }
+    if (rejection == NULL) {
+      rejection = "too long body";
+    }
+  } else if (!Read(length, &line)) {
+    return false;
+  }
+  if (rejection != NULL) {
+    *error_message = rejection;
+    return true;
+  }
+  entry->set_body(line);
+
+  *error_message = NULL;
+  return true;
+}
+
+bool Connection::WriteResponse(const char *status,
+    const nwc_toolkit::String &result) {
+  char header[64];
+  int header_length = std::snprintf(header, sizeof(header), "%s\n%lu\n",
+      status, static_cast<unsigned long>(result.length()));
+  return WriteAll(header, header_length) &&
+      WriteAll(result.ptr(), result.length());
+}
+
+bool Connection::ReadLine(nwc_toolkit::String *line) {
+  std::size_t pos = begin_;
+  for ( ; ; ) {
+    const char *delim = static_cast<const char *>(std::memchr(
+        buf_.ptr() + pos, '\n', buf_.length() - pos));
+    if (delim != NULL) {
+      line->Assign(buf_.ptr() + begin_, delim + 1 - (buf_.ptr() + begin_));
+      begin_ = delim + 1 - buf_.ptr();
+      return true;
+    }
+    // A line without a newline must not grow the buffer without limit.
+    pos = buf_.length() - begin_;
+    if ((pos > MAX_LINE_LENGTH) || !FillBuf()) {
+      return false;
+    }
+    pos += begin_;
+  }
+}
+
+bool Connection::ReadLength(std::size_t *length) {
+  nwc_toolkit::String line;
+  if (!ReadLine(&line)) {
+    return false;
+  }
+  line = line.StripRight();
+  char *end_of_value;
+  long long value = std::strtoll(line.ptr(), &end_of_value, 10);
+  if (line.is_empty() || (end_of_value != line.end()) || (value < 0)) {
+    return false;
+  }
+  *length = static_cast<std::size_t>(value);
+  return true;
+}
+
+bool Connection::Read(std::size_t size, nwc_toolkit::String *data) {
+  while (buf_.length() - begin_ < size) {
+    if (!FillBuf()) {
+      return false;
+    }
+  }
+  data->Assign(buf_.ptr() + begin_, size);
+  begin_ += size;
+  return true;
+}
+
+bool Connection::Skip(std::size_t size) {
+  while (buf_.length() - begin_ < size) {
+    size -= buf_.length() - begin_;
+    begin_ = buf_.length();
+    if (!FillBuf()) {
+      return false;
+    }
+  }
+  begin_ += size;
+  return true;
+}
+
+// Moves the unread bytes to the front and appends bytes read from the
+// input. The buffer grows only while a request does not fit in it.
+bool Connection::FillBuf() {
+  std::size_t avail = buf_.length() - begin_;
+  if (begin_ != 0) {
+    std::memmove(buf_.buf(), buf_.ptr() + begin_, avail);
+    buf_.Resize(avail);
+    begin_ = 0;
+  }
+  std::size_t size = buf_.size() - avail;
+  if (size < MIN_READ_SIZE) {
+    size = MIN_READ_SIZE;
+  }
+  buf_.Resize(avail + size);
+  for ( ; ; ) {
+    ssize_t size_read = ::read(input_fd_, buf_.buf() + avail, size);
+    if (size_read > 0) {
+      buf_.Resize(avail + size_read);
+      return true;
+    } else if ((size_read < 0) && (errno == EINTR)) {
+      continue;
+    }
+    buf_.Resize(avail);
+    return false;
+  }
+}
+
+bool Connection::WriteAll(const char *ptr, std::size_t size) {
+  while (size > 0) {
+    ssize_t size_written = ::write(output_fd_, ptr, size);
+    if (size_written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    ptr += size_written;
+    size -= size_written;
+  }
+  return true;
+}
+
+// Extractor keeps the documents, the normalizer and the buffers which are
+// reused for every request, so that a request does not pay for their
+// construction and memory allocation. Each thread has its own Extractor.
+class Extractor {
+ public:
+  Extractor()
+      : html_doc_(),
+        cetr_doc_(),
+        normalizer_(),
+        normalizer_options_(NO_TEXT_OPTIONS),
+        text_(),
+        normalized_text_(),
+        filtered_text_() {
+    html_doc_.set_attribute_handler(
+        nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
+    if (default_text_options.with_unicode_normalization &&
+        !OpenNormalizer(default_text_options)) {
+      NWC_TOOLKIT_ERROR("failed to open unicode normalizer");
+    }
+  }
+  ~Extractor() {}
+
+  // Returns an error message if the request is failed, or NULL otherwise.
+  const char *Extract(const nwc_toolkit::String &command,
+      const nwc_toolkit::HtmlArchiveEntry &entry,
+      nwc_toolkit::StringBuilder *result);
+
+ private:
+  nwc_toolkit::HtmlDocument html_doc_;
+  nwc_toolkit::CetrDocument cetr_doc_;
+  nwc_toolkit::UnicodeNormalizer normalizer_;
+  TextOptions normalizer_options_;
+  nwc_toolkit::StringBuilder text_;
+  nwc_toolkit::StringBuilder normalized_text_;
+  nwc_toolkit::StringBuilder filtered_text_;
+
+  bool OpenNormalizer(const TextOptions &options);
+  const char *ExtractText(const nwc_toolkit::HtmlArchiveEntry &entry,
+      const TextOptions &options, nwc_toolkit::StringBuilder *result);
+  const char *ExtractContents(const nwc_toolkit::HtmlArchiveEntry &entry,
+      nwc_toolkit::StringBuilder *result);
+
+  // Disallows copy and assignment.
+  Extractor(const Extractor &);
+  Extractor &operator=(const Extractor &);
+};
+
+const char *Extractor::Extract(const nwc_toolkit::String &command,
+    const nwc_toolkit::HtmlArchiveEntry &entry,
+    nwc_toolkit::StringBuilder *result) {
+  result->Clear();
+  nwc_toolkit::String delim = command.FindFirstOf(' ');
+  nwc_toolkit::String name(command.begin(), delim.begin());
+  if ((entry.status_code() != 0) && (entry.status_code() != 200)) {
+    return "status code is not 200";
+  } else if (name == "text") {
+    TextOptions options = default_text_options;
+    if (!delim.is_empty() &&
+        !ParseTextOptions(nwc_toolkit::String(delim.end(), command.end()),
+        &options)) {
+      return "unknown option";
+    }
+    return ExtractText(entry, options, result);
+  } else if (name == "content") {
+    if (!delim.is_empty()) {
+      return "unknown option";
+    }
+    return ExtractContents(entry, result);
+  }
+  return "unknown command";
+}
+
+// The normalizer is reopened only when a request asks for another form.
+bool Extractor::OpenNormalizer(const TextOptions &options) {
+  if (normalizer_.is_open() &&
+      (options.normalization_form == normalizer_options_.normalization_form) &&
+      (options.illegal_input_handler ==
+       normalizer_options_.illegal_input_handler)) {
+    return true;
+  }
+  normalizer_options_ = options;
+  return normalizer_.Open(options.normalization_form,
+      options.illegal_input_handler);
+}
+
+// The result is the same as that of nwc-toolkit-text-extractor.
+const char *Extractor::ExtractText(
+    const nwc_toolkit::HtmlArchiveEntry &entry, const TextOptions &options,
+    nwc_toolkit::StringBuilder *result) {
+  text_.Clear();
+  if (!html_doc_.Parse(entry)) {
+    return "failed to parse html document";
+  }
+  html_doc_.ExtractText(&text_);
+  nwc_toolkit::StringBuilder *temp = &text_;
+
+  if (options.with_unicode_normalization) {
+    normalized_text_.Clear();
+    if (!OpenNormalizer(options)) {
+      return "failed to open unicode normalizer";
+    } else if (!normalizer_.Normalize(temp->str(), &normalized_text_)) {
+      return "failed to normalize text";
+    }
+    temp = &normalized_text_;
+  }
+
+  if (options.with_text_filter) {
+    filtered_text_.Clear();
+    nwc_toolkit::TextFilter::Filter(temp->str(), &filtered_text_);
+    temp = &filtered_text_;
+  }
+
+  result->Append(temp->str()).Append('\n');
+  return NULL;
+}
+
+void AppendLineTag(const nwc_toolkit::CetrDocument &doc,
+    std::size_t line_id, nwc_toolkit::StringBuilder *result) {
+  enum { MAX_LENGTH = 256 };
+  result->Reserve(result->length() + MAX_LENGTH);
+  int length = std::snprintf(result->buf() + result->length(), MAX_LENGTH,
+      "<Line is_content=\"%s\" num_tags=\"%zd\" num_chars=\"%zd\""
+      " tag_ratio=\"%f\" smoothed_tag_ratio=\"%f\""
+      " derivate=\"%f\" smoothed_derivate=\"%f\">\n",
+      (doc.is_content(line_id) ? "yes" : " no"),
+      doc.line(line_id).num_tags(), doc.line(line_id).num_text_chars(),
+      doc.tag_ratio(line_id), doc.smoothed_tag_ratio(line_id),
+      doc.derivate(line_id), doc.smoothed_derivate(line_id));
+  if ((length < 0) || (length >= MAX_LENGTH)) {
+    NWC_TOOLKIT_ERROR("too long line tag");
+  }
+  result->Resize(result->length() + length);
+}
+
+// The result is the same as that of nwc-toolkit-content-extractor --xml.
+const char *Extractor::ExtractContents(
+    const nwc_toolkit::HtmlArchiveEntry &entry,
+    nwc_toolkit::StringBuilder *result) {
+  cetr_doc_.Clear();
+  if (!html_doc_.Parse(entry)) {
+    return "failed to parse html document";
+  }
+  cetr_doc_.Parse(html_doc_);
+
+  result->Append(
+      "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+      "<ResultSet>\n"
+      "<Result>\n");
+  for (std::size_t i = 0; i < cetr_doc_.num_lines(); ++i) {
+    AppendLineTag(cetr_doc_, i, result);
+    const nwc_toolkit::CetrLine &line = cetr_doc_.line(i);
+    for (std::size_t j = 0; j < line.num_units(); ++j) {
+      const nwc_toolkit::CetrUnit &unit = line.unit(j);
+      result->Append("<Unit type=\"");
+      switch (unit.type()) {
+        case nwc_toolkit::CetrUnit::TAG_UNIT: {
+          result->Append("tag");
+          break;
+        }
+        case nwc_toolkit::CetrUnit::TEXT_UNIT: {
+          result->Append("text");
+          break;
+        }
+        default: {
+          result->Append("invisible");
+          break;
+        }
+      }
+      result->Append("\">");
+      nwc_toolkit::CharacterReference::Encode(unit.content(), result);
+      result->Append("</Unit>\n");
+    }
+    result->Append("</Line>\n");
+  }
+  result->Append("</Result>\n"
+      "</ResultSet>\n");
+  return NULL;
+}
+
+// Serves requests on a connection until the client closes it or sends a
+// broken request.
+void ServeConnection(Connection *connection, Extractor *extractor) {
+  nwc_toolkit::StringBuilder command;
+  nwc_toolkit::HtmlArchiveEntry entry;
+  nwc_toolkit::StringBuilder result;
+  const char *error_message;
+  while (connection->ReadRequest(&command, &entry, &error_message)) {
+    double start_time = nwc_toolkit::Metrics::GetTime();
+    if (error_message == NULL) {
+      error_message = extractor->Extract(command.str(), entry, &result);
+    }
+    bool is_ok = (error_message == NULL) ?
+        connection->WriteResponse("OK", result.str()) :
+        connection->WriteResponse("ERROR", error_message);
+
+    ::pthread_mutex_lock(&metrics_mutex);
+    request_counter->Increment();
+    if (error_message != NULL) {
+      error_counter->Increment();
+    }
+    input_counter->Add(entry.url().length() + entry.header().length()
+        + entry.body().length());
+    output_counter->Add(result.length());
+    request_histogram->Observe(nwc_toolkit::Metrics::GetTime() - start_time);
+    metrics.Update();
+    ::pthread_mutex_unlock(&metrics_mutex);
+
+    if (!is_ok) {
+      return;
+    }
+  }
+  if (error_message != NULL) {
+    connection->WriteResponse("ERROR", error_message);
+  }
+}
+
+int listen_fd = -1;
+
+// Each thread accepts connections from the shared socket and serves them
+// with its own Extractor, which is constructed only once.
+void *ServeSocket(void *) {
+  Extractor extractor;
+  for ( ; ; ) {
+    int fd = ::accept(listen_fd, NULL, NULL);
+    if (fd == -1) {
+      if ((errno == EINTR) || (errno == ECONNABORTED)) {
+        continue;
+      }
+      NWC_TOOLKIT_ERROR("failed to accept connection");
+    }
+
+    ::pthread_mutex_lock(&metrics_mutex);
+    connection_counter->Increment();
+    ::pthread_mutex_unlock(&metrics_mutex);
+
+    // A client which sends nothing must not hold the thread forever.
+    struct timeval time_limit;
+    time_limit.tv_sec = timeout;
+    time_limit.tv_usec = 0;
+    if ((::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO,
+        &time_limit, sizeof(time_limit)) == -1) ||
+        (::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO,
+        &time_limit, sizeof(time_limit)) == -1)) {
+      NWC_TOOLKIT_ERROR("failed to set socket timeout");
+    }
+
+    Connection connection(fd, fd);
+    ServeConnection(&connection, &extractor);
+    ::close(fd);
+  }
+  return NULL;
+}
+
+void OpenSocket() {
+  struct sockaddr_un address;
+  if (socket_path.length() >= sizeof(address.sun_path)) {
+    NWC_TOOLKIT_ERROR("too long socket path: %s", socket_path.ptr());
+  }
+  std::memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  std::memcpy(address.sun_path, socket_path.ptr(), socket_path.length());
+
+  listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listen_fd == -1) {
+    NWC_TOOLKIT_ERROR("failed to create socket");
+  }
+  // A socket file left by a killed server is replaced, but any other file
+  // at `socket_path' is never removed.
+  struct stat status;
+  if (::lstat(address.sun_path, &status) == 0) {
+    if (!S_ISSOCK(status.st_mode)) {
+      errno = EEXIST;
+      NWC_TOOLKIT_ERROR("not a socket: %s", socket_path.ptr());
+    } else if (::unlink(address.sun_path) == -1) {
+      NWC_TOOLKIT_ERROR("failed to remove socket: %s", socket_path.ptr());
+    }
+  } else if (errno != ENOENT) {
+    NWC_TOOLKIT_ERROR("failed to stat socket: %s", socket_path.ptr());
+  }
+  if (::bind(listen_fd, reinterpret_cast<struct sockaddr *>(&address),
+      sizeof(address)) == -1) {
+    NWC_TOOLKIT_ERROR("failed to bind socket: %s", socket_path.ptr());
+  }
+  if (::listen(listen_fd, SOMAXCONN) == -1) {
+    NWC_TOOLKIT_ERROR("failed to listen socket: %s", socket_path.ptr());
+  }
+}
+
+// Serves requests on the socket until SIGINT, SIGTERM or SIGHUP is
+// received. The signals are blocked in all threads and received by sigwait()
+// in the main thread, which removes the socket file and exits the process by
+// _exit(). The worker threads may be blocked in accept() or read() for a long
+// time, so they are not joined, and static destruction is skipped because
+// the threads may still touch the counters.
+void Serve() {
+  sigset_t signal_set;
+  sigemptyset(&signal_set);
+  sigaddset(&signal_set, SIGINT);
+  sigaddset(&signal_set, SIGTERM);
+  sigaddset(&signal_set, SIGHUP);
+  if (::pthread_sigmask(SIG_BLOCK, &signal_set, NULL) != 0) {
+    NWC_TOOLKIT_ERROR("failed to block signals");
+  }
+
+  OpenSocket();
+  std::vector< ::pthread_t> threads;
+  for (std::size_t i = 0; i < num_threads; ++i) {
+    ::pthread_t thread;
+    if (::pthread_create(&thread, NULL, ServeSocket, NULL) != 0) {
+      NWC_TOOLKIT_ERROR("failed to start threads: %lu",
+          static_cast<unsigned long>(num_threads));
+    }
+    threads.push_back(thread);
+  }
+  std::cerr << "socket: " << socket_path << " (" << num_threads
+      << " threads)" << std::endl;
+
+  int signal_number;
+  if (::sigwait(&signal_set, &signal_number) != 0) {
+    NWC_TOOLKIT_ERROR("failed to wait for signals");
+  }
+  std::cerr << "signal: " << signal_number << std::endl;
+
+  ::unlink(socket_path.ptr());
+  // `metrics_mutex' is kept locked so that no thread updates the counters
+  // after the metrics file is closed.
+  ::pthread_mutex_lock(&metrics_mutex);
+  metrics.Close();
+  ::_exit(0);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  ParseOptions(argc, argv);
+  if (is_help_mode) {
+    PrintHelp(argv[0]);
+    return 0;
+  }
+
+  // A client which closes its connection must not kill the server.
+  ::signal(SIGPIPE, SIG_IGN);
+
+  if (!metrics_options.Open("extraction-server", &metrics)) {
+    NWC_TOOLKIT_ERROR("failed to open metrics file: %s",
+        metrics_options.path().ptr());
+  }
+
+  if (!socket_path.is_empty()) {
+    Serve();
+  }
+
+  // In the standard input and output mode, requests are served one by one
+  // because the responses must be returned in order.
+  std::cerr << "socket: (standard input and output)" << std::endl;
+  Extractor extractor;
+  Connection connection(0, 1);
+  ServeConnection(&connection, &extractor);
+  metrics.Close();
+
+  return 0;
+}
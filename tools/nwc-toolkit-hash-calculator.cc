@@ -11,32 +11,68 @@
 
 #include <nwc-toolkit/html-archive-entry.h>
 #include <nwc-toolkit/input-file.h>
+#include <nwc-toolkit/metrics.h>
 #include <nwc-toolkit/output-file.h>
 #include <nwc-toolkit/sha1-digest.h>
+#include <nwc-toolkit/worker-pool.h>
 
 #define NWC_TOOLKIT_ERROR(fmt, ...) \
   error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
 
 namespace {
 
+// A batch is closed when it has MAX_BATCH_SIZE entries or its bodies reach
+// BATCH_BODY_THRESHOLD bytes.
+enum {
+  MAX_BATCH_SIZE = 256,
+  BATCH_BODY_THRESHOLD = 1 << 22
+};
+
+enum { MAX_NUM_THREADS = 256 };
+
 nwc_toolkit::String output_file_name;
+std::size_t num_threads = 1;
+nwc_toolkit::MetricsOptions metrics_options;
 bool is_help_mode = false;
 
+nwc_toolkit::Metrics metrics;
+nwc_toolkit::Metrics::Counter *entry_counter = metrics.AddCounter("entries");
+nwc_toolkit::Metrics::Counter *body_counter = metrics.AddCounter("body_bytes");
+
 void ParseOptions(int argc, char *argv[]) {
   static const struct option long_options[] = {
     { "output", 1, NULL, 'o' },
+    { "threads", 1, NULL, 't' },
+    NWC_TOOLKIT_METRICS_LONG_OPTIONS,
     { "help", 0, NULL, 'h' },
     { NULL, 0, NULL, '\0' }
   };
 
   int value;
   while ((value = ::getopt_long(argc, argv,
-      "o:h", long_options, NULL)) != -1) {
+      "o:t:h", long_options, NULL)) != -1) {
     switch (value) {
       case 'o': {
         output_file_name = optarg;
         break;
       }
+      case 't': {
+        char *end_of_value;
+        long value = std::strtol(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value <= 0) ||
+            (value > MAX_NUM_THREADS)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        num_threads = static_cast<std::size_t>(value);
+        break;
+      }
+      case nwc_toolkit::MetricsOptions::METRICS_OPTION:
+      case nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION: {
+        if (!metrics_options.Parse(value, optarg)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
       case 'h': {
         is_help_mode = true;
         break;
@@ -52,35 +88,104 @@ void PrintHelp(const char *command) {
   std::cerr << "Usage: " << command << " [OPTION]... [FILE]...\n\n"
       "Options:\n"
       "  -o, --output=[FILE]  write result to FILE (default: stdout)\n"
+      "  -t, --threads=[N]    calculate hash values in N threads (default: 1)\n"
+      << nwc_toolkit::MetricsOptions::help() <<
       "  -h, --help    print this help\n"
       << std::flush;
 }
 
-void Calculate(nwc_toolkit::InputFile *input_file,
-    nwc_toolkit::OutputFile *output_file) {
-  std::time_t start_time = std::time(NULL);
-
-  long long count = 0;
-
-  nwc_toolkit::HtmlArchiveEntry entry;
-  nwc_toolkit::StringBuilder dest;
-  while (entry.Read(input_file)) {
-    nwc_toolkit::Sha1Digest digest;
-    digest.Append(entry.body());
-    digest.Finish();
-    dest.Append(digest.hex_digest()).Append('\t');
-    dest.Append(entry.url()).Append('\n');
-    if (!output_file->Write(dest.str())) {
+// The bodies of a batch are hashed at once by Sha1Digest::Calculate(),
+// which uses parallel lanes if available.
+struct Batch : public nwc_toolkit::EntryBatch<nwc_toolkit::HtmlArchiveEntry,
+    MAX_BATCH_SIZE, BATCH_BODY_THRESHOLD> {
+  Batch()
+      : nwc_toolkit::EntryBatch<nwc_toolkit::HtmlArchiveEntry,
+            MAX_BATCH_SIZE, BATCH_BODY_THRESHOLD>(),
+        bodies(),
+        digests(),
+        result() {}
+
+  nwc_toolkit::String bodies[MAX_BATCH_SIZE];
+  nwc_toolkit::Sha1Digest digests[MAX_BATCH_SIZE];
+  nwc_toolkit::StringBuilder result;
+};
+
+class BatchCalculator {
+ public:
+  BatchCalculator() {}
+
+  void operator()(Batch *batch) const {
+    for (std::size_t i = 0; i < batch->num_entries; ++i) {
+      batch->bodies[i] = batch->entries[i].body();
+    }
+    nwc_toolkit::Sha1Digest::Calculate(batch->bodies, batch->num_entries,
+        batch->digests);
+
+    batch->result.Clear();
+    for (std::size_t i = 0; i < batch->num_entries; ++i) {
+      batch->result.Append(batch->digests[i].hex_digest()).Append('\t');
+      batch->result.Append(batch->entries[i].url()).Append('\n');
+    }
+  }
+
+ private:
+  // Disallows copy and assignment.
+  BatchCalculator(const BatchCalculator &);
+  BatchCalculator &operator=(const BatchCalculator &);
+};
+
+class BatchWriter {
+ public:
+  explicit BatchWriter(nwc_toolkit::OutputFile *output_file)
+      : output_file_(output_file),
+        start_time_(std::time(NULL)),
+        count_(0) {}
+
+  void operator()(const Batch *batch) {
+    if (!output_file_->Write(batch->result.str())) {
       NWC_TOOLKIT_ERROR("failed to write result");
     }
-    dest.Clear();
-    if ((++count % 1000) == 0) {
-      std::cerr << '\r' << count
-          << " (" << (std::time(NULL) - start_time) << "sec)";
+    for (std::size_t i = 0; i < batch->num_entries; ++i) {
+      entry_counter->Increment();
+      body_counter->Add(batch->entries[i].body().length());
+    }
+    metrics.Update();
+
+    long long prev_count = count_;
+    count_ += batch->num_entries;
+    if ((count_ / 1000) != (prev_count / 1000)) {
+      Print();
     }
   }
-  std::cerr << '\r' << count
-      << " (" << (std::time(NULL) - start_time) << "sec)" << std::endl;
+  void Finish() const {
+    Print();
+    std::cerr << std::endl;
+  }
+
+ private:
+  nwc_toolkit::OutputFile *output_file_;
+  std::time_t start_time_;
+  long long count_;
+
+  void Print() const {
+    std::cerr << '\r' << count_
+        << " (" << (std::time(NULL) - start_time_) << "sec)";
+  }
+
+  // Disallows copy and assignment.
+  BatchWriter(const BatchWriter &);
+  BatchWriter &operator=(const BatchWriter &);
+};
+
+void Calculate(nwc_toolkit::InputFile *input_file,
+    nwc_toolkit::OutputFile *output_file) {
+  BatchWriter writer(output_file);
+  if (!nwc_toolkit::ProcessJobsInOrder<Batch, BatchCalculator>(
+      input_file, &writer, num_threads)) {
+    NWC_TOOLKIT_ERROR("failed to start threads: %lu",
+        static_cast<unsigned long>(num_threads));
+  }
+  writer.Finish();
 }
 
 }  // namespace
@@ -100,6 +205,11 @@ int main(int argc, char *argv[]) {
         output_file_name.ptr());
   }
 
+  if (!metrics_options.Open("hash-calculator", &metrics)) {
+    NWC_TOOLKIT_ERROR("failed to open metrics file: %s",
+        metrics_options.path().ptr());
+  }
+
   if (optind == argc) {
     nwc_toolkit::InputFile input_file;
     std::cerr << "input: (standard input)" << std::endl;
@@ -120,6 +230,7 @@ int main(int argc, char *argv[]) {
     }
     Calculate(&input_file, &output_file);
   }
+  metrics.Close();
 
   return 0;
 }
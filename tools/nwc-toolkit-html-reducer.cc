@@ -3,46 +3,84 @@
 #include <errno.h>
 #include <error.h>
 #include <getopt.h>
+#include <unistd.h>
 
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
-#include <tr1/unordered_set>
+#include <limits>
 
+#include <nwc-toolkit/digest-set.h>
 #include <nwc-toolkit/html-reducer.h>
-#include <nwc-toolkit/string-hash.h>
+#include <nwc-toolkit/metrics.h>
+#include <nwc-toolkit/sorted-string-set.h>
 
 #define NWC_TOOLKIT_ERROR(fmt, ...) \
   error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
 
 namespace {
 
-typedef std::tr1::unordered_set<nwc_toolkit::String,
-    nwc_toolkit::StringHash> HostSet;
-
 enum InputFormat {
   HTML_ARCHIVE,
   SINGLE_HTML_DOCUMENT,
   DEFAULT_FORMAT = HTML_ARCHIVE
 };
 
+// Long options without short names.
+enum {
+  DEDUP_OPTION = 0x100,
+  DEDUP_MEMORY_OPTION,
+  DEDUP_FILE_OPTION,
+  HOST_FILE_OPTION
+};
+
 InputFormat input_format = DEFAULT_FORMAT;
 bool needs_section_target = false;
 bool unique_host = false;
-nwc_toolkit::StringPool host_pool;
-HostSet host_set;
+nwc_toolkit::String host_file_name;
+// Hosts of HTML documents written so far. Hosts in --host-file are
+// searched in the mapped file, so they are not loaded into memory.
+nwc_toolkit::SortedStringSet host_set;
+bool with_deduplication = false;
+std::size_t dedup_memory_limit =
+    nwc_toolkit::DigestSet::DEFAULT_MEMORY_LIMIT;
+nwc_toolkit::String dedup_file_name;
+// Digests of bodies read so far. Bodies are deduplicated across all
+// the input files, and across processes if --dedup-file is given.
+nwc_toolkit::DigestSet body_set;
 nwc_toolkit::String output_file_name;
+nwc_toolkit::MetricsOptions metrics_options;
 bool is_help_mode = false;
 
+nwc_toolkit::Metrics metrics;
+nwc_toolkit::Metrics::Counter *entry_counter = metrics.AddCounter("entries");
+nwc_toolkit::Metrics::Counter *duplicate_counter =
+    metrics.AddCounter("duplicate_hosts");
+nwc_toolkit::Metrics::Counter *duplicate_body_counter =
+    metrics.AddCounter("duplicate_bodies");
+nwc_toolkit::Metrics::Counter *status_error_counter =
+    metrics.AddCounter("status_errors");
+nwc_toolkit::Metrics::Counter *parse_error_counter =
+    metrics.AddCounter("parse_errors");
+nwc_toolkit::Metrics::Counter *output_counter = metrics.AddCounter("outputs");
+nwc_toolkit::Metrics::Counter *output_byte_counter =
+    metrics.AddCounter("output_bytes");
+nwc_toolkit::Metrics::Gauge *host_gauge = metrics.AddGauge("unique_hosts");
+
 void ParseOptions(int argc, char *argv[]) {
   static const struct option long_options[] = {
     { "archive", 0, NULL, 'a' },
     { "single", 0, NULL, 's' },
     { "target", 0, NULL, 't' },
     { "unique", 0, NULL, 'u' },
+    { "host-file", 1, NULL, HOST_FILE_OPTION },
     { "output", 1, NULL, 'o' },
+    { "dedup", 0, NULL, DEDUP_OPTION },
+    { "dedup-memory", 1, NULL, DEDUP_MEMORY_OPTION },
+    { "dedup-file", 1, NULL, DEDUP_FILE_OPTION },
+    NWC_TOOLKIT_METRICS_LONG_OPTIONS,
     { "help", 0, NULL, 'h' },
     { NULL, 0, NULL, '\0' }
   };
@@ -67,10 +105,42 @@ void ParseOptions(int argc, char *argv[]) {
         unique_host = true;
         break;
       }
+      case HOST_FILE_OPTION: {
+        host_file_name = optarg;
+        unique_host = true;
+        break;
+      }
       case 'o': {
         output_file_name = optarg;
         break;
       }
+      case DEDUP_OPTION: {
+        with_deduplication = true;
+        break;
+      }
+      case DEDUP_MEMORY_OPTION: {
+        char *end_of_value;
+        long long value = std::strtoll(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value <= 0) ||
+            (value > static_cast<long long>(
+            std::numeric_limits<std::size_t>::max() >> 20))) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        dedup_memory_limit = static_cast<std::size_t>(value) << 20;
+        break;
+      }
+      case DEDUP_FILE_OPTION: {
+        dedup_file_name = optarg;
+        with_deduplication = true;
+        break;
+      }
+      case nwc_toolkit::MetricsOptions::METRICS_OPTION:
+      case nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION: {
+        if (!metrics_options.Parse(value, optarg)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
       case 'h': {
         is_help_mode = true;
         break;
@@ -89,7 +159,22 @@ void PrintHelp(const char *command) {
       "  -s, --single   reduce HTML documents\n"
       "  -t, --target   extract HTML documents having section targets\n"
       "  -u, --unique   extract HTML documents having unique hosts\n"
+      "      --host-file=[FILE]\n"
+      "                       load hosts from FILE if it exists and save\n"
+      "                       them to FILE at the end (implies --unique)\n"
       "  -o, --output=[FILE]  write result to FILE (default: stdout)\n"
+      "      --dedup    skip HTML documents having duplicate bodies\n"
+      "      --dedup-memory=[N]\n"
+      "                       limit the memory usage of --dedup to N MiB\n"
+      "                       (default: "
+      << (nwc_toolkit::DigestSet::DEFAULT_MEMORY_LIMIT >> 20) << ")\n"
+      "                       bodies are not remembered once the limit\n"
+      "                       is reached\n"
+      "      --dedup-file=[FILE]\n"
+      "                       load digests of bodies from FILE if it\n"
+      "                       exists and save them to FILE at the end\n"
+      "                       (implies --dedup)\n"
+      << nwc_toolkit::MetricsOptions::help() <<
       "  -h, --help     print this help\n"
       << std::flush;
 }
@@ -122,6 +207,20 @@ void ReduceHtmlHeader(const nwc_toolkit::HtmlArchiveEntry &entry,
   header->Resize(header->length() + length);
 }
 
+// Returns false if `body' has already appeared. A new body whose digest
+// does not fit in memory is still reduced, but its copies are not detected.
+bool DigestBody(const nwc_toolkit::String &body,
+    long long *num_untracked_bodies) {
+  nwc_toolkit::DigestSet::Digest digest =
+      nwc_toolkit::DigestSet::Calculate(body);
+  if (body_set.Contains(digest)) {
+    return false;
+  } else if (!body_set.Insert(digest)) {
+    ++*num_untracked_bodies;
+  }
+  return true;
+}
+
 void ReduceHtmlArchive(nwc_toolkit::InputFile *input_file,
     nwc_toolkit::OutputFile *output_file) {
   std::time_t start_time = std::time(NULL);
@@ -130,23 +229,35 @@ void ReduceHtmlArchive(nwc_toolkit::InputFile *input_file,
   nwc_toolkit::StringBuilder last_host;
 
   nwc_toolkit::HtmlDocument doc;
+  doc.set_attribute_handler(
+      nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
   nwc_toolkit::StringBuilder body;
   nwc_toolkit::StringBuilder header;
 
   long long num_entries = 0;
   long long duplicate_count = 0;
+  long long duplicate_body_count = 0;
+  long long untracked_body_count = 0;
   long long status_error_count = 0;
   long long parse_error_count = 0;
   long long output_count = 0;
 
   while (entry.Read(input_file)) {
     nwc_toolkit::String host = Gethost(entry.url());
-    if (unique_host && host_set.find(host) != host_set.end()) {
+    if (unique_host && host_set.Contains(host)) {
       ++duplicate_count;
+      duplicate_counter->Increment();
     } else if (entry.status_code() != 200) {
       ++status_error_count;
+      status_error_counter->Increment();
+    } else if (with_deduplication &&
+        !DigestBody(entry.body(), &untracked_body_count)) {
+      // A duplicate body is skipped before parsing.
+      ++duplicate_body_count;
+      duplicate_body_counter->Increment();
     } else if (!doc.Parse(entry)) {
       ++parse_error_count;
+      parse_error_counter->Increment();
     } else {
       nwc_toolkit::HtmlReducer::Reduce(doc, &body);
       if (!needs_section_target ||
@@ -157,12 +268,17 @@ void ReduceHtmlArchive(nwc_toolkit::InputFile *input_file,
           NWC_TOOLKIT_ERROR("failed to write result");
         }
         ++output_count;
+        output_counter->Increment();
+        output_byte_counter->Add(header.length() + body.length());
         if (unique_host) {
-          host_set.insert(host_pool.Append(host));
+          host_set.Insert(host);
+          host_gauge->Set(static_cast<double>(host_set.num_strings()));
           last_host = host;
         }
       }
     }
+    entry_counter->Increment();
+    metrics.Update();
 
     if ((++num_entries % 100) == 0) {
       std::cerr << '\r' << status_error_count << " ("
@@ -189,6 +305,14 @@ void ReduceHtmlArchive(nwc_toolkit::InputFile *input_file,
       << ((num_entries != 0) ? (100.0 * output_count / num_entries) : 0.0)
       << "%) / " << num_entries
       << " (" << (std::time(NULL) - start_time) << "sec)" << std::endl;
+  if (with_deduplication) {
+    std::cerr << "duplicates: " << duplicate_body_count << " ("
+        << std::fixed << std::setprecision(2) << ((num_entries != 0) ?
+            (100.0 * duplicate_body_count / num_entries) : 0.0)
+        << "%), digests: " << body_set.num_digests()
+        << " (" << (body_set.memory_usage() >> 20) << "MiB)"
+        << ", untracked: " << untracked_body_count << std::endl;
+  }
 }
 
 void ReduceSingleHtmlDocument(nwc_toolkit::InputFile *input_file,
@@ -200,6 +324,8 @@ void ReduceSingleHtmlDocument(nwc_toolkit::InputFile *input_file,
   }
 
   nwc_toolkit::HtmlDocument doc;
+  doc.set_attribute_handler(
+      nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
   if (!doc.Parse(body.str())) {
     NWC_TOOLKIT_ERROR("failed to parse html document");
   }
@@ -244,6 +370,32 @@ int main(int argc, char *argv[]) {
         output_file_name.ptr());
   }
 
+  if (!host_file_name.is_empty() &&
+      (::access(host_file_name.ptr(), F_OK) == 0)) {
+    std::cerr << "hosts: " << host_file_name << std::endl;
+    if (!host_set.Open(host_file_name)) {
+      NWC_TOOLKIT_ERROR("failed to load hosts: %s", host_file_name.ptr());
+    }
+    host_gauge->Set(static_cast<double>(host_set.num_strings()));
+  }
+
+  if (with_deduplication) {
+    body_set.Reset(dedup_memory_limit);
+    if (!dedup_file_name.is_empty() &&
+        (::access(dedup_file_name.ptr(), F_OK) == 0)) {
+      std::cerr << "dedup: " << dedup_file_name << std::endl;
+      if (!body_set.Load(dedup_file_name)) {
+        NWC_TOOLKIT_ERROR("failed to load digests: %s",
+            dedup_file_name.ptr());
+      }
+    }
+  }
+
+  if (!metrics_options.Open("html-reducer", &metrics)) {
+    NWC_TOOLKIT_ERROR("failed to open metrics file: %s",
+        metrics_options.path().ptr());
+  }
+
   if (optind == argc) {
     nwc_toolkit::InputFile input_file;
     std::cerr << "input: (standard input)" << std::endl;
@@ -265,5 +417,20 @@ int main(int argc, char *argv[]) {
     Reduce(&input_file, &output_file);
   }
 
+  // Hosts and digests are saved after the result is complete.
+  if (!host_file_name.is_empty() || !dedup_file_name.is_empty()) {
+    if (!output_file.Close()) {
+      NWC_TOOLKIT_ERROR("failed to close output file");
+    }
+  }
+  if (!host_file_name.is_empty() && !host_set.Save(host_file_name)) {
+    NWC_TOOLKIT_ERROR("failed to save hosts: %s", host_file_name.ptr());
+  }
+  if (!dedup_file_name.is_empty() && !body_set.Save(dedup_file_name)) {
+    NWC_TOOLKIT_ERROR("failed to save digests: %s",
+        dedup_file_name.ptr());
+  }
+  metrics.Close();
+
   return 0;
 }
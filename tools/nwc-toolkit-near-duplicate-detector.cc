@@ -0,0 +1,803 @@
+// Copyright 2010 Susumu Yata <syata@acm.org>
+
+#include <errno.h>
+#include <error.h>
+#include <getopt.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <nwc-toolkit/html-archive-entry.h>
+#include <nwc-toolkit/html-document.h>
+#include <nwc-toolkit/input-file.h>
+#include <nwc-toolkit/metrics.h>
+#include <nwc-toolkit/min-hash.h>
+#include <nwc-toolkit/output-file.h>
+#include <nwc-toolkit/worker-pool.h>
+
+#define NWC_TOOLKIT_ERROR(fmt, ...) \
+  error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
+
+namespace {
+
+// A batch is closed when it has MAX_BATCH_SIZE entries or its bodies reach
+// BATCH_BODY_THRESHOLD bytes.
+enum {
+  MAX_BATCH_SIZE = 256,
+  BATCH_BODY_THRESHOLD = 1 << 22
+};
+
+enum { DEFAULT_MEMORY_LIMIT = 1024 };
+enum { MAX_NUM_THREADS = 256 };
+
+enum {
+  THRESHOLD_OPTION = 0x100
+};
+
+// Candidates are united if their signatures agree on this ratio of hash
+// values, which is around (1 / bands)^(1 / rows) for the default bands and
+// rows, where the probability of being a candidate rises most sharply.
+const double DEFAULT_THRESHOLD = 0.7;
+
+nwc_toolkit::String output_file_name;
+std::size_t num_threads = 1;
+std::size_t num_bands = nwc_toolkit::MinHash::DEFAULT_NUM_BANDS;
+std::size_t num_rows = nwc_toolkit::MinHash::DEFAULT_NUM_ROWS;
+std::size_t shingle_size = nwc_toolkit::MinHash::DEFAULT_SHINGLE_SIZE;
+double threshold = DEFAULT_THRESHOLD;
+std::size_t memory_limit = static_cast<std::size_t>(DEFAULT_MEMORY_LIMIT) << 20;
+nwc_toolkit::String temporary_directory;
+nwc_toolkit::MetricsOptions metrics_options;
+bool is_help_mode = false;
+
+nwc_toolkit::Metrics metrics;
+nwc_toolkit::Metrics::Counter *entry_counter = metrics.AddCounter("entries");
+nwc_toolkit::Metrics::Counter *document_counter =
+    metrics.AddCounter("documents");
+nwc_toolkit::Metrics::Counter *spill_counter =
+    metrics.AddCounter("spilled_keys");
+nwc_toolkit::Metrics::Counter *output_counter =
+    metrics.AddCounter("near_duplicates");
+
+std::size_t ParseSize(const char *str, std::size_t max_value) {
+  char *end_of_value;
+  long long value = std::strtoll(str, &end_of_value, 10);
+  if ((*end_of_value != '\0') || (value <= 0) ||
+      (static_cast<unsigned long long>(value) > max_value)) {
+    NWC_TOOLKIT_ERROR("invalid argument: %s", str);
+  }
+  return static_cast<std::size_t>(value);
+}
+
+void ParseOptions(int argc, char *argv[]) {
+  static const struct option long_options[] = {
+    { "output", 1, NULL, 'o' },
+    { "threads", 1, NULL, 't' },
+    { "bands", 1, NULL, 'b' },
+    { "rows", 1, NULL, 'r' },
+    { "shingle-size", 1, NULL, 's' },
+    { "threshold", 1, NULL, THRESHOLD_OPTION },
+    { "memory", 1, NULL, 'l' },
+    { "temporary-directory", 1, NULL, 'T' },
+    NWC_TOOLKIT_METRICS_LONG_OPTIONS,
+    { "help", 0, NULL, 'h' },
+    { NULL, 0, NULL, '\0' }
+  };
+
+  int value;
+  while ((value = ::getopt_long(argc, argv,
+      "o:t:b:r:s:l:T:h", long_options, NULL)) != -1) {
+    switch (value) {
+      case 'o': {
+        output_file_name = optarg;
+        break;
+      }
+      case 't': {
+        num_threads = ParseSize(optarg, MAX_NUM_THREADS);
+        break;
+      }
+      case 'b': {
+        num_bands = ParseSize(optarg, nwc_toolkit::MinHash::MAX_NUM_HASHES);
+        break;
+      }
+      case 'r': {
+        num_rows = ParseSize(optarg, nwc_toolkit::MinHash::MAX_NUM_HASHES);
+        break;
+      }
+      case 's': {
+        shingle_size = ParseSize(optarg, 1024);
+        break;
+      }
+      case THRESHOLD_OPTION: {
+        char *end_of_value;
+        threshold = std::strtod(optarg, &end_of_value);
+        if ((*end_of_value != '\0') || !(threshold >= 0.0) ||
+            (threshold > 1.0)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
+      case 'l': {
+        memory_limit = ParseSize(optarg,
+            std::numeric_limits<std::size_t>::max() >> 20) << 20;
+        break;
+      }
+      case 'T': {
+        temporary_directory = optarg;
+        break;
+      }
+      case nwc_toolkit::MetricsOptions::METRICS_OPTION:
+      case nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION: {
+        if (!metrics_options.Parse(value, optarg)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
+      case 'h': {
+        is_help_mode = true;
+        break;
+      }
+      default: {
+        NWC_TOOLKIT_ERROR("invalid option");
+      }
+    }
+  }
+  if ((num_bands * num_rows) > nwc_toolkit::MinHash::MAX_NUM_HASHES) {
+    NWC_TOOLKIT_ERROR("invalid argument: too many hash functions: %lu",
+        static_cast<unsigned long>(num_bands * num_rows));
+  }
+}
+
+void PrintHelp(const char *command) {
+  std::cerr << "Usage: " << command << " [OPTION]... [FILE]...\n\n"
+      "Options:\n"
+      "  -o, --output=[FILE]  write result to FILE (default: stdout)\n"
+      "  -t, --threads=[N]    calculate signatures in N threads (default: 1)\n"
+      "  -b, --bands=[N]      split signatures into N bands (default: "
+      << nwc_toolkit::MinHash::DEFAULT_NUM_BANDS << ")\n"
+      "  -r, --rows=[N]       put N hash values in each band (default: "
+      << nwc_toolkit::MinHash::DEFAULT_NUM_ROWS << ")\n"
+      "  -s, --shingle-size=[N]\n"
+      "                       make shingles of N characters (default: "
+      << nwc_toolkit::MinHash::DEFAULT_SHINGLE_SIZE << ")\n"
+      "      --threshold=[X]  unite candidates whose signatures agree on\n"
+      "                       X or more of hash values (default: "
+      << DEFAULT_THRESHOLD << ")\n"
+      "  -l, --memory=[N]     limit the memory usage of buckets to N MiB\n"
+      "                       (default: " << DEFAULT_MEMORY_LIMIT << ")\n"
+      "                       clusters take another 4 bytes per document,\n"
+      "                       which are not limited\n"
+      "  -T, --temporary-directory=[DIR]\n"
+      "                       create temporary files in DIR\n"
+      "                       (default: $TMPDIR or /tmp)\n"
+      << nwc_toolkit::MetricsOptions::help() <<
+      "  -h, --help    print this help\n"
+      << std::flush;
+}
+
+// TemporaryFile is removed as soon as it is created, so it never remains
+// after the process ends.
+class TemporaryFile {
+ public:
+  TemporaryFile() : file_(NULL) {}
+  ~TemporaryFile() {
+    Close();
+  }
+
+  bool is_open() const {
+    return file_ != NULL;
+  }
+
+  void Open() {
+    std::string path;
+    if (!temporary_directory.is_empty()) {
+      path.assign(temporary_directory.ptr(), temporary_directory.length());
+    } else if (std::getenv("TMPDIR") != NULL) {
+      path = std::getenv("TMPDIR");
+    } else {
+      path = "/tmp";
+    }
+    path += "/nwc-toolkit-near-duplicate-detector.XXXXXX";
+    int fd = ::mkstemp(&path[0]);
+    if (fd == -1) {
+      NWC_TOOLKIT_ERROR("failed to create temporary file: %s", path.c_str());
+    }
+    ::unlink(path.c_str());
+    file_ = ::fdopen(fd, "w+b");
+    if (file_ == NULL) {
+      NWC_TOOLKIT_ERROR("failed to open temporary file: %s", path.c_str());
+    }
+  }
+  void Close() {
+    if (file_ != NULL) {
+      std::fclose(file_);
+      file_ = NULL;
+    }
+  }
+
+  void Write(const void *ptr, std::size_t size) {
+    if (std::fwrite(ptr, 1, size, file_) != size) {
+      NWC_TOOLKIT_ERROR("failed to write temporary file");
+    }
+  }
+  void Rewind() {
+    if (std::fflush(file_) != 0) {
+      NWC_TOOLKIT_ERROR("failed to write temporary file");
+    }
+    std::rewind(file_);
+  }
+  // Moves to `offset' for reading after Rewind().
+  void Seek(unsigned long long offset) {
+    if (::fseeko(file_, static_cast<off_t>(offset), SEEK_SET) != 0) {
+      NWC_TOOLKIT_ERROR("failed to seek temporary file");
+    }
+  }
+  // Returns false at the end of the file.
+  bool Read(void *ptr, std::size_t size) {
+    std::size_t num_read_bytes = std::fread(ptr, 1, size, file_);
+    if (num_read_bytes == size) {
+      return true;
+    } else if ((num_read_bytes != 0) || std::ferror(file_)) {
+      NWC_TOOLKIT_ERROR("failed to read temporary file");
+    }
+    return false;
+  }
+
+ private:
+  std::FILE *file_;
+
+  // Disallows copy and assignment.
+  TemporaryFile(const TemporaryFile &);
+  TemporaryFile &operator=(const TemporaryFile &);
+};
+
+// BucketIndex is an open-addressing table with linear probing, which maps
+// each band key to the first document that has it. The table is doubled
+// while the old and new tables fit in the memory limit together, and after
+// that Insert() fails.
+class BucketIndex {
+ public:
+  enum { MIN_NUM_SLOTS = 1 << 12 };
+
+  BucketIndex() : slots_(NULL), num_slots_(0), num_keys_(0),
+      memory_limit_(0) {}
+  ~BucketIndex() {
+    Clear();
+  }
+
+  // Removes all keys and changes the memory limit.
+  void Reset(std::size_t memory_limit) {
+    Clear();
+    memory_limit_ = memory_limit;
+  }
+  void Clear() {
+    delete [] slots_;
+    slots_ = NULL;
+    num_slots_ = 0;
+    num_keys_ = 0;
+  }
+
+  // Returns false if `key' is not found.
+  bool Find(unsigned long long key, unsigned int *doc_id) const {
+    if (num_slots_ == 0) {
+      return false;
+    }
+    const Slot *slot = FindSlot(FixKey(key));
+    if (slot->key == 0) {
+      return false;
+    }
+    *doc_id = slot->doc_id;
+    return true;
+  }
+  // Inserts a key which is not in the index, or returns false if the
+  // memory limit does not allow.
+  bool Insert(unsigned long long key, unsigned int doc_id) {
+    if ((num_keys_ >= num_slots_ - (num_slots_ / 4)) && !Grow()) {
+      return false;
+    }
+    Slot *slot = FindSlot(FixKey(key));
+    slot->key = FixKey(key);
+    slot->doc_id = doc_id;
+    ++num_keys_;
+    return true;
+  }
+
+ private:
+  struct Slot {
+    unsigned long long key;
+    unsigned int doc_id;
+  };
+
+  Slot *slots_;
+  std::size_t num_slots_;
+  std::size_t num_keys_;
+  std::size_t memory_limit_;
+
+  // 0 represents an empty slot.
+  static unsigned long long FixKey(unsigned long long key) {
+    return (key != 0) ? key : 1;
+  }
+
+  // Returns the slot of `key' or the first empty slot. The upper bits are
+  // left for choosing partitions.
+  Slot *FindSlot(unsigned long long key) const {
+    std::size_t mask = num_slots_ - 1;
+    std::size_t slot_id = static_cast<std::size_t>(key) & mask;
+    while ((slots_[slot_id].key != 0) && (slots_[slot_id].key != key)) {
+      slot_id = (slot_id + 1) & mask;
+    }
+    return &slots_[slot_id];
+  }
+
+  bool Grow() {
+    std::size_t new_num_slots =
+        (num_slots_ != 0) ? (num_slots_ * 2) :
+        static_cast<std::size_t>(MIN_NUM_SLOTS);
+    if ((num_slots_ + new_num_slots) > (memory_limit_ / sizeof(Slot))) {
+      return false;
+    }
+    Slot *old_slots = slots_;
+    std::size_t old_num_slots = num_slots_;
+    slots_ = new Slot[new_num_slots]();
+    num_slots_ = new_num_slots;
+    for (std::size_t i = 0; i < old_num_slots; ++i) {
+      if (old_slots[i].key != 0) {
+        *FindSlot(old_slots[i].key) = old_slots[i];
+      }
+    }
+    delete [] old_slots;
+    return true;
+  }
+
+  // Disallows copy and assignment.
+  BucketIndex(const BucketIndex &);
+  BucketIndex &operator=(const BucketIndex &);
+};
+
+// DisjointSet keeps clusters of documents. The root of a cluster is its
+// first document, so a parent is never greater than its child.
+class DisjointSet {
+ public:
+  DisjointSet() : parents_() {}
+  ~DisjointSet() {}
+
+  std::size_t size() const {
+    return parents_.size();
+  }
+
+  unsigned int Add() {
+    if (parents_.size() >= std::numeric_limits<unsigned int>::max()) {
+      NWC_TOOLKIT_ERROR("too many documents: %lu",
+          static_cast<unsigned long>(parents_.size()));
+    }
+    parents_.push_back(static_cast<unsigned int>(parents_.size()));
+    return parents_.back();
+  }
+
+  unsigned int Find(unsigned int id) {
+    while (parents_[id] != id) {
+      parents_[id] = parents_[parents_[id]];
+      id = parents_[id];
+    }
+    return id;
+  }
+  void Unite(unsigned int lhs, unsigned int rhs) {
+    lhs = Find(lhs);
+    rhs = Find(rhs);
+    if (lhs < rhs) {
+      parents_[rhs] = lhs;
+    } else if (rhs < lhs) {
+      parents_[lhs] = rhs;
+    }
+  }
+
+  // Makes every document point to its root directly.
+  void Flatten() {
+    for (std::size_t i = 0; i < parents_.size(); ++i) {
+      parents_[i] = parents_[parents_[i]];
+    }
+  }
+  // Returns the root of a document after Flatten().
+  unsigned int root(unsigned int id) const {
+    return parents_[id];
+  }
+
+ private:
+  std::vector<unsigned int> parents_;
+
+  // Disallows copy and assignment.
+  DisjointSet(const DisjointSet &);
+  DisjointSet &operator=(const DisjointSet &);
+};
+
+// Keys which do not fit in memory are split into NUM_PARTITIONS files by
+// PARTITION_BITS bits of the keys, and each file is processed in the same
+// way with the next bits.
+enum {
+  PARTITION_BITS = 4,
+  NUM_PARTITIONS = 1 << PARTITION_BITS,
+  MAX_NUM_LEVELS = 64 / PARTITION_BITS
+};
+
+BucketIndex bucket_index;
+DisjointSet document_set;
+TemporaryFile url_file;
+// Signatures are kept in a file of fixed-size records, which are read by
+// document numbers to verify candidates.
+TemporaryFile signature_file;
+// Pairs of documents which share a band key are verified after all the
+// keys are added.
+TemporaryFile candidate_file;
+long long num_candidates = 0;
+long long num_rejected_candidates = 0;
+
+std::size_t GetPartitionID(unsigned long long key, int level) {
+  return static_cast<std::size_t>(
+      key >> (64 - (PARTITION_BITS * (level + 1)))) & (NUM_PARTITIONS - 1);
+}
+
+// Makes a document a candidate near-duplicate of the first document with
+// the same key. Keys which cannot be remembered go to `partitions'.
+void AddKey(unsigned long long key, unsigned int doc_id, int level,
+    TemporaryFile *partitions) {
+  unsigned int first_doc_id;
+  if (bucket_index.Find(key, &first_doc_id)) {
+    candidate_file.Write(&first_doc_id, sizeof(first_doc_id));
+    candidate_file.Write(&doc_id, sizeof(doc_id));
+    ++num_candidates;
+  } else if (!bucket_index.Insert(key, doc_id)) {
+    if (level >= MAX_NUM_LEVELS) {
+      NWC_TOOLKIT_ERROR("too many keys: memory limit is too small");
+    }
+    TemporaryFile *partition = &partitions[GetPartitionID(key, level)];
+    if (!partition->is_open()) {
+      partition->Open();
+    }
+    partition->Write(&key, sizeof(key));
+    partition->Write(&doc_id, sizeof(doc_id));
+    spill_counter->Increment();
+  }
+}
+
+// A cluster does not depend on the order of keys, so the keys in each
+// partition are processed with a fresh index.
+void AddKeysInPartitions(TemporaryFile *partitions, int level) {
+  for (std::size_t i = 0; i < NUM_PARTITIONS; ++i) {
+    if (!partitions[i].is_open()) {
+      continue;
+    }
+    bucket_index.Reset(memory_limit);
+    TemporaryFile next_partitions[NUM_PARTITIONS];
+    partitions[i].Rewind();
+    unsigned long long key;
+    unsigned int doc_id;
+    while (partitions[i].Read(&key, sizeof(key))) {
+      if (!partitions[i].Read(&doc_id, sizeof(doc_id))) {
+        NWC_TOOLKIT_ERROR("failed to read temporary file");
+      }
+      AddKey(key, doc_id, level + 1, next_partitions);
+    }
+    partitions[i].Close();
+    metrics.Update();
+    AddKeysInPartitions(next_partitions, level + 1);
+  }
+}
+
+void ReadSignature(unsigned int doc_id, std::vector<unsigned int> *values) {
+  std::size_t record_size = values->size() * sizeof(unsigned int);
+  signature_file.Seek(static_cast<unsigned long long>(doc_id) * record_size);
+  if (!signature_file.Read(&(*values)[0], record_size)) {
+    NWC_TOOLKIT_ERROR("failed to read temporary file");
+  }
+}
+
+// Unites the candidates whose signatures are similar enough. A pair which
+// is already in the same cluster is not verified again, so the same pair
+// from different bands costs only one verification.
+void VerifyCandidates() {
+  std::vector<unsigned int> values(num_bands * num_rows);
+  std::vector<unsigned int> another_values(num_bands * num_rows);
+  signature_file.Rewind();
+  candidate_file.Rewind();
+  unsigned int doc_ids[2];
+  while (candidate_file.Read(doc_ids, sizeof(doc_ids))) {
+    if (document_set.Find(doc_ids[0]) == document_set.Find(doc_ids[1])) {
+      continue;
+    }
+    ReadSignature(doc_ids[0], &values);
+    ReadSignature(doc_ids[1], &another_values);
+    if (nwc_toolkit::MinHash::EstimateSimilarity(&values[0],
+        &another_values[0], values.size()) >= threshold) {
+      document_set.Unite(doc_ids[0], doc_ids[1]);
+    } else {
+      ++num_rejected_candidates;
+    }
+  }
+  candidate_file.Close();
+  signature_file.Close();
+  metrics.Update();
+}
+
+// Signatures of a batch are calculated in one thread.
+struct Batch : public nwc_toolkit::EntryBatch<nwc_toolkit::HtmlArchiveEntry,
+    MAX_BATCH_SIZE, BATCH_BODY_THRESHOLD> {
+  Batch()
+      : nwc_toolkit::EntryBatch<nwc_toolkit::HtmlArchiveEntry,
+            MAX_BATCH_SIZE, BATCH_BODY_THRESHOLD>(),
+        has_signatures(),
+        band_keys(),
+        signatures() {}
+
+  bool has_signatures[MAX_BATCH_SIZE];
+  std::vector<unsigned long long> band_keys;
+  std::vector<unsigned int> signatures;
+};
+
+// BatchCalculator keeps the objects which are reused for every entry.
+// Each thread has its own BatchCalculator.
+class BatchCalculator {
+ public:
+  BatchCalculator() : document_(), text_(), min_hash_() {
+    document_.set_attribute_handler(
+        nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
+    min_hash_.Reset(num_bands, num_rows, shingle_size);
+  }
+
+  void operator()(Batch *batch);
+
+ private:
+  nwc_toolkit::HtmlDocument document_;
+  nwc_toolkit::StringBuilder text_;
+  nwc_toolkit::MinHash min_hash_;
+
+  // Disallows copy and assignment.
+  BatchCalculator(const BatchCalculator &);
+  BatchCalculator &operator=(const BatchCalculator &);
+};
+
+// Entries whose status is not 200 and entries which have no text are
+// ignored.
+void BatchCalculator::operator()(Batch *batch) {
+  std::size_t num_hashes = num_bands * num_rows;
+  batch->band_keys.resize(batch->num_entries * num_bands);
+  batch->signatures.resize(batch->num_entries * num_hashes);
+  for (std::size_t i = 0; i < batch->num_entries; ++i) {
+    const nwc_toolkit::HtmlArchiveEntry &entry = batch->entries[i];
+    batch->has_signatures[i] = false;
+    if (entry.status_code() != 200) {
+      continue;
+    }
+    document_.Clear();
+    if (!document_.Parse(entry)) {
+      continue;
+    }
+    text_.Clear();
+    document_.ExtractText(&text_);
+    if (!min_hash_.Calculate(text_.str())) {
+      continue;
+    }
+    batch->has_signatures[i] = true;
+    for (std::size_t j = 0; j < num_bands; ++j) {
+      batch->band_keys[(i * num_bands) + j] = min_hash_.band_key(j);
+    }
+    for (std::size_t j = 0; j < num_hashes; ++j) {
+      batch->signatures[(i * num_hashes) + j] = min_hash_.value(j);
+    }
+  }
+}
+
+class ProgressReporter {
+ public:
+  ProgressReporter()
+      : start_time_(std::time(NULL)),
+        num_entries_(0),
+        num_documents_(0) {}
+
+  // Prints the progress whenever the number of entries passes a multiple
+  // of 1000.
+  void Update(long long num_entries, long long num_documents) {
+    long long prev_num_entries = num_entries_;
+    num_entries_ += num_entries;
+    num_documents_ += num_documents;
+    if ((num_entries_ / 1000) != (prev_num_entries / 1000)) {
+      Print();
+    }
+  }
+  void Finish() {
+    Print();
+    std::cerr << std::endl;
+  }
+
+ private:
+  std::time_t start_time_;
+  long long num_entries_;
+  long long num_documents_;
+
+  void Print() const {
+    std::cerr << '\r' << num_documents_ << " / " << num_entries_
+        << " (" << (std::time(NULL) - start_time_) << "sec)";
+  }
+
+  // Disallows copy and assignment.
+  ProgressReporter(const ProgressReporter &);
+  ProgressReporter &operator=(const ProgressReporter &);
+};
+
+// Documents are numbered and their keys are added in input order.
+class BatchAdder {
+ public:
+  BatchAdder(TemporaryFile *partitions, ProgressReporter *reporter)
+      : partitions_(partitions),
+        reporter_(reporter) {}
+
+  void operator()(const Batch *batch);
+
+ private:
+  TemporaryFile *partitions_;
+  ProgressReporter *reporter_;
+
+  // Disallows copy and assignment.
+  BatchAdder(const BatchAdder &);
+  BatchAdder &operator=(const BatchAdder &);
+};
+
+void BatchAdder::operator()(const Batch *batch) {
+  long long num_documents = 0;
+  for (std::size_t i = 0; i < batch->num_entries; ++i) {
+    entry_counter->Increment();
+    if (!batch->has_signatures[i]) {
+      continue;
+    }
+    unsigned int doc_id = document_set.Add();
+    const nwc_toolkit::String &url = batch->entries[i].url();
+    unsigned int url_length = static_cast<unsigned int>(url.length());
+    url_file.Write(&url_length, sizeof(url_length));
+    url_file.Write(url.ptr(), url_length);
+    std::size_t num_hashes = num_bands * num_rows;
+    signature_file.Write(&batch->signatures[i * num_hashes],
+        num_hashes * sizeof(unsigned int));
+    for (std::size_t j = 0; j < num_bands; ++j) {
+      AddKey(batch->band_keys[(i * num_bands) + j], doc_id, 0, partitions_);
+    }
+    document_counter->Increment();
+    ++num_documents;
+  }
+  metrics.Update();
+  reporter_->Update(batch->num_entries, num_documents);
+}
+
+void AddDocuments(nwc_toolkit::InputFile *input_file,
+    TemporaryFile *partitions, ProgressReporter *reporter) {
+  BatchAdder adder(partitions, reporter);
+  if (!nwc_toolkit::ProcessJobsInOrder<Batch, BatchCalculator>(
+      input_file, &adder, num_threads)) {
+    NWC_TOOLKIT_ERROR("failed to start threads: %lu",
+        static_cast<unsigned long>(num_threads));
+  }
+}
+
+// Writes `root\turl' for each document in a cluster of 2 or more documents,
+// where `root' is the number of the first document in the cluster.
+void WriteClusters(nwc_toolkit::OutputFile *output_file) {
+  document_set.Flatten();
+  std::vector<bool> has_members(document_set.size(), false);
+  for (std::size_t i = 0; i < document_set.size(); ++i) {
+    unsigned int doc_id = static_cast<unsigned int>(i);
+    if (document_set.root(doc_id) != doc_id) {
+      has_members[document_set.root(doc_id)] = true;
+    }
+  }
+
+  long long num_clusters = 0;
+  long long num_near_duplicates = 0;
+  url_file.Rewind();
+  nwc_toolkit::StringBuilder line;
+  nwc_toolkit::StringBuilder url;
+  for (std::size_t i = 0; i < document_set.size(); ++i) {
+    unsigned int url_length;
+    if (!url_file.Read(&url_length, sizeof(url_length))) {
+      NWC_TOOLKIT_ERROR("failed to read temporary file");
+    }
+    url.Resize(url_length);
+    if ((url_length != 0) && !url_file.Read(url.buf(), url_length)) {
+      NWC_TOOLKIT_ERROR("failed to read temporary file");
+    }
+
+    unsigned int doc_id = static_cast<unsigned int>(i);
+    unsigned int root = document_set.root(doc_id);
+    if (root != doc_id) {
+      ++num_near_duplicates;
+      output_counter->Increment();
+    } else if (has_members[doc_id]) {
+      ++num_clusters;
+    } else {
+      continue;
+    }
+    char root_buf[32];
+    int root_length = std::sprintf(root_buf, "%u\t", root);
+    line.Clear();
+    line.Append(root_buf, root_length).Append(url.str()).Append('\n');
+    if (!output_file->Write(line.str())) {
+      NWC_TOOLKIT_ERROR("failed to write result");
+    }
+  }
+  url_file.Close();
+  metrics.Update();
+
+  std::cerr << "documents: " << document_set.size()
+      << ", clusters: " << num_clusters
+      << ", near-duplicates: " << num_near_duplicates << " ("
+      << std::fixed << std::setw(5) << std::setprecision(2)
+      << ((document_set.size() != 0) ?
+          (100.0 * num_near_duplicates / document_set.size()) : 0.0)
+      << "%), candidates: " << num_candidates
+      << ", rejected: " << num_rejected_candidates << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  ParseOptions(argc, argv);
+  if (is_help_mode) {
+    PrintHelp(argv[0]);
+    return 0;
+  }
+
+  nwc_toolkit::OutputFile output_file;
+  std::cerr << "output: " << (output_file_name.is_empty()
+      ? "(standard output)" : output_file_name) << std::endl;
+  if (!output_file.Open(output_file_name)) {
+    NWC_TOOLKIT_ERROR("failed to open output file: %s",
+        output_file_name.ptr());
+  }
+
+  if (!metrics_options.Open("near-duplicate-detector", &metrics)) {
+    NWC_TOOLKIT_ERROR("failed to open metrics file: %s",
+        metrics_options.path().ptr());
+  }
+
+  // Clusters are built across all the input files.
+  bucket_index.Reset(memory_limit);
+  url_file.Open();
+  signature_file.Open();
+  candidate_file.Open();
+  TemporaryFile partitions[NUM_PARTITIONS];
+  ProgressReporter reporter;
+
+  if (optind == argc) {
+    nwc_toolkit::InputFile input_file;
+    std::cerr << "input: (standard input)" << std::endl;
+    if (!input_file.Open(NULL)) {
+      NWC_TOOLKIT_ERROR("failed to open standard input");
+    }
+    AddDocuments(&input_file, partitions, &reporter);
+  }
+
+  for (int i = optind; i < argc; ++i) {
+    nwc_toolkit::String input_file_name = argv[i];
+    std::cerr << "input: " << (input_file_name.is_empty()
+        ? "(standard input)" : input_file_name) << std::endl;
+    nwc_toolkit::InputFile input_file;
+    if (!input_file.Open(input_file_name)) {
+      NWC_TOOLKIT_ERROR("failed to open input file: %s",
+          input_file_name.ptr());
+    }
+    AddDocuments(&input_file, partitions, &reporter);
+  }
+  reporter.Finish();
+
+  AddKeysInPartitions(partitions, 0);
+  bucket_index.Clear();
+  VerifyCandidates();
+  WriteClusters(&output_file);
+  metrics.Close();
+
+  return 0;
+}
@@ -12,6 +12,7 @@
 #include <sstream>
 #include <vector>
 
+#include <nwc-toolkit/metrics.h>
 #include <nwc-toolkit/ngram-counter.h>
 
 #define NWC_TOOLKIT_ERROR(fmt, ...) \
@@ -47,12 +48,22 @@ const char * const DEFAULT_OUTPUT_FILE_EXTENSION = "gz";
 int max_file_id = DEFAULT_MAX_FILE_ID;
 nwc_toolkit::String output_file_prefix;
 nwc_toolkit::String output_file_extension = DEFAULT_OUTPUT_FILE_EXTENSION;
+nwc_toolkit::MetricsOptions metrics_options;
 bool is_help_mode = false;
 
 nwc_toolkit::NgramCounter ngram_counter;
 int file_id = 0;
 std::time_t start_time = std::time(NULL);
 
+nwc_toolkit::Metrics metrics;
+nwc_toolkit::Metrics::Counter *sentence_counter =
+    metrics.AddCounter("sentences");
+nwc_toolkit::Metrics::Counter *token_counter = metrics.AddCounter("tokens");
+nwc_toolkit::Metrics::Counter *output_file_counter =
+    metrics.AddCounter("output_files");
+nwc_toolkit::Metrics::Histogram *flush_histogram =
+    metrics.AddHistogram("flush_seconds");
+
 int ParseIntegerValue(const char *arg, long min_value, long max_value) {
   char *end_of_value;
   long value = std::strtol(optarg, &end_of_value, 10);
@@ -74,6 +85,7 @@ void ParseOptions(int argc, char *argv[]) {
     { "prefix", 1, NULL, 'p' },
     { "extension", 1, NULL, 'e' },
     { "files", 1, NULL, 'f' },
+    NWC_TOOLKIT_METRICS_LONG_OPTIONS,
     { "help", 0, NULL, 'h' },
     { NULL, 0, NULL, '\0' }
   };
@@ -144,6 +156,13 @@ void ParseOptions(int argc, char *argv[]) {
         }
         break;
       }
+      case nwc_toolkit::MetricsOptions::METRICS_OPTION:
+      case nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION: {
+        if (!metrics_options.Parse(value, optarg)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
       case 'h': {
         is_help_mode = true;
         break;
@@ -181,6 +200,7 @@ void PrintHelp(const char *command) {
       << '-' << MAX_MAX_FILE_ID << "]\n"
       "                  limit the number of output files to N + 1 (default: "
       << DEFAULT_MAX_FILE_ID << ")\n"
+      << nwc_toolkit::MetricsOptions::help() <<
       "  -h, --help      print this help\n"
       << std::flush;
 }
@@ -197,6 +217,14 @@ void PrintProgress() {
       << ") (" << (std::time(NULL) - start_time) << "sec)";
 }
 
+// Counters follow the totals of `ngram_counter'.
+void UpdateMetrics() {
+  sentence_counter->Add(
+      ngram_counter.sentence_count() - sentence_counter->value());
+  token_counter->Add(ngram_counter.token_count() - token_counter->value());
+  metrics.Update();
+}
+
 // This function must not be called more than once.
 void GenerateDefaultOutputFilePrefix() {
   static char static_buf[32];
@@ -228,11 +256,14 @@ void FlushNgrams() {
   PrintProgress();
   std::cerr << std::endl;
 
+  double flush_start_time = nwc_toolkit::Metrics::GetTime();
   nwc_toolkit::OutputFile output_file;
   OpenNextOutputFile(&output_file);
   if (!ngram_counter.Flush(&output_file)) {
     NWC_TOOLKIT_ERROR("failed to flush n-grams");
   }
+  flush_histogram->Observe(nwc_toolkit::Metrics::GetTime() - flush_start_time);
+  output_file_counter->Increment();
 }
 
 void CountNgrams(nwc_toolkit::InputFile *input_file) {
@@ -243,6 +274,7 @@ void CountNgrams(nwc_toolkit::InputFile *input_file) {
     if ((ngram_counter.sentence_count() % 10000) == 0) {
       PrintProgress();
     }
+    UpdateMetrics();
   }
   if (!ngram_counter.is_empty()) {
     FlushNgrams();
@@ -262,6 +294,11 @@ int main(int argc, char *argv[]) {
     GenerateDefaultOutputFilePrefix();
   }
 
+  if (!metrics_options.Open("ngram-counter", &metrics)) {
+    NWC_TOOLKIT_ERROR("failed to open metrics file: %s",
+        metrics_options.path().ptr());
+  }
+
   if (optind == argc) {
     nwc_toolkit::InputFile input_file;
     std::cerr << "input: (standard input)" << std::endl;
@@ -283,5 +320,8 @@ int main(int argc, char *argv[]) {
     CountNgrams(&input_file);
   }
 
+  UpdateMetrics();
+  metrics.Close();
+
   return 0;
 }
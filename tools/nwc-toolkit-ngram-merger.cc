@@ -13,6 +13,7 @@
 
 #include <nwc-toolkit/heap-queue.h>
 #include <nwc-toolkit/input-file.h>
+#include <nwc-toolkit/metrics.h>
 #include <nwc-toolkit/output-file.h>
 
 #define NWC_TOOLKIT_ERROR(fmt, ...) \
@@ -24,12 +25,22 @@ enum { OUTPUT_BUF_LENGTH_THRESHOLD = (1 << 16) - (1 << 10) };
 
 long long freq_threshold = 0;
 nwc_toolkit::String output_file_name;
+nwc_toolkit::MetricsOptions metrics_options;
 bool is_help_mode = false;
 
+nwc_toolkit::Metrics metrics;
+nwc_toolkit::Metrics::Counter *input_counter =
+    metrics.AddCounter("input_ngrams");
+nwc_toolkit::Metrics::Counter *output_counter =
+    metrics.AddCounter("output_ngrams");
+nwc_toolkit::Metrics::Gauge *open_file_gauge =
+    metrics.AddGauge("open_input_files");
+
 void ParseOptions(int argc, char *argv[]) {
   static const struct option long_options[] = {
     { "threshold", 1, NULL, 'n' },
     { "output", 1, NULL, 'o' },
+    NWC_TOOLKIT_METRICS_LONG_OPTIONS,
     { "help", 0, NULL, 'h' },
     { NULL, 0, NULL, '\0' }
   };
@@ -50,6 +61,13 @@ void ParseOptions(int argc, char *argv[]) {
         output_file_name = optarg;
         break;
       }
+      case nwc_toolkit::MetricsOptions::METRICS_OPTION:
+      case nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION: {
+        if (!metrics_options.Parse(value, optarg)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
       case 'h': {
         is_help_mode = true;
         break;
@@ -67,6 +85,7 @@ void PrintHelp(const char *command) {
       "  -n, --threshold=[N]  "
       "cut off n-grams whose frequencies are less than N\n"
       "  -o, --output=[FILE]  write result to FILE (default: stdout)\n"
+      << nwc_toolkit::MetricsOptions::help() <<
       "  -h, --help           print this help\n"
       << std::flush;
 }
@@ -139,6 +158,15 @@ bool Merge(int num_file_names, char *file_names[],
       queue.Dequeue();
     }
 
+    // Metrics are updated in batches because a line is merged in a few
+    // hundred nanoseconds.
+    if ((input_count % 65536) == 0) {
+      input_counter->Add(input_count - input_counter->value());
+      output_counter->Add(output_count - output_counter->value());
+      open_file_gauge->Set(static_cast<double>(queue.num_objs()));
+      metrics.Update();
+    }
+
     if ((input_count % 1000000) == 0) {
       std::cerr << '\r' << "input: " << input_count
           << ", output: " << output_count << " ("
@@ -154,6 +182,9 @@ bool Merge(int num_file_names, char *file_names[],
   if (!output_file->Write(output_buf.str())) {
     NWC_TOOLKIT_ERROR("failed to write result");
   }
+  input_counter->Add(input_count - input_counter->value());
+  output_counter->Add(output_count - output_counter->value());
+  open_file_gauge->Set(0.0);
   std::cerr << '\r' << "input: " << input_count
       << ", output: " << output_count << " ("
       << std::fixed << std::setprecision(2)
@@ -180,12 +211,18 @@ int main(int argc, char *argv[]) {
         output_file_name.ptr());
   }
 
+  if (!metrics_options.Open("ngram-merger", &metrics)) {
+    NWC_TOOLKIT_ERROR("failed to open metrics file: %s",
+        metrics_options.path().ptr());
+  }
+
   if (optind == argc) {
     char *input_file_names[] = { NULL };
     Merge(1, input_file_names, &output_file);
   } else {
     Merge(argc - optind, argv + optind, &output_file);
   }
+  metrics.Close();
 
   return 0;
 }
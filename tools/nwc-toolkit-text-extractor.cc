@@ -3,13 +3,19 @@
 #include <errno.h>
 #include <error.h>
 #include <getopt.h>
+#include <time.h>
+#include <unistd.h>
 
 #include <cstdlib>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <string>
 
+#include <nwc-toolkit/digest-set.h>
 #include <nwc-toolkit/html-document.h>
+#include <nwc-toolkit/metrics.h>
 #include <nwc-toolkit/text-filter.h>
 #include <nwc-toolkit/unicode-normalizer.h>
 
@@ -24,20 +30,173 @@ enum InputFormat {
   DEFAULT_FORMAT = HTML_ARCHIVE
 };
 
+enum OversizeHandler {
+  SKIP_OVERSIZED_ENTRIES,
+  TRUNCATE_OVERSIZED_ENTRIES,
+  DEFAULT_OVERSIZE_HANDLER = SKIP_OVERSIZED_ENTRIES
+};
+
 InputFormat input_format = DEFAULT_FORMAT;
 long long max_num_entries = 0;
+std::size_t max_body_length = 0;
+OversizeHandler oversize_handler = DEFAULT_OVERSIZE_HANDLER;
+std::size_t window_size = 1 << 20;
 nwc_toolkit::UnicodeNormalizer::NormalizationForm normalization_form;
 nwc_toolkit::UnicodeNormalizer::IllegalInputHandler illegal_input_handler;
 bool with_unicode_normalization = false;
 bool with_text_filter = false;
+bool with_deduplication = false;
+std::size_t dedup_memory_limit =
+    nwc_toolkit::DigestSet::DEFAULT_MEMORY_LIMIT;
+nwc_toolkit::String dedup_file_name;
 nwc_toolkit::String output_file_name;
+bool is_profile_mode = false;
+nwc_toolkit::MetricsOptions metrics_options;
 bool is_help_mode = false;
 
+// Long options without short names.
+enum {
+  DEDUP_OPTION = 0x100,
+  DEDUP_MEMORY_OPTION,
+  DEDUP_FILE_OPTION
+};
+
+// Stages of text extraction, which are timed in profile mode.
+enum Stage {
+  READ_STAGE,
+  DECODE_STAGE,
+  PARSE_STAGE,
+  EXTRACT_STAGE,
+  NORMALIZE_STAGE,
+  FILTER_STAGE,
+  WRITE_STAGE,
+  NUM_STAGES
+};
+
+const char * const STAGE_NAMES[NUM_STAGES] = {
+  "read", "decode", "parse", "extract", "normalize", "filter", "write"
+};
+
+// StageProfiler accumulates the time and the number of input/output bytes
+// of each stage. Lap() reads the monotonic clock once, which costs tens of
+// nanoseconds, so profile mode hardly affects the throughput. After
+// ExportTo(), the time of each lap is also observed by a histogram.
+class StageProfiler {
+ public:
+  StageProfiler()
+      : start_time_(Now()), lap_time_(start_time_), stats_(), histograms_() {
+    for (int i = 0; i < NUM_STAGES; ++i) {
+      histograms_[i] = NULL;
+    }
+  }
+
+  void ExportTo(nwc_toolkit::Metrics *metrics) {
+    for (int i = 0; i < NUM_STAGES; ++i) {
+      histograms_[i] = metrics->AddHistogram(
+          (std::string(STAGE_NAMES[i]) + "_seconds").c_str());
+    }
+  }
+
+  // Starts timing a new stage.
+  void Start() {
+    lap_time_ = Now();
+  }
+  // Finishes timing `stage' and starts timing the next stage.
+  void Lap(Stage stage, std::size_t bytes_in, std::size_t bytes_out) {
+    double now = Now();
+    stats_[stage].seconds += now - lap_time_;
+    if (histograms_[stage] != NULL) {
+      histograms_[stage]->Observe(now - lap_time_);
+    }
+    stats_[stage].count += 1;
+    stats_[stage].bytes_in += bytes_in;
+    stats_[stage].bytes_out += bytes_out;
+    lap_time_ = now;
+  }
+
+  void WriteReport(long long num_entries, std::ostream *output) const;
+
+ private:
+  struct Stats {
+    Stats() : seconds(0.0), count(0), bytes_in(0), bytes_out(0) {}
+
+    double seconds;
+    long long count;
+    long long bytes_in;
+    long long bytes_out;
+  };
+
+  double start_time_;
+  double lap_time_;
+  Stats stats_[NUM_STAGES];
+  nwc_toolkit::Metrics::Histogram *histograms_[NUM_STAGES];
+
+  static double Now() {
+    struct timespec ts;
+    ::clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec * 0.000000001);
+  }
+};
+
+void StageProfiler::WriteReport(long long num_entries,
+    std::ostream *output) const {
+  double elapsed_seconds = Now() - start_time_;
+  long long total_bytes_in = stats_[READ_STAGE].bytes_out;
+  *output << std::fixed << std::setprecision(6) << "{\n"
+      << "  \"entries\": " << num_entries << ",\n"
+      << "  \"seconds\": " << elapsed_seconds << ",\n"
+      << "  \"entries_per_second\": " << ((elapsed_seconds > 0.0) ?
+          (num_entries / elapsed_seconds) : 0.0) << ",\n"
+      << "  \"megabytes_per_second\": " << ((elapsed_seconds > 0.0) ?
+          (total_bytes_in / elapsed_seconds / 1000000.0) : 0.0) << ",\n"
+      << "  \"stages\": {\n";
+  for (int i = 0; i < NUM_STAGES; ++i) {
+    const Stats &stats = stats_[i];
+    *output << "    \"" << STAGE_NAMES[i] << "\": {"
+        << " \"count\": " << stats.count << ","
+        << " \"seconds\": " << stats.seconds << ","
+        << " \"bytes_in\": " << stats.bytes_in << ","
+        << " \"bytes_out\": " << stats.bytes_out << ","
+        << " \"megabytes_per_second\": " << ((stats.seconds > 0.0) ?
+            (stats.bytes_in / stats.seconds / 1000000.0) : 0.0) << " }"
+        << ((i + 1 < NUM_STAGES) ? ",\n" : "\n");
+  }
+  *output << "  }\n}" << std::endl;
+}
+
+StageProfiler *profiler = NULL;
+long long total_num_entries = 0;
+
+// Digests of bodies read so far. Bodies are deduplicated across all
+// the input files, and across processes if --dedup-file is given.
+nwc_toolkit::DigestSet body_set;
+long long num_digested_bodies = 0;
+long long num_duplicate_bodies = 0;
+long long num_untracked_bodies = 0;
+
+nwc_toolkit::Metrics metrics;
+nwc_toolkit::Metrics::Counter *entry_counter = metrics.AddCounter("entries");
+nwc_toolkit::Metrics::Counter *input_counter =
+    metrics.AddCounter("input_bytes");
+nwc_toolkit::Metrics::Counter *output_counter =
+    metrics.AddCounter("output_bytes");
+nwc_toolkit::Metrics::Counter *status_error_counter =
+    metrics.AddCounter("status_errors");
+nwc_toolkit::Metrics::Counter *parse_error_counter =
+    metrics.AddCounter("parse_errors");
+nwc_toolkit::Metrics::Counter *oversize_counter =
+    metrics.AddCounter("oversized_entries");
+nwc_toolkit::Metrics::Counter *duplicate_counter =
+    metrics.AddCounter("duplicate_bodies");
+
 void ParseOptions(int argc, char *argv[]) {
   static const struct option long_options[] = {
     { "archive", 0, NULL, 'a' },
     { "single", 0, NULL, 's' },
     { "entries", 1, NULL, 'n' },
+    { "budget", 1, NULL, 'b' },
+    { "truncate", 0, NULL, 't' },
+    { "window", 1, NULL, 'w' },
     { "NFC", 0, NULL, 'c' },
     { "NFD", 0, NULL, 'd' },
     { "NFKC", 0, NULL, 'C' },
@@ -46,13 +205,18 @@ void ParseOptions(int argc, char *argv[]) {
     { "remove", 0, NULL, 'r' },
     { "filter", 0, NULL, 'f' },
     { "output", 1, NULL, 'o' },
+    { "profile", 0, NULL, 'p' },
+    { "dedup", 0, NULL, DEDUP_OPTION },
+    { "dedup-memory", 1, NULL, DEDUP_MEMORY_OPTION },
+    { "dedup-file", 1, NULL, DEDUP_FILE_OPTION },
+    NWC_TOOLKIT_METRICS_LONG_OPTIONS,
     { "help", 0, NULL, 'h' },
     { NULL, 0, NULL, '\0' }
   };
 
   int value;
   while ((value = ::getopt_long(argc, argv,
-      "asn:cdCDkrfo:h", long_options, NULL)) != -1) {
+      "asn:b:tw:cdCDkrfo:ph", long_options, NULL)) != -1) {
     switch (value) {
       case 'a': {
         input_format = HTML_ARCHIVE;
@@ -70,6 +234,28 @@ void ParseOptions(int argc, char *argv[]) {
         }
         break;
       }
+      case 'b': {
+        char *end_of_value;
+        long long value = std::strtoll(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value < 0)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        max_body_length = static_cast<std::size_t>(value);
+        break;
+      }
+      case 't': {
+        oversize_handler = TRUNCATE_OVERSIZED_ENTRIES;
+        break;
+      }
+      case 'w': {
+        char *end_of_value;
+        long long value = std::strtoll(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value <= 0)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        window_size = static_cast<std::size_t>(value);
+        break;
+      }
       case 'c': {
         normalization_form = nwc_toolkit::UnicodeNormalizer::NFC;
         with_unicode_normalization = true;
@@ -108,6 +294,37 @@ void ParseOptions(int argc, char *argv[]) {
         output_file_name = optarg;
         break;
       }
+      case 'p': {
+        is_profile_mode = true;
+        break;
+      }
+      case DEDUP_OPTION: {
+        with_deduplication = true;
+        break;
+      }
+      case DEDUP_MEMORY_OPTION: {
+        char *end_of_value;
+        long long value = std::strtoll(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value <= 0) ||
+            (value > static_cast<long long>(
+            std::numeric_limits<std::size_t>::max() >> 20))) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        dedup_memory_limit = static_cast<std::size_t>(value) << 20;
+        break;
+      }
+      case DEDUP_FILE_OPTION: {
+        dedup_file_name = optarg;
+        with_deduplication = true;
+        break;
+      }
+      case nwc_toolkit::MetricsOptions::METRICS_OPTION:
+      case nwc_toolkit::MetricsOptions::METRICS_INTERVAL_OPTION: {
+        if (!metrics_options.Parse(value, optarg)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        break;
+      }
       case 'h': {
         is_help_mode = true;
         break;
@@ -126,6 +343,15 @@ void PrintHelp(const char *command) {
       "  -s, --single   extract text from HTML documents\n"
       "  -n, --entries=[N]    "
       "limit the maximum number of entries to N (default: 0)\n"
+      "  -b, --budget=[N]     "
+      "limit the body of each entry to N bytes (default: 0)\n"
+      "                 an entry with a longer body is skipped by default\n"
+      "  -t, --truncate truncate a longer body to N bytes instead of skipping\n"
+      "  -w, --window=[N]     "
+      "parse a body longer than N bytes window by window\n"
+      "                       (default: 1048576)\n"
+      "                 XML bodies are parsed as a whole, and invalid bytes\n"
+      "                 after the first window are replaced with U+FFFD\n"
       "  -c, --NFC      Normalization Form C (default)\n"
       "  -d, --NFD      Normalization Form D\n"
       "  -C, --NFKC     Normalization Form KC\n"
@@ -135,15 +361,102 @@ void PrintHelp(const char *command) {
       "  -r, --remove   remove replacement characters\n"
       "  -f, --filter   apply text filter\n"
       "  -o, --output=[FILE]  write result to FILE (default: stdout)\n"
+      "  -p, --profile  print time spent on each stage in JSON\n"
+      "      --dedup    write an empty line for an entry whose body has\n"
+      "                 already appeared\n"
+      "      --dedup-memory=[N]      "
+      "limit the memory usage of --dedup to N MiB\n"
+      "                 (default: "
+      << (nwc_toolkit::DigestSet::DEFAULT_MEMORY_LIMIT >> 20) << ")\n"
+      "                 bodies are written without being remembered\n"
+      "                 once the limit is reached\n"
+      "      --dedup-file=[FILE]     "
+      "load body digests from FILE if it exists\n"
+      "                 and save them to FILE at the end (implies --dedup)\n"
+      << nwc_toolkit::MetricsOptions::help() <<
       "  -h, --help     print this help\n"
       << std::flush;
 }
 
+// Returns false if `body' has already appeared. A truncated body is not
+// digested because its digest differs from that of the whole body. A new
+// body whose digest does not fit in memory is still written, so that each
+// entry keeps its line, but its copies are not detected.
+bool DigestBody(const nwc_toolkit::String &body) {
+  ++num_digested_bodies;
+  nwc_toolkit::DigestSet::Digest digest =
+      nwc_toolkit::DigestSet::Calculate(body);
+  if (body_set.Contains(digest)) {
+    ++num_duplicate_bodies;
+    duplicate_counter->Increment();
+    return false;
+  } else if (!body_set.Insert(digest)) {
+    ++num_untracked_bodies;
+  }
+  return true;
+}
+
+void PrintDeduplicationReport() {
+  std::cerr << "bodies: " << num_digested_bodies
+      << ", duplicates: " << num_duplicate_bodies << " (" << std::fixed
+      << std::setprecision(2) << ((num_digested_bodies != 0)
+      ? (100.0 * num_duplicate_bodies / num_digested_bodies) : 0.0) << "%)"
+      << ", digests: " << body_set.num_digests()
+      << " (" << (body_set.memory_usage() >> 20) << "MiB)"
+      << ", untracked: " << num_untracked_bodies << std::endl;
+}
+
+// A body longer than the window size is parsed window by window so that
+// memory usage is bounded. In profile mode, the time spent on the
+// window-by-window parsing is regarded as that of the parse stage.
+bool ExtractTextFromHtmlArchiveEntry(
+    const nwc_toolkit::HtmlArchiveEntry &entry,
+    nwc_toolkit::HtmlDocument *document, nwc_toolkit::StringBuilder *text) {
+  if (entry.body().length() > window_size) {
+    bool is_ok = document->ExtractText(entry, window_size, text);
+    if (profiler != NULL) {
+      profiler->Lap(PARSE_STAGE, entry.body().length(), text->length());
+    }
+    return is_ok;
+  }
+
+  bool is_decoded = document->Decode(entry);
+  if (profiler != NULL) {
+    profiler->Lap(DECODE_STAGE, entry.body().length(),
+        document->body().length());
+  }
+  if (!is_decoded) {
+    return false;
+  }
+
+  std::size_t body_length = document->body().length();
+  bool is_parsed = document->ParseDecodedBody();
+  if (profiler != NULL) {
+    profiler->Lap(PARSE_STAGE, body_length, 0);
+  }
+  if (!is_parsed) {
+    return false;
+  }
+
+  document->ExtractText(text);
+  if (profiler != NULL) {
+    profiler->Lap(EXTRACT_STAGE, document->body().length(), text->length());
+  }
+  return true;
+}
+
 void ExtractTextFromHtmlArchvie(nwc_toolkit::InputFile *input_file,
     nwc_toolkit::OutputFile *output_file) {
   std::time_t start_time = std::time(NULL);
 
   nwc_toolkit::HtmlDocument document;
+  document.set_attribute_handler(
+      nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
+  nwc_toolkit::UnicodeNormalizer normalizer;
+  if (with_unicode_normalization &&
+      !normalizer.Open(normalization_form, illegal_input_handler)) {
+    NWC_TOOLKIT_ERROR("failed to open unicode normalizer");
+  }
   nwc_toolkit::StringBuilder text;
   nwc_toolkit::StringBuilder normalized_text;
   nwc_toolkit::StringBuilder filtered_text;
@@ -151,23 +464,50 @@ void ExtractTextFromHtmlArchvie(nwc_toolkit::InputFile *input_file,
   long long num_entries = 0;
   long long status_error_count = 0;
   long long parse_error_count = 0;
+  long long oversize_count = 0;
   nwc_toolkit::HtmlArchiveEntry entry;
-  while (entry.Read(input_file)) {
+  if (profiler != NULL) {
+    profiler->Start();
+  }
+  while (entry.Read(input_file, max_body_length)) {
+    if (profiler != NULL) {
+      std::size_t entry_length = entry.url().length()
+          + entry.header().length() + entry.body().length();
+      profiler->Lap(READ_STAGE, entry_length, entry_length);
+    }
+    entry_counter->Increment();
+    input_counter->Add(entry.url().length() + entry.header().length()
+        + entry.body().length());
     nwc_toolkit::StringBuilder *temp = &text;
     text.Clear();
 
+    if (entry.is_truncated()) {
+      ++oversize_count;
+      oversize_counter->Increment();
+    }
+
     if (entry.status_code() != 200) {
       ++status_error_count;
-    } else if (!document.Parse(entry)) {
+      status_error_counter->Increment();
+    } else if (with_deduplication && !entry.is_truncated() &&
+        !DigestBody(entry.body())) {
+      // A duplicate entry is also written as an empty line.
+    } else if (entry.is_truncated() &&
+        (oversize_handler == SKIP_OVERSIZED_ENTRIES)) {
+      // A skipped entry is written as an empty line.
+    } else if (!ExtractTextFromHtmlArchiveEntry(entry, &document, &text)) {
       ++parse_error_count;
+      parse_error_counter->Increment();
     } else {
-      document.ExtractText(&text);
-
       if (with_unicode_normalization) {
         normalized_text.Clear();
-        if (!nwc_toolkit::UnicodeNormalizer::Normalize(normalization_form,
-            illegal_input_handler, temp->str(), &normalized_text)) {
+        if (!normalizer.Normalize(temp->str(), &normalized_text)) {
           ++parse_error_count;
+          parse_error_counter->Increment();
+        }
+        if (profiler != NULL) {
+          profiler->Lap(NORMALIZE_STAGE, temp->length(),
+              normalized_text.length());
         }
         temp = &normalized_text;
       }
@@ -175,6 +515,9 @@ void ExtractTextFromHtmlArchvie(nwc_toolkit::InputFile *input_file,
       if (with_text_filter) {
         filtered_text.Clear();
         nwc_toolkit::TextFilter::Filter(temp->str(), &filtered_text);
+        if (profiler != NULL) {
+          profiler->Lap(FILTER_STAGE, temp->length(), filtered_text.length());
+        }
         temp = &filtered_text;
       }
     }
@@ -182,6 +525,12 @@ void ExtractTextFromHtmlArchvie(nwc_toolkit::InputFile *input_file,
     if (!output_file->Write(temp->str())) {
       NWC_TOOLKIT_ERROR("failed to write result");
     }
+    if (profiler != NULL) {
+      profiler->Lap(WRITE_STAGE, temp->length(), temp->length());
+    }
+    output_counter->Add(temp->length());
+    metrics.Update();
+    ++total_num_entries;
 
     if (++num_entries == max_num_entries) {
       break;
@@ -206,6 +555,11 @@ void ExtractTextFromHtmlArchvie(nwc_toolkit::InputFile *input_file,
       << ((num_entries != 0) ? (100.0 * parse_error_count / num_entries) : 0.0)
       << "%) / " << num_entries
       << " (" << (std::time(NULL) - start_time) << "sec)" << std::endl;
+  if (max_body_length != 0) {
+    std::cerr << "oversized: " << oversize_count << " ("
+        << ((oversize_handler == SKIP_OVERSIZED_ENTRIES) ?
+            "skipped" : "truncated") << ")" << std::endl;
+  }
 }
 
 void ExtractTextFromSingleHtmlDocument(nwc_toolkit::InputFile *input_file,
@@ -217,6 +571,8 @@ void ExtractTextFromSingleHtmlDocument(nwc_toolkit::InputFile *input_file,
   }
 
   nwc_toolkit::HtmlDocument document;
+  document.set_attribute_handler(
+      nwc_toolkit::HtmlDocument::KEEP_ATTRIBUTES_AS_IS);
   if (!document.Parse(body.str())) {
     NWC_TOOLKIT_ERROR("failed to parse html document");
   }
@@ -271,6 +627,31 @@ int main(int argc, char *argv[]) {
     return 0;
   }
 
+  if (!metrics_options.Open("text-extractor", &metrics)) {
+    NWC_TOOLKIT_ERROR("failed to open metrics file: %s",
+        metrics_options.path().ptr());
+  }
+
+  if (with_deduplication) {
+    body_set.Reset(dedup_memory_limit);
+    if (!dedup_file_name.is_empty() &&
+        (::access(dedup_file_name.ptr(), F_OK) == 0)) {
+      std::cerr << "dedup: " << dedup_file_name << std::endl;
+      if (!body_set.Load(dedup_file_name)) {
+        NWC_TOOLKIT_ERROR("failed to load digests: %s",
+            dedup_file_name.ptr());
+      }
+    }
+  }
+
+  StageProfiler stage_profiler;
+  if (is_profile_mode || metrics.is_open()) {
+    profiler = &stage_profiler;
+  }
+  if (metrics.is_open()) {
+    stage_profiler.ExportTo(&metrics);
+  }
+
   nwc_toolkit::OutputFile output_file;
   std::cerr << "output: " << (output_file_name.is_empty()
       ? "(standard output)" : output_file_name) << std::endl;
@@ -300,5 +681,24 @@ int main(int argc, char *argv[]) {
     ExtractText(&input_file, &output_file);
   }
 
+  if (is_profile_mode) {
+    if (!output_file.Close()) {
+      NWC_TOOLKIT_ERROR("failed to close output file");
+    }
+    profiler->WriteReport(total_num_entries, &std::cerr);
+  }
+  if (with_deduplication) {
+    PrintDeduplicationReport();
+    // Digests are saved after the result is complete.
+    if (output_file.is_open() && !output_file.Close()) {
+      NWC_TOOLKIT_ERROR("failed to close output file");
+    }
+    if (!dedup_file_name.is_empty() && !body_set.Save(dedup_file_name)) {
+      NWC_TOOLKIT_ERROR("failed to save digests: %s",
+          dedup_file_name.ptr());
+    }
+  }
+  metrics.Close();
+
   return 0;
 }
@@ -4,13 +4,19 @@
 #include <error.h>
 #include <getopt.h>
 
+#include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 
+#include <nwc-toolkit/fingerprint-set.h>
 #include <nwc-toolkit/input-file.h>
 #include <nwc-toolkit/output-file.h>
+#include <nwc-toolkit/spill-file.h>
 #include <nwc-toolkit/text-filter.h>
+#include <nwc-toolkit/worker-pool.h>
 
 #define NWC_TOOLKIT_ERROR(fmt, ...) \
   error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
@@ -18,25 +24,94 @@
 namespace {
 
 enum { FLUSH_THRESHOLD = 1 << 20 };
+enum { MAX_NUM_THREADS = 256 };
 
 nwc_toolkit::String output_file_name;
+std::size_t num_threads = 1;
+bool with_deduplication = false;
+std::size_t memory_limit = nwc_toolkit::FingerprintSet::DEFAULT_MEMORY_LIMIT;
+nwc_toolkit::String temporary_directory;
 bool is_help_mode = false;
 
+// Fingerprints of sentences written so far. Sentences are deduplicated
+// across all the input files. Sentences whose fingerprints do not fit in
+// memory are kept in `spilled_sentences' until all the input is read.
+nwc_toolkit::FingerprintSet sentence_set;
+nwc_toolkit::SpillFile spilled_sentences[
+    nwc_toolkit::SpillFile::NUM_PARTITIONS];
+long long num_sentences = 0;
+long long num_unique_sentences = 0;
+long long num_spilled_sentences = 0;
+
+struct Chunk : public nwc_toolkit::LineChunk<FLUSH_THRESHOLD> {
+  Chunk() : nwc_toolkit::LineChunk<FLUSH_THRESHOLD>(), dest() {}
+
+  nwc_toolkit::StringBuilder dest;
+};
+
+class ChunkFilter {
+ public:
+  ChunkFilter() {}
+
+  void operator()(Chunk *chunk) const {
+    chunk->dest.Clear();
+    nwc_toolkit::TextFilter::Filter(chunk->src.str(), &chunk->dest);
+  }
+
+ private:
+  // Disallows copy and assignment.
+  ChunkFilter(const ChunkFilter &);
+  ChunkFilter &operator=(const ChunkFilter &);
+};
+
 void ParseOptions(int argc, char *argv[]) {
   static const struct option long_options[] = {
     { "output", 1, NULL, 'o' },
+    { "threads", 1, NULL, 't' },
+    { "unique", 0, NULL, 'u' },
+    { "memory", 1, NULL, 'l' },
+    { "temporary-directory", 1, NULL, 'T' },
     { "help", 0, NULL, 'h' },
     { NULL, 0, NULL, '\0' }
   };
 
   int value;
   while ((value = ::getopt_long(argc, argv,
-      "o:h", long_options, NULL)) != -1) {
+      "o:t:ul:T:h", long_options, NULL)) != -1) {
     switch (value) {
       case 'o': {
         output_file_name = optarg;
         break;
       }
+      case 't': {
+        char *end_of_value;
+        long value = std::strtol(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value <= 0) ||
+            (value > MAX_NUM_THREADS)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        num_threads = static_cast<std::size_t>(value);
+        break;
+      }
+      case 'u': {
+        with_deduplication = true;
+        break;
+      }
+      case 'l': {
+        char *end_of_value;
+        long long value = std::strtoll(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value <= 0) ||
+            (value > static_cast<long long>(
+            std::numeric_limits<std::size_t>::max() >> 20))) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        memory_limit = static_cast<std::size_t>(value) << 20;
+        break;
+      }
+      case 'T': {
+        temporary_directory = optarg;
+        break;
+      }
       case 'h': {
         is_help_mode = true;
         break;
@@ -52,42 +127,165 @@ void PrintHelp(const char *command) {
   std::cerr << "Usage: " << command << " [OPTION]... [FILE]...\n\n"
       "Options:\n"
       "  -o, --output=[FILE]  write result to FILE (default: stdout)\n"
+      "  -t, --threads=[N]    filter text in N threads (default: 1)\n"
+      "  -u, --unique  remove duplicate sentences\n"
+      "  -l, --memory=[N]     "
+      "limit the memory usage of -u to N MiB (default: "
+      << (nwc_toolkit::FingerprintSet::DEFAULT_MEMORY_LIMIT >> 20) << ")\n"
+      "                       sentences are written to temporary files\n"
+      "                       once the limit is reached and deduplicated\n"
+      "                       at the end, so their order is not kept\n"
+      "  -T, --temporary-directory=[DIR]\n"
+      "                       create temporary files in DIR\n"
+      "                       (default: $TMPDIR or /tmp)\n"
       "  -h, --help    print this help\n"
       << std::flush;
 }
 
-void Filter(nwc_toolkit::InputFile *input_file,
-    nwc_toolkit::OutputFile *output_file) {
-  std::time_t start_time = std::time(NULL);
+// Returns true if `sentence' has not appeared. A sentence whose
+// fingerprint cannot be remembered goes to `partitions' and false is
+// returned, because it is checked again after all the input is read.
+bool IsNewSentence(unsigned long long fingerprint,
+    const nwc_toolkit::String &sentence, int level,
+    nwc_toolkit::SpillFile *partitions) {
+  if (sentence_set.Contains(fingerprint)) {
+    return false;
+  } else if (sentence_set.Insert(fingerprint)) {
+    ++num_unique_sentences;
+    return true;
+  }
+
+  if (level >= nwc_toolkit::SpillFile::MAX_NUM_LEVELS) {
+    NWC_TOOLKIT_ERROR("too many sentences: memory limit is too small");
+  }
+  nwc_toolkit::SpillFile *partition = &partitions[
+      nwc_toolkit::SpillFile::GetPartitionID(fingerprint, level)];
+  if (!partition->is_open() && !partition->Open(temporary_directory)) {
+    NWC_TOOLKIT_ERROR("failed to create temporary file");
+  }
+  if (!partition->Write(nwc_toolkit::String(
+      reinterpret_cast<const char *>(&fingerprint), sizeof(fingerprint)),
+      sentence)) {
+    NWC_TOOLKIT_ERROR("failed to write temporary file");
+  }
+  if (level == 0) {
+    ++num_spilled_sentences;
+  }
+  return false;
+}
 
-  long long total_in = 0;
-  long long total_out = 0;
+// Removes sentences which have already appeared. Filtered text has one
+// sentence per line.
+void RemoveDuplicateSentences(nwc_toolkit::StringBuilder *text) {
+  std::size_t length = 0;
+  nwc_toolkit::String avail = text->str();
+  while (!avail.is_empty()) {
+    nwc_toolkit::String delim = avail.FindFirstOf('\n');
+    nwc_toolkit::String sentence(avail.begin(), delim.begin());
+    nwc_toolkit::String line(avail.begin(), delim.end());
+    avail.set_begin(delim.end());
 
-  nwc_toolkit::String line;
-  nwc_toolkit::StringBuilder src;
-  nwc_toolkit::StringBuilder dest;
-  while (input_file->ReadLine(&line)) {
-    src.Append(line);
-    if (src.length() >= FLUSH_THRESHOLD) {
-      nwc_toolkit::TextFilter::Filter(src.str(), &dest);
-      if (!output_file->Write(dest.str())) {
-        NWC_TOOLKIT_ERROR("failed to write result");
+    ++num_sentences;
+    if (IsNewSentence(nwc_toolkit::StringHash64()(sentence), sentence, 0,
+        spilled_sentences)) {
+      std::memmove(text->buf() + length, line.ptr(), line.length());
+      length += line.length();
+    }
+  }
+  text->Resize(length);
+}
+
+// Writes the unique sentences in `partitions'. Each partition is checked
+// with a new set, which may spill to the next level.
+void WriteSpilledSentences(nwc_toolkit::SpillFile *partitions, int level,
+    nwc_toolkit::OutputFile *output_file) {
+  for (std::size_t i = 0; i < nwc_toolkit::SpillFile::NUM_PARTITIONS; ++i) {
+    if (!partitions[i].is_open()) {
+      continue;
+    }
+    sentence_set.Reset(memory_limit);
+    nwc_toolkit::SpillFile next_partitions[
+        nwc_toolkit::SpillFile::NUM_PARTITIONS];
+    if (!partitions[i].Rewind()) {
+      NWC_TOOLKIT_ERROR("failed to write temporary file");
+    }
+    nwc_toolkit::StringBuilder key, sentence;
+    while (partitions[i].Read(&key, &sentence)) {
+      unsigned long long fingerprint;
+      std::memcpy(&fingerprint, key.ptr(), sizeof(fingerprint));
+      if (IsNewSentence(fingerprint, sentence.str(), level + 1,
+          next_partitions)) {
+        if (!output_file->Write(sentence.str()) ||
+            !output_file->Write("\n")) {
+          NWC_TOOLKIT_ERROR("failed to write result");
+        }
       }
-      total_in += src.length();
-      total_out += dest.length();
-      src.Clear();
-      dest.Clear();
     }
+    if (partitions[i].has_error()) {
+      NWC_TOOLKIT_ERROR("failed to read temporary file");
+    }
+    partitions[i].Close();
+    WriteSpilledSentences(next_partitions, level + 1, output_file);
+  }
+}
+
+class ChunkWriter {
+ public:
+  explicit ChunkWriter(nwc_toolkit::OutputFile *output_file)
+      : output_file_(output_file),
+        total_in_(0),
+        total_out_(0) {}
+
+  long long total_in() const {
+    return total_in_;
+  }
+  long long total_out() const {
+    return total_out_;
   }
-  if (!src.is_empty()) {
-    nwc_toolkit::TextFilter::Filter(src.str(), &dest);
-    if (!output_file->Write(dest.str())) {
-        NWC_TOOLKIT_ERROR("failed to write result");
+
+  void operator()(Chunk *chunk) {
+    if (with_deduplication) {
+      RemoveDuplicateSentences(&chunk->dest);
+    }
+    if (!output_file_->Write(chunk->dest.str())) {
+      NWC_TOOLKIT_ERROR("failed to write result");
     }
-    total_in += src.length();
-    total_out += dest.length();
+    total_in_ += chunk->src.length();
+    total_out_ += chunk->dest.length();
+  }
+
+ private:
+  nwc_toolkit::OutputFile *output_file_;
+  long long total_in_;
+  long long total_out_;
+
+  // Disallows copy and assignment.
+  ChunkWriter(const ChunkWriter &);
+  ChunkWriter &operator=(const ChunkWriter &);
+};
+
+void PrintDeduplicationReport() {
+  long long num_duplicates = num_sentences - num_unique_sentences;
+  std::cerr << "sentences: " << num_sentences
+      << ", unique: " << num_unique_sentences
+      << ", duplicates: " << num_duplicates << " (" << std::fixed
+      << std::setprecision(2) << ((num_sentences != 0)
+      ? (100.0 * num_duplicates / num_sentences) : 0.0) << "%)"
+      << ", spilled: " << num_spilled_sentences << std::endl;
+}
+
+void Filter(nwc_toolkit::InputFile *input_file,
+    nwc_toolkit::OutputFile *output_file) {
+  std::time_t start_time = std::time(NULL);
+
+  ChunkWriter writer(output_file);
+  if (!nwc_toolkit::ProcessJobsInOrder<Chunk, ChunkFilter>(
+      input_file, &writer, num_threads)) {
+    NWC_TOOLKIT_ERROR("failed to start threads: %lu",
+        static_cast<unsigned long>(num_threads));
   }
-  std::cerr << '\r' << total_in << " / " << total_out
+
+  std::cerr << '\r' << writer.total_in() << " / " << writer.total_out()
       << " (" << (std::time(NULL) - start_time) << "sec)" << std::endl;
 }
 
@@ -100,6 +298,10 @@ int main(int argc, char *argv[]) {
     return 0;
   }
 
+  if (with_deduplication) {
+    sentence_set.Reset(memory_limit);
+  }
+
   nwc_toolkit::OutputFile output_file;
   std::cerr << "output: " << (output_file_name.is_empty()
       ? "(standard output)" : output_file_name) << std::endl;
@@ -129,5 +331,11 @@ int main(int argc, char *argv[]) {
     Filter(&input_file, &output_file);
   }
 
+  if (with_deduplication) {
+    WriteSpilledSentences(spilled_sentences, 0, &output_file);
+    sentence_set.Clear();
+    PrintDeduplicationReport();
+  }
+
   return 0;
 }
@@ -4,6 +4,7 @@
 #include <error.h>
 #include <getopt.h>
 
+#include <cstdlib>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
@@ -11,6 +12,7 @@
 #include <nwc-toolkit/input-file.h>
 #include <nwc-toolkit/output-file.h>
 #include <nwc-toolkit/unicode-normalizer.h>
+#include <nwc-toolkit/worker-pool.h>
 
 #define NWC_TOOLKIT_ERROR(fmt, ...) \
   error_at_line(-(__LINE__), errno, __FILE__, __LINE__, fmt, ## __VA_ARGS__)
@@ -18,12 +20,42 @@
 namespace {
 
 enum { FLUSH_THRESHOLD = 1 << 20 };
+enum { MAX_NUM_THREADS = 256 };
 
 nwc_toolkit::UnicodeNormalizer::NormalizationForm normalization_form;
 nwc_toolkit::UnicodeNormalizer::IllegalInputHandler illegal_input_handler;
 nwc_toolkit::String output_file_name;
+std::size_t num_threads = 1;
 bool is_help_mode = false;
 
+struct Chunk : public nwc_toolkit::LineChunk<FLUSH_THRESHOLD> {
+  Chunk() : nwc_toolkit::LineChunk<FLUSH_THRESHOLD>(), dest(), is_ok(false) {}
+
+  nwc_toolkit::StringBuilder dest;
+  bool is_ok;
+};
+
+// Each worker thread has its own normalizer.
+class ChunkNormalizer {
+ public:
+  ChunkNormalizer() : normalizer_() {
+    normalizer_.Open(normalization_form, illegal_input_handler);
+  }
+
+  void operator()(Chunk *chunk) {
+    chunk->dest.Clear();
+    chunk->is_ok = normalizer_.is_open() &&
+        normalizer_.Normalize(chunk->src.str(), &chunk->dest);
+  }
+
+ private:
+  nwc_toolkit::UnicodeNormalizer normalizer_;
+
+  // Disallows copy and assignment.
+  ChunkNormalizer(const ChunkNormalizer &);
+  ChunkNormalizer &operator=(const ChunkNormalizer &);
+};
+
 void ParseOptions(int argc, char *argv[]) {
   static const struct option long_options[] = {
     { "NFC", 0, NULL, 'c' },
@@ -33,13 +65,14 @@ void ParseOptions(int argc, char *argv[]) {
     { "keep", 0, NULL, 'k' },
     { "remove", 0, NULL, 'r' },
     { "output", 1, NULL, 'o' },
+    { "threads", 1, NULL, 't' },
     { "help", 0, NULL, 'h' },
     { NULL, 0, NULL, '\0' }
   };
 
   int value;
   while ((value = ::getopt_long(argc, argv,
-      "cdCDkro:h", long_options, NULL)) != -1) {
+      "cdCDkro:t:h", long_options, NULL)) != -1) {
     switch (value) {
       case 'c': {
         normalization_form = nwc_toolkit::UnicodeNormalizer::NFC;
@@ -71,6 +104,16 @@ void ParseOptions(int argc, char *argv[]) {
         output_file_name = optarg;
         break;
       }
+      case 't': {
+        char *end_of_value;
+        long value = std::strtol(optarg, &end_of_value, 10);
+        if ((*end_of_value != '\0') || (value <= 0) ||
+            (value > MAX_NUM_THREADS)) {
+          NWC_TOOLKIT_ERROR("invalid argument: %s", optarg);
+        }
+        num_threads = static_cast<std::size_t>(value);
+        break;
+      }
       case 'h': {
         is_help_mode = true;
         break;
@@ -93,46 +136,57 @@ void PrintHelp(const char *command) {
       "  -k, --keep    keep replacement characters (default)\n"
       "  -r, --remove  remove replacement characters\n"
       "  -o, --output=[FILE]  write result to FILE (default: stdout)\n"
+      "  -t, --threads=[N]    normalize text in N threads (default: 1)\n"
       "  -h, --help    print this help\n"
       << std::flush;
 }
 
-void Normalize(nwc_toolkit::InputFile *input_file,
-    nwc_toolkit::OutputFile *output_file) {
-  std::time_t start_time = std::time(NULL);
-
-  long long total_in = 0;
-  long long total_out = 0;
+class ChunkWriter {
+ public:
+  explicit ChunkWriter(nwc_toolkit::OutputFile *output_file)
+      : output_file_(output_file),
+        total_in_(0),
+        total_out_(0) {}
 
-  nwc_toolkit::String line;
-  nwc_toolkit::StringBuilder src;
-  nwc_toolkit::StringBuilder dest;
-  while (input_file->ReadLine(&line)) {
-    src.Append(line);
-    if (src.length() >= FLUSH_THRESHOLD) {
-      if (!nwc_toolkit::UnicodeNormalizer::Normalize(
-          normalization_form, illegal_input_handler, src.str(), &dest)) {
-        NWC_TOOLKIT_ERROR("failed to normalize text");
-      } else if (!output_file->Write(dest.str())) {
-        NWC_TOOLKIT_ERROR("failed to write result");
-      }
-      total_in += src.length();
-      total_out += dest.length();
-      src.Clear();
-      dest.Clear();
-    }
+  long long total_in() const {
+    return total_in_;
+  }
+  long long total_out() const {
+    return total_out_;
   }
-  if (!src.is_empty()) {
-    if (!nwc_toolkit::UnicodeNormalizer::Normalize(
-        normalization_form, src.str(), &dest)) {
+
+  void operator()(const Chunk *chunk) {
+    if (!chunk->is_ok) {
       NWC_TOOLKIT_ERROR("failed to normalize text");
-    } else if (!output_file->Write(dest.str())) {
+    } else if (!output_file_->Write(chunk->dest.str())) {
       NWC_TOOLKIT_ERROR("failed to write result");
     }
-    total_in += src.length();
-    total_out += dest.length();
+    total_in_ += chunk->src.length();
+    total_out_ += chunk->dest.length();
+  }
+
+ private:
+  nwc_toolkit::OutputFile *output_file_;
+  long long total_in_;
+  long long total_out_;
+
+  // Disallows copy and assignment.
+  ChunkWriter(const ChunkWriter &);
+  ChunkWriter &operator=(const ChunkWriter &);
+};
+
+void Normalize(nwc_toolkit::InputFile *input_file,
+    nwc_toolkit::OutputFile *output_file) {
+  std::time_t start_time = std::time(NULL);
+
+  ChunkWriter writer(output_file);
+  if (!nwc_toolkit::ProcessJobsInOrder<Chunk, ChunkNormalizer>(
+      input_file, &writer, num_threads)) {
+    NWC_TOOLKIT_ERROR("failed to start threads: %lu",
+        static_cast<unsigned long>(num_threads));
   }
-  std::cerr << '\r' << total_in << " / " << total_out
+
+  std::cerr << '\r' << writer.total_in() << " / " << writer.total_out()
       << " (" << (std::time(NULL) - start_time) << "sec)" << std::endl;
 }
 